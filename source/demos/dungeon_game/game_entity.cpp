@@ -36,6 +36,7 @@
 #include "framework/camera_base.hpp"
 #include "framework/game_time.hpp"
 #include "framework/game_pad.hpp"
+#include "framework/ps2_math/fast_math.hpp"
 
 // ========================================================
 // A few hardcoded game constants:
@@ -396,8 +397,10 @@ bool PlayerEntity::playerMovement(const float movementAmount)
 {
 	// Calculate direction from angle:
 	const float angle = mapValueRange(yawTotalDegrees, 0.0f, 360.0f, -PS2MATH_PI, PS2MATH_PI);
-	const float headingX = ps2math::cos(angle) * movementAmount;
-	const float headingZ = ps2math::sin(angle) * movementAmount;
+	float sinAng, cosAng;
+	ps2math::fast::sinCos(angle, &sinAng, &cosAng);
+	const float headingX = cosAng * movementAmount;
+	const float headingZ = sinAng * movementAmount;
 
 	// If the new position would collide with a wall or prop, we don't move.
 	const float newX = worldPosition.x + headingX;
@@ -528,7 +531,7 @@ void EnemyEntity::init(GameWorld * gw, RenderEntity * re, const Vector & pos, co
 	// Set up the particle emitter used for the attack effects:
 	attackPrt = world->allocParticleEmitter();
 	attackPrt->setEnabled(false);
-	attackPrt->setMinMaxParticles(200, 300);
+	attackPrt->setMinMaxParticles(200, GameWorld::ENEMY_ATTACK_PARTICLES);
 	attackPrt->setParticleReleaseAmount(100);
 	attackPrt->setParticleReleaseInterval(20);
 	attackPrt->setParticleLifeCycle(20);
@@ -539,6 +542,7 @@ void EnemyEntity::init(GameWorld * gw, RenderEntity * re, const Vector & pos, co
 	attackPrt->setParticleBaseColor(makeColor4f(0.0f, 1.0f, 0.5f));
 	attackPrt->setParticleSpriteTexture(world->getBuiltInTexture("particle_star"));
 	attackPrt->setEmitterOrigin(worldPosition);
+	attackPrt->setPriority(1); // Gameplay feedback, served before the ambient emitters.
 	attackPrt->allocateParticles();
 }
 
@@ -619,7 +623,7 @@ void EnemyEntity::update()
 		const Vector & playerWorldPos = player.getWorldPosition();
 		const float dx = playerWorldPos.x - worldPosition.x;
 		const float dz = playerWorldPos.z - worldPosition.z;
-		const float newYawDegrees = radToDeg(atan2f(dx, dz));
+		const float newYawDegrees = radToDeg(ps2math::fast::atan2(dx, dz));
 
 		if (!ps2math::floatEquals(targetYawDegrees, newYawDegrees, 0.5f))
 		{
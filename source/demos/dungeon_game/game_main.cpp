@@ -35,12 +35,91 @@
 #include "framework/game_time.hpp"
 #include "framework/ingame_console.hpp"
 
+#define PROFILE_ENABLED 1
+#include "framework/profile.hpp"
+
+// ========================================================
+// Memory budgets:
+// ========================================================
+
+// The main heap takes the rest of RAM, minus what is left to the C heap
+// for the code that calls malloc directly: newlib's stdio buffers (the log
+// dump file) and the PS2SDK libraries. The framework default of 1MB
+// leaves little headroom for those.
+static const size_t MAIN_HEAP_MAX_RESERVE = MEM_HEAP_DEFAULT_MAX_RESERVE;
+static const size_t MAIN_HEAP_C_SLACK     = 2 * 1024 * 1024;
+
+// Particles get their own heap, so emitter churn doesn't fragment the
+// main heap. The particle pool takes 36 bytes per particle and is sized
+// per level; the biggest, "The Dungeons", reserves 10600 particles (373KB).
+// The rest is for the emitter objects.
+static const size_t PARTICLES_ARENA_SIZE = 512 * 1024;
+
+// Warn-only limits for the rest. Textures are the bulk of it, since
+// the model skins are kept in main RAM after uploading to the GS.
+static const size_t TEXTURE_MEM_BUDGET   = 20 * 1024 * 1024;
+static const size_t GEOMETRY_MEM_BUDGET  = 2  * 1024 * 1024;
+static const size_t RENDERER_MEM_BUDGET  = 2  * 1024 * 1024;
+
+// Each half of the frame allocator must hold the biggest MD2 model
+// assembled as DrawVertexes: the enemy, with 2376 vertexes (111KB).
+// The rest is for the cull lists, sort buffers and lights of a frame.
+static const size_t FRAME_MEM_SIZE = 160 * 1024;
+
+static void initMemoryBudgets()
+{
+	if (!memSetMainHeapReserve(MAIN_HEAP_MAX_RESERVE, MAIN_HEAP_C_SLACK))
+	{
+		logWarning("Main heap already reserved, C heap slack not applied.");
+	}
+
+	if (!memCreateTagArena(MEM_TAG_PARTICLES, PARTICLES_ARENA_SIZE))
+	{
+		logWarning("No particles arena, sharing the main heap.");
+	}
+
+	memSetTagBudget(MEM_TAG_PARTICLES, PARTICLES_ARENA_SIZE);
+	memSetTagBudget(MEM_TAG_TEXTURE,   TEXTURE_MEM_BUDGET);
+	memSetTagBudget(MEM_TAG_GEOMETRY,  GEOMETRY_MEM_BUDGET);
+	memSetTagBudget(MEM_TAG_RENDERER,  RENDERER_MEM_BUDGET);
+
+	gFrameAllocator.init(FRAME_MEM_SIZE);
+}
+
+static void logMemoryUsage(const char * when)
+{
+	static const MemAllocTag tags[]  = { MEM_TAG_TEXTURE, MEM_TAG_GEOMETRY, MEM_TAG_RENDERER, MEM_TAG_PARTICLES };
+	static const char * const names[] = { "textures", "geometry", "renderer", "particles" };
+
+	const size_t heapSize = memGetMainHeapSize();
+	if (heapSize != 0)
+	{
+		logComment("Memory %s: main heap %s reserved", when, formatMemoryUnit(heapSize));
+	}
+
+	MemTagStats stats;
+	for (uint t = 0; t < arrayLength(tags); ++t)
+	{
+		if (!memGetTagStats(tags[t], &stats))
+		{
+			return; // No MEM_TRACKING.
+		}
+
+		logComment("Memory %s: %s %s in %u allocs, peak %s, budget %s", when, names[t],
+		           formatMemoryUnit(stats.liveBytes), stats.liveAllocs,
+		           formatMemoryUnit(stats.peakBytes), formatMemoryUnit(stats.budgetBytes));
+	}
+}
+
 // ========================================================
 // main():
 // ========================================================
 
 int main()
 {
+	// Before anything gets allocated with these tags.
+	initMemoryBudgets();
+
 	initIop();
 	soundInit();
 
@@ -65,12 +144,14 @@ int main()
 	// Game instance initialization. `GameWorld` is quite
 	// big, so it is best to allocate it dynamically.
 	GameWorld * gameWorld = new(MEM_TAG_GENERIC) GameWorld();
+	logMemoryUsage("after init");
 
 	// Main game loop, until the PS2 is rebooted:
 	for (;;)
 	{
 		// Update the global clock:
 		gTime.beginFrame();
+		PROFILE_NEW_FRAME();
 
 		// Game Logic update:
 		gameWorld->updateGameLogic();
@@ -80,10 +161,15 @@ int main()
 		{
 			gRenderer.clearScreen();
 			gameWorld->renderFrame3d();
+
+			PROFILE_BEGIN("Render 2D");
 			gameWorld->renderUiOverlays();
 			gameWorld->renderMisc2d();
+			PROFILE_END();
 		}
-		gRenderer.endFrame();
+		PROFILE_BEGIN("End frame");
+		gRenderer.endFrame(); // Includes the wait for the vertical sync.
+		PROFILE_END();
 
 		// Update time deltas:
 		gTime.endFrame();
@@ -34,6 +34,7 @@
 #include "framework/sound.hpp"
 #include "framework/game_time.hpp"
 #include "framework/ingame_console.hpp"
+#include "framework/ps2_math/fast_math.hpp"
 
 // ========================================================
 // Local data and constants:
@@ -111,12 +112,23 @@ allLevels[LEVEL_COUNT] ATTRIBUTE_ALIGNED(16) =
 #define PROFILE_ENABLED 1
 #include "framework/profile.hpp"
 
-PROFILE_DECL(prof_update,          "Update    ");
-PROFILE_DECL(prof_render3d,        "Render 3D ");
-PROFILE_DECL(prof_mapDraw,         " Map draw ");
-PROFILE_DECL(prof_entDraw,         " Ent draw ");
-PROFILE_DECL(prof_lightShadowDraw, " L.S. draw");
-PROFILE_DECL(prof_prtDraw,         " PRTs draw");
+// Where [SQUARE] dumps the profiler history when the debug overlay is on.
+static const char PROFILE_TRACE_FILE[] = "host:profile_trace.json";
+
+// ========================================================
+
+//
+// MD2 per-vertex lighting tunables:
+//
+const float TORCH_LIGHT_RADIUS     = 9.0f;
+const float TORCH_LIGHT_HEIGHT     = 1.5f; // Above the torch model origin; where the fire is.
+const uint  MAX_LIGHTS_PER_ENTITY  = 3;
+
+// With the torch light baked into the models, the floor lightmaps
+// are only worth the extra blended draw when close to the player.
+// They fade out between the two distances instead of popping.
+const float LIGHTMAP_FADE_START_DIST = 2.0f * TILE_SIZE;
+const float LIGHTMAP_FADE_END_DIST   = 3.0f * TILE_SIZE;
 
 } // namespace {}
 
@@ -131,6 +143,7 @@ GameWorld::GameWorld()
 	, shadowsDrawn(0)
 	, lightmapsDrawn(0)
 	, prtsDrawn(0)
+	, entitiesLit(0)
 	, drawModelBounds(false)
 	, showDevConsole(false)
 	, fadeAlpha(0)
@@ -140,11 +153,8 @@ GameWorld::GameWorld()
 	, inMainMenu(true)
 	, currLevel(NO_LEVEL)
 	, currMainMenuSel(0)
-	, enemyEntitiesInUse(0)
-	, renderEntitiesInUse(0)
-	, shadowBlobsInUse(0)
-	, lightmapsInUse(0)
-	, prtEmittersInUse(0)
+	, frameLights(nullptr)
+	, frameLightCount(0)
 {
 	// Init game controller 0 (first slot in the Console). Wait up to
 	// 200ms for it to be ready. If we can't connect, terminate immediately.
@@ -169,17 +179,6 @@ GameWorld::GameWorld()
 	frustum.setProjection(degToRad(60.0f), gRenderer.getScreenWidth(),
 			gRenderer.getScreenHeight(), 2.0f, 2000.0f);
 
-	// Set correct types for the LightShadowBlobs:
-	//
-	for (uint s = 0; s < MAX_SHADOW_BLOBS; ++s)
-	{
-		shadowBlobs[s].type = LightShadowBlob::SHADOW_BLOB;
-	}
-	for (uint l = 0; l < MAX_LIGHTMAPS; ++l)
-	{
-		lightmaps[l].type = LightShadowBlob::LIGHTMAP;
-	}
-
 	// Load other permanent textures:
 	//
 	loadPermanentTexture(menuBgTexture,         menu_bg_texture,          size_menu_bg_texture,          TEXTURE_FUNCTION_DECAL);
@@ -211,7 +210,7 @@ GameWorld::GameWorld()
 
 void GameWorld::updateGameLogic()
 {
-	PROFILE_BEGIN(prof_update);
+	PROFILE_SCOPE("Update");
 
 	// Get user input:
 	gamePad->update();
@@ -244,6 +243,22 @@ void GameWorld::updateGameLogic()
 		logComment("Debug bounds rendering %s.", (drawModelBounds ? "on" : "off"));
 	}
 
+	// Export the profiler frames with [SQUARE] while debug drawing is on:
+	//
+	static bool squareBtnDown = false;
+	if (gamePad->isDown(padlib::PAD_SQUARE))
+	{
+		squareBtnDown = true;
+	}
+	else if (gamePad->isUp(padlib::PAD_SQUARE) && squareBtnDown)
+	{
+		squareBtnDown = false;
+		if (drawModelBounds)
+		{
+			profileExportChromeTrace(PROFILE_TRACE_FILE);
+		}
+	}
+
 	// Exit early when running a screen fade effect.
 	//
 	if (drawFadeScreen)
@@ -348,15 +363,15 @@ void GameWorld::updateGameLogic()
 
 	// Enemy entity refresh:
 	//
-	for (uint e = 0; e < enemyEntitiesInUse; ++e)
+	PROFILE_BEGIN("Enemies");
+	for (uint e = 0; e < enemyEntities.size(); ++e)
 	{
 		if (worldMap.inActiveArea(enemyEntities[e].getWorldPosition()))
 		{
 			enemyEntities[e].update();
 		}
 	}
-
-	PROFILE_END(prof_update);
+	PROFILE_END();
 }
 
 // ========================================================
@@ -371,7 +386,7 @@ void GameWorld::renderFrame3d()
 		return;
 	}
 
-	PROFILE_BEGIN(prof_render3d);
+	PROFILE_SCOPE("Render 3D");
 	gRenderer.begin3d();
 
 	const Color4f fadedColorTint = worldMap.getFadedColorTint();
@@ -381,20 +396,28 @@ void GameWorld::renderFrame3d()
 	//
 	viewMatrix = currCamera->getViewMatrix();
 	frustum.update(viewMatrix);
+	cullPlanes.setFrustum(frustum);
 
 	gRenderer.setEyePosition(eyePosition);
 	gRenderer.setViewProjMatrix(viewMatrix * projectionMatrix);
 
 	// Tile map rendering:
 	//
-	PROFILE_BEGIN(prof_mapDraw);
-	worldMap.drawMap(frustum);
-	PROFILE_END(prof_mapDraw);
+	PROFILE_BEGIN("Map draw");
+	worldMap.drawMap(cullPlanes);
+	PROFILE_END();
+
+	// Frame memory used to draw the objects is released at the end.
+	const size_t frameMark = gFrameAllocator.getMark();
 
-	// 3D object / props rendering:
+	// 3D object / props rendering. Objects are frustum culled one by
+	// one. Their bounds change every frame (animation, movement), so
+	// gathering them for cullAabbs() costs more than the batch test
+	// saves (see tools/cull_bench). Only the tiles are batch culled.
 	//
-	PROFILE_BEGIN(prof_entDraw);
-	for (uint e = 0; e < renderEntitiesInUse; ++e)
+	PROFILE_BEGIN("Entity draw");
+	gatherFrameLights();
+	for (uint e = 0; e < renderEntities.size(); ++e)
 	{
 		bool inEdge = false;
 		const RenderEntity & renderEnt = renderEntities[e];
@@ -402,7 +425,7 @@ void GameWorld::renderFrame3d()
 		if (worldMap.inActiveArea(renderEnt.getWorldPosition(), &inEdge)
 			&& renderEnt.isVisible(frustum))
 		{
-			renderEnt.draw(inEdge ? &fadedColorTint : nullptr);
+			renderEnt.draw(inEdge ? &fadedColorTint : nullptr, computeEntityLighting(renderEnt));
 			if (drawModelBounds)
 			{
 				renderEnt.drawBounds();
@@ -410,7 +433,7 @@ void GameWorld::renderFrame3d()
 			++entitiesDrawn;
 		}
 	}
-	PROFILE_END(prof_entDraw);
+	PROFILE_END();
 
 	//
 	// Render objects with transparency last:
@@ -418,12 +441,12 @@ void GameWorld::renderFrame3d()
 
 	gRenderer.setPrimBlending(true);
 
-	PROFILE_BEGIN(prof_lightShadowDraw);
+	PROFILE_BEGIN("Light/shadow draw");
 
 	// Shadow blobs:
 	//
 	gRenderer.setTexture(shadowTexture);
-	for (uint s = 0; s < shadowBlobsInUse; ++s)
+	for (uint s = 0; s < shadowBlobs.size(); ++s)
 	{
 		bool inEdge = false;
 		const LightShadowBlob & shadow = shadowBlobs[s];
@@ -438,54 +461,65 @@ void GameWorld::renderFrame3d()
 		}
 	}
 
-	// Light-maps:
+	// Light-maps (only the ones near the player, faded out with the
+	// distance, the rest is approximated by the per-vertex lighting
+	// of the models):
 	//
 	gRenderer.setTexture(lightmapTexture);
-	for (uint l = 0; l < lightmapsInUse; ++l)
+	const Vector playerPos = player.getWorldPosition();
+	for (uint l = 0; l < lightmaps.size(); ++l)
 	{
 		bool inEdge = false;
 		const LightShadowBlob & lightmap = lightmaps[l];
 
 		if (lightmap.type != LightShadowBlob::NONE
+			&& distanceSqr(lightmap.position, playerPos) < (LIGHTMAP_FADE_END_DIST * LIGHTMAP_FADE_END_DIST)
 			&& worldMap.inActiveArea(lightmap.position, &inEdge)
 			&& lightmap.isVisible(frustum))
 		{
-			lightmap.draw(inEdge ? &fadedColorTint : nullptr);
+			const float dist = ps2math::sqrt(distanceSqr(lightmap.position, playerPos));
+
+			Color4f tint = inEdge ? fadedColorTint : makeColor4f(1.0f, 1.0f, 1.0f);
+			const float fade = (LIGHTMAP_FADE_END_DIST - dist) / (LIGHTMAP_FADE_END_DIST - LIGHTMAP_FADE_START_DIST);
+			tint.a = clamp(fade, 0.0f, 1.0f);
+
+			lightmap.draw(&tint);
 			++lightmapsDrawn;
 		}
 	}
 
-	PROFILE_END(prof_lightShadowDraw);
+	PROFILE_END();
 
 	// Particle emitters, update and render:
 	//
-	if (prtEmittersInUse != 0)
+	if (!prtEmitters.isEmpty())
 	{
-		PROFILE_BEGIN(prof_prtDraw);
+		PROFILE_BEGIN("Particles");
 
 		gRenderer.disableDepthWriting();
 		gRenderer.setModelMatrix(IDENTITY_MATRIX);
-		for (uint p = 0; p < prtEmittersInUse; ++p)
+		for (uint p = 0; p < prtEmitters.size(); ++p)
 		{
 			ParticleEmitter & prt = prtEmitters[p];
 			if (prt.isEnabled()
 				&& worldMap.inActiveArea(prt.getEmitterOrigin())
 				&& prt.isVisible(frustum))
 			{
-				prt.updateParticles();
-				prt.drawParticles(viewMatrix, eyePosition);
+				gParticleManager.queueEmitter(&prt);
 				++prtsDrawn;
 			}
 		}
+		gParticleManager.updateEmitters(eyePosition);
+		gParticleManager.drawAllParticles(eyePosition);
 		gRenderer.enableDepthWriting();
 
-		PROFILE_END(prof_prtDraw);
+		PROFILE_END();
 	}
 
 	gRenderer.setPrimBlending(false);
+	gFrameAllocator.rewind(frameMark);
 
 	gRenderer.end3d();
-	PROFILE_END(prof_render3d);
 }
 
 // ========================================================
@@ -510,13 +544,13 @@ void GameWorld::renderMisc2d()
 		// Title:
 		//
 		gRenderer.setGlobalTextScale(1.4f);
-		gRenderer.drawText(pos, makeColor4b(80, 40, 5),
+		gRenderer.drawCachedText(pos, makeColor4b(80, 40, 5),
 			FONT_CONSOLAS_24, "A Dungeon Game - Created by Lampert\n\n");
 
 		// Level list:
 		//
 		gRenderer.setGlobalTextScale(1.2f);
-		gRenderer.drawText(pos, makeColor4b(80, 40, 5),
+		gRenderer.drawCachedText(pos, makeColor4b(80, 40, 5),
 			FONT_CONSOLAS_24, "+ Choose a level and press [X]\n\n");
 
 		for (int l = 0; l < LEVEL_COUNT; ++l)
@@ -582,13 +616,17 @@ void GameWorld::renderMisc2d()
 		{
 			pos.x = 225.0f;
 			pos.y = gRenderer.getScreenHeight() - 168.0f;
-			gRenderer.drawText(pos, white, FONT_CONSOLAS_24, "Memory estimates:\n");
+			gRenderer.drawCachedText(pos, white, FONT_CONSOLAS_24, "Memory estimates:\n");
 			gRenderer.drawText(pos, white, FONT_CONSOLAS_24, getMemTagsStr());
 
+			// Last 60 frames (2 seconds) against the 30 FPS budget, under the FPS counter.
+			const Rect4i graphRect = { gRenderer.getScreenWidth() - 215, 40, 210, 100 };
+			profileDrawGraph(graphRect, 60, 1000.0f / 30.0f);
+
 			pos.x = 5.0f;
 			pos.y = 68.0f;
-			gRenderer.drawText(pos, white, FONT_CONSOLAS_24, "--------------------------\nFrame times:\n");
-			PROFILE_PRINT(pos, &prof_update, &prof_render3d, &prof_mapDraw, &prof_entDraw, prof_lightShadowDraw, prof_prtDraw);
+			gRenderer.drawCachedText(pos, white, FONT_CONSOLAS_24, "--------------------------\nFrame times:\n");
+			profileDrawFrameTimes(pos, FONT_CONSOLAS_24);
 		}
 		#else // !PROFILE_ENABLED
 		pos.x = 5.0f;
@@ -597,19 +635,24 @@ void GameWorld::renderMisc2d()
 
 		// Misc render stats:
 		//
-		gRenderer.drawText(pos, white, FONT_CONSOLAS_24,        "--------------------------\n");
-		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Num tiles         : %d\n", worldMap.getTotalTiles()));
+		gRenderer.drawCachedText(pos, white, FONT_CONSOLAS_24, "--------------------------\n");
+		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Num tiles         : %u\n", worldMap.getTotalTiles()));
 		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Tiles drawn       : %d\n", worldMap.getTileDrawCount()));
-		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Num entities      : %d\n", renderEntitiesInUse));
+		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Num entities      : %u\n", renderEntities.size()));
 		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Entities drawn    : %d\n", entitiesDrawn));
+		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Entities lit      : %d\n", entitiesLit));
 		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Shadows drawn     : %d\n", shadowsDrawn));
 		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Lightmaps drawn   : %d\n", lightmapsDrawn));
 		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Prt emitters draw : %d\n", prtsDrawn));
+		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Prt budget        : %u/%u (%u wanted)\n",
+			gParticleManager.getParticlesGranted(), gParticleManager.getParticleBudget(),
+			gParticleManager.getParticlesRequested()));
 		gRenderer.drawText(pos, white, FONT_CONSOLAS_24, format("Draw fade screen  : %s\n", (drawFadeScreen ? "yes" : "no")));
-		gRenderer.drawText(pos, white, FONT_CONSOLAS_24,        "--------------------------\n");
+		gRenderer.drawCachedText(pos, white, FONT_CONSOLAS_24, "--------------------------\n");
 
 		// Reset for next frame.
 		entitiesDrawn  = 0;
+		entitiesLit    = 0;
 		shadowsDrawn   = 0;
 		lightmapsDrawn = 0;
 		prtsDrawn      = 0;
@@ -633,16 +676,15 @@ void GameWorld::renderMisc2d()
 
 void GameWorld::drawMainMenuOpt(Vec2f & pos, const char * entryName, const bool checked)
 {
-	if (checked)
-	{
-		gRenderer.drawText(pos, makeColor4b(110, 65, 10),
-			FONT_CONSOLAS_24, format("> %s\n", entryName));
-	}
-	else
-	{
-		gRenderer.drawText(pos, makeColor4b(80, 40, 5),
-			FONT_CONSOLAS_24, format("  %s\n", entryName));
-	}
+	// The marker and the name are cached separately, so the
+	// entries stay literal strings whatever the selection is.
+	const Color4b color = checked ? makeColor4b(110, 65, 10) : makeColor4b(80, 40, 5);
+	const float lineX = pos.x;
+
+	gRenderer.drawCachedText(pos, color, FONT_CONSOLAS_24, (checked ? "> " : "  "));
+	gRenderer.drawCachedText(pos, color, FONT_CONSOLAS_24, entryName);
+	gRenderer.drawText(pos, color, FONT_CONSOLAS_24, "\n");
+	pos.x = lineX;
 }
 
 // ========================================================
@@ -786,30 +828,14 @@ void GameWorld::unloadLevel()
 
 	logComment("Unloading current level...");
 
-	for (uint e = 0; e < enemyEntitiesInUse; ++e)
-	{
-		enemyEntities[e].reset();
-	}
-
-	for (uint e = 0; e < renderEntitiesInUse; ++e)
-	{
-		renderEntities[e].reset();
-	}
-
-	for (uint s = 0; s < shadowBlobsInUse; ++s)
-	{
-		shadowBlobs[s].reset(LightShadowBlob::SHADOW_BLOB);
-	}
-
-	for (uint l = 0; l < lightmapsInUse; ++l)
-	{
-		lightmaps[l].reset(LightShadowBlob::LIGHTMAP);
-	}
-
-	for (uint p = 0; p < prtEmittersInUse; ++p)
-	{
-		prtEmitters[p].setDefaults();
-	}
+	// Destroys all the objects; the memory is kept
+	// until the next level sizes the pools again.
+	enemyEntities.clear();
+	renderEntities.clear();
+	shadowBlobs.clear();
+	lightmaps.clear();
+	prtEmitters.clear();
+	pointLights.clear();
 
 	gTime.reset();
 	player.reset();
@@ -824,11 +850,9 @@ void GameWorld::unloadLevel()
 	shadowsDrawn        = 0;
 	lightmapsDrawn      = 0;
 	prtsDrawn           = 0;
-	enemyEntitiesInUse  = 0;
-	renderEntitiesInUse = 0;
-	shadowBlobsInUse    = 0;
-	lightmapsInUse      = 0;
-	prtEmittersInUse    = 0;
+	entitiesLit         = 0;
+	frameLights         = nullptr;
+	frameLightCount     = 0;
 
 	logComment("Level unloaded / GameWorld reset!");
 }
@@ -850,6 +874,7 @@ void GameWorld::loadLevel(const char * mapName, const TileId * tileMap, PropDesc
 
 	if (propMap == nullptr)
 	{
+		initEntityPools(nullptr, 0);
 		logComment("Map '%s' has no props!", mapName);
 		return;
 	}
@@ -873,12 +898,30 @@ void GameWorld::loadLevel(const char * mapName, const TileId * tileMap, PropDesc
 
 	// Group the ones with same model type to reduce texture changes when drawing:
 	propList.sort(&PropDesc::sortByModelType);
+	initEntityPools(propList.data(), propList.size());
 
 	// Actually instantiate the scene props:
 	const uint propCount = propList.size();
 	for (uint p = 0; p < propCount; ++p)
 	{
 		const PropDesc * prop = propList[p];
+
+		// The pools were sized from these same counts, so this only fails if
+		// the code below allocates something `addPropObjects()` doesn't count.
+		PropObjectCounts needed;
+		memset(&needed, 0, sizeof(needed));
+		addPropObjects(*prop, needed);
+		if (!entityPoolsHaveRoomFor(needed))
+		{
+			if (prop->modelId == MDL_PLAYER)
+			{
+				fatalError("No room in the entity pools for the player of map '%s'!", mapName);
+			}
+			logWarning("No room in the entity pools for prop %u (model %i) of map '%s'! Skipping it.",
+			           p, scast<int>(prop->modelId), mapName);
+			continue;
+		}
+
 		RenderEntity * renderEnt = allocRenderEntity();
 
 		const Vector renderEntWPos(prop->tx + prop->mpx, prop->mpy, prop->tz + prop->mpz, 1.0f);
@@ -959,7 +1002,7 @@ void GameWorld::loadLevel(const char * mapName, const TileId * tileMap, PropDesc
 			{
 				// Add a fire emitter on top of the torch:
 				ParticleEmitter * prt = allocParticleEmitter();
-				prt->setMinMaxParticles(300, 400);
+				prt->setMinMaxParticles(300, TORCH_FIRE_PARTICLES);
 				prt->setParticleReleaseAmount(10);
 				prt->setParticleReleaseInterval(50);
 				prt->setParticleLifeCycle(700);
@@ -973,6 +1016,13 @@ void GameWorld::loadLevel(const char * mapName, const TileId * tileMap, PropDesc
 				prt->setParticleSpriteTexture(&particleFireTexture);
 				prt->setEmitterOrigin(Vector(renderEntWPos.x, renderEntWPos.y + 1.5f, renderEntWPos.z, 1.0f));
 				prt->allocateParticles();
+
+				// And a light source for the nearby models:
+				PointLight * light  = allocPointLight();
+				light->position     = Vector(renderEntWPos.x, renderEntWPos.y + TORCH_LIGHT_HEIGHT, renderEntWPos.z, 1.0f);
+				light->color        = makeColor4f(0.9f, 0.5f, 0.2f);
+				light->radius       = TORCH_LIGHT_RADIUS;
+				light->flickerTime  = randomFloat(0.0f, PS2MATH_TWOPI);
 			}
 
 			// Place the prop over a map tile (necessary for player => prop collision tests):
@@ -1013,14 +1063,111 @@ const Texture * GameWorld::getBuiltInTexture(const char * id) const
 	return nullptr;
 }
 
+// ========================================================
+// GameWorld::initEntityPools():
+// ========================================================
+
+// ObjectPool and the particle pool can't be empty.
+static inline uint entityPoolSize(const uint count)
+{
+	return (count != 0) ? count : 1;
+}
+
+void GameWorld::initEntityPools(PropDesc * const * props, const uint propCount)
+{
+	PropObjectCounts total;
+	memset(&total, 0, sizeof(total));
+	for (uint p = 0; p < propCount; ++p)
+	{
+		addPropObjects(*props[p], total);
+	}
+
+	// Nothing is allocated after the level is loaded, so no spare room.
+	enemyEntities.init(entityPoolSize(total.enemies));
+	renderEntities.init(entityPoolSize(total.renders));
+	shadowBlobs.init(entityPoolSize(total.shadows));
+	lightmaps.init(entityPoolSize(total.lightmaps));
+	prtEmitters.init(entityPoolSize(total.emitters), MEM_TAG_PARTICLES);
+	pointLights.init(entityPoolSize(total.lights));
+
+	// One range of the shared particle pool per emitter.
+	// Ranges freed during the level are reused.
+	gParticleManager.reservePool(entityPoolSize(total.particles));
+
+	logComment("Entity pools: %u enemies, %u render ents, %u shadows, %u lightmaps, %u emitters, %u lights, %u particles",
+	           enemyEntities.capacity(), renderEntities.capacity(), shadowBlobs.capacity(),
+	           lightmaps.capacity(), prtEmitters.capacity(), pointLights.capacity(),
+	           gParticleManager.getPoolCapacity());
+}
+
+// ========================================================
+// GameWorld::addPropObjects():
+// ========================================================
+
+void GameWorld::addPropObjects(const PropDesc & prop, PropObjectCounts & counts)
+{
+	++counts.renders;
+
+	switch (prop.modelId)
+	{
+	case MDL_PLAYER :
+		++counts.renders; // Weapon
+		break;
+	case MDL_BOSS :
+		++counts.renders; // Weapon
+		++counts.enemies;
+		++counts.emitters; // Attack effect
+		counts.particles += ENEMY_ATTACK_PARTICLES;
+		break;
+	case MDL_ENEMY :
+		++counts.enemies;
+		++counts.emitters; // Attack effect
+		counts.particles += ENEMY_ATTACK_PARTICLES;
+		break;
+	case MDL_TORCH :
+		++counts.emitters;
+		++counts.lights;
+		counts.particles += TORCH_FIRE_PARTICLES;
+		break;
+	default :
+		break;
+	} // switch (prop.modelId)
+
+	if (prop.lightOrShadow == LightShadowBlob::LIGHTMAP)
+	{
+		++counts.lightmaps;
+	}
+	else if (prop.lightOrShadow == LightShadowBlob::SHADOW_BLOB)
+	{
+		++counts.shadows;
+	}
+}
+
+// ========================================================
+// GameWorld::entityPoolsHaveRoomFor():
+// ========================================================
+
+bool GameWorld::entityPoolsHaveRoomFor(const PropObjectCounts & counts) const
+{
+	// Particle ranges are not checked: `allocRange()` gives an
+	// emitter what is left of the pool and logs the shortfall.
+	return (enemyEntities.size()  + counts.enemies   <= enemyEntities.capacity())  &&
+	       (renderEntities.size() + counts.renders   <= renderEntities.capacity()) &&
+	       (shadowBlobs.size()    + counts.shadows   <= shadowBlobs.capacity())    &&
+	       (lightmaps.size()      + counts.lightmaps <= lightmaps.capacity())      &&
+	       (prtEmitters.size()    + counts.emitters  <= prtEmitters.capacity())    &&
+	       (pointLights.size()    + counts.lights    <= pointLights.capacity());
+}
+
 // ========================================================
 // GameWorld::allocEnemyEntity():
 // ========================================================
 
 EnemyEntity * GameWorld::allocEnemyEntity()
 {
-	ps2assert(enemyEntitiesInUse < MAX_ENEMY_ENTITIES && "No more EnemyEntity instances!");
-	return &enemyEntities[enemyEntitiesInUse++];
+	EnemyEntity * enemyEnt = enemyEntities.allocate();
+	ps2assert(enemyEnt != nullptr && "No more EnemyEntity instances!");
+	return enemyEnt;
 }
 
 // ========================================================
@@ -1029,8 +1176,9 @@ EnemyEntity * GameWorld::allocEnemyEntity()
 
 RenderEntity * GameWorld::allocRenderEntity()
 {
-	ps2assert(renderEntitiesInUse < MAX_RENDER_ENTITIES && "No more RenderEntity instances!");
-	return &renderEntities[renderEntitiesInUse++];
+	RenderEntity * renderEnt = renderEntities.allocate();
+	ps2assert(renderEnt != nullptr && "No more RenderEntity instances!");
+	return renderEnt;
 }
 
 // ========================================================
@@ -1039,8 +1187,10 @@ RenderEntity * GameWorld::allocRenderEntity()
 
 LightShadowBlob * GameWorld::allocShadowBlob()
 {
-	ps2assert(shadowBlobsInUse < MAX_SHADOW_BLOBS && "No more ShadowBlob instances!");
-	return &shadowBlobs[shadowBlobsInUse++];
+	LightShadowBlob * shadow = shadowBlobs.allocate();
+	ps2assert(shadow != nullptr && "No more ShadowBlob instances!");
+	shadow->type = LightShadowBlob::SHADOW_BLOB;
+	return shadow;
 }
 
 // ========================================================
@@ -1049,8 +1199,158 @@ LightShadowBlob * GameWorld::allocShadowBlob()
 
 LightShadowBlob * GameWorld::allocLightmap()
 {
-	ps2assert(lightmapsInUse < MAX_LIGHTMAPS && "No more LightMap instances!");
-	return &lightmaps[lightmapsInUse++];
+	LightShadowBlob * lightmap = lightmaps.allocate();
+	ps2assert(lightmap != nullptr && "No more LightMap instances!");
+	lightmap->type = LightShadowBlob::LIGHTMAP;
+	return lightmap;
+}
+
+// ========================================================
+// GameWorld::allocPointLight():
+// ========================================================
+
+PointLight * GameWorld::allocPointLight()
+{
+	PointLight * light = pointLights.allocate();
+	ps2assert(light != nullptr && "No more PointLight instances!");
+	return light;
+}
+
+// ========================================================
+// GameWorld::free*():
+// ========================================================
+
+void GameWorld::freeEnemyEntity(EnemyEntity * enemyEnt)
+{
+	enemyEntities.release(enemyEnt);
+}
+
+void GameWorld::freeRenderEntity(RenderEntity * renderEnt)
+{
+	renderEntities.release(renderEnt);
+}
+
+void GameWorld::freeShadowBlob(LightShadowBlob * shadow)
+{
+	shadowBlobs.release(shadow);
+}
+
+void GameWorld::freeLightmap(LightShadowBlob * lightmap)
+{
+	lightmaps.release(lightmap);
+}
+
+void GameWorld::freeParticleEmitter(ParticleEmitter * prt)
+{
+	prtEmitters.release(prt);
+}
+
+void GameWorld::freePointLight(PointLight * light)
+{
+	pointLights.release(light);
+}
+
+// ========================================================
+// GameWorld::gatherFrameLights():
+// ========================================================
+
+void GameWorld::gatherFrameLights()
+{
+	// Collect the lights in the active area and apply the flicker
+	// once per light, so each lit entity only pays for the table.
+	frameLightCount = 0;
+	frameLights = gFrameAllocator.alloc<PointLight>(pointLights.size());
+	if (frameLights == nullptr)
+	{
+		return;
+	}
+
+	for (uint l = 0; l < pointLights.size(); ++l)
+	{
+		const PointLight & light = pointLights[l];
+		if (!worldMap.inActiveArea(light.position))
+		{
+			continue;
+		}
+
+		const float flicker = 0.85f + 0.15f * ps2math::fast::sin(gTime.currentTimeSeconds * 8.0f + light.flickerTime);
+
+		PointLight & frameLight = frameLights[frameLightCount++];
+		frameLight.position     = light.position;
+		frameLight.radius       = light.radius;
+		frameLight.flickerTime  = light.flickerTime;
+		frameLight.color.r      = light.color.r * flicker;
+		frameLight.color.g      = light.color.g * flicker;
+		frameLight.color.b      = light.color.b * flicker;
+		frameLight.color.a      = 1.0f;
+	}
+}
+
+// ========================================================
+// GameWorld::computeEntityLighting():
+// ========================================================
+
+//
+// Rebuilds the light table for every visible entity in range of a light,
+// every frame. There's no per-light result to cache and share: the lights
+// are points, so the direction to each differs per entity, and the torches
+// flicker, so their colors change every frame. A table is 162 dot products
+// per light, where lighting the models directly takes one per vertex per
+// light. `tools/md2_bench` measures the build with 3 lights at about 1/10
+// of directly lighting a 500 triangle model, and the color fetches add
+// 10-15% to the frame assembly.
+//
+const Md2LightTable * GameWorld::computeEntityLighting(const RenderEntity & renderEnt)
+{
+	if (frameLightCount == 0)
+	{
+		return nullptr;
+	}
+
+	const Vector entCenter = renderEnt.getBounds().getCenter() + renderEnt.getWorldPosition();
+	const Matrix & modelMatrix = renderEnt.getModelMatrix();
+	uint lightsAdded = 0;
+
+	for (uint l = 0; l < frameLightCount && lightsAdded < MAX_LIGHTS_PER_ENTITY; ++l)
+	{
+		const PointLight & light = frameLights[l];
+		const float distSqr = distanceSqr(light.position, entCenter);
+		if (distSqr >= (light.radius * light.radius) || distSqr < 0.0001f)
+		{
+			continue;
+		}
+
+		if (lightsAdded == 0)
+		{
+			// Ambient is "unlit", so entities leaving the light radius don't pop.
+			entityLightTable.setAmbient(makeColor4f(1.0f, 1.0f, 1.0f));
+		}
+
+		// Linear falloff to zero at the light radius:
+		const float dist  = ps2math::sqrt(distSqr);
+		const float atten = 1.0f - (dist / light.radius);
+		const Color4f lightColor = makeColor4f(light.color.r * atten, light.color.g * atten, light.color.b * atten);
+
+		// Bring the world direction into model space. Model matrices are
+		// rigid (rotation + translation), so the inverse is the transpose.
+		const Vector worldDir = (light.position - entCenter) / dist;
+		const Vector modelDir(
+			worldDir.x * modelMatrix(0,0) + worldDir.y * modelMatrix(0,1) + worldDir.z * modelMatrix(0,2),
+			worldDir.x * modelMatrix(1,0) + worldDir.y * modelMatrix(1,1) + worldDir.z * modelMatrix(1,2),
+			worldDir.x * modelMatrix(2,0) + worldDir.y * modelMatrix(2,1) + worldDir.z * modelMatrix(2,2),
+			0.0f);
+
+		entityLightTable.addLight(modelDir, lightColor);
+		++lightsAdded;
+	}
+
+	if (lightsAdded == 0)
+	{
+		return nullptr;
+	}
+
+	++entitiesLit;
+	return &entityLightTable;
 }
 
 // ========================================================
@@ -1059,6 +1359,7 @@ LightShadowBlob * GameWorld::allocLightmap()
 
 ParticleEmitter * GameWorld::allocParticleEmitter()
 {
-	ps2assert(prtEmittersInUse < MAX_PARTICLE_EMITTERS && "No more ParticleEmitter instances!");
-	return &prtEmitters[prtEmittersInUse++];
+	ParticleEmitter * prt = prtEmitters.allocate();
+	ps2assert(prt != nullptr && "No more ParticleEmitter instances!");
+	return prt;
 }
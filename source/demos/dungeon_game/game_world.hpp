@@ -38,6 +38,7 @@
 #include "game_entity.hpp"
 
 #include "framework/game_pad.hpp"
+#include "framework/object_pool.hpp"
 #include "framework/particle_emitter.hpp"
 #include "framework/third_person_camera.hpp"
 #include "framework/first_person_camera.hpp"
@@ -70,6 +71,19 @@ struct ATTRIBUTE_ALIGNED(16) PropDesc
 	}
 };
 
+// ========================================================
+// struct PointLight:
+// ========================================================
+
+// Point light source used for the MD2 per-vertex lighting (e.g.: torch fire).
+struct ATTRIBUTE_ALIGNED(16) PointLight
+{
+	Vector  position;
+	Color4f color;
+	float   radius;      // Contribution fades to zero at this distance.
+	float   flickerTime; // Per-light time offset, so torches don't flicker in sync.
+};
+
 // ========================================================
 // enum LevelId:
 // ========================================================
@@ -120,13 +134,27 @@ public:
 	const Texture * getBuiltInTexture(const char * id) const;
 
 	//
-	// Entity allocation:
+	// Entity allocation. The pools are sized on load for exactly what the
+	// props of the level instantiate, so these return null past that.
 	//
 	EnemyEntity     * allocEnemyEntity();
 	RenderEntity    * allocRenderEntity();
 	LightShadowBlob * allocShadowBlob();
 	LightShadowBlob * allocLightmap();
 	ParticleEmitter * allocParticleEmitter();
+	PointLight      * allocPointLight();
+
+	void freeEnemyEntity(EnemyEntity * enemyEnt);
+	void freeRenderEntity(RenderEntity * renderEnt);
+	void freeShadowBlob(LightShadowBlob * shadow);
+	void freeLightmap(LightShadowBlob * lightmap);
+	void freeParticleEmitter(ParticleEmitter * prt);
+	void freePointLight(PointLight * light);
+
+	// Max particles of the emitters created per prop,
+	// which also size the particle pool of each level.
+	static const uint TORCH_FIRE_PARTICLES   = 400;
+	static const uint ENEMY_ATTACK_PARTICLES = 300;
 
 private:
 
@@ -140,11 +168,15 @@ private:
 	void onFadeOutFinished();
 	void onFadeInFinished();
 	static void drawMainMenuOpt(Vec2f & pos, const char * entryName, bool checked);
+	void gatherFrameLights();
+	void initEntityPools(PropDesc * const * props, uint propCount);
+	const Md2LightTable * computeEntityLighting(const RenderEntity & renderEnt);
 
 	// Render matrices, culling:
 	Matrix  viewMatrix;
 	Matrix  projectionMatrix;
 	Frustum frustum;
+	FrustumCullPlanes cullPlanes;
 
 	// Cameras / controls:
 	GamePad    * gamePad;
@@ -163,6 +195,7 @@ private:
 	uint shadowsDrawn;
 	uint lightmapsDrawn;
 	uint prtsDrawn;
+	uint entitiesLit;
 	bool drawModelBounds;
 	bool showDevConsole;
 
@@ -177,27 +210,40 @@ private:
 	LevelId currLevel;
 	int     currMainMenuSel;
 
-	// These values are per game-level/world instance, not per rendered frame!
-	// My demo levels are quite small, so we don't need many at the moment.
-	static const uint MAX_ENEMY_ENTITIES    = 24;
-	static const uint MAX_RENDER_ENTITIES   = 64;
-	static const uint MAX_SHADOW_BLOBS      = 64;
-	static const uint MAX_LIGHTMAPS         = 32;
-	static const uint MAX_PARTICLE_EMITTERS = 24;
-
-	// Used count in the following arrays:
-	uint enemyEntitiesInUse;
-	uint renderEntitiesInUse;
-	uint shadowBlobsInUse;
-	uint lightmapsInUse;
-	uint prtEmittersInUse;
-
-	// Entity/object pools, for each level/world instance:
-	EnemyEntity     enemyEntities  [MAX_ENEMY_ENTITIES]    ATTRIBUTE_ALIGNED(16);
-	RenderEntity    renderEntities [MAX_RENDER_ENTITIES]   ATTRIBUTE_ALIGNED(16);
-	LightShadowBlob shadowBlobs    [MAX_SHADOW_BLOBS]      ATTRIBUTE_ALIGNED(16);
-	LightShadowBlob lightmaps      [MAX_LIGHTMAPS]         ATTRIBUTE_ALIGNED(16);
-	ParticleEmitter prtEmitters    [MAX_PARTICLE_EMITTERS] ATTRIBUTE_ALIGNED(16);
+	// Objects instantiated for a prop by `loadLevel()`, including the
+	// attack emitter of `EnemyEntity::init()`. Counted by `addPropObjects()`,
+	// the one place with these rules, to size the pools and to check
+	// they have room before a prop is instantiated.
+	struct PropObjectCounts
+	{
+		uint enemies;
+		uint renders;
+		uint shadows;
+		uint lightmaps;
+		uint emitters;
+		uint lights;
+		uint particles;
+	};
+
+	static void addPropObjects(const PropDesc & prop, PropObjectCounts & counts);
+	bool entityPoolsHaveRoomFor(const PropObjectCounts & counts) const;
+
+	// Entity/object pools, for each level/world instance.
+	// Sized by `initEntityPools()` from the props of the level.
+	ObjectPool<EnemyEntity>     enemyEntities;
+	ObjectPool<RenderEntity>    renderEntities;
+	ObjectPool<LightShadowBlob> shadowBlobs;
+	ObjectPool<LightShadowBlob> lightmaps;
+	ObjectPool<ParticleEmitter> prtEmitters;
+	ObjectPool<PointLight>      pointLights;
+
+	// Lights in the active area for the current frame, with the flicker
+	// already applied to the color. Frame allocated, refreshed once per frame.
+	PointLight * frameLights;
+	uint frameLightCount;
+
+	// Scratch table reused by every lit entity drawn in a frame.
+	Md2LightTable entityLightTable;
 };
 
 #endif // GAME_WORLD_HPP
@@ -34,6 +34,7 @@
 #include "tile_map.hpp"
 
 #include "framework/game_time.hpp"
+#include "framework/scratchpad.hpp"
 #include "framework/ps2_math/frustum.hpp"
 
 // ================================================================================================
@@ -174,6 +175,9 @@ void initAllModels()
 		return; // Do this only once.
 	}
 
+	// The animation tables and frame bounds of the models are Arrays.
+	ScopedMemTag geometryTag(MEM_TAG_GEOMETRY);
+
 	INIT_MDL_DATA( MDL_PLAYER,           player_model           );
 	INIT_MDL_DATA( MDL_PLAYER_WEAPON,    player_weapon_model    );
 	INIT_MDL_DATA( MDL_ENEMY,            enemy_model            );
@@ -333,26 +337,36 @@ bool LightShadowBlob::isVisible(const Frustum & frustum) const
 // RenderEntity shared data:
 // ========================================================
 
-DrawVertex * RenderEntity::tempMd2Verts = nullptr;
-static const uint TEMP_MD2_VERT_COUNT   = 4096; // Default Quake MD2 max was 2048
+// Animation LOD thresholds, as the ratio of the model's bounding
+// radius over its distance to the eye. Squared to avoid the sqrt.
+// Roughly: full rate up to ~8 units away for a player-sized model,
+// half rate up to ~14 units and quarter rate at the active area's edge.
+static const float ANIM_LOD_FULL_RATIO_SQR = 0.12f * 0.12f;
+static const float ANIM_LOD_HALF_RATIO_SQR = 0.07f * 0.07f;
+
+// Frames the displayed pose is held for, indexed by RenderEntity::AnimLod.
+static const uint animLodPoseIntervals[] = { 1, 2, 4 };
 
 // ========================================================
 // RenderEntity::RenderEntity():
 // ========================================================
 
 RenderEntity::RenderEntity()
+	: animPoseVerts(nullptr)
 {
 	reset();
 
 	// Init once (never deallocated):
 	initAllModels();
-	if (tempMd2Verts == nullptr)
-	{
-		tempMd2Verts = memClearedAlloc<DrawVertex>(MEM_TAG_GEOMETRY, TEMP_MD2_VERT_COUNT);
-		logComment("Allocated space for temp MD2 vertexes...");
-	}
+}
 
-	vbPtr = tempMd2Verts;
+// ========================================================
+// RenderEntity::~RenderEntity():
+// ========================================================
+
+RenderEntity::~RenderEntity()
+{
+	freeAnimPoseCache();
 }
 
 // ========================================================
@@ -377,40 +391,101 @@ void RenderEntity::reset()
 
 	animState.clear();
 	modelMatrix.makeIdentity();
+
+	animLod           = ANIM_LOD_FULL;
+	animPoseAge       = 0;
+	animPoseFrameA    = 0;
+	animPoseFrameB    = 0;
+	animPoseSrcFrameA = ~0u; // Force a refresh on first draw.
+	animPoseSrcFrameB = ~0u;
+	animPoseInterp    = 0.0f;
+	freeAnimPoseCache();
 }
 
 // ========================================================
 // RenderEntity::draw():
 // ========================================================
 
-void RenderEntity::draw(const Color4f * tint) const
+void RenderEntity::draw(const Color4f * tint, const Md2LightTable * lightTable) const
 {
 	if (model == nullptr)
 	{
 		return;
 	}
 
-	const uint mdlVertCount = model->getTriangleCount() * 3;
-	ps2assert(mdlVertCount < TEMP_MD2_VERT_COUNT);
 	ps2assert(texture != nullptr);
 
+	const uint mdlVertCount = model->getTriangleCount() * 3;
+
 	if (isAnimated)
 	{
+		// Always advance the animation timing, regardless of LOD,
+		// so the current frame stays exact for the game logic.
 		animState.update(gTime.currentTimeSeconds, model->getKeyframeCount());
+		const AnimLod lod = selectAnimLod();
+		const bool poseChanged = refreshAnimPose(lod);
+
+		// The lower tiers draw the held pose straight from the cache and
+		// only assemble when it changes. The lighting baked in it is held
+		// as long as the pose (at most 3 frames). The faded tint of the
+		// entities at the edge of the active area is not cached, those
+		// few go through the per-frame path below.
+		if (lod != ANIM_LOD_FULL && tint == nullptr)
+		{
+			if (animPoseVerts == nullptr)
+			{
+				animPoseVerts = memAlloc<DrawVertex>(MEM_TAG_GEOMETRY, mdlVertCount);
+			}
+			if (poseChanged || !animPoseVertsValid)
+			{
+				assembleAnimPose(animPoseVerts, colorTint, lightTable);
+				animPoseVertsValid = true;
+			}
+
+			gRenderer.setTexture(*texture);
+			gRenderer.setModelMatrix(modelMatrix);
+			gRenderer.drawUnindexedTriangles(animPoseVerts, mdlVertCount);
+			drawCustomLightShadow();
+			return;
+		}
+		animPoseVertsValid = false;
+	}
 
-		model->assembleFrameInterpolated(animState.currFrame, animState.nextFrame, animState.interp,
-			originalTexSize.x, originalTexSize.y, (tint != nullptr) ? (*tint) : colorTint, vbPtr);
+	// The generated vertexes are copied into the render packet by
+	// `drawUnindexedTriangles()`, so they only need to live until then.
+	// Smaller models (up to ~300 verts) are blended in the Scratch Pad.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	DrawVertex * vbPtr     = sprOrFrameAlloc<DrawVertex>(mdlVertCount);
+	if (vbPtr == nullptr)
+	{
+		return;
+	}
+
+	if (isAnimated)
+	{
+		assembleAnimPose(vbPtr, (tint != nullptr) ? (*tint) : colorTint, lightTable);
 	}
 	else // Simpler path for static models:
 	{
 		model->assembleFrame(animState.endFrame, originalTexSize.x, originalTexSize.y,
-			(tint != nullptr) ? (*tint) : colorTint, vbPtr);
+			(tint != nullptr) ? (*tint) : colorTint, vbPtr, lightTable);
 	}
 
 	gRenderer.setTexture(*texture);
 	gRenderer.setModelMatrix(modelMatrix);
 	gRenderer.drawUnindexedTriangles(vbPtr, mdlVertCount);
+	gFrameAllocator.rewind(frameMark);
+
+	drawCustomLightShadow();
+}
+
+// ========================================================
+// RenderEntity::drawCustomLightShadow():
+// ========================================================
 
+void RenderEntity::drawCustomLightShadow() const
+{
 	// Objects that have a custom lightmap or shadow won't be rendered
 	// by the game world as a batch, so we render them here.
 	if (lightOrShadow != nullptr && lightOrShadow->type == LightShadowBlob::CUSTOM)
@@ -427,6 +502,102 @@ void RenderEntity::draw(const Color4f * tint) const
 	}
 }
 
+// ========================================================
+// RenderEntity::selectAnimLod():
+// ========================================================
+
+RenderEntity::AnimLod RenderEntity::selectAnimLod() const
+{
+	const Aabb & modelAabb = model->getBoundsForFrame(animState.currFrame);
+	const float radiusSqr  = distanceSqr(modelAabb.mins, modelAabb.maxs) * 0.25f;
+	const float distSqr    = distanceSqr(worldPos, gRenderer.getEyePosition());
+
+	// Compare radius/dist against the thresholds without dividing.
+	if (radiusSqr >= distSqr * ANIM_LOD_FULL_RATIO_SQR)
+	{
+		return ANIM_LOD_FULL;
+	}
+	if (radiusSqr >= distSqr * ANIM_LOD_HALF_RATIO_SQR)
+	{
+		return ANIM_LOD_HALF;
+	}
+	return ANIM_LOD_QUARTER;
+}
+
+// ========================================================
+// RenderEntity::refreshAnimPose():
+// ========================================================
+
+bool RenderEntity::refreshAnimPose(const AnimLod lod) const
+{
+	// A keyframe switch always refreshes the pose, so the held
+	// pose never shows a frame the animation has already left.
+	const bool keyframeChanged = (animPoseSrcFrameA != animState.currFrame) ||
+	                             (animPoseSrcFrameB != animState.nextFrame);
+
+	animLod = lod;
+	if (!keyframeChanged && ++animPoseAge < animLodPoseIntervals[lod])
+	{
+		return false; // Hold the current pose.
+	}
+
+	const uint  prevFrameA = animPoseFrameA;
+	const uint  prevFrameB = animPoseFrameB;
+	const float prevInterp = animPoseInterp;
+
+	animPoseAge       = 0;
+	animPoseSrcFrameA = animState.currFrame;
+	animPoseSrcFrameB = animState.nextFrame;
+	animPoseFrameA    = animState.currFrame;
+	animPoseFrameB    = animState.nextFrame;
+	animPoseInterp    = clamp(animState.interp, 0.0f, 1.0f);
+
+	if (lod == ANIM_LOD_QUARTER)
+	{
+		// Drop to the nearest keyframe. Cheaper to assemble than a blend.
+		if (animPoseInterp >= 0.5f)
+		{
+			animPoseFrameA = animState.nextFrame;
+		}
+		animPoseInterp = 0.0f;
+	}
+
+	// Snapping often lands on the keyframe already displayed,
+	// e.g. when the animation catches up with a rounded up pose.
+	return (animPoseFrameA != prevFrameA) || (animPoseInterp != prevInterp) ||
+	       (animPoseInterp > 0.0f && animPoseFrameB != prevFrameB);
+}
+
+// ========================================================
+// RenderEntity::assembleAnimPose():
+// ========================================================
+
+void RenderEntity::assembleAnimPose(DrawVertex * dest, const Color4f & tint,
+                                    const Md2LightTable * lightTable) const
+{
+	if (animPoseInterp > 0.0f)
+	{
+		model->assembleFrameInterpolated(animPoseFrameA, animPoseFrameB, animPoseInterp,
+			originalTexSize.x, originalTexSize.y, tint, dest, lightTable);
+	}
+	else // Exactly on a keyframe, no blending needed:
+	{
+		model->assembleFrame(animPoseFrameA, originalTexSize.x, originalTexSize.y,
+			tint, dest, lightTable);
+	}
+}
+
+// ========================================================
+// RenderEntity::freeAnimPoseCache():
+// ========================================================
+
+void RenderEntity::freeAnimPoseCache()
+{
+	memFree(MEM_TAG_GEOMETRY, animPoseVerts);
+	animPoseVerts      = nullptr;
+	animPoseVertsValid = false;
+}
+
 // ========================================================
 // RenderEntity::drawBounds():
 // ========================================================
@@ -465,6 +636,7 @@ const Aabb & RenderEntity::getBounds() const
 void RenderEntity::setModel(const ModelId mdlId)
 {
 	ps2assert(uint(mdlId) < MODEL_COUNT);
+	freeAnimPoseCache(); // Sized for the old model.
 	model           = md2Models[mdlId].mdl;
 	texture         = md2Models[mdlId].tex;
 	originalTexSize = md2Models[mdlId].texSize;
@@ -476,6 +648,7 @@ void RenderEntity::setModel(const ModelId mdlId)
 
 void RenderEntity::setModel(const Md2Model * mdl, const Texture * tex)
 {
+	freeAnimPoseCache(); // Sized for the old model.
 	model   = mdl;
 	texture = tex;
 
@@ -500,7 +673,9 @@ void RenderEntity::setAnimation(const StdMd2AnimId animId)
 	animState.nextFrame  = start + 1;
 	animState.fps        = frameRate;
 
-	isAnimated = true;
+	isAnimated        = true;
+	animPoseSrcFrameA = ~0u; // Force a pose refresh on next draw.
+	animPoseSrcFrameB = ~0u;
 }
 
 // ========================================================
@@ -510,6 +685,7 @@ void RenderEntity::setAnimation(const StdMd2AnimId animId)
 void RenderEntity::setColorTint(const Color4f & tint)
 {
 	colorTint = tint;
+	animPoseVertsValid = false; // Baked into the held pose.
 }
 
 // ========================================================
@@ -558,13 +734,28 @@ void RenderEntity::setLightShadowSize(const float blobSize)
 
 bool RenderEntity::isVisible(const Frustum & frustum) const
 {
+	Aabb modelAabb;
+	if (!getWorldBounds(&modelAabb))
+	{
+		return false;
+	}
+	return frustum.testAabb(modelAabb);
+}
+
+// ========================================================
+// RenderEntity::getWorldBounds():
+// ========================================================
+
+bool RenderEntity::getWorldBounds(Aabb * bbox) const
+{
+	ps2assert(bbox != nullptr);
 	if (model == nullptr)
 	{
 		return false;
 	}
 
-	Aabb modelAabb = model->getBoundsForFrame(animState.currFrame);
-	modelAabb.mins += worldPos;
-	modelAabb.maxs += worldPos;
-	return frustum.testAabb(modelAabb);
+	(*bbox) = model->getBoundsForFrame(animState.currFrame);
+	bbox->mins += worldPos;
+	bbox->maxs += worldPos;
+	return true;
 }
@@ -106,8 +106,11 @@ class RenderEntity
 public:
 
 	RenderEntity();
+	~RenderEntity();
 	void reset();
-	void draw(const Color4f * tint = nullptr) const;
+
+	// Optional light table for MD2 per-vertex lighting. Null = unlit.
+	void draw(const Color4f * tint = nullptr, const Md2LightTable * lightTable = nullptr) const;
 
 	// Access the model's AABB or draw it:
 	void drawBounds() const;
@@ -143,6 +146,22 @@ public:
 	// Visibility test of the model's AABB against the view frustum.
 	bool isVisible(const Frustum & frustum) const;
 
+	// Model's AABB for the current frame translated to the world position.
+	// False if there's no model.
+	bool getWorldBounds(Aabb * bbox) const;
+
+	// Animation level-of-detail. Selected every draw from the projected
+	// size of the model. The animation timing is always updated at full
+	// rate, so frame-exact queries like GameEntity::currentAnimationFinished()
+	// are unaffected. Only the displayed pose is refreshed less often.
+	enum AnimLod
+	{
+		ANIM_LOD_FULL,    // Pose refreshed every frame, blended keyframes.
+		ANIM_LOD_HALF,    // Pose refreshed every other frame, interpolation held in between.
+		ANIM_LOD_QUARTER  // Pose refreshed every fourth frame, snapped to the nearest keyframe.
+	};
+	AnimLod getAnimLod() const { return animLod; }
+
 private:
 
 	// Copy/assign disallowed.
@@ -153,10 +172,6 @@ private:
 	const Md2Model * model;
 	const Texture  * texture;
 
-	// Pointer to `tempMd2Verts`, stored locally in each
-	// instance to avoid accessing the global when rendering.
-	DrawVertex * vbPtr;
-
 	// Size of the original texture.
 	// Some textures are re-scaled to fit out 256^2 limit
 	// so we need the original size to ensure the MD2 is
@@ -170,6 +185,28 @@ private:
 	mutable Md2AnimState animState;
 	bool isAnimated;
 
+	// Animation LOD and the pose currently displayed. The pose lags
+	// `animState` by at most a few frames on the lower LOD tiers.
+	// `animPoseSrcFrame*` are the keyframes the pose was taken from,
+	// which differ from the displayed ones once snapped to a keyframe.
+	AnimLod selectAnimLod() const;
+	bool refreshAnimPose(AnimLod lod) const;
+	void assembleAnimPose(DrawVertex * dest, const Color4f & tint, const Md2LightTable * lightTable) const;
+	void freeAnimPoseCache();
+	void drawCustomLightShadow() const;
+	mutable AnimLod animLod;
+	mutable uint  animPoseAge;
+	mutable uint  animPoseFrameA;
+	mutable uint  animPoseFrameB;
+	mutable uint  animPoseSrcFrameA;
+	mutable uint  animPoseSrcFrameB;
+	mutable float animPoseInterp;
+
+	// The held pose, assembled once and drawn as is while the lower
+	// LOD tiers hold it. Allocated on first use, freed with the model.
+	mutable DrawVertex * animPoseVerts;
+	mutable bool animPoseVertsValid;
+
 	// Pseudo-light-map or shadow blob renderer (not owned by RenderEntity):
 	LightShadowBlob * lightOrShadow;
 
@@ -178,10 +215,6 @@ private:
 
 	// Model-to-world matrix, used for rendering.
 	Matrix modelMatrix;
-
-	// This pool of temporary vertexes is shared by all MD2 model instances.
-	// They are used to store the vertexes generated by animation blending.
-	static DrawVertex * tempMd2Verts;
 };
 
 #endif // RENDER_ENTITY_HPP
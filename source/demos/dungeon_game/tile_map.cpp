@@ -33,6 +33,7 @@
 #include "tile_map.hpp"
 #include "render_entity.hpp"
 #include "framework/quick_sort.hpp"
+#include "framework/scratchpad.hpp"
 
 // ================================================================================================
 // Built-in tile data (include files generated with `obj2c` or `bin2c`):
@@ -247,6 +248,10 @@ struct TileDrawCmd
 	bool fade;
 };
 
+// Batches are at most ActiveTiles::PATTERN_SIZE (121) tiles, fewer after
+// culling, with few distinct ids. That is well below the ~256 keys where
+// radixSort16() clearly pulls ahead (see tools/radix_sort_bench), so the
+// tiles are quick-sorted.
 struct TileDrawQSortPredicate
 {
 	int operator() (const TileDrawCmd & tileA, const TileDrawCmd & tileB) const
@@ -409,7 +414,7 @@ void TileMap::removeSceneProp(const Vector & worldPos)
 // TileMap::drawMap():
 // ========================================================
 
-void TileMap::drawMap(const Frustum & frustum)
+void TileMap::drawMap(const FrustumCullPlanes & cullPlanes)
 {
 	ps2assert(tiles != nullptr);
 	ps2assert(mapTilesX != 0);
@@ -417,16 +422,34 @@ void TileMap::drawMap(const Frustum & frustum)
 
 	// We batch the tiles to reduces texture changes to two:
 	// 1 for the walls and 1 for the floor. The batch is sorted
-	// before drawing to group each type of tile. Batch is fixed
-	// size, so the amount of tiles drawn cannot exceed the max!
+	// before drawing to group each type of tile. Only tiles in
+	// the active area are drawn, so that's the max batch size.
+	// The batch and the tile bounds for the frustum culling are
+	// kept in the Scratch Pad (~5KB), falling back to frame memory.
 	//
-	static const uint TILE_BATCH_SIZE = 1024;
-	static TileDrawCmd tileBatch[TILE_BATCH_SIZE] ATTRIBUTE_ALIGNED(16);
+	static const uint TILE_BATCH_SIZE = ActiveTiles::PATTERN_SIZE;
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	TileDrawCmd * tileBatch = sprOrFrameAlloc<TileDrawCmd>(TILE_BATCH_SIZE);
+	float * tileBoxMemory   = sprOrFrameAlloc<float>(AabbSoA::floatsNeeded(TILE_BATCH_SIZE));
+	uint * tileVisibleBits  = sprOrFrameAlloc<uint>(cullBitWords(TILE_BATCH_SIZE));
+
+	if (tileBatch == nullptr || tileBoxMemory == nullptr || tileVisibleBits == nullptr)
+	{
+		gFrameAllocator.rewind(frameMark);
+		return;
+	}
+
+	AabbSoA tileBoxes;
+	tileBoxes.setMemory(tileBoxMemory, TILE_BATCH_SIZE);
 
-	// Assemble the batch for visible tiles:
+	// Gather the tiles in the active area and their bounds:
 	//
+	Aabb areaBounds;
+	areaBounds.clear();
+
 	bool fadeTile = false;
-	uint tilesBatched = 0;
+	uint tilesGathered = 0;
 	for (uint z = 0; z < mapTilesZ; ++z)
 	{
 		for (uint x = 0; x < mapTilesX; ++x)
@@ -453,21 +476,54 @@ void TileMap::drawMap(const Frustum & frustum)
 				continue;
 			}
 
-			// Also skip tiles that are not inside the view frustum:
-			if (!tileIsVisible(frustum, tileId, tx, tz))
-			{
-				continue;
-			}
+			ps2assert(tilesGathered < TILE_BATCH_SIZE && "Tile batch size exceeded!");
 
-			ps2assert(tilesBatched < TILE_BATCH_SIZE && "Tile batch size exceeded!");
+			// Translated tile bounding box:
+			Aabb tileAabb = tileBounds[tileId];
+			tileAabb.mins.x += tx;
+			tileAabb.mins.z += tz;
+			tileAabb.maxs.x += tx;
+			tileAabb.maxs.z += tz;
+			tileBoxes.setBox(tilesGathered, tileAabb);
+			areaBounds.merge(tileAabb);
 
 			// Add a draw command to the batch:
-			TileDrawCmd & cmd = tileBatch[tilesBatched++];
+			TileDrawCmd & cmd = tileBatch[tilesGathered];
 			cmd.x    = tx;
 			cmd.z    = tz;
 			cmd.id   = tileId;
 			cmd.fade = fadeTile;
+			++tilesGathered;
+		}
+	}
+
+	// Frustum cull the whole active area first, then the tiles
+	// only against the planes the active area crosses. When it
+	// is fully inside the frustum, the tiles need no tests at all.
+	//
+	uint planeMask = FRUSTUM_NO_PLANES;
+	if (tilesGathered == 0 || !cullAabb(cullPlanes, areaBounds, FRUSTUM_ALL_PLANES, &planeMask))
+	{
+		gFrameAllocator.rewind(frameMark);
+		return;
+	}
+	cullAabbs(cullPlanes, tileBoxes, tilesGathered, planeMask, tileVisibleBits);
+
+	// Move the visible tiles to the front of the batch:
+	//
+	uint tilesBatched = 0;
+	for (uint t = 0; t < tilesGathered; ++t)
+	{
+		if (!isAabbVisible(tileVisibleBits, t))
+		{
+			continue;
+		}
+
+		if (t != tilesBatched)
+		{
+			tileBatch[tilesBatched] = tileBatch[t];
 		}
+		++tilesBatched;
 	}
 
 	// Sort the batch:
@@ -506,6 +562,8 @@ void TileMap::drawMap(const Frustum & frustum)
 		const Color4f & tileTint = cmd.fade ? fadedColorTint : mapColorTint;
 		drawSingleTile(cmd.id, cmd.x, cmd.z, tileTint);
 	}
+
+	gFrameAllocator.rewind(frameMark);
 }
 
 // ========================================================
@@ -35,7 +35,7 @@
 
 #include "framework/common.hpp"
 #include "framework/renderer.hpp"
-#include "framework/ps2_math/frustum.hpp"
+#include "framework/ps2_math/frustum_cull.hpp"
 
 // ========================================================
 
@@ -138,7 +138,7 @@ public:
 	//
 	// Map rendering/updating:
 	//
-	void drawMap(const Frustum & frustum);
+	void drawMap(const FrustumCullPlanes & cullPlanes);
 	void drawSingleTile(TileId tileId, float x, float z, const Color4f & tileTint);
 	void updateActiveArea(const Vector & center); // `center` is usually the player's position.
 
@@ -4,7 +4,7 @@
 // File: array.hpp
 // Author: Guilherme R. Lampert
 // Created on: 12/01/15
-// Brief: Dynamic array template class, a minimal replacement for std::vector<T> (POD types only).
+// Brief: Dynamic array template classes, a minimal replacement for std::vector<T>.
 //
 // License:
 //  This source code is released under the MIT License.
@@ -40,12 +40,17 @@
 // ========================================================
 
 //
-// NOTE: This class will only work with Plain Old Data (POD) types!
-// No constructors or destructor are called for type T.
-// Copies on reallocation are done with `memcpy()/memmove()`.
+// Elements are constructed with placement new and destroyed when removed,
+// so non-POD types are fine. Reallocation copy-constructs the elements in
+// the new block, then destroys the old ones. `sort()` uses `qsort()`, so
+// it is only safe for types that can be moved with a `memcpy()`.
 //
-// Only allocates memory on first insertion, if constructed
-// with default `Array<T>()` empty constructor.
+// Memory comes from the same tag as a plain `new` (MEM_TAG_CPP_NEW,
+// or the tag of the enclosing ScopedMemTag when it allocates).
+//
+// Capacity grows by 1.5x, so `pushBack()` is amortized constant time.
+// Only allocates memory on first insertion, if constructed with
+// default `Array<T>()` empty constructor.
 //
 template<class T>
 class Array
@@ -70,7 +75,7 @@ public:
 	explicit Array(size_type newSize, const value_type & fillVal);
 
 	void reserve(size_type newCapacity);
-	void resize(size_type newSize, const value_type & fillVal = value_type());
+	void resize(size_type newSize, const value_type & fillVal = value_type()); // Also fills the existing elements!
 	void clear(); // Also frees the memory!
 
 	void pushBack(const value_type & val);
@@ -98,22 +103,65 @@ public:
 	const_pointer data() const;
 	pointer data();
 
+protected:
+
+	// Used by SmallArray to start with its inline buffer.
+	Array(value_type * inlineBuf, size_type inlineCap);
+
 private:
 
 	// Copy/assign disallowed.
 	Array(const Array &);
 	Array & operator = (const Array &);
 
+	void grow(size_type minCapacity);
+	void growAndPushBack(const value_type & val);
+	void reallocate(size_type newCapacity);
+	void destroyAll();
+
 	// Member data:
-	value_type * ptr;   // Array with `total` elements.
-	size_type    total; // Total elements allocated.
-	size_type    used;  // Elements committed.
-
-	// Extra elements per allocation (Powers of 2):
-	enum { ALLOCEXTRA = ( (sizeof(T) <= 1) ? 64
-	                    : (sizeof(T) <= 2) ? 32
-	                    : (sizeof(T) <= 4) ? 16
-	                    : (sizeof(T) <= 8) ? 8 : 4 ) };
+	value_type * ptr;            // Array with `total` elements.
+	value_type * inlineStorage;  // SmallArray buffer or null. Never freed.
+	size_type    inlineCapacity; // Elements in `inlineStorage`.
+	size_type    total;          // Total elements allocated.
+	size_type    used;           // Elements committed (constructed).
+
+	// Minimum elements allocated (Powers of 2):
+	enum { MINCAPACITY = ( (sizeof(T) <= 1) ? 64
+	                     : (sizeof(T) <= 2) ? 32
+	                     : (sizeof(T) <= 4) ? 16
+	                     : (sizeof(T) <= 8) ? 8 : 4 ) };
+};
+
+// ========================================================
+// template class SmallArray<T, N>:
+// ========================================================
+
+//
+// Array<T> with room for N elements inside the object itself, so
+// small arrays never touch the heap. Grows into heap memory like a
+// normal Array past that, and `clear()` takes it back to the inline
+// buffer. Can be passed anywhere an `Array<T> &` is expected.
+//
+template<class T, unsigned int N>
+class SmallArray
+	: public Array<T>
+{
+public:
+
+	 SmallArray() : Array<T>(rcast<T *>(inlineBuffer), N) { }
+	~SmallArray() { this->clear(); }
+
+	// True while the elements still live in the inline buffer.
+	bool isInline() const { return this->data() == rcast<const T *>(inlineBuffer); }
+
+private:
+
+	// Copy/assign disallowed.
+	SmallArray(const SmallArray &);
+	SmallArray & operator = (const SmallArray &);
+
+	ubyte inlineBuffer[N * sizeof(T)] ATTRIBUTE_ALIGNED(16);
 };
 
 // ========================================================
@@ -123,6 +171,8 @@ private:
 template<class T>
 Array<T>::Array()
 	: ptr(nullptr)
+	, inlineStorage(nullptr)
+	, inlineCapacity(0)
 	, total(0)
 	, used(0)
 {
@@ -132,6 +182,8 @@ Array<T>::Array()
 template<class T>
 Array<T>::Array(const size_type newSize)
 	: ptr(nullptr)
+	, inlineStorage(nullptr)
+	, inlineCapacity(0)
 	, total(0)
 	, used(0)
 {
@@ -141,75 +193,147 @@ Array<T>::Array(const size_type newSize)
 template<class T>
 Array<T>::Array(const size_type newSize, const value_type & fillVal)
 	: ptr(nullptr)
+	, inlineStorage(nullptr)
+	, inlineCapacity(0)
 	, total(0)
 	, used(0)
 {
 	resize(newSize, fillVal);
 }
 
+template<class T>
+Array<T>::Array(value_type * inlineBuf, const size_type inlineCap)
+	: ptr(inlineBuf)
+	, inlineStorage(inlineBuf)
+	, inlineCapacity(inlineCap)
+	, total(inlineCap)
+	, used(0)
+{
+	// Construct empty, with the inline storage.
+}
+
 template<class T>
 Array<T>::~Array()
 {
-	if (ptr != nullptr)
+	destroyAll();
+	if (ptr != inlineStorage)
 	{
-		memFree(MEM_TAG_GENERIC, ptr);
+		memFree(memGetNewTag(), ptr);
 	}
 }
 
 template<class T>
 void Array<T>::reserve(const size_type newCapacity)
 {
-	if (newCapacity <= total)
+	if (newCapacity > total)
 	{
-		return;
+		reallocate(newCapacity);
 	}
+}
 
-	value_type * oldPtr = ptr;
+template<class T>
+void Array<T>::grow(const size_type minCapacity)
+{
+	size_type newCapacity = total + (total >> 1);
+	if (newCapacity < minCapacity)
+	{
+		newCapacity = minCapacity;
+	}
+	if (newCapacity < size_type(MINCAPACITY))
+	{
+		newCapacity = MINCAPACITY;
+	}
+	reallocate(newCapacity);
+}
 
-	total = newCapacity + ALLOCEXTRA;
-	ptr   = memAlloc<T>(MEM_TAG_GENERIC, total);
+template<class T>
+void Array<T>::reallocate(const size_type newCapacity)
+{
+	ps2assert(newCapacity >= used);
+	value_type * newPtr = memAlloc<T>(memGetNewTag(), newCapacity);
 
-	if (ptr == nullptr)
+	if (newPtr == nullptr)
 	{
 		fatalError("Out-of-memory on Array<T> reallocation!");
 	}
 
-	if (oldPtr != nullptr)
+	for (size_type i = 0; i < used; ++i)
 	{
-		memcpy(ptr, oldPtr, used * sizeof(T));
-		memFree(MEM_TAG_GENERIC, oldPtr);
+		memConstruct(&newPtr[i], ptr[i]);
+		memDestroy(&ptr[i]);
 	}
+
+	if (ptr != inlineStorage)
+	{
+		memFree(memGetNewTag(), ptr);
+	}
+
+	ptr   = newPtr;
+	total = newCapacity;
+}
+
+template<class T>
+void Array<T>::destroyAll()
+{
+	for (size_type i = 0; i < used; ++i)
+	{
+		memDestroy(&ptr[i]);
+	}
+	used = 0;
 }
 
 template<class T>
 void Array<T>::resize(const size_type newSize, const value_type & fillVal)
 {
+	// Copy first, `fillVal` might be an element of this array.
+	const value_type fillCopy(fillVal);
+
+	while (used > newSize)
+	{
+		popBack();
+	}
+
 	reserve(newSize);
 	ps2assert(total >= newSize);
-	used = newSize;
-	fill(fillVal);
+
+	fill(fillCopy);
+	while (used < newSize)
+	{
+		memConstruct(&ptr[used++], fillCopy);
+	}
 }
 
 template<class T>
 void Array<T>::clear()
 {
-	if (ptr != nullptr)
+	destroyAll();
+	if (ptr != inlineStorage)
 	{
-		memFree(MEM_TAG_GENERIC, ptr);
-		ptr   = nullptr;
-		total = 0;
-		used  = 0;
+		memFree(memGetNewTag(), ptr);
+		ptr   = inlineStorage;
+		total = inlineCapacity;
 	}
 }
 
 template<class T>
 void Array<T>::pushBack(const value_type & val)
 {
+	// Kept this small so it inlines; the growth path is out of line.
 	if (used == total)
 	{
-		reserve(total + 1);
+		growAndPushBack(val);
+		return;
 	}
-	ptr[used++] = val;
+	memConstruct(&ptr[used++], val);
+}
+
+template<class T>
+void Array<T>::growAndPushBack(const value_type & val)
+{
+	// Copy first, `val` might be an element of this array.
+	const value_type valCopy(val);
+	grow(used + 1);
+	memConstruct(&ptr[used++], valCopy);
 }
 
 template<class T>
@@ -217,30 +341,39 @@ void Array<T>::popBack()
 {
 	if (used != 0)
 	{
-		--used;
+		memDestroy(&ptr[--used]);
 	}
 }
 
 template<class T>
 void Array<T>::insert(const size_type index, const value_type & val)
 {
-	ps2assert(ptr != nullptr);
 	ps2assert(index <= size());
 
-	if (total <= used)
+	// Copy first, `val` might be an element of this array.
+	const value_type valCopy(val);
+	if (used == total)
+	{
+		grow(used + 1);
+	}
+
+	if (index == used)
 	{
-		reserve(total + 1);
+		memConstruct(&ptr[used++], valCopy);
+		return;
 	}
-	if (index < used)
+
+	// Shift the tail up by one, then assign into the hole.
+	// Local copy of `ptr` so that stores to the elements don't
+	// force the compiler to reload it on every iteration.
+	value_type * const elements = ptr;
+	memConstruct(&elements[used], elements[used - 1]);
+	for (size_type i = used - 1; i > index; --i)
 	{
-		ubyte * bytes = rcast<ubyte *>(ptr);
-		memmove(
-			bytes + (index + 1) * sizeof(T),
-			bytes + (index + 0) * sizeof(T),
-			(used - index) * sizeof(T));
+		elements[i] = elements[i - 1];
 	}
+	elements[index] = valCopy;
 	++used;
-	ptr[index] = val;
 }
 
 template<class T>
@@ -280,9 +413,11 @@ void Array<T>::fill(const value_type & val)
 template<class T>
 void Array<T>::remove(const value_type & val)
 {
+	// Copy first, `val` might be an element of this array.
+	const value_type valCopy(val);
 	for (size_type i = 0; i < used; i++)
 	{
-		if (ptr[i] == val)
+		if (ptr[i] == valCopy)
 		{
 			erase(i);
 		}
@@ -296,11 +431,13 @@ void Array<T>::erase(const size_type index)
 	{
 		return;
 	}
-	if (--used == 0)
+	value_type * const elements = ptr;
+	const size_type count = used;
+	for (size_type i = index + 1; i < count; ++i)
 	{
-		return;
+		elements[i - 1] = elements[i];
 	}
-	memmove(&ptr[index], &ptr[index + 1], used * sizeof(T));
+	memDestroy(&elements[--used]);
 }
 
 template<class T>
@@ -0,0 +1,1320 @@
+// Consolas SDF atlas, generated by tools/sdf_font_gen. Do not edit.
+// Atlas is 256x256 PSMT8, 210 rows in use, glyph cells of 18x30 texels.
+
+static const int SDF_ATLAS_WIDTH   = 256;
+static const int SDF_ATLAS_HEIGHT  = 256;
+static const int SDF_ATLAS_RLE_SIZE = 29263; // Bytes
+static const int SDF_CHAR_START    = 32;
+static const int SDF_CHAR_COUNT    = 96;
+
+// RLE compressed atlas indexes:
+static const uint32 consolasSdfAtlasRle[] __attribute__((aligned(16))) = {
+	0xff00ff00, 0x5200ff00, 0x1d201d12, 0x090a0012, 0x030d100f, 0x0d033500,
+	0x00030d10, 0x100d0309, 0x6c00030d, 0x201f1809, 0x0009181f, 0x1f180909,
+	0x1f1d2020, 0x121d2020, 0x2c171c00, 0x2c3c403c, 0x09070017, 0x302f2719,
+	0x0912202c, 0x1d201f18, 0x09060012, 0x20201f18, 0x00121d20, 0x1f18090b,
+	0x121d2020, 0x1f0b0d00, 0x1f2c302c, 0x0b07000b, 0x2c302c1f, 0x0e000b1f,
+	0x1f201d12, 0x56000918, 0x3f352209, 0x22353f40, 0x09070009, 0x403f3522,
+	0x403f3c40, 0x162c3c40, 0x18090700, 0x12181f1f, 0x121d201d, 0x13030800,
+	0x6059442c, 0x122c4459, 0x220b0500, 0x504f4335, 0x222c3c4b, 0x3c403f35,
+	0x0400162c, 0x3f35220b, 0x3c404040, 0x0900172c, 0x3f352209, 0x2c3c4040,
+	0x0b0b0016, 0x504b3822, 0x0922384b, 0x22090500, 0x4b504b38, 0x000b2238,
+	0x170d030a, 0x3f403c2c, 0x030e2235, 0x35185400, 0x5e605e4f, 0x0018354f,
+	0x4f351807, 0x5960605e, 0x5960605e, 0x00092743, 0x35220905, 0x2c353f3f,
+	0x2c3c403c, 0x0b060017, 0x593c2c1f, 0x59708070, 0x000b213c, 0x38220903,
+	0x706d5f4f, 0x38445966, 0x59605e4f, 0x00092743, 0x38220b02, 0x60605e4f,
+	0x2d445960, 0x18080017, 0x605e4f35, 0x27435960, 0x04090009, 0x654f381f,
+	0x354f6570, 0x18050018, 0x70654f35, 0x22384f65, 0x0b08000b, 0x43312c1f,
+	0x4f5e6059, 0x0b1f2c37, 0x3f1f5300, 0x7a807a5e, 0x001f3f5e, 0x5e3f1f07,
+	0x6d80807a, 0x6d80807a, 0x000f2f4f, 0x4f351805, 0x444f5e5e, 0x44596059,
+	0x0400122c, 0x4b38220b, 0x91806352, 0x384b6080, 0x0200031f, 0x654f3519,
+	0x808e867a, 0x654f5970, 0x4f6d807a, 0x01000f2f, 0x4f381f03, 0x80807a65,
+	0x445a7080, 0x0700122c, 0x7a5e3f1f, 0x4f6d8080, 0x09000f2f, 0x654b2f17,
+	0x5e7a8b7a, 0x05001f3f, 0x7a5e3f1f, 0x4f657a8b, 0x00041f38, 0x381f0306,
+	0x6d52504b, 0x4f5e7a80, 0x0922384b, 0x40205200, 0x80988060, 0x00204060,
+	0x60402007, 0x70909b80, 0x70909b80, 0x00103050, 0x3f210504, 0x657a7a5e,
+	0x70807059, 0x001d3c59, 0x38220903, 0x7a70654f, 0x707a9386, 0x0d2c4b65,
+	0x43270200, 0x868d7a5f, 0x61809386, 0x808d7a5f, 0x0d2c4b66, 0x2e120100,
+	0x907a654b, 0x86949092, 0x1d3c5970, 0x40200700, 0x909b8060, 0x10305070,
+	0x2c120800, 0x8e725a44, 0x3f5e7a90, 0x1d05001f, 0x8670593c, 0x4b657a8d,
+	0x0600162f, 0x654b2c0d, 0x8e706570, 0x656d6580, 0x0018354f, 0x1f180907,
+	0x09181f20, 0x40204400, 0x80988060, 0x00204060, 0x60402007, 0x6e869980,
+	0x6d869980, 0x000f2f4f, 0x2f1f0b03, 0x8e80664b, 0x91806070, 0x23406080,
+	0x1902000b, 0x7a654f35, 0xa19d928e, 0x50708c92, 0x02001030, 0x866d4f2f,
+	0x90727290, 0x86706d86, 0x3c597086, 0x01000320, 0x72593c1d, 0x727a908e,
+	0x60809786, 0x07002040, 0x80604020, 0x4f6d8699, 0x07000f2f, 0x593c2003,
+	0x7a8d8670, 0x18354f65, 0x2c120500, 0x8e725a44, 0x435a728e, 0x05000a27,
+	0x70503010, 0x88747a8a, 0x7a867a75, 0x001f3f5e, 0x35220906, 0x353f403f,
+	0x43000922, 0x80604020, 0x40608098, 0x20070020, 0x98806040, 0x98806880,
+	0x27446180, 0x03020009, 0x544b381f, 0x6d868e70, 0x72908060, 0x1f384b5b,
+	0x43270903, 0x90907a5f, 0x80939380, 0x30507084, 0x30020010, 0x908e7050,
+	0x8e907070, 0x7a8f8072, 0x122c445f, 0x40200200, 0x80968060, 0x98806166,
+	0x20406080, 0x40200700, 0x80988060, 0x09274461, 0x2e120700, 0x9380664b,
+	0x384f6680, 0x06000922, 0x654b2f17, 0x6d868f7a, 0x00193551, 0x4f2f0f05,
+	0x868b866d, 0x868b808b, 0x1f3f5e7a, 0x35180600, 0x5e605e4f, 0x0018354f,
+	0x60402043, 0x60809880, 0x07002040, 0x80604020, 0x80688096, 0x40608096,
+	0x0d030020, 0x70654b2c, 0x70809074, 0x74908070, 0x2c4b6570, 0x4f2f0f0d,
+	0x7a92866d, 0x708e9072, 0x2c4b656d, 0x2c02000d, 0x8f80664b, 0x808f7a7a,
+	0x6d868d7a, 0x00193551, 0x60402003, 0x6d869780, 0x80968067, 0x03204060,
+	0x40200600, 0x80968060, 0x00204060, 0x593c1d08, 0x728e8e72, 0x0b223c59,
+	0x1f040700, 0x866d5138, 0x435f7a92, 0x04000927, 0x5a432709, 0x9a867a6d,
+	0x5f6d7a86, 0x0018354f, 0x3f1f0305, 0x7a807a5e, 0x031f3f5e, 0x0d031a00,
+	0x10101010, 0x00090f10, 0x6040201f, 0x60809880, 0x07002040, 0x70593c1d,
+	0x70637a80, 0x3f5e7a80, 0x1003001f, 0x8c705030, 0x90939b90, 0x909b9390,
+	0x3050708c, 0x50301010, 0x72908e70, 0x66809070, 0x1f384b51, 0x20020003,
+	0x8c72593c, 0x75868b8f, 0x5a728e86, 0x000a2743, 0x593c1d03, 0x7a938e72,
+	0x70868d80, 0x172c4159, 0x3c1d0600, 0x7a807059, 0x001f3f5e, 0x44270907,
+	0x80968061, 0x122e4b66, 0x270c0900, 0x927a5f43, 0x2f4f6d86, 0x0d04000f,
+	0x7a654b2c, 0x8a958b86, 0x596d7a86, 0x03001d3c, 0x241f1809, 0x98806040,
+	0x24406080, 0x0009181f, 0x2c1f0b17, 0x30303030, 0x16272f30, 0x40201e00,
+	0x80988060, 0x00204060, 0x442c1207, 0x4f5e6059, 0x4f5e6059, 0x03001835,
+	0x6d4f2f0f, 0x86938080, 0x93938080, 0x4f6d8080, 0x2c0d0f2f, 0x9480664b,
+	0x80907c86, 0x2c3c4b61, 0x12030017, 0x72654b2e, 0x80717a80, 0x4b657a8f,
+	0x00091d31, 0x4b321803, 0x93937a65, 0x6370868f, 0x2c445960, 0x12050012,
+	0x6059442c, 0x18354f5e, 0x2f0f0700, 0x92866d4f, 0x213f5e7a, 0x190a0003,
+	0x90705235, 0x31507090, 0x10040013, 0x8b705030, 0x76887c86, 0x60808b86,
+	0x02002040, 0x3f352209, 0x80604440, 0x44608098, 0x22353f40, 0x09150009,
+	0x504b3822, 0x50505050, 0x162d434f, 0x40201d00, 0x80988060, 0x00204060,
+	0x3c2c1708, 0x3c353f40, 0x22353f40, 0x0d030009, 0x61594329, 0x64809070,
+	0x708e9070, 0x27435960, 0x3c200309, 0x92867059, 0x72869892, 0x2c445966,
+	0x03020012, 0x594b381f, 0x8d7a6460, 0x4f566d86, 0x09223543, 0x270a0100,
+	0x80705a43, 0x70809c92, 0x70807a63, 0x001d3c59, 0x3c2c1706, 0x22353f40,
+	0x10070009, 0x90705030, 0x35527090, 0x0f0b0018, 0x866d4f2f, 0x3c597290,
+	0x0f04001d, 0x806d4f2f, 0x7a8a7070, 0x59707a6e, 0x02001d3c, 0x5e4f3518,
+	0x80646060, 0x60648098, 0x354f5e60, 0x18150018, 0x70654f35, 0x70707070,
+	0x27435a6d, 0x201c0009, 0x98806040, 0x20406080, 0x1d120900, 0x1d181f20,
+	0x09181f20, 0x35180400, 0x7a635e4f, 0x70648092, 0x5e698090, 0x001b364f,
+	0x442c1202, 0x867a6d5a, 0x808e979d, 0x203c5970, 0x0b020003, 0x52412e1f,
+	0x758e866d, 0x5f6d7070, 0x0019354f, 0x51351801, 0x8694866d, 0x697a8f86,
+	0x60809680, 0x07002040, 0x1f201d12, 0x08000918, 0x70503010, 0x50709090,
+	0x0b001030, 0x61442709, 0x60809680, 0x04002040, 0x59432709, 0x8c705b60,
+	0x595e6180, 0x00122c44, 0x5e3f1f02, 0x8080807a, 0x80869a86, 0x5e7a8080,
+	0x06001f3f, 0x201f1809, 0x0009181f, 0x5e3f1f08, 0x90908e7a, 0x6d869090,
+	0x000f2f4f, 0x6040201c, 0x60809880, 0x17002040, 0x7a5e3f1f, 0x869a8680,
+	0x86938080, 0x3f5e7a80, 0x1703001f, 0x6351432d, 0x8e809280, 0x4b668093,
+	0x03000d2c, 0x654b2f16, 0x7a7a8b7a, 0x7a86908e, 0x0927435f, 0x7a5e3f1f,
+	0x7a708692, 0x867a9090, 0x3f5e7a92, 0x1015001f, 0x90705030, 0x30507090,
+	0x040b0010, 0x80604022, 0x40608098, 0x16050020, 0x4b403c2c, 0x596d7065,
+	0x172c3c42, 0x40200300, 0x90908060, 0x93a19390, 0x80909090, 0x00204060,
+	0x35220b05, 0x353f403f, 0x07000b22, 0x80604020, 0x90909090, 0x50708c90,
+	0x1c001030, 0x80604020, 0x40608090, 0x20170020, 0x90806040, 0x90909b93,
+	0x90939e92, 0x20406080, 0x1f0b0200, 0x6144332c, 0x74729080, 0x50708e90,
+	0x02001030, 0x5a43270c, 0x7c868b72, 0x8f80868d, 0x2f4f6d86, 0x6040200f,
+	0x61809880, 0x86927a65, 0x52709093, 0x15001835, 0x70503010, 0x50709090,
+	0x0b001331, 0x664b2c0d, 0x60809680, 0x06002040, 0x38231d12, 0x434f504b,
+	0x00121d2c, 0x593c1d04, 0x7070706d, 0x70809880, 0x596d7070, 0x04001d3c,
+	0x4f381f03, 0x4f5e605e, 0x00031f38, 0x593c1d06, 0x7070706d, 0x65707070,
+	0x000d2c4b, 0x3e21031b, 0x70787059, 0x03213e59, 0x3c1d1600, 0x80706d59,
+	0x80707490, 0x6d708098, 0x001d3c59, 0x381f0301, 0x6d53504b, 0x70709086,
+	0x50709090, 0x01001030, 0x51381f03, 0x728b866d, 0x67729080, 0x50709080,
+	0x40201030, 0x80988060, 0x866d5561, 0x6d869e98, 0x00102f4f, 0x50301015,
+	0x72908e70, 0x001d3c59, 0x5031130b, 0x72908e70, 0x001d3c59, 0x2c1f0b08,
+	0x16272f30, 0x12050001, 0x504f432c, 0x98806050, 0x50506080, 0x122c434f,
+	0x2c0d0400, 0x807a654b, 0x2e4b657a, 0x12060012, 0x504f432c, 0x50505050,
+	0x1f384b50, 0x0d1b0003, 0x7a654b2c, 0x4b657a8b, 0x16000d2c, 0x50432c12,
+	0x70908061, 0x80988060, 0x2c434f60, 0x0d010012, 0x70654b2c, 0x90907470,
+	0x86927a74, 0x0f2f4f6d, 0x2e120100, 0x8b7a654b, 0x9080697a, 0x90806772,
+	0x10305070, 0x80604020, 0x66728697, 0xa0907666, 0x384f6680, 0x1400031f,
+	0x664b2c0d, 0x61809680, 0x000a2744, 0x593c1d0a, 0x708e9072, 0x00133150,
+	0x100d0309, 0x0800090f, 0x302f2716, 0x98806040, 0x30406080, 0x0016272f,
+	0x50301005, 0x8e9f8e70, 0x1d3c5972, 0x27160700, 0x3030302f, 0x2c303030,
+	0x1c000b1f, 0x70503010, 0x708e9e8b, 0x00103050, 0x4f301717, 0x7090866d,
+	0x7a928060, 0x16283f5e, 0x30100200, 0x908c7050, 0x909b9b90, 0x5f7a868f,
+	0x00092743, 0x593c1d01, 0x6d868e72, 0x868f7a5f, 0x6d868d80, 0x1d0f2f4f,
+	0x8670593c, 0x80808e95, 0x90938f8e, 0x2c4b657a, 0x0314000d, 0x7a5e3f21,
+	0x516d8692, 0x09001935, 0x61452c12, 0x66809380, 0x000d2c4b, 0x200f0917,
+	0x90806040, 0x20406080, 0x0600090f, 0x6d4f2f0f, 0x809aa186, 0x00204060,
+	0x100f0908, 0x10101010, 0x00030d10, 0x4b2c0d1d, 0x868e7a65, 0x0f2f4f6d,
+	0x2f0f1700, 0x86866d4f, 0x8c80606d, 0x18355270, 0x2f0f0300, 0x86806d4f,
+	0x86939b90, 0x4f5f7080, 0x02001935, 0x80604020, 0x515f7a8b, 0x908e806d,
+	0x435a7086, 0x2c120927, 0x86705a44, 0x86909090, 0x8a8e7a7a, 0x10305070,
+	0x35181500, 0x92866d51, 0x2c445f7a, 0x0b070012, 0x70593c22, 0x59728e86,
+	0x0003203c, 0x593c1d19, 0x596d706d, 0x07001d3c, 0x432f1f0b, 0x9a937a5f,
+	0x20406080, 0x1f032f00, 0x70654f38, 0x27435a6d, 0x09170009, 0x6d5a4327,
+	0x6d595a6d, 0x2c4b6570, 0x0903000d, 0x61594327, 0x80927c6d, 0x4459616d,
+	0x00092235, 0x593c1d02, 0x4f65706d, 0x70665943, 0x445a6d70, 0x0200162d,
+	0x5a442d17, 0x7070706d, 0x70655f6d, 0x2c4b6570, 0x0a15000d, 0x7a5f4327,
+	0x59708692, 0x0009223c, 0x38220905, 0x9380664f, 0x2e4b6680, 0x121a0012,
+	0x504f432c, 0x122c434f, 0x1f030600, 0x5f524b38, 0x728e9072, 0x001d3c59,
+	0x38220b30, 0x434f504b, 0x1900162d, 0x4f432d16, 0x4f43434f, 0x1f384b50,
+	0x16040003, 0x60463c2c, 0x60809080, 0x192c3c46, 0x12030009, 0x504f432c,
+	0x3c2c384b, 0x4f50504b, 0x00172d43, 0x432d1704, 0x5050504f, 0x504b434f,
+	0x1f384b50, 0x19160003, 0x866d5135, 0x4f668094, 0x05001835, 0x654f3518,
+	0x70868d7a, 0x03203c59, 0x27161b00, 0x272f302f, 0x0d070016, 0x70654b2c,
+	0x7a8d867a, 0x122e4b65, 0x1f0b3100, 0x272f302c, 0x161b0016, 0x272f2f27,
+	0x2c302f27, 0x06000b1f, 0x593c2012, 0x596d706d, 0x0012203c, 0x2f271606,
+	0x131f2c30, 0x30302c20, 0x0016272f, 0x2f271606, 0x2f303030, 0x30302c27,
+	0x000b1f2c, 0x43270a17, 0x8d86705a, 0x1f3f5e7a, 0x3f1f0500, 0x8e907a5e,
+	0x2c445a72, 0x091d0012, 0x090f100f, 0x30100800, 0x8b8a7050, 0x4f657a8e,
+	0x00031f38, 0x100d0332, 0x1d00090f, 0x090f0f09, 0x0d100f09, 0x12080003,
+	0x504f432c, 0x122c434f, 0x0f090800, 0x00030d10, 0x100d0301, 0x00090f10,
+	0x100f0908, 0x090f1010, 0x0d10100d, 0x16190003, 0x705a442d, 0x3f5e7a86,
+	0x1d05001f, 0x8670593c, 0x2f4b657a, 0x0d2b0017, 0x7a654b2c, 0x4f65707a,
+	0x000b2238, 0x2f271667, 0x16272f30, 0x2d174300, 0x656d5a44, 0x0018354f,
+	0x442c1205, 0x4f656d5a, 0x00041f38, 0x381f032b, 0x525e5e4f, 0x0b22384b,
+	0x0f096900, 0x00090f10, 0x432d1745, 0x22384b4f, 0x17060009, 0x4b4f432d,
+	0x000b2238, 0x35220b2d, 0x2c353f3f, 0xb5000b1f, 0x2c2f2716, 0x08000b1f,
+	0x2c2f2716, 0x2f000b1f, 0x1f1f1809, 0x00030d18, 0x0d0f09b7, 0x090a0003,
+	0x00030d0f, 0x00ff00ff, 0x00ff00ff, 0x201d1274, 0x0009181f, 0x3c2c17f9,
+	0x22353f40, 0x12070009, 0x2020201d, 0x000a181f, 0x1f180a0b, 0x00121d20,
+	0x1f180a0a, 0x1d202020, 0x08000312, 0x201f1809, 0x1d202020, 0x0c000312,
+	0x20201d12, 0x0009181f, 0x201d1207, 0x20202020, 0x09181f20, 0x0d030a00,
+	0x20201f18, 0x0600121d, 0x201f1809, 0x20202020, 0x1d202020, 0x03070012,
+	0x20201d12, 0x121d2020, 0x09080003, 0x20201f18, 0x09181f20, 0x2c124600,
+	0x5e605944, 0x0018354f, 0x2c190905, 0x4040403c, 0x1627353f, 0x190a0800,
+	0x403f3527, 0x00162c3c, 0x35271608, 0x4040403f, 0x0b1f2e3c, 0x220b0600,
+	0x40403f35, 0x2e3c4040, 0x0a000b1f, 0x403c2c17, 0x22353f40, 0x16050009,
+	0x40403c2c, 0x40404040, 0x0b22353f, 0x20120800, 0x403f352c, 0x172c3c40,
+	0x220b0400, 0x40403f35, 0x40404040, 0x2c3c4040, 0x0b050016, 0x403c2e1f,
+	0x3c404040, 0x000b1f2e, 0x35220b06, 0x4040403f, 0x0b22353f, 0x20034400,
+	0x8070593c, 0x1f3f5e7a, 0x22090400, 0x60594435, 0x515e6060, 0x00172d43,
+	0x27190905, 0x5e514335, 0x27435960, 0x17060009, 0x5e51432d, 0x59606060,
+	0x0b22384b, 0x1f030400, 0x605e4f38, 0x59606060, 0x0b22384b, 0x2c120800,
+	0x60605944, 0x18354f5e, 0x27090400, 0x60605943, 0x60606060, 0x1f384f5e,
+	0x17060003, 0x524b3c2c, 0x5960605e, 0x00122c44, 0x381f0302, 0x60605e4f,
+	0x60606060, 0x43596060, 0x03000927, 0x4b38220b, 0x60606059, 0x384b5960,
+	0x04000b22, 0x4f38220b, 0x6060605e, 0x22384f5e, 0x0d43000b, 0x80664b2c,
+	0x3f5e7a8f, 0x1904001f, 0x705f4f35, 0x7a808080, 0x2c445a6d, 0x09030012,
+	0x51433522, 0x807a6d5f, 0x0f2f4f6d, 0x2c120500, 0x7a6d5a44, 0x72808080,
+	0x1f384f65, 0x0d030003, 0x7a654b2c, 0x80808080, 0x384f6572, 0x0600031f,
+	0x593c2209, 0x7a808070, 0x001f3f5e, 0x4f2f0f04, 0x8080806d, 0x7a808080,
+	0x0d2c4b65, 0x2d170500, 0x70665944, 0x7080807a, 0x001d3c59, 0x4b2c0d02,
+	0x80807a65, 0x80808080, 0x4f6d8080, 0x02000f2f, 0x4f382209, 0x80807265,
+	0x65728080, 0x031f384f, 0x220b0200, 0x7a654f38, 0x7a808080, 0x22384f65,
+	0x09070009, 0x1f201f18, 0x0c000918, 0x1f201d12, 0x22000918, 0x70523519,
+	0x52708e8e, 0x03001835, 0x5f442c12, 0x9093867a, 0x70869292, 0x03203c59,
+	0x35180200, 0x7a6d5f4f, 0x70909386, 0x00103050, 0x593c1d05, 0x908f8670,
+	0x7a8e9490, 0x0d2c4b65, 0x30100300, 0x928e7050, 0x8e939090, 0x2e4b657a,
+	0x19060012, 0x80664f35, 0x60809c99, 0x04002040, 0x70503010, 0x98989c90,
+	0x708b9898, 0x00103050, 0x442d1604, 0x8e80705a, 0x80939892, 0x00204060,
+	0x50301002, 0x98988b70, 0x98989898, 0x5070909c, 0x02001030, 0x654f3518,
+	0x908f8e7a, 0x7a8e9390, 0x0d2c4b65, 0x1f030100, 0x7a654f38, 0x9290928f,
+	0x4f657a8f, 0x06001935, 0x3f35220b, 0x22353f40, 0x170a000b, 0x3f403c2c,
+	0x000b2235, 0x43270920, 0x808f7a5f, 0x0d2c4b66, 0x3c1d0300, 0x8f867059,
+	0x867a7280, 0x4b668094, 0x0200122e, 0x7a5e3f1f, 0x93868f86, 0x30507090,
+	0x1f050010, 0x8b7a5e3f, 0x86727280, 0x52708e98, 0x03001835, 0x6d4f2f0f,
+	0x72707a80, 0x728e9080, 0x001d3c59, 0x442c1205, 0x938d7a5f, 0x4060809c,
+	0x10040020, 0x90705030, 0x80808093, 0x4b657a80, 0x03000d2c, 0x5a43270a,
+	0x868f8670, 0x70808080, 0x001d3c59, 0x4b2c0d02, 0x80807a65, 0x80808080,
+	0x50708e93, 0x02001030, 0x7a5e3f1f, 0x707a868f, 0x8e938072, 0x10305070,
+	0x2c0d0100, 0x8d7a654b, 0x7a707a86, 0x5f7a8f86, 0x00092743, 0x381f0304,
+	0x5e605e4f, 0x031f384f, 0x2d160800, 0x5e605944, 0x0922384f, 0x30121f00,
+	0x90866d4f, 0x203c5972, 0x09020003, 0x80614427, 0x59678093, 0x8e90725f,
+	0x1d3c5972, 0x40200200, 0x808f8060, 0x70909076, 0x00103050, 0x4f351805,
+	0x59667065, 0x9390725a, 0x1f3f5e7a, 0x27090300, 0x5e605943, 0x80675952,
+	0x40608096, 0x09040020, 0x70593c22, 0x98808e86, 0x20406080, 0x30100400,
+	0x90907050, 0x60606070, 0x1f384f5e, 0x18030003, 0x866d5135, 0x616d7a8d,
+	0x44596060, 0x0200122c, 0x4f381f03, 0x6060605e, 0x93806960, 0x2c4b6680,
+	0x2002000d, 0x98806040, 0x59526380, 0x70909070, 0x00103050, 0x50301001,
+	0x72908e70, 0x7a61555f, 0x4f6d8692, 0x04000f2f, 0x654b2c0d, 0x657a807a,
+	0x000d2c4b, 0x43270907, 0x7a80705a, 0x18354f65, 0x20031e00, 0x9072593c,
+	0x304f6d86, 0x0f030012, 0x866d4f2f, 0x59597290, 0x9a937a66, 0x20406080,
+	0x3f1f0200, 0x667a7a5e, 0x70909070, 0x00103050, 0x38220905, 0x3e4b504b,
+	0x9f907050, 0x20406080, 0x2c160400, 0x504f493c, 0x92806652, 0x1f3f5e7a,
+	0x35190400, 0x8f80664f, 0x8098807a, 0x00204060, 0x50301004, 0x70909070,
+	0x454d5054, 0x000b2237, 0x5e3f1f04, 0x6880927a, 0x525e6061, 0x051c3346,
+	0x220b0300, 0x40403f35, 0x8e725944, 0x3c59728e, 0x02000320, 0x80604020,
+	0x5a6d8096, 0x8e90725f, 0x10305070, 0x30100100, 0x90907050, 0x523c5070,
+	0x70909070, 0x00103050, 0x50301004, 0x8e9f8e70, 0x10305070, 0x2f0f0700,
+	0x9a866d4f, 0x3f5e7a90, 0x0d1e001f, 0x80664b2c, 0x435f7a8f, 0x03000927,
+	0x70503010, 0x5c709090, 0x9d8f8070, 0x4060809f, 0x18020020, 0x5e5e4f35,
+	0x90907056, 0x10305070, 0x1f0b0600, 0x382f302c, 0x93907052, 0x1f3f5e7a,
+	0x27090400, 0x706d5a43, 0x868d7a70, 0x1835516d, 0x270c0300, 0x8f7a5f43,
+	0x98806e86, 0x20406080, 0x10030002, 0x90705030, 0x70707490, 0x2d445966,
+	0x09030017, 0x80614427, 0x80727c92, 0x5a6d7a80, 0x00162d44, 0x1f180904,
+	0x664b2f21, 0x66809380, 0x00122e4b, 0x593c1d03, 0x86928e72, 0x8d867a72,
+	0x2c4b657a, 0x1001000d, 0x90705030, 0x50557090, 0x90907055, 0x10305070,
+	0x30100400, 0x9f8e7050, 0x3050708e, 0x0f070010, 0x866d4f2f, 0x5e7a909a,
+	0x1e001f3f, 0x70523519, 0x52708e8e, 0x04001935, 0x70503010, 0x72729090,
+	0x86869486, 0x40608099, 0x09020020, 0x403f3522, 0x90907050, 0x10305070,
+	0x0e030700, 0x654f351c, 0x6d86927a, 0x00183551, 0x4f2f0f04, 0x9090866d,
+	0x5f758692, 0x00162f48, 0x381f0302, 0x8f866d51, 0x9880677a, 0x28406080,
+	0x10030016, 0x90705030, 0x8e909097, 0x445a7080, 0x0200122c, 0x6d4f2f0f,
+	0x90869386, 0x86929896, 0x27435a70, 0x0705000a, 0x72593c20, 0x59728e8e,
+	0x0003203c, 0x4b2e1203, 0x98867a65, 0x7a929390, 0x1f384f65, 0x0f010003,
+	0x866d4f2f, 0x70707a92, 0x90937a70, 0x10305070, 0x2c0d0400, 0x807a654b,
+	0x2c4b657a, 0x0907000d, 0x705a4327, 0x4f657a80, 0x0e001835, 0x1d201d12,
+	0x09000312, 0x5f43270a, 0x66808f7a, 0x000d2c4b, 0x50301004, 0x7c909070,
+	0x71868f8e, 0x60809880, 0x03002040, 0x301f1809, 0x90907050, 0x10305070,
+	0x2d170800, 0x907a5f44, 0x435f7a90, 0x04000a27, 0x6d4f2f0f, 0x90909086,
+	0x5a70868f, 0x00092743, 0x4b2e1201, 0x808f7a65, 0x98806166, 0x434f6080,
+	0x0200162d, 0x6d4f2f0f, 0x80808080, 0x7086948e, 0x001d3c59, 0x50301002,
+	0x869b9070, 0x86808080, 0x516d8695, 0x05001835, 0x664b2e12, 0x66809380,
+	0x00122e4b, 0x442c1204, 0x9886705a, 0x86989a90, 0x27435a70, 0x0901000a,
+	0x7a5f4327, 0x90909290, 0x90a19290, 0x10305070, 0x1f030400, 0x605e4f38,
+	0x1f384f5e, 0x16080003, 0x6059442d, 0x22384f5e, 0x170d0009, 0x3c403c2c,
+	0x000b1f2e, 0x51351808, 0x728e866d, 0x03203c59, 0x30100400, 0x9b907050,
+	0x6d7a8e8f, 0x80988064, 0x00204060, 0x30130604, 0x90907050, 0x12305070,
+	0x2d170700, 0x86705a44, 0x4f657a8f, 0x05001935, 0x5a432709, 0x7270706d,
+	0x6d868f80, 0x000f2f4f, 0x593c1d01, 0x76868e72, 0x98807070, 0x5a6d7080,
+	0x00092743, 0x43270901, 0x60606059, 0x97867266, 0x20406080, 0x30100200,
+	0x90907050, 0x61606172, 0x7a928670, 0x001f3f5e, 0x3c200304, 0x908e7259,
+	0x203c5972, 0x03030003, 0x70593c20, 0x75869586, 0x86989080, 0x1835516d,
+	0x35190200, 0x807a654f, 0x8086908e, 0x50709093, 0x05001030, 0x3f35220b,
+	0x22353f40, 0x0609000b, 0x4843331c, 0x11283c47, 0x2d160d00, 0x59605944,
+	0x031f384b, 0x21030600, 0x927a5e3f, 0x2e4b6680, 0x10050012, 0x90705030,
+	0x657286a0, 0x96806153, 0x20406080, 0x1f0b0300, 0x7050342c, 0x50709090,
+	0x00162734, 0x442d1705, 0x8d86705a, 0x3b4f657a, 0x000b1f2e, 0x33210b04,
+	0x50504f43, 0x90907059, 0x10305070, 0x40200100, 0x939a8060, 0x93909090,
+	0x869093a1, 0x0f2f4f6d, 0x2c160200, 0x4040403c, 0x9880614b, 0x20406080,
+	0x30100200, 0x908e7050, 0x46445972, 0x80988061, 0x00204060, 0x4b2e1204,
+	0x86978066, 0x12304f6d, 0x2c0d0400, 0x9780664b, 0x665e7086, 0x7a93937a,
+	0x001f3f5e, 0x38220902, 0x70665e4f, 0x90726d70, 0x2f4f6d86, 0x1605000f,
+	0x504f432d, 0x162d434f, 0x2d160900, 0x5e605944, 0x0922384f, 0x27090b00,
+	0x80705a43, 0x2e4b6572, 0x12060012, 0x80664b2e, 0x3f5e7a92, 0x05000321,
+	0x6d4f2f0f, 0x61809986, 0x866d5352, 0x3c597290, 0x0902001d, 0x504b3822,
+	0x90907054, 0x434f5470, 0x0300162d, 0x5a442c12, 0x7a8d8670, 0x50505665,
+	0x031f384b, 0x22090200, 0x444f4b38, 0x70554b40, 0x50709090, 0x01001030,
+	0x80604020, 0x90909090, 0x93a19390, 0x4f6d8690, 0x01000f2f, 0x4b382209,
+	0x4f44444f, 0x80968061, 0x00204060, 0x4b2c0d02, 0x80968066, 0x664d4b61,
+	0x5e7a9280, 0x04001f3f, 0x72593c1d, 0x5f7a938e, 0x00092743, 0x50301004,
+	0x809c8e70, 0x70544b61, 0x60809f90, 0x02002040, 0x4b382209, 0x60595550,
+	0x7a8f806d, 0x0927435f, 0x27090400, 0x706d5a43, 0x27435a6d, 0x09070009,
+	0x705a4327, 0x4f657a80, 0x0b001835, 0x6d4f2f0f, 0x728c9586, 0x001d3c59,
+	0x593c1d06, 0x6d868e72, 0x00183551, 0x43270906, 0x86927a5f, 0x7a6d6672,
+	0x4f6d868f, 0x02001230, 0x654f3518, 0x90747070, 0x6d707490, 0x0927435a,
+	0x3c1d0200, 0x8f867059, 0x7070727c, 0x4b657070, 0x02000d2c, 0x654f3518,
+	0x6660616d, 0x868f7a70, 0x0f2f4f6d, 0x3c1d0100, 0x70706d59, 0x80707070,
+	0x6d708098, 0x0927435a, 0x35180100, 0x616d654f, 0x86726d61, 0x3c59728e,
+	0x0302001d, 0x7a5e3f21, 0x66728692, 0x8e8e7466, 0x18355270, 0x27090300,
+	0x97806144, 0x35516d86, 0x0f050019, 0x866d4f2f, 0x616d8099, 0x93907466,
+	0x1f3f5e7a, 0x35180200, 0x7070654f, 0x8f867a70, 0x35516d86, 0x0f050019,
+	0x866d4f2f, 0x4f6d8690, 0x07000f2f, 0x6d4f2f0f, 0x7a909a86, 0x001f3f5e,
+	0x5030100b, 0x95a79070, 0x20406080, 0x270a0500, 0x93806144, 0x27446180,
+	0x1907000a, 0x866d5135, 0x86808e94, 0x5a728c8f, 0x00092743, 0x5e3f1f02,
+	0x90908e7a, 0x90909b9b, 0x2f4f6d86, 0x2002000f, 0x9a806040, 0x9090909b,
+	0x708c9090, 0x00103050, 0x5e3f1f02, 0x8080867a, 0x868f8e80, 0x27435a70,
+	0x12010009, 0x504f432c, 0x60505050, 0x60809880, 0x162d434f, 0x3f1f0200,
+	0x80867a5e, 0x8d908680, 0x2e4b657a, 0x18030012, 0x866d5135, 0x80808e94,
+	0x657a8d8e, 0x000d2c4b, 0x4f2f0f03, 0x7a92866d, 0x0a27435f, 0x27090500,
+	0x907a5f43, 0x80808692, 0x6d86948e, 0x00183551, 0x5e3f1f02, 0x90908e7a,
+	0x70869292, 0x0a27435a, 0x30100500, 0xa5907050, 0x30507090, 0x0f070010,
+	0x866d4f2f, 0x60809f9b, 0x0b002040, 0x6d4f2f0f, 0x70869086, 0x001d3c59,
+	0x51351805, 0x728e866d, 0x001d3c59, 0x43270a08, 0x8e80705a, 0x72869090,
+	0x162f4b65, 0x3f1f0300, 0x908e7a5e, 0x90909090, 0x4f6d8690, 0x02000f2f,
+	0x80604020, 0x90909090, 0x8c909090, 0x10305070, 0x3f1f0200, 0x908e7a5e,
+	0x808e9090, 0x2d445a70, 0x16030016, 0x30302f27, 0x7a5e3f30, 0x4060808e,
+	0x03001628, 0x7a5e3f1f, 0x9090908e, 0x4f657a86, 0x00031f38, 0x43270a03,
+	0x8e80705a, 0x7a869090, 0x1f384f65, 0x10030003, 0x8c705030, 0x35516d86,
+	0x19070019, 0x7a654f35, 0x90909086, 0x5a70808e, 0x000a2743, 0x5e3f1f02,
+	0x86908e7a, 0x5a6d7a80, 0x00162d44, 0x4f2f0f06, 0x8690866d, 0x0f2f4f6d,
+	0x2c160700, 0x90725a43, 0x4060809f, 0x090b0020, 0x6d5a4327, 0x445a6d70,
+	0x0500122c, 0x7a5e3f1f, 0x4b668092, 0x0900122e, 0x59442d16, 0x70707066,
+	0x384b5a6d, 0x0300041f, 0x654f3518, 0x70707070, 0x6d707070, 0x0927435a,
+	0x3c1d0200, 0x70706d59, 0x70707070, 0x4b657070, 0x02000d2c, 0x654f3518,
+	0x70707070, 0x44596670, 0x0500172d, 0x10100f09, 0x654f3519, 0x3c596d70,
+	0x1804001d, 0x70654f35, 0x6d707070, 0x22384f5f, 0x1605000b, 0x6659442d,
+	0x6d707070, 0x22384f5f, 0x0d04000b, 0x70654b2c, 0x27435a6d, 0x0907000a,
+	0x5f4f3822, 0x7070706d, 0x44596670, 0x0300162d, 0x654f3518, 0x616d7070,
+	0x2d43515e, 0x09070017, 0x6d5a4327, 0x435a6d70, 0x06000927, 0x4f432c12,
+	0x9390725a, 0x1f3f5e7a, 0x2d160c00, 0x4f504f43, 0x00172d43, 0x60402006,
+	0x5e7a8e80, 0x0003213f, 0x3c2c170a, 0x5050504b, 0x1f2f434f, 0x0904000b,
+	0x504b3822, 0x50505050, 0x434f5050, 0x0300162d, 0x4f432c12, 0x50505050,
+	0x50505050, 0x031f384b, 0x22090200, 0x50504b38, 0x4b505050, 0x00172c3c,
+	0x3822090a, 0x434f504b, 0x0400122c, 0x4b382209, 0x50505050, 0x2235434f,
+	0x1707000b, 0x504b3c2c, 0x434f5050, 0x000b2235, 0x381f0305, 0x434f504b,
+	0x0900162d, 0x4335220b, 0x5050504f, 0x2c3c4b50, 0x09040017, 0x504b3822,
+	0x3f444f50, 0x00162735, 0x432d1609, 0x434f504f, 0x0700162d, 0x6d593c1d,
+	0x86948672, 0x1835516d, 0x27160d00, 0x272f302f, 0x1d070016, 0x706d593c,
+	0x18354f65, 0x20120c00, 0x3030302c, 0x0416272f, 0x1f0b0600, 0x3030302c,
+	0x30303030, 0x0016272f, 0x2f271605, 0x30303030, 0x30303030, 0x000b1f2c,
+	0x2c1f0b04, 0x30303030, 0x12202c30, 0x1f0b0c00, 0x272f302c, 0x0b060016,
+	0x30302c1f, 0x272f3030, 0x09000919, 0x302c2012, 0x272f3030, 0x07000919,
+	0x302c1f0b, 0x0016272f, 0x2719090b, 0x3030302f, 0x12202c30, 0x1f0b0600,
+	0x2f30302c, 0x0a181f27, 0x27160b00, 0x272f302f, 0x20080016, 0x8a806040,
+	0x5a70808b, 0x000a2743, 0x100f090e, 0x0800090f, 0x4f432c12, 0x22384b50,
+	0x030d0009, 0x1010100d, 0x0900090f, 0x10100d03, 0x10101010, 0x00090f10,
+	0x100f0907, 0x10101010, 0x0d101010, 0x03060003, 0x1010100d, 0x030d1010,
+	0x0d030e00, 0x00090f10, 0x100d0308, 0x0f101010, 0x030c0009, 0x1010100d,
+	0x0a00090f, 0x0f100d03, 0x090e0009, 0x1010100f, 0x00030d10, 0x100d0308,
+	0x00090f10, 0x100f090f, 0x0900090f, 0x7a5e3f1f, 0x5966707a, 0x00162d44,
+	0x2f27161d, 0x0b1f2c30, 0x3518d100, 0x525e5e4f, 0x172c3c4b, 0x0f091f00,
+	0x00030d10, 0x352209d2, 0x2c353f3f, 0xf8001220, 0x1f1f1809, 0x00030d18,
+	0x00ff00ff, 0x00ff00ff, 0x100f095f, 0xe600030d, 0x20201d12, 0x030d181f,
+	0x1d120b00, 0x2c302f27, 0x00091821, 0x3c2c16e3, 0x353f4040, 0x000b1f2c,
+	0x3c2c1709, 0x4b504f44, 0x0b22353f, 0x18090800, 0x1d20201f, 0x09080012,
+	0x20201f18, 0x1d202020, 0x0a000912, 0x201d1203, 0x1f202020, 0x05000918,
+	0x20201d12, 0x181f2020, 0x0900090f, 0x20201d12, 0x20202020, 0x09181f20,
+	0x1d120600, 0x20202020, 0x1f202020, 0x08000918, 0x201d1203, 0x1f202020,
+	0x05000a18, 0x1f201d12, 0x01000918, 0x201f1809, 0x0600121d, 0x20201d12,
+	0x20202020, 0x09181f20, 0x27093f00, 0x60605943, 0x384b525e, 0x07000b22,
+	0x59442d17, 0x66706d61, 0x22384f5e, 0x0b06000b, 0x403f3522, 0x162c3c40,
+	0x22090600, 0x40403f35, 0x3c404040, 0x00162730, 0x2e201208, 0x4040403c,
+	0x22353f40, 0x1603000b, 0x40403c2c, 0x353f4040, 0x0016272f, 0x3c2c1607,
+	0x40404040, 0x3f404040, 0x00092235, 0x3c2c1604, 0x40404040, 0x3f404040,
+	0x00092235, 0x2e201206, 0x4040403c, 0x27353f40, 0x16030016, 0x3f403c2c,
+	0x22112235, 0x3c403f35, 0x0400162c, 0x403c2c17, 0x40404040, 0x353f4040,
+	0x0f000922, 0x090f0f09, 0x0f091b00, 0x0c00090f, 0x6d4f2f0f, 0x707a8080,
+	0x22384f65, 0x1605000b, 0x705a442d, 0x808e8680, 0x384f657a, 0x0400031f,
+	0x4f381f03, 0x5960605e, 0x000a2743, 0x4f351805, 0x6060605e, 0x4f596060,
+	0x00172d43, 0x3c2c1706, 0x6060594b, 0x4f5e6060, 0x00031f38, 0x43270901,
+	0x60606059, 0x4f525e60, 0x00172d43, 0x43270905, 0x60606059, 0x60606060,
+	0x18354f5e, 0x27090300, 0x60605943, 0x60606060, 0x354f5e60, 0x17050018,
+	0x594b3c2c, 0x60606060, 0x2c43515e, 0x09010012, 0x60594327, 0x26384f5e,
+	0x605e4f38, 0x09274359, 0x2c120200, 0x60605944, 0x60606060, 0x354f5e60,
+	0x090d0018, 0x2f2f2719, 0x19001627, 0x2f2f2716, 0x00091927, 0x5030100a,
+	0x92928c70, 0x4f657a8e, 0x00031f38, 0x43270a03, 0x8f86705a, 0x8d8e8086,
+	0x2c4b657a, 0x0d04000d, 0x7a654b2c, 0x516d8080, 0x05001835, 0x7a5e3f1f,
+	0x80808080, 0x5a6d7280, 0x00122c44, 0x442d1604, 0x80726659, 0x7a808080,
+	0x0d2c4b65, 0x2f0f0100, 0x80806d4f, 0x707a8080, 0x2d445a6d, 0x0f040017,
+	0x806d4f2f, 0x80808080, 0x5e7a8080, 0x03001f3f, 0x6d4f2f0f, 0x80808080,
+	0x7a808080, 0x001f3f5e, 0x442d1704, 0x80726659, 0x7a808080, 0x1d3c596d,
+	0x2f0f0100, 0x7a806d4f, 0x4b344b65, 0x6d807a65, 0x000f2f4f, 0x593c1d02,
+	0x80808070, 0x80808080, 0x1f3f5e7a, 0x220b0c00, 0x4f4f4335, 0x00162d43,
+	0x432d1617, 0x35434f4f, 0x09000b22, 0x654b2c0d, 0x90807a70, 0x4b657a90,
+	0x0300122e, 0x6d513519, 0x6d7a8d86, 0x8e867266, 0x18355270, 0x35180400,
+	0x9f8e7052, 0x3f5e7a93, 0x04000321, 0x80604020, 0x9898999b, 0x70869096,
+	0x03203c59, 0x270a0200, 0x80705a43, 0x9090938e, 0x50708e92, 0x01001030,
+	0x70503010, 0x98989c90, 0x70869092, 0x162d445a, 0x30100300, 0x9c907050,
+	0x98989898, 0x40608098, 0x10030020, 0x90705030, 0x9898989c, 0x60809898,
+	0x03002040, 0x5a442c12, 0x8f8e8070, 0x92929090, 0x20406080, 0x30100100,
+	0x8e907050, 0x50385070, 0x70908e70, 0x00103050, 0x60402002, 0x99989380,
+	0x9898999f, 0x20406080, 0x220c0b00, 0x6d5f4f38, 0x27435a6d, 0x09040009,
+	0x20201f18, 0x20202020, 0x09181f20, 0x27090400, 0x6d6d5a43, 0x22384f5f,
+	0x0308000c, 0x524b381f, 0x937a665e, 0x3c59728e, 0x0a02001d, 0x7a5f4327,
+	0x57657a8b, 0x8b7a5f55, 0x1f3f5e7a, 0x3f1f0400, 0x93937a5e, 0x4b668097,
+	0x04000d2c, 0x80604020, 0x80808699, 0x80978680, 0x0d2c4b66, 0x35180200,
+	0x94866d51, 0x70728086, 0x4f6d807a, 0x01000f2f, 0x70503010, 0x80809390,
+	0x868f8680, 0x27435a70, 0x10020009, 0x90705030, 0x80808093, 0x5e7a8080,
+	0x03001f3f, 0x70503010, 0x80809390, 0x7a808080, 0x001f3f5e, 0x3c200302,
+	0x94867059, 0x70707a86, 0x5e7a807a, 0x01001f3f, 0x70503010, 0x50709090,
+	0x90705038, 0x30507090, 0x1d020010, 0x8070593c, 0x869a8680, 0x5e7a8080,
+	0x0a001f3f, 0x4f382716, 0x86867a65, 0x0f2f4f6d, 0x220b0300, 0x40403f35,
+	0x40404040, 0x22353f40, 0x0f03000b, 0x866d4f2f, 0x4f657a86, 0x00162738,
+	0x2d1f0b08, 0x70524038, 0x60809a90, 0x02002040, 0x6d513518, 0x606d8686,
+	0x746b706d, 0x44618090, 0x02000927, 0x61442709, 0x907c9280, 0x3552708e,
+	0x20040018, 0x98806040, 0x63606480, 0x708e937a, 0x00103050, 0x3f210301,
+	0x8e937a5e, 0x52596172, 0x4359605e, 0x01000927, 0x70503010, 0x60709090,
+	0x94806d61, 0x2f4f6d86, 0x1002000f, 0x90705030, 0x60607090, 0x4f5e6060,
+	0x03001835, 0x70503010, 0x60709090, 0x5e606060, 0x0018354f, 0x4b2c0d02,
+	0x86948066, 0x52525f70, 0x4f5e605e, 0x01001835, 0x70503010, 0x50709090,
+	0x90705038, 0x30507090, 0x12020010, 0x6059442c, 0x80988064, 0x4f5e6064,
+	0x09001835, 0x51432d17, 0x8f8f7a65, 0x2c4b657a, 0x0302000d, 0x5e4f381f,
+	0x60606060, 0x5e606060, 0x031f384f, 0x2c0d0200, 0x8f7a654b, 0x51657a8f,
+	0x00172d43, 0x381f0307, 0x7059504b, 0x60809a90, 0x02002040, 0x7a5e3f1f,
+	0x7a687a8b, 0x80808e86, 0x4f6d8686, 0x02000f2f, 0x6d4f3012, 0x86769086,
+	0x3f5e7a92, 0x03000321, 0x80604020, 0x50608098, 0x8690725a, 0x0f2f4f6d,
+	0x2c0d0100, 0x9880664b, 0x3c4b6680, 0x3c403f35, 0x0200162c, 0x70503010,
+	0x50709090, 0x90725944, 0x35527090, 0x10020018, 0x90705030, 0x50547090,
+	0x3d4c5050, 0x03000e28, 0x70503010, 0x50709090, 0x47484848, 0x000e283c,
+	0x50311302, 0x72908e70, 0x4242495a, 0x3c474848, 0x01000e28, 0x70503010,
+	0x54709090, 0x90705450, 0x30507090, 0x17030010, 0x60443c2c, 0x60809880,
+	0x22353f44, 0x17080009, 0x6d5a442d, 0x7a868d7a, 0x1f384f65, 0x0d020003,
+	0x7a654b2c, 0x80808080, 0x7a808080, 0x0d2c4b65, 0x1f030200, 0x7a654f38,
+	0x6d7a8d86, 0x172d445a, 0x2c0d0600, 0x7270654b, 0x728e9380, 0x001d3c59,
+	0x61442702, 0x7a729080, 0x9886868d, 0x70908080, 0x00103050, 0x593c1d02,
+	0x6e869072, 0x66809680, 0x000d2c4b, 0x60402003, 0x70809880, 0x8d867270,
+	0x27435f7a, 0x10010009, 0x8e705030, 0x3f5e7a93, 0x201f1823, 0x0300121d,
+	0x70503010, 0x50709090, 0x866d4f38, 0x3f5e7a92, 0x1002001f, 0x90705030,
+	0x70707490, 0x4f657070, 0x03001835, 0x70503010, 0x60709090, 0x5e606060,
+	0x0018354f, 0x593c1d02, 0x6d869072, 0x60605e56, 0x4f5e6060, 0x01001835,
+	0x70503010, 0x70749090, 0x90747070, 0x30507090, 0x12040010, 0x80604023,
+	0x40608098, 0x00091824, 0x442c1208, 0x8f86705a, 0x4f5f7086, 0x000b2238,
+	0x50301003, 0x98988b70, 0x98989898, 0x50708b98, 0x03001030, 0x4f38220b,
+	0x8f86705f, 0x445a7086, 0x0500122c, 0x70503010, 0x8e8f908c, 0x2e4b657a,
+	0x2f020012, 0x86866d4f, 0x71868e76, 0x80809680, 0x30507090, 0x09010010,
+	0x80614427, 0x72648093, 0x52708e90, 0x03001835, 0x80604020, 0x9090939c,
+	0x6b7c8f90, 0x03203c55, 0x30100100, 0x90907050, 0x18355270, 0x30100800,
+	0x90907050, 0x44335070, 0x80988061, 0x00204060, 0x50301002, 0x909b9070,
+	0x8e909090, 0x1f3f5e7a, 0x30100300, 0x93907050, 0x80808080, 0x3f5e7a80,
+	0x2002001f, 0x96806040, 0x7a5e6180, 0x80808080, 0x1f3f5e7a, 0x30100100,
+	0x9b907050, 0x90909090, 0x70909b90, 0x00103050, 0x60402005, 0x60809880,
+	0x00022040, 0x593c1d09, 0x868f8670, 0x35445a70, 0x04000b22, 0x654b2c0d,
+	0x8080807a, 0x80808080, 0x2c4b657a, 0x0b04000d, 0x5a443522, 0x868f8670,
+	0x1d3c5970, 0x30100500, 0x93907050, 0x4f65707a, 0x00031f38, 0x70503002,
+	0x927a8090, 0x90806880, 0x70908072, 0x00103050, 0x4f301201, 0x7290866d,
+	0x92866d5b, 0x213f5e7a, 0x20020003, 0x9c806040, 0x90909093, 0x657a8e94,
+	0x00122e4b, 0x50301001, 0x70909070, 0x00133150, 0x50301008, 0x70909070,
+	0x60403150, 0x60809880, 0x02002040, 0x70503010, 0x90909b90, 0x7a8e9090,
+	0x001f3f5e, 0x50301003, 0x909b9070, 0x90909090, 0x20406080, 0x40200200,
+	0x80988060, 0x90806060, 0x80999290, 0x00204060, 0x50301001, 0x909b9070,
+	0x90909090, 0x5070909b, 0x05001030, 0x80604020, 0x40608098, 0x200a0020,
+	0x8f806040, 0x4e5f7586, 0x00102438, 0x43270905, 0x70706d5a, 0x70707070,
+	0x435a6d70, 0x05000927, 0x4e382410, 0x8f86755f, 0x20406080, 0x30100500,
+	0x90907050, 0x384b5570, 0x03000b22, 0x90705030, 0x7a928080, 0x7090866e,
+	0x4f6d8680, 0x01000f2f, 0x72593c1d, 0x606e8690, 0x80968065, 0x0d2c4b66,
+	0x40200200, 0x80988060, 0x80727070, 0x59728e93, 0x01001d3c, 0x70503010,
+	0x59729090, 0x0f0a1d3c, 0x00030d10, 0x50301003, 0x70909070, 0x664b3650,
+	0x5e7a9280, 0x02001f3f, 0x70503010, 0x70749090, 0x65707070, 0x0018354f,
+	0x50301003, 0x74909070, 0x70707070, 0x1d3c596d, 0x40200200, 0x80968060,
+	0x706d5a66, 0x80988070, 0x00204060, 0x50301001, 0x74909070, 0x74707070,
+	0x50709090, 0x04001030, 0x60402006, 0x60809880, 0x000a2040, 0x593c1d09,
+	0x868d7a6d, 0x384f6572, 0x04001222, 0x6d4f2f0f, 0x90909086, 0x90909090,
+	0x2f4f6d86, 0x1204000f, 0x654f3822, 0x7a8d8672, 0x1d3c596d, 0x30100500,
+	0x8c8c7050, 0x1f325070, 0x3004000b, 0x80907050, 0x70709080, 0x86769090,
+	0x27446180, 0x44270909, 0x86978061, 0x80808080, 0x52708e93, 0x02001835,
+	0x80604020, 0x50608098, 0x9a907059, 0x20406080, 0x30100100, 0x988e7050,
+	0x29446180, 0x2c302f27, 0x02000b1f, 0x70503010, 0x50709090, 0x8e70523b,
+	0x35527090, 0x10020018, 0x90705030, 0x50547090, 0x384b5050, 0x03000922,
+	0x70503010, 0x54709090, 0x4f505050, 0x00122c43, 0x593c1d02, 0x708e9072,
+	0x60504f54, 0x60809880, 0x01002040, 0x70503010, 0x54709090, 0x90705450,
+	0x30507090, 0x0b030010, 0x60402d1f, 0x60809880, 0x16272f40, 0x2c120800,
+	0x7a655143, 0x657a8e8d, 0x162c3c4f, 0x2f0f0300, 0x90866d4f, 0x90909090,
+	0x6d869090, 0x000f2f4f, 0x3c2c1603, 0x8e7a654f, 0x51657a8d, 0x00122c43,
+	0x4b301205, 0x65727665, 0x000d2c4b, 0x70503005, 0x90808090, 0x90907270,
+	0x60808e78, 0x01002040, 0x6d4f3012, 0x90909886, 0x93909090, 0x3f5e7a93,
+	0x01000321, 0x80604020, 0x50608098, 0x93907055, 0x1f3f5e7a, 0x2c0d0100,
+	0x9980664b, 0x44536d86, 0x4b504f44, 0x00031f38, 0x50301001, 0x70909070,
+	0x7a655254, 0x4f6d8692, 0x02000f2f, 0x70503010, 0x54709090, 0x4f505050,
+	0x00122c43, 0x50301003, 0x70909070, 0x30303450, 0x0016272f, 0x4f301203,
+	0x7a92866d, 0x60484f5f, 0x60809880, 0x01002040, 0x70503010, 0x50709090,
+	0x90705038, 0x30507090, 0x09020010, 0x504b3822, 0x80988060, 0x434f5060,
+	0x0800122c, 0x4f382716, 0x8d8e7a65, 0x4359667a, 0x02000927, 0x5a432709,
+	0x7070706d, 0x70707070, 0x27435a6d, 0x09020009, 0x66594327, 0x7a8e8d7a,
+	0x27384f65, 0x1d060016, 0x8670593c, 0x2c4b657a, 0x3005000d, 0x80907050,
+	0x86808f80, 0x8a809390, 0x1d3c5972, 0x3c1d0100, 0x8e907259, 0x70707074,
+	0x80988070, 0x0d2c4b66, 0x40200100, 0x80988060, 0x7a707070, 0x52708e93,
+	0x01001835, 0x5e3f2103, 0x7a93907a, 0x6d61616d, 0x2c4b6570, 0x1001000d,
+	0x90705030, 0x70707490, 0x7a90907a, 0x0927435f, 0x30100200, 0x90907050,
+	0x70707074, 0x3c596d70, 0x1003001d, 0x90705030, 0x30507090, 0x090f1014,
+	0x27090400, 0x927a5f43, 0x616d7286, 0x80988067, 0x00204060, 0x50301001,
+	0x70909070, 0x70503850, 0x50709090, 0x02001030, 0x654f3518, 0x98807070,
+	0x6d707080, 0x001d3c59, 0x38220c09, 0x8672654f, 0x4f6d808d, 0x03000f2f,
+	0x4f432d16, 0x50505050, 0x4f505050, 0x00162d43, 0x4f2f0f03, 0x868d806d,
+	0x384f6572, 0x07000c22, 0x80604020, 0x50708e9a, 0x05001030, 0x90705030,
+	0x90867180, 0x8e8e7a86, 0x2e4b657a, 0x20010012, 0x96806040, 0x50526680,
+	0x937a5e50, 0x3050708e, 0x20010010, 0x9c806040, 0x90909093, 0x657a8e8f,
+	0x000d2c4b, 0x4f351802, 0x92907a65, 0x86808086, 0x3050708c, 0x10010010,
+	0x90705030, 0x9090909b, 0x657a8e8f, 0x0019354f, 0x50301003, 0x909b9070,
+	0x90909090, 0x20406080, 0x30100300, 0x90907050, 0x10305070, 0x35190800,
+	0x8f866d51, 0x80808690, 0x60809790, 0x01002040, 0x70503010, 0x50709090,
+	0x90705038, 0x30507090, 0x1f020010, 0x8e7a5e3f, 0x93a19390, 0x60809090,
+	0x0a002040, 0x4b38220b, 0x7a86705a, 0x0d2c4b65, 0x27160400, 0x3030302f,
+	0x30303030, 0x0016272f, 0x4b2c0d04, 0x70867a65, 0x22384b5a, 0x1f08000b,
+	0x8e7a5e3f, 0x2f4f6d86, 0x3005000f, 0x808e7050, 0x6d706d68, 0x65707065,
+	0x031f384f, 0x40200100, 0x7a8e8060, 0x37303f5e, 0x8c866d51, 0x10305070,
+	0x40200100, 0x90908060, 0x80869090, 0x384f6572, 0x0200031f, 0x4f382209,
+	0x90867a65, 0x86909090, 0x0f2f4f6d, 0x30100100, 0x908c7050, 0x80869090,
+	0x384f6572, 0x03000922, 0x70503010, 0x9090908c, 0x80909090, 0x00204060,
+	0x50301003, 0x6d868c70, 0x000f2f4f, 0x43270a08, 0x867a6d5a, 0x8e909090,
+	0x3c597080, 0x1001001d, 0x8c705030, 0x374f6d86, 0x8c866d4f, 0x10305070,
+	0x3f1f0200, 0x908e7a5e, 0x90909090, 0x40608090, 0x0b0b0020, 0x5a442f1f,
+	0x384f656d, 0x0500031f, 0x10100f09, 0x10101010, 0x00090f10, 0x381f0305,
+	0x5a6d654f, 0x0b1f2f44, 0x35180900, 0x6d70654f, 0x0927435a, 0x4b2c0500,
+	0x728e8066, 0x4f4f525b, 0x384e5757, 0x02000b22, 0x6d593c1d, 0x354f6570,
+	0x5a432719, 0x4b65706d, 0x01000d2c, 0x6d593c1d, 0x70707070, 0x4b59616d,
+	0x000b2238, 0x38220b04, 0x706d5f4f, 0x6d707070, 0x0927435a, 0x2c0d0100,
+	0x7070654b, 0x616d7070, 0x22384b59, 0x0d04000b, 0x70654b2c, 0x70707070,
+	0x596d7070, 0x03001d3c, 0x654b2c0d, 0x435a6d70, 0x09000927, 0x51432d16,
+	0x70706d5f, 0x59667070, 0x00122c44, 0x4b2c0d01, 0x5a6d7065, 0x5a432e43,
+	0x4b65706d, 0x02000d2c, 0x654f3518, 0x70707070, 0x6d707070, 0x001d3c59,
+	0x2d17040c, 0x384b4f43, 0x17000b22, 0x4b38220b, 0x172d434f, 0x090a0004,
+	0x504b3822, 0x162d434f, 0x3f210600, 0x808f7a5e, 0x6160616d, 0x3c596d6d,
+	0x1203001d, 0x504f432c, 0x0922384b, 0x4f432d16, 0x1f384b50, 0x12010003,
+	0x504f432c, 0x4f505050, 0x1f2e3c44, 0x0b06000b, 0x4f433522, 0x50505050,
+	0x162d434f, 0x1f030200, 0x50504b38, 0x444f5050, 0x0b1f2e3c, 0x1f030500,
+	0x50504b38, 0x50505050, 0x2c434f50, 0x03030012, 0x504b381f, 0x162d434f,
+	0x27160b00, 0x504f4335, 0x4b505050, 0x00172c3c, 0x381f0302, 0x434f504b,
+	0x432d1c2d, 0x384b504f, 0x0200031f, 0x4b382209, 0x50505050, 0x4f505050,
+	0x00122c43, 0x2f27160e, 0x000b1f2c, 0x2c1f0b19, 0x0016272f, 0x2c1f0b0d,
+	0x16272f30, 0x35180700, 0x8f866d51, 0x80808086, 0x40608086, 0x16040020,
+	0x2c302f27, 0x02000b1f, 0x302f2716, 0x000b1f2c, 0x2f271603, 0x30303030,
+	0x121d272f, 0x09080003, 0x302f2719, 0x2f303030, 0x04001627, 0x302c1f0b,
+	0x2f303030, 0x03121d27, 0x1f0b0700, 0x3030302c, 0x30303030, 0x0016272f,
+	0x2c1f0b05, 0x16272f30, 0x190a0d00, 0x30302f27, 0x202c3030, 0x0b040012,
+	0x2f302c1f, 0x16061627, 0x2c302f27, 0x04000b1f, 0x302c1f0b, 0x30303030,
+	0x272f3030, 0x09100016, 0x00030d0f, 0x0f0d031b, 0x030f0009, 0x090f100d,
+	0x270a0800, 0x80705a43, 0x8e90908e, 0x3c597080, 0x0905001d, 0x030d100f,
+	0x0f090400, 0x00030d10, 0x100f0905, 0x0f101010, 0x090d0009, 0x1010100f,
+	0x00090f10, 0x100d0306, 0x0f101010, 0x030b0009, 0x1010100d, 0x10101010,
+	0x0700090f, 0x0f100d03, 0x09100009, 0x1010100f, 0x00030d10, 0x100d0306,
+	0x0300090f, 0x0d100f09, 0x03060003, 0x1010100d, 0x10101010, 0x5100090f,
+	0x59442d16, 0x70707066, 0x44596670, 0xf300122c, 0x4b3c2c17, 0x50505050,
+	0x172c3c4b, 0x2012f500, 0x3030302c, 0x12202c30, 0x0d03f700, 0x10101010,
+	0xff00030d, 0xff00ff00, 0xff00ff00, 0x1d12b400, 0x20202020, 0x181f2020,
+	0x09060009, 0x1d201f18, 0x09010012, 0x1d201f18, 0x09060012, 0x1d201f18,
+	0x090b0012, 0x1f201f18, 0x1d120918, 0x121d2020, 0x18090500, 0x181f201f,
+	0x1f180909, 0x00121d20, 0x1d120307, 0x1f202020, 0x07000a18, 0x201f1809,
+	0x1f202020, 0x00030d18, 0x1d120309, 0x1f202020, 0x08000a18, 0x20201d12,
+	0x181f2020, 0x0900030d, 0x201d1203, 0x1f202020, 0x06000918, 0x20201d12,
+	0x20202020, 0x1f202020, 0x04000918, 0x1f201d12, 0x01000918, 0x201f1809,
+	0x0400121d, 0x20201d12, 0x0300121d, 0x201f1809, 0x0300121d, 0x201f1809,
+	0x0300121d, 0x1f1f1809, 0x08000918, 0x403c2c16, 0x40404040, 0x22353f40,
+	0x0904000b, 0x403f3522, 0x22172c3c, 0x3c403f35, 0x0400162c, 0x3f35220b,
+	0x162c3c40, 0x220b0900, 0x3f403f35, 0x3c2c2235, 0x2c3c4040, 0x0b030016,
+	0x403f3522, 0x2222353f, 0x3c403f35, 0x0500172c, 0x3c2e1f0b, 0x3f404040,
+	0x00162735, 0x35220905, 0x4040403f, 0x2c353f40, 0x07000b1f, 0x3c2e1f0b,
+	0x3f404040, 0x00162735, 0x3c2c1706, 0x40404040, 0x1f2c353f, 0x0b07000b,
+	0x403c2e1f, 0x3f404040, 0x000b2235, 0x3c2c1704, 0x40404040, 0x40404040,
+	0x22353f40, 0x16020009, 0x3f403c2c, 0x22112235, 0x3c403f35, 0x0200162c,
+	0x403c2c16, 0x172c3c40, 0x220b0100, 0x3c403f35, 0x0100162c, 0x3f352209,
+	0x172c3c40, 0x220b0100, 0x353f3f35, 0x06000b22, 0x59432709, 0x60606060,
+	0x4f5e6060, 0x00031f38, 0x4f351803, 0x4459605e, 0x5e4f382d, 0x27435960,
+	0x03020009, 0x5e4f381f, 0x27435960, 0x03070009, 0x5e4f381f, 0x374f5e60,
+	0x60605944, 0x0a274359, 0x1f030100, 0x605e4f38, 0x35384f5e, 0x59605e4f,
+	0x00122c44, 0x38220b03, 0x6060594b, 0x43515e60, 0x0400172d, 0x5e4f3518,
+	0x60606060, 0x384b525e, 0x05000b22, 0x4b38220b, 0x60606059, 0x2d43515e,
+	0x12040017, 0x6059442c, 0x5e606060, 0x22384b52, 0x0b05000b, 0x594b3822,
+	0x60606060, 0x1f384f5e, 0x12020003, 0x6059442c, 0x60606060, 0x60606060,
+	0x18354f5e, 0x27090100, 0x5e605943, 0x3826384f, 0x59605e4f, 0x00092743,
+	0x59432701, 0x44596060, 0x381f122c, 0x59605e4f, 0x18092743, 0x605e4f35,
+	0x122c4459, 0x5e4f381f, 0x1f384f5e, 0x0f050003, 0x806d4f2f, 0x80808080,
+	0x4b657a80, 0x03000d2c, 0x7a5e3f1f, 0x41597080, 0x807a654f, 0x0f2f4f6d,
+	0x2c0d0200, 0x807a654b, 0x0f2f4f6d, 0x2c0d0700, 0x807a654b, 0x59475f7a,
+	0x6d808070, 0x00183551, 0x4b2c0d01, 0x7a807a65, 0x5e3f4b65, 0x5970807a,
+	0x02001d3c, 0x4f38220b, 0x80807265, 0x5a6d7a80, 0x00122c44, 0x5e3f1f03,
+	0x8080807a, 0x65707a80, 0x0b22384f, 0x22090300, 0x72654f38, 0x7a808080,
+	0x2c445a6d, 0x1d030012, 0x8070593c, 0x7a808080, 0x384f6570, 0x03000922,
+	0x4f382209, 0x80807265, 0x657a8080, 0x000d2c4b, 0x593c1d02, 0x80808070,
+	0x80808080, 0x5e7a8080, 0x01001f3f, 0x6d4f2f0f, 0x4b657a80, 0x7a654b34,
+	0x2f4f6d80, 0x2f01000f, 0x80806d4f, 0x1d3c5970, 0x7a654b2c, 0x2f4f6d80,
+	0x5e3f1f0f, 0x5970807a, 0x4b2c1d3c, 0x657a7a65, 0x000d2c4b, 0x50301005,
+	0x98989070, 0x8e9c9898, 0x10305070, 0x40200300, 0x80968060, 0x7a655060,
+	0x4f6d868d, 0x02000f2f, 0x70503010, 0x5070908e, 0x07001030, 0x70503010,
+	0x6d869c8e, 0x99806151, 0x3f5e7a93, 0x1001001f, 0x8e705030, 0x59728e9f,
+	0x96806046, 0x20406080, 0x1f030100, 0x7a654f38, 0x92908f8e, 0x59708692,
+	0x0003203c, 0x60402002, 0x98999b80, 0x7a8e9298, 0x1f384f65, 0x19020003,
+	0x7a654f35, 0x92908f8e, 0x59708692, 0x0003203c, 0x60402002, 0x98999980,
+	0x7a8e9298, 0x18354f65, 0x35190300, 0x8e7a654f, 0x9290908f, 0x3050708e,
+	0x20020010, 0x93806040, 0x9f999898, 0x98989899, 0x20406080, 0x30100100,
+	0x8e907050, 0x50385070, 0x70908e70, 0x00103050, 0x70503001, 0x6080978e,
+	0x52352540, 0x70908e70, 0x20103050, 0x96806040, 0x20406080, 0x8e705030,
+	0x3050708e, 0x0f050010, 0x806d4f2f, 0x80808080, 0x50709093, 0x03001030,
+	0x80604020, 0x65608098, 0x70868d7a, 0x0927435a, 0x30100200, 0x90907050,
+	0x10305070, 0x30100700, 0x93907050, 0x6d5b728e, 0x809fa286, 0x00204060,
+	0x50301001, 0x97a59070, 0x604d6680, 0x60809880, 0x01002040, 0x654b2c0d,
+	0x7a868d7a, 0x94867a70, 0x2e4b6680, 0x20020012, 0x99806040, 0x80808086,
+	0x657a9090, 0x000d2c4b, 0x43270a01, 0x868d7a5f, 0x867a707a, 0x4b668094,
+	0x0200122e, 0x80604020, 0x80808699, 0x7a909080, 0x001f3f5e, 0x43270902,
+	0x868d7a5f, 0x7a70707a, 0x2f4f6d80, 0x1d02000f, 0x8070593c, 0x9a868080,
+	0x80808086, 0x1f3f5e7a, 0x30100100, 0x90907050, 0x50385070, 0x70909070,
+	0x00103050, 0x664b2c01, 0x66809880, 0x5e3f2e4b, 0x6d86927a, 0x200f2f4f,
+	0x98806040, 0x30406080, 0x90705034, 0x3050708e, 0x09050010, 0x60594327,
+	0x70606060, 0x50709090, 0x03001030, 0x80604020, 0x72648098, 0x5a728e8e,
+	0x00162d44, 0x50301003, 0x70909070, 0x00103050, 0x50301007, 0x8e809070,
+	0x8e726480, 0x60809c93, 0x01002040, 0x70503010, 0x8e869390, 0x80605972,
+	0x40608098, 0x18010020, 0x8e705235, 0x555f7290, 0x8e8e725f, 0x1d3c5972,
+	0x40200200, 0x80988060, 0x7a666064, 0x50708e93, 0x01001030, 0x6d513518,
+	0x5f729086, 0x8e725f55, 0x3c59728e, 0x2002001d, 0x98806040, 0x67606480,
+	0x60809880, 0x02002040, 0x6d4f2f0f, 0x5f729086, 0x605e5252, 0x09274359,
+	0x2c120200, 0x60605944, 0x80988064, 0x5e606064, 0x0018354f, 0x50301001,
+	0x70909070, 0x70503850, 0x50709090, 0x01001030, 0x7a5e3f21, 0x52708e93,
+	0x80664b38, 0x44618096, 0x40200927, 0x80988060, 0x4b504c60, 0x80907050,
+	0x0d2c4b66, 0x2c160600, 0x4040403c, 0x90907050, 0x10305070, 0x40200300,
+	0x80988060, 0x7a8d8671, 0x172f4b65, 0x30100400, 0x90907050, 0x10305070,
+	0x30100700, 0x80907050, 0x806e868e, 0x8098808e, 0x00204060, 0x50301001,
+	0x80909070, 0x60618093, 0x60809880, 0x01002040, 0x7a5e3f1f, 0x4f6d8692,
+	0x80664b3a, 0x40608096, 0x20020020, 0x98806040, 0x52446080, 0x70909070,
+	0x00103050, 0x5e3f1f01, 0x6d86927a, 0x664b3a4f, 0x60809680, 0x02002040,
+	0x80604020, 0x4d608098, 0x80988061, 0x00204060, 0x50301002, 0x7a938e70,
+	0x45465161, 0x162c3c40, 0x2c170400, 0x6044403c, 0x60809880, 0x353f4044,
+	0x01000922, 0x70503010, 0x50709090, 0x90705038, 0x30507090, 0x18010010,
+	0x8e705235, 0x425e7a93, 0x908e7052, 0x1d3c5972, 0x40200100, 0x80988060,
+	0x65706560, 0x80907056, 0x04224060, 0x1d120700, 0x50302020, 0x70909070,
+	0x00103050, 0x60402003, 0x86809880, 0x4f657a8d, 0x00041f38, 0x50301004,
+	0x70909070, 0x00103050, 0x50301007, 0x80809070, 0x86867690, 0x60809880,
+	0x01002040, 0x70503010, 0x8e789090, 0x80616d86, 0x40608098, 0x20010020,
+	0x98806040, 0x2c446180, 0x98806040, 0x20406080, 0x40200200, 0x80988060,
+	0x70544860, 0x50709090, 0x01001030, 0x80604020, 0x44618098, 0x8060402c,
+	0x40608098, 0x20020020, 0x98806040, 0x72666480, 0x5e7a9286, 0x02001f3f,
+	0x664b2c0d, 0x7a869780, 0x4b59616d, 0x000b2238, 0x241d1205, 0x98806040,
+	0x24406080, 0x0009181f, 0x50301002, 0x70909070, 0x70503850, 0x50709090,
+	0x01001030, 0x664b2c0d, 0x66809880, 0x927a5e4c, 0x304f6d86, 0x1f010012,
+	0x927a5e3f, 0x8a726480, 0x9070607a, 0x20406080, 0x30100b00, 0x90907050,
+	0x10305070, 0x40200300, 0x86998060, 0x4f657a8b, 0x000b2238, 0x50301005,
+	0x70909070, 0x00103050, 0x50301007, 0x7a809070, 0x7a8a808f, 0x60809880,
+	0x01002040, 0x70503010, 0x80729090, 0x80677a8f, 0x40608098, 0x20010020,
+	0x98806040, 0x28406080, 0x98806040, 0x20406080, 0x40200200, 0x80988060,
+	0x7a6d6164, 0x4f6d868f, 0x01000f2f, 0x80604020, 0x40608098, 0x80604028,
+	0x40608098, 0x20020020, 0x99806040, 0x8e808086, 0x516d868f, 0x02001835,
+	0x593c2003, 0x92928670, 0x65728086, 0x0922384f, 0x20030500, 0x98806040,
+	0x20406080, 0x10040004, 0x90705030, 0x38507090, 0x90907050, 0x10305070,
+	0x21030100, 0x937a5e3f, 0x6656708e, 0x5f7a9280, 0x00092743, 0x52351801,
+	0x6a809070, 0x6d869780, 0x60809070, 0x0b002040, 0x70503010, 0x50709090,
+	0x03001030, 0x80604020, 0x7a8f939c, 0x22384f65, 0x10050009, 0x90705030,
+	0x30507090, 0x18070010, 0x90705235, 0x92866e80, 0x9880708b, 0x20406080,
+	0x30100100, 0x90907050, 0x868e7270, 0x8098806e, 0x00204060, 0x60402001,
+	0x60809880, 0x60402840, 0x60809880, 0x02002040, 0x80604020, 0x80808699,
+	0x70868f86, 0x0927435a, 0x40200100, 0x80988060, 0x40284060, 0x80988060,
+	0x00204060, 0x60402002, 0x90939c80, 0x6d7a9392, 0x0a27435a, 0x2c120300,
+	0x7a6d5a44, 0x8e969286, 0x354f657a, 0x20060019, 0x98806040, 0x20406080,
+	0x30100500, 0x90907050, 0x50385070, 0x70909070, 0x00103050, 0x52351802,
+	0x7a938e70, 0x8e8e7060, 0x19355270, 0x30100200, 0x8e907050, 0x909c8676,
+	0x80907072, 0x00204060, 0x1f180907, 0x5030171d, 0x70909070, 0x00103050,
+	0x60402003, 0x86809880, 0x4f657a8f, 0x05001935, 0x70503010, 0x50709090,
+	0x0f101430, 0x1f040009, 0x927a5e3f, 0x96806880, 0x98806a80, 0x20406080,
+	0x30100100, 0x90907050, 0x92806670, 0x8098807a, 0x00204060, 0x60402001,
+	0x60809880, 0x60402940, 0x60809880, 0x02002040, 0x80604020, 0x9090939c,
+	0x5a70808e, 0x00162d44, 0x60402002, 0x60809880, 0x60402940, 0x60809880,
+	0x02002040, 0x80604020, 0x7a708098, 0x5970868d, 0x0003203c, 0x432d1704,
+	0x7a6d5f51, 0x7a909080, 0x0927435f, 0x40200500, 0x80988060, 0x00204060,
+	0x50301005, 0x70909070, 0x70503850, 0x50709090, 0x02001030, 0x664b2c0d,
+	0x69809880, 0x6680927a, 0x000d2c4b, 0x50301002, 0x78909070, 0x808f868e,
+	0x60809072, 0x06002040, 0x3f352209, 0x5032303c, 0x70909070, 0x00103050,
+	0x60402003, 0x7a809880, 0x5f7a9090, 0x00172d44, 0x50301004, 0x70909070,
+	0x30303450, 0x0016272f, 0x60402003, 0x64809880, 0x667a8070, 0x6080927a,
+	0x01002040, 0x70503010, 0x5f709090, 0x8086927a, 0x40608098, 0x20010020,
+	0x98806040, 0x31446180, 0x9680664b, 0x20406080, 0x40200200, 0x80988060,
+	0x66707070, 0x172d4459, 0x40200300, 0x80988060, 0x4b314461, 0x80968066,
+	0x00204060, 0x60402002, 0x61809880, 0x80938066, 0x122e4b66, 0x1f0b0300,
+	0x433a332c, 0x7a665e51, 0x4f6d8692, 0x05000f2f, 0x80604020, 0x40608098,
+	0x10050020, 0x90705030, 0x38507090, 0x90907050, 0x10305070, 0x21030200,
+	0x937a5e3f, 0x9280728e, 0x213f5e7a, 0x10020003, 0x90705030, 0x788e8090,
+	0x96808e8e, 0x20406080, 0x35180600, 0x4f595e4f, 0x90725947, 0x3050708e,
+	0x20030010, 0x98806040, 0x8f7a6980, 0x445a7086, 0x0300122c, 0x70503010,
+	0x54709090, 0x4f505050, 0x00162d43, 0x60402002, 0x60809880, 0x575e6059,
+	0x61809070, 0x10092744, 0x90705030, 0x6d587090, 0x98809086, 0x20406080,
+	0x3f1f0100, 0x86927a5e, 0x5447536d, 0x728e8e70, 0x001d3c59, 0x60402002,
+	0x60809880, 0x3c4b5050, 0x0400172c, 0x7a5e3f1f, 0x536d8692, 0x8e705447,
+	0x3c597290, 0x2002001d, 0x98806040, 0x72596080, 0x59728e90, 0x0003203c,
+	0x381f0301, 0x444f504b, 0x70564942, 0x50708e90, 0x05001030, 0x80604020,
+	0x40608098, 0x10050020, 0x90705030, 0x47547090, 0x90907054, 0x10305070,
+	0x35180300, 0x938e7052, 0x708e8e7c, 0x00183552, 0x50301003, 0x80909070,
+	0x92807186, 0x60809986, 0x06002040, 0x7a5e3f1f, 0x6d616d72, 0x66809380,
+	0x000d2c4b, 0x60402003, 0x61809880, 0x86948066, 0x223c5970, 0x10020009,
+	0x90705030, 0x70707490, 0x5a6d7070, 0x00092743, 0x60402001, 0x60809880,
+	0x50404044, 0x6d869070, 0x100f2f4f, 0x90705030, 0x5f527090, 0x9c938f7a,
+	0x20406080, 0x35180100, 0x92866d51, 0x6d616d7a, 0x66808f7a, 0x00122e4b,
+	0x60402002, 0x60809880, 0x202c3040, 0x18050012, 0x866d5135, 0x616d7a92,
+	0x868f7a6d, 0x12304f6d, 0x40200200, 0x80988060, 0x866d4f60, 0x4b668097,
+	0x0100122e, 0x654b2c0d, 0x60616d70, 0x8f7a6d61, 0x2c4b6680, 0x2005000d,
+	0x98806040, 0x20406080, 0x2f0f0500, 0x92866d4f, 0x6d616d7a, 0x6d868f7a,
+	0x000f2f4f, 0x4b2c0d03, 0x86998066, 0x4b668092, 0x03000d2c, 0x70503010,
+	0x8092988e, 0xa0937a67, 0x3f5e7a93, 0x2006001f, 0x8e806040, 0x8f868086,
+	0x3c59728c, 0x03000320, 0x80604020, 0x59608098, 0x80948670, 0x18354f66,
+	0x30100200, 0x9b907050, 0x90909090, 0x4f6d8690, 0x01000f2f, 0x80604020,
+	0x40608098, 0x70503024, 0x50709090, 0x30101030, 0x90907050, 0x6d515070,
+	0x809fa186, 0x00204060, 0x43270a01, 0x92907a5f, 0x8f868086, 0x3c597086,
+	0x02000320, 0x80604020, 0x40608098, 0x00030e20, 0x43270a06, 0x92907a5f,
+	0x8f868086, 0x435a7086, 0x02000927, 0x80604020, 0x49608098, 0x8e937a5f,
+	0x1d3c5972, 0x30100100, 0x868c7050, 0x86808080, 0x5970868f, 0x0003203c,
+	0x60402005, 0x60809880, 0x05002040, 0x5f432709, 0x8692907a, 0x8c8f8680,
+	0x27435a72, 0x03030009, 0x7a5e3f21, 0x7a93a093, 0x03213f5e, 0x2c0d0300,
+	0x9f80664b, 0x6d5f7a93, 0x7090a086, 0x00183552, 0x593c1d06, 0x90908670,
+	0x65728690, 0x00122e4b, 0x60402004, 0x5e7a8e80, 0x86705a48, 0x3f5e7a8a,
+	0x0f02001f, 0x866d4f2f, 0x90909090, 0x6d869090, 0x000f2f4f, 0x60402001,
+	0x5e7a8e80, 0x5030203f, 0x6d868c70, 0x0f0f2f4f, 0x866d4f2f, 0x4350708c,
+	0x8e8e7a5f, 0x1f3f5e7a, 0x35190200, 0x867a654f, 0x808e9090, 0x2c445a70,
+	0x20030012, 0x8e806040, 0x1f3f5e7a, 0x35190900, 0x867a654f, 0x86929a92,
+	0x43505c70, 0x0200122c, 0x7a5e3f1f, 0x4260808e, 0x8e866d51, 0x20406080,
+	0x30100100, 0x908c7050, 0x8e909090, 0x445a7080, 0x0600122c, 0x7a5e3f1f,
+	0x4060808e, 0x19060020, 0x7a654f35, 0x90909086, 0x4b657286, 0x0500162f,
+	0x6d513518, 0x6d869086, 0x00183551, 0x40220404, 0x86908060, 0x7a5f516d,
+	0x50708c8e, 0x06001030, 0x5a442c12, 0x7070706d, 0x384b5a6d, 0x0400031f,
+	0x6d593c1d, 0x374f6570, 0x706d5a44, 0x1d3c596d, 0x27090200, 0x706d5a43,
+	0x70707070, 0x435a6d70, 0x01000927, 0x6d593c1d, 0x354f6570, 0x654b2c1a,
+	0x435a6d70, 0x27090927, 0x706d5a43, 0x4f384b65, 0x65707065, 0x0018354f,
+	0x38220902, 0x706d5f4f, 0x59667070, 0x00172d44, 0x593c1d04, 0x4f65706d,
+	0x09001835, 0x4f382209, 0x98806d5f, 0x66647180, 0x203c596d, 0x18010003,
+	0x70654f35, 0x433c596d, 0x6d706d5a, 0x001d3c59, 0x4b2c0d01, 0x70707065,
+	0x66707070, 0x172d4459, 0x35180700, 0x6d70654f, 0x001d3c59, 0x38220906,
+	0x706d5f4f, 0x5a6d7070, 0x041f384b, 0x270a0500, 0x706d5a43, 0x27435a6d,
+	0x1d05000a, 0x706d593c, 0x4f435a6d, 0x65707065, 0x000d2c4b, 0x432d1707,
+	0x5050504f, 0x1f2f434f, 0x1205000b, 0x504f432c, 0x2d22384b, 0x4f504f43,
+	0x00122c43, 0x432d1603, 0x5050504f, 0x4f505050, 0x00162d43, 0x432c1202,
+	0x384b504f, 0x381f0d22, 0x434f504b, 0x0200162d, 0x4f432d16, 0x27384b50,
+	0x50504b38, 0x0922384b, 0x220b0300, 0x504f4335, 0x3c4b5050, 0x0500172c,
+	0x4f432c12, 0x22384b50, 0x0b0a0009, 0x5e453522, 0x8090907a, 0x66808080,
+	0x000d2c4b, 0x38220901, 0x434f504b, 0x4f432d2c, 0x2c434f50, 0x03010012,
+	0x504b381f, 0x50505050, 0x2c3c4b50, 0x09080017, 0x504b3822, 0x122c434f,
+	0x220b0700, 0x504f4335, 0x434f5050, 0x000b1f2f, 0x432d1607, 0x434f504f,
+	0x0600162d, 0x4f432c12, 0x2d434f50, 0x50504b38, 0x031f384b, 0x27160800,
+	0x3030302f, 0x0416272f, 0x27160700, 0x1f2c302f, 0x2f27160b, 0x16272f30,
+	0x27160500, 0x3030302f, 0x2f303030, 0x04001627, 0x302f2716, 0x000b1f2c,
+	0x2c1f0b01, 0x16272f30, 0x27160400, 0x1f2c302f, 0x302c1f11, 0x0b1f2c30,
+	0x19090500, 0x30302f27, 0x12202c30, 0x27160700, 0x1f2c302f, 0x090c000b,
+	0x654f351b, 0x96968e7a, 0x4f6d8690, 0x02000f2f, 0x302c1f0b, 0x1616272f,
+	0x2f302f27, 0x03001627, 0x302c1f0b, 0x30303030, 0x12202c30, 0x1f0b0a00,
+	0x272f302c, 0x09090016, 0x302f2719, 0x272f3030, 0x09000416, 0x302f2716,
+	0x0016272f, 0x2f271608, 0x16272f30, 0x30302c1f, 0x000b1f2c, 0x100f090a,
+	0x090f1010, 0x0f090a00, 0x00030d10, 0x100f0902, 0x0700090f, 0x10100f09,
+	0x10101010, 0x0600090f, 0x0d100f09, 0x03030003, 0x090f100d, 0x0f090600,
+	0x00030d10, 0x100d0301, 0x00030d10, 0x100f0908, 0x030d1010, 0x0f090900,
+	0x00030d10, 0x3822090e, 0x8072654f, 0x5a6d7280, 0x00092743, 0x100d0303,
+	0x0200090f, 0x0f100f09, 0x03050009, 0x1010100d, 0x0d101010, 0x030c0003,
+	0x090f100d, 0x0f090c00, 0x0f101010, 0x090c0009, 0x090f100f, 0x0f090a00,
+	0x00090f10, 0x100d0301, 0x00030d10, 0x38220b8a, 0x6060594b, 0x2d434f59,
+	0x0bf50016, 0x403c2e1f, 0x27303c40, 0x03f70016, 0x20201d12, 0x0009121d,
+	0x00ff00ff, 0x00ff00ff, 0x100f09b2, 0x0d101010, 0x031b0003, 0x1010100d,
+	0x030d1010, 0x2716d300, 0x3030302f, 0x0b1f2c30, 0x18090600, 0x181f201f,
+	0x0b0c0009, 0x30302c1f, 0x2c303030, 0x2b000b1f, 0x20201d12, 0x0009181f,
+	0x1f18091c, 0x09181f20, 0x18092300, 0x181f201f, 0x091a0009, 0x1f201f18,
+	0x01000918, 0x201f1809, 0x0009181f, 0x201d1203, 0x00121d20, 0x1f180903,
+	0x00121d20, 0x1f180904, 0x20202020, 0x20202020, 0x0600121d, 0x4f432d16,
+	0x50505050, 0x0922384b, 0x22090400, 0x3f403f35, 0x00092235, 0x381f030a,
+	0x5050504b, 0x384b5050, 0x0900031f, 0x1f201d12, 0x1a000918, 0x403c2c16,
+	0x22353f40, 0x091a000b, 0x403f3522, 0x0922353f, 0x22092100, 0x3f403f35,
+	0x00092235, 0x35220918, 0x353f403f, 0x35221022, 0x353f403f, 0x01000922,
+	0x403c2c16, 0x172c3c40, 0x220b0100, 0x3c403f35, 0x0200162c, 0x3f35220b,
+	0x40404040, 0x40404040, 0x00162c3c, 0x43270904, 0x70706d5a, 0x4f657070,
+	0x04001835, 0x5e4f3518, 0x354f5e60, 0x0d0a0018, 0x70654b2c, 0x70707070,
+	0x0d2c4b65, 0x2c170800, 0x353f403c, 0x18000922, 0x59432709, 0x4f5e6060,
+	0x000b2238, 0x4f351819, 0x4f5e605e, 0x21001835, 0x5e4f3518, 0x354f5e60,
+	0x18180018, 0x605e4f35, 0x24384f5e, 0x605e4f35, 0x18354f5e, 0x43270100,
+	0x59606059, 0x22162d44, 0x605e4f38, 0x09274359, 0x4f381f03, 0x6060605e,
+	0x60606060, 0x27435960, 0x0f030009, 0x866d4f2f, 0x8e909090, 0x1f3f5e7a,
+	0x3f1f0400, 0x7a807a5e, 0x03213f5e, 0x30100900, 0x908c7050, 0x708c9090,
+	0x00103050, 0x442c1207, 0x4f5e6059, 0x18001935, 0x6d4f2f0f, 0x657a8080,
+	0x0922384f, 0x3f1f1800, 0x7a807a5e, 0x041f3f5e, 0x1f031f00, 0x807a5e3f,
+	0x1f3f5e7a, 0x3f1f1800, 0x7a807a5e, 0x44374f65, 0x7a807a5f, 0x001f3f5e,
+	0x6d4f2f01, 0x5a708080, 0x4f352743, 0x6d807a65, 0x0d0f2f4f, 0x7a654b2c,
+	0x80808080, 0x80808080, 0x0f2f4f6d, 0x30100300, 0x9b907050, 0x7a8e9090,
+	0x001f3f5e, 0x5e3f1f04, 0x6680927a, 0x00122e4b, 0x50301009, 0x90908c70,
+	0x5070909b, 0x06001030, 0x593c2004, 0x5f7a8070, 0x00122c44, 0x4b2c0d17,
+	0x8d867a65, 0x354f657a, 0x03080018, 0x20201d12, 0x181f2020, 0x2006000a,
+	0x98806040, 0x24406080, 0x00121d20, 0x1f180a0a, 0x20202020, 0x0800121d,
+	0x241d1203, 0x98806040, 0x20406080, 0x12030600, 0x2020201d, 0x000a181f,
+	0x593c1d09, 0x7a908e72, 0x7059475f, 0x5e7a9286, 0x01001f3f, 0x866d4f2f,
+	0x516d8694, 0x7a5f4335, 0x4f6d868f, 0x30100f2f, 0x988b7050, 0x98989898,
+	0x70909f99, 0x00103050, 0x50301003, 0x74909070, 0x4f657070, 0x04001835,
+	0x6d513518, 0x59728e86, 0x0003203c, 0x4b2c0d08, 0x74707065, 0x50709090,
+	0x06001030, 0x664b2f16, 0x70869680, 0x04203c59, 0x1f031600, 0x705f4f38,
+	0x5e7a8a86, 0x07001f3f, 0x3c2e1f0b, 0x40404040, 0x1627353f, 0x40200500,
+	0x80988060, 0x40404460, 0x00172c3c, 0x35271608, 0x4040403f, 0x172c3c40,
+	0x1f0b0600, 0x44403c2e, 0x80988060, 0x00204060, 0x2e1f0b05, 0x4040403c,
+	0x1627353f, 0x2e120800, 0x9780664b, 0x665a7086, 0x6d869480, 0x00183551,
+	0x5a432701, 0x7a938e72, 0x6d51435f, 0x5f7a9286, 0x0d092743, 0x7a654b2c,
+	0x80808080, 0x86988680, 0x0f2f4f6d, 0x30100300, 0x90907050, 0x4b505470,
+	0x00092238, 0x43270a04, 0x808f7a5f, 0x0d2c4b66, 0x1f030800, 0x54504b38,
+	0x70909070, 0x00103050, 0x43270a05, 0x868b725a, 0x4b66808f, 0x1700162f,
+	0x4435220b, 0x6d706d5a, 0x001d3c59, 0x381f0306, 0x6060594b, 0x515e6060,
+	0x00162d43, 0x60402004, 0x63809880, 0x59606060, 0x00172d44, 0x432d1706,
+	0x60605e51, 0x44596060, 0x0400122c, 0x4b38220b, 0x64606059, 0x60809880,
+	0x04002040, 0x4b382209, 0x60606059, 0x2d43515e, 0x03070017, 0x70593c20,
+	0x69809786, 0x728e907a, 0x0a27435a, 0x2f160100, 0x9780664b, 0x5f516d86,
+	0x6d86927a, 0x00193551, 0x381f0301, 0x60605e4f, 0x8e726460, 0x435a728e,
+	0x03000927, 0x70503010, 0x50709090, 0x0b1f2c34, 0x35190600, 0x8e8e7052,
+	0x19355270, 0x1f0b0900, 0x7050342c, 0x50709090, 0x05001030, 0x6d513519,
+	0x86768b86, 0x435a728b, 0x17000a27, 0x432d1909, 0x434f504f, 0x0600122c,
+	0x654b2c0d, 0x80808072, 0x5a6d7a80, 0x000a2743, 0x60402003, 0x72809880,
+	0x70808080, 0x122c445a, 0x2c120400, 0x7a6d5a44, 0x80808080, 0x1d3c5970,
+	0x22090300, 0x72654f38, 0x86808080, 0x40608099, 0x19040020, 0x72654f35,
+	0x7a808080, 0x2c445a6d, 0x12070012, 0x7a5f442c, 0x867a9090, 0x4b657a92,
+	0x0200162f, 0x593c2004, 0x7a938e72, 0x8f866d5f, 0x27435f7a, 0x0b02000a,
+	0x403f3522, 0x866d5243, 0x4b657a8f, 0x0400162f, 0x70503010, 0x50709090,
+	0x00031330, 0x4b2c0d07, 0x7a8f8066, 0x0927435f, 0x13030900, 0x90705030,
+	0x30507090, 0x0a040010, 0x7a5f4327, 0x72657a8b, 0x516d868b, 0x19001935,
+	0x302f2716, 0x0016272f, 0x50301007, 0x90938c70, 0x86929290, 0x1835516d,
+	0x40200300, 0x86998060, 0x94908f8e, 0x3c597086, 0x02000320, 0x593c2003,
+	0x92928670, 0x80939090, 0x00204060, 0x4f351903, 0x8f8e7a65, 0x9f989090,
+	0x20406080, 0x2c120300, 0x8e7a5f44, 0x9292908f, 0x3c597086, 0x07000320,
+	0x664f3519, 0x98939880, 0x38516d86, 0x0300041f, 0x654b2e12, 0x7086927a,
+	0x66808f7a, 0x0019354f, 0x22180904, 0x7a654b30, 0x516d868f, 0x00041f38,
+	0x50301004, 0x70909070, 0x00103050, 0x3c200308, 0x86907259, 0x12304f6d,
+	0x30100a00, 0x90907050, 0x10305070, 0x35180400, 0x86866d51, 0x8066556d,
+	0x435f7a8f, 0x19000927, 0x0f100f09, 0x0f080009, 0x806d4f2f, 0x7a707280,
+	0x5e7a9286, 0x03001f3f, 0x80604020, 0x7a86989f, 0x80948672, 0x0d2c4b66,
+	0x2e120200, 0x9480664b, 0x72707a86, 0x3f5e7a80, 0x0902001f, 0x7a5f4327,
+	0x707a868f, 0x80998672, 0x00204060, 0x593c1d03, 0x7a8f8670, 0x94867a70,
+	0x2c4b6680, 0x0907000d, 0x70593c22, 0x7a93a186, 0x0c27435f, 0x1f030400,
+	0x866d5138, 0x8e8e7c92, 0x223c5972, 0x0c050009, 0x725a4327, 0x5a728e8e,
+	0x000c2743, 0x50301005, 0x70909070, 0x00103050, 0x4f301209, 0x7290866d,
+	0x03203c59, 0x30100900, 0x90907050, 0x10305070, 0x3f1f0400, 0x7a8b7a5e,
+	0x7259475f, 0x4f6d868e, 0x26000f2f, 0x59432709, 0x595c6060, 0x80988063,
+	0x00204060, 0x60402003, 0x70869980, 0x90725a5f, 0x3050708e, 0x1d020010,
+	0x8e72593c, 0x525f728e, 0x4f5e6059, 0x02001835, 0x6d4f2f0f, 0x617a9286,
+	0x98806152, 0x20406080, 0x27090200, 0x93806144, 0x60596680, 0x708e9072,
+	0x00103050, 0x381f0407, 0xa1866d51, 0x435a7290, 0x05000c27, 0x5f43270c,
+	0x9493907a, 0x2e4b6680, 0x04050012, 0x6d51381f, 0x657a8f86, 0x00162f4b,
+	0x50301006, 0x70909070, 0x00103050, 0x43270909, 0x808f7a5f, 0x0d2c4b66,
+	0x30100900, 0x90907050, 0x10305070, 0x3f1f0400, 0x657a7a5e, 0x654b394f,
+	0x4f6d807a, 0x26000f2f, 0x4f382209, 0x70706d5f, 0x80988070, 0x00204060,
+	0x60402003, 0x61809880, 0x90705045, 0x30507090, 0x20020010, 0x96806040,
+	0x354b6680, 0x353f403c, 0x02000922, 0x70503010, 0x52709090, 0x98806042,
+	0x20406080, 0x2f0f0200, 0x90866d4f, 0x70707076, 0x70909074, 0x00103050,
+	0x4b2f1607, 0x93937a65, 0x516d8695, 0x00041f38, 0x4f351905, 0x86998066,
+	0x203c5970, 0x16050003, 0x7a654b2f, 0x516d868f, 0x09112038, 0x30100500,
+	0x90907050, 0x10305070, 0x35190a00, 0x8e8e7052, 0x19355270, 0x30100900,
+	0x90907050, 0x10305070, 0x35180400, 0x4f5e5e4f, 0x4f382738, 0x4359605e,
+	0x26000927, 0x654f3519, 0x9090867a, 0x809c9390, 0x00204060, 0x60402003,
+	0x60809880, 0x90705040, 0x30507090, 0x20020010, 0x98806040, 0x22406080,
+	0x181f201d, 0x10030009, 0x90705030, 0x40507090, 0x80988060, 0x00204060,
+	0x50301002, 0x909b9070, 0x90909090, 0x50709097, 0x06001030, 0x5a43270c,
+	0x7c908e72, 0x657a938e, 0x00162f4b, 0x40240905, 0x80988060, 0x122c4561,
+	0x270c0500, 0x8e725a43, 0x435a728e, 0x272f3032, 0x10040016, 0x90705030,
+	0x30507090, 0x0d0a0010, 0x80664b2c, 0x435f7a8f, 0x08000927, 0x70503010,
+	0x50709090, 0x04001030, 0x3f352209, 0x1122353f, 0x403f3522, 0x00162c3c,
+	0x43270926, 0x868d7a5f, 0x86808080, 0x40608099, 0x20030020, 0x98806040,
+	0x50406080, 0x70909070, 0x00103050, 0x60402002, 0x60809880, 0x302c2840,
+	0x0016272f, 0x50301003, 0x70909070, 0x80604050, 0x40608098, 0x10020020,
+	0x8e705030, 0x80808093, 0x80808080, 0x0f2f4f6d, 0x1f030500, 0x866d5138,
+	0x7a6c8094, 0x5a728e93, 0x000a2743, 0x60402005, 0x60809880, 0x00022040,
+	0x381f0304, 0x8f866d51, 0x5053657a, 0x434f5050, 0x0300122c, 0x70503010,
+	0x50709090, 0x0a001030, 0x593c2003, 0x6d869072, 0x0012304f, 0x50301008,
+	0x70909070, 0x00103050, 0x1f180905, 0x0009181f, 0x1f180901, 0x00121d20,
+	0x4f2f0f27, 0x7290866d, 0x80676161, 0x40608098, 0x20030020, 0x98806040,
+	0x59486080, 0x708e9072, 0x00103050, 0x60402002, 0x66809680, 0x504b4451,
+	0x122c434f, 0x30100200, 0x90907050, 0x66515270, 0x60809880, 0x02002040,
+	0x664b2c0d, 0x657a9280, 0x60606060, 0x27435960, 0x12050009, 0x7a654b2e,
+	0x5c728e93, 0x8698866d, 0x1935516d, 0x40200500, 0x80988060, 0x00204060,
+	0x4b2c0d05, 0x86927a65, 0x70707074, 0x596d7070, 0x03001d3c, 0x70503010,
+	0x50709090, 0x0b001030, 0x6d4f3012, 0x59729086, 0x0003203c, 0x50301007,
+	0x70909070, 0x00103050, 0x50301039, 0x74908e70, 0x867a6d66, 0x40608099,
+	0x20030020, 0x98806040, 0x6d616780, 0x66809380, 0x000d2c4b, 0x593c1d02,
+	0x7a908e72, 0x7066616d, 0x1d3c596d, 0x2f0f0200, 0x92866d4f, 0x7a6d667a,
+	0x6080978b, 0x02002040, 0x5e3f2103, 0x7286927a, 0x70666066, 0x1d3c596d,
+	0x3c1d0600, 0x938e7259, 0x5f4e657a, 0x7a93907a, 0x0927435f, 0x40200400,
+	0x80988060, 0x00204060, 0x50301005, 0x93a18e70, 0x90909090, 0x60809090,
+	0x03002040, 0x70503010, 0x50709090, 0x00031330, 0x4327090a, 0x808f7a5f,
+	0x122e4b66, 0x13030600, 0x90705030, 0x30507090, 0x03160010, 0x1010100d,
+	0x10101010, 0x10101010, 0x1400030d, 0x664b2c0d, 0x808e9380, 0x92868f86,
+	0x20406080, 0x40200300, 0x909a8060, 0x8f868080, 0x3c597086, 0x02000320,
+	0x654b2e12, 0x8692907a, 0x808b8080, 0x00204060, 0x43270902, 0x90907a5f,
+	0x7c8b8680, 0x40608090, 0x18030020, 0x866d5135, 0x80808e94, 0x60808e80,
+	0x06002040, 0x80604020, 0x516d868e, 0x7a654f3d, 0x4f6d848e, 0x04000f2f,
+	0x7a5e3f1f, 0x4060808e, 0x10050020, 0x8c705030, 0x90909090, 0x8e909090,
+	0x1f3f5e7a, 0x30100300, 0x90907050, 0x2c345070, 0x0a000b1f, 0x6d513519,
+	0x59728e86, 0x05001d3c, 0x342c1f0b, 0x90907050, 0x10305070, 0x1f0b1500,
+	0x3030302c, 0x30303030, 0x30303030, 0x000b1f2c, 0x3c200313, 0x8e807059,
+	0x76808e90, 0x4060808c, 0x1f030020, 0x867a5e3f, 0x8e909090, 0x445a7080,
+	0x0300122c, 0x4f381f03, 0x90867a65, 0x70869090, 0x001d3c59, 0x4f351903,
+	0x908e7a65, 0x8c727a8e, 0x20406080, 0x270a0300, 0x80705a43, 0x9090908e,
+	0x3f5e7a8e, 0x1d06001f, 0x706d593c, 0x2b435a6d, 0x70654f38, 0x2c4b6570,
+	0x1804000d, 0x70654f35, 0x1d3c596d, 0x2c0d0500, 0x7070654b, 0x70707070,
+	0x65707070, 0x0018354f, 0x50301003, 0x70909070, 0x384b5054, 0x09000922,
+	0x6144270a, 0x61809380, 0x00092744, 0x381f0303, 0x7054504b, 0x50709090,
+	0x15001030, 0x504b381f, 0x50505050, 0x50505050, 0x384b5050, 0x13000922,
+	0x59442c12, 0x70707066, 0x6d706566, 0x001d3c59, 0x4f351803, 0x70706d5f,
+	0x59667070, 0x00172d44, 0x38220b05, 0x706d5f4f, 0x5a6d7070, 0x00122c44,
+	0x38220903, 0x7070654f, 0x70656570, 0x1d3c596d, 0x2d160400, 0x70665944,
+	0x70707070, 0x18354f65, 0x2c120600, 0x4f504f43, 0x22172d43, 0x50504b38,
+	0x031f384b, 0x22090400, 0x4f504b38, 0x00122c43, 0x381f0305, 0x5050504b,
+	0x50505050, 0x384b5050, 0x03000922, 0x70503010, 0x70749090, 0x354f6570,
+	0x1d0a0018, 0x8c72593c, 0x2f4f6d84, 0x0d03000f, 0x70654b2c, 0x90907470,
+	0x10305070, 0x4b2c1500, 0x70707065, 0x70707070, 0x70707070, 0x18354f65,
+	0x2c171400, 0x50504b3c, 0x504b4b50, 0x122c434f, 0x22090300, 0x504f4335,
+	0x4b505050, 0x00172c3c, 0x35220b07, 0x50504f43, 0x2d434f50, 0x0b050017,
+	0x504b3822, 0x4b4b5050, 0x2c434f50, 0x17050012, 0x504b3c2c, 0x50505050,
+	0x0922384b, 0x27160700, 0x272f302f, 0x0b010016, 0x30302c1f, 0x000b1f2c,
+	0x2c1f0b06, 0x16272f30, 0x1f0b0700, 0x3030302c, 0x30303030, 0x1f2c3030,
+	0x1004000b, 0x90705030, 0x8e90909b, 0x1f3f5e7a, 0x2e120a00, 0x7070654b,
+	0x0d2c4b65, 0x30100300, 0x908c7050, 0x70909b90, 0x00103050, 0x70503015,
+	0x9090908c, 0x90909090, 0x7a8e9090, 0x001f3f5e, 0x2c201215, 0x2c303030,
+	0x272f302c, 0x09050016, 0x302f2719, 0x2c303030, 0x09001220, 0x2f271909,
+	0x2f303030, 0x07001627, 0x302c1f0b, 0x2c2c3030, 0x16272f30, 0x20120700,
+	0x3030302c, 0x1f2c3030, 0x0909000b, 0x090f100f, 0x0d030300, 0x030d1010,
+	0x0d030800, 0x00090f10, 0x100d0309, 0x10101010, 0x10101010, 0x0500030d,
+	0x6d4f2f0f, 0x90909086, 0x3f5e7a8e, 0x030a001f, 0x504b381f, 0x1f384b50,
+	0x10030003, 0x8c705030, 0x8c909090, 0x10305070, 0x50301500, 0x90908c70,
+	0x90909090, 0x8e909090, 0x1f3f5e7a, 0x0d031600, 0x0d101010, 0x090f100d,
+	0x0f090800, 0x10101010, 0x0c00030d, 0x10100f09, 0x00090f10, 0x100d0309,
+	0x0d0d1010, 0x00090f10, 0x100d0309, 0x10101010, 0x4000030d, 0x5a432709,
+	0x7070706d, 0x354f6570, 0x0b0b0018, 0x30302c1f, 0x000b1f2c, 0x4b2c0d04,
+	0x70707065, 0x4b657070, 0x15000d2c, 0x70654b2c, 0x70707070, 0x70707070,
+	0x4f657070, 0xa9001835, 0x4f432d16, 0x50505050, 0x0922384b, 0x0d030c00,
+	0x030d1010, 0x1f030500, 0x50504b38, 0x4b505050, 0x00031f38, 0x4b381f15,
+	0x50505050, 0x50505050, 0x4b505050, 0x00092238, 0x2f2716aa, 0x30303030,
+	0x000b1f2c, 0x2c1f0b19, 0x30303030, 0x0b1f2c30, 0x1f0b1600, 0x3030302c,
+	0x30303030, 0x30303030, 0x000b1f2c, 0x100f09ac, 0x0d101010, 0x031b0003,
+	0x1010100d, 0x030d1010, 0x0d031800, 0x10101010, 0x10101010, 0x0d101010,
+	0x00ff0003, 0x00ff00ff, 0x100d037d, 0x00090f10, 0x211809f8, 0x2f30302c,
+	0x00091927, 0x1f180916, 0x09181f20, 0x1d120f00, 0x09181f20, 0x18090d00,
+	0x121d201f, 0x18090700, 0x181f201f, 0x120c0009, 0x2020201d, 0x121d2020,
+	0x220b8d00, 0x504b3f35, 0x35434f50, 0x14000922, 0x3f352209, 0x22353f40,
+	0x170d0009, 0x3f403c2c, 0x000b2235, 0x35220b0b, 0x2c3c403f, 0x09050017,
+	0x403f3522, 0x0922353f, 0x2c160a00, 0x4040403c, 0x2c3c4040, 0x098b0016,
+	0x5e4f3822, 0x6d707066, 0x18354f5f, 0x35181400, 0x5e605e4f, 0x0018354f,
+	0x442d160c, 0x4f5e6059, 0x00031f38, 0x381f0309, 0x59605e4f, 0x00162d44,
+	0x4f351804, 0x4f5e605e, 0x09001835, 0x59432709, 0x60606060, 0x27435960,
+	0x198a0009, 0x7a654f35, 0x86908e80, 0x1f3f5e7a, 0x3f1f1400, 0x7a807a5e,
+	0x041f3f5e, 0x27090a00, 0x80705a43, 0x2c4b657a, 0x0e09000d, 0x7a654b2c,
+	0x435a7080, 0x03000927, 0x7a5e3f1f, 0x3f5e7a80, 0x0800031f, 0x6d4f2f0f,
+	0x80808080, 0x2f4f6d80, 0x0989000f, 0x7a5f4327, 0x90909290, 0x40608090,
+	0x09050020, 0x20201f18, 0x20202020, 0x0009181f, 0x60402003, 0x60809880,
+	0x1d202440, 0x14080012, 0x866d4f2f, 0x50708e9a, 0x07001030, 0x30201d12,
+	0x9a8e7050, 0x2f4f6d86, 0x2003000f, 0x98806040, 0x21406080, 0x1d20201d,
+	0x10040012, 0x8c705030, 0x90979090, 0x10305070, 0x1d120600, 0x201f1d20,
+	0x201f1b1f, 0x0009181f, 0x1f180905, 0x201d1d20, 0x121d2020, 0x12030900,
+	0x2020201d, 0x00121d20, 0x1f180907, 0x201d1d20, 0x121d2020, 0x03080003,
+	0x20201d12, 0x1f202020, 0x06000918, 0x1f201d12, 0x20201f1b, 0x000a181f,
+	0x1d120308, 0x20202020, 0x0009181f, 0x2f13090a, 0x92866d4f, 0x7070707a,
+	0x1d3c596d, 0x220b0400, 0x40403f35, 0x40404040, 0x0922353f, 0x40200200,
+	0x80988060, 0x40404460, 0x00172c3c, 0x3c2c1606, 0x95866d4f, 0x2f4f6d86,
+	0x1706000f, 0x40403c2c, 0x95866d4f, 0x2f4f6d86, 0x2003000f, 0x98806040,
+	0x2e406080, 0x3c40403c, 0x0300162c, 0x654b2c0d, 0x90747070, 0x30507090,
+	0x17050010, 0x3c403c2c, 0x393f403f, 0x353f403f, 0x03000b22, 0x3f352209,
+	0x403c3c40, 0x2c3c4040, 0x0b070017, 0x403c2e1f, 0x3c404040, 0x0500172c,
+	0x3f352209, 0x403c3c40, 0x2e3c4040, 0x06000b1f, 0x3c2e1f0b, 0x40404040,
+	0x22353f40, 0x16040009, 0x3f403c2c, 0x40403f39, 0x1627353f, 0x1f0b0600,
+	0x40403c2e, 0x353f4040, 0x08000b22, 0x342f2716, 0x90907050, 0x50505570,
+	0x122c434f, 0x220b0300, 0x605e4f38, 0x60606060, 0x354f5e60, 0x20020018,
+	0x98806040, 0x60606380, 0x2d445960, 0x09040017, 0x60594327, 0x70807164,
+	0x0927435a, 0x2c120500, 0x60605944, 0x80716460, 0x27435a70, 0x20030009,
+	0x98806040, 0x44406080, 0x59606059, 0x00092743, 0x381f0302, 0x7054504b,
+	0x50709090, 0x04001030, 0x59442c12, 0x605e5960, 0x605e555e, 0x1f384f5e,
+	0x18020003, 0x605e4f35, 0x60605959, 0x2d445960, 0x0b050017, 0x594b3822,
+	0x60606060, 0x172d4459, 0x35180400, 0x59605e4f, 0x60606059, 0x22384b59,
+	0x0b040009, 0x594b3822, 0x60606060, 0x354f5e60, 0x09030018, 0x60594327,
+	0x605e555e, 0x43515e60, 0x0400122c, 0x4b38220b, 0x60606059, 0x384f5e60,
+	0x0600031f, 0x4f432c12, 0x90705450, 0x50547090, 0x2c434f50, 0x09020012,
+	0x654f3822, 0x8080807a, 0x7a808080, 0x001f3f5e, 0x60402002, 0x72809880,
+	0x70808080, 0x122c445a, 0x2f0f0300, 0x80806d4f, 0x657a8080, 0x000d2c4b,
+	0x593c1d05, 0x80808070, 0x7a808080, 0x001f3f5e, 0x60402004, 0x60809880,
+	0x80705a49, 0x2f4f6d80, 0x0b03000f, 0x50342c1f, 0x70909070, 0x00103050,
+	0x593c1d04, 0x7a708070, 0x7a6b7a80, 0x4b657a80, 0x0200122e, 0x7a5e3f1f,
+	0x80727080, 0x5a708080, 0x00122c44, 0x38220903, 0x8072654f, 0x70808080,
+	0x162d445a, 0x3f1f0300, 0x70807a5e, 0x80808072, 0x354f6572, 0x09030019,
+	0x654f3822, 0x80808072, 0x5e7a8080, 0x03001f3f, 0x6d4f2f0f, 0x7a687a80,
+	0x6d7a8080, 0x03203c59, 0x1f030200, 0x72654f38, 0x80808080, 0x2c4b657a,
+	0x1d06000d, 0x706d593c, 0x90907470, 0x70707074, 0x1d3c596d, 0x35180200,
+	0x8d7a654f, 0x97909090, 0x6080999f, 0x02002040, 0x80604020, 0x8e8b8699,
+	0x70869490, 0x001d3c59, 0x50301003, 0x98989070, 0x50708e9c, 0x05001030,
+	0x80604020, 0x98989893, 0x60809b99, 0x04002040, 0x80604020, 0x5a608098,
+	0x86948670, 0x0f2f4f6d, 0x13030400, 0x90705030, 0x30507090, 0x20040010,
+	0x8e806040, 0x8e928b7c, 0x8e928b7c, 0x1d3c5972, 0x40200200, 0x7c908060,
+	0x94908e8b, 0x3c597086, 0x1903001d, 0x7a654f35, 0x90908f8e, 0x5a708693,
+	0x000a2743, 0x60402002, 0x8e7c9080, 0x8e93908f, 0x27435f7a, 0x19020009,
+	0x7a654f35, 0x90908f8e, 0x60809b97, 0x03002040, 0x70503010, 0x8d7a8090,
+	0x80939290, 0x122e4b66, 0x2c0d0200, 0x8e7a654b, 0x9290908f, 0x3050708e,
+	0x20060010, 0x90806040, 0x9b9b9090, 0x90909090, 0x20406080, 0x3f1f0200,
+	0x868f7a5e, 0x86727072, 0x5e7a869a, 0x02001f3f, 0x80604020, 0x7286989f,
+	0x80978672, 0x00204060, 0x4f2f0f03, 0x8080806d, 0x50709093, 0x05001030,
+	0x70593c1d, 0x80808080, 0x60809986, 0x04002040, 0x80604020, 0x70648098,
+	0x70869486, 0x0927435a, 0x30100500, 0x90907050, 0x10305070, 0x40200400,
+	0x8e978060, 0x8e97807a, 0x8096807a, 0x00204060, 0x60402002, 0x868f9780,
+	0x97867272, 0x20406080, 0x27090200, 0x907a5f43, 0x72707a90, 0x6d868f80,
+	0x00183551, 0x60402002, 0x868f9780, 0x9280727a, 0x304f6d86, 0x09010012,
+	0x7a5f4327, 0x707a868f, 0x80998672, 0x00204060, 0x50301003, 0x8b869070,
+	0x907a7280, 0x3c59728e, 0x1002001d, 0x8e705030, 0x70707a93, 0x4f6d807a,
+	0x06000f2f, 0x7a5e3f1f, 0x93808080, 0x80808093, 0x3f5e7a80, 0x2002001f,
+	0x98806040, 0x61506180, 0x63809880, 0x0018354f, 0x60402002, 0x70869980,
+	0x9880615a, 0x20406080, 0x27090300, 0x60605943, 0x70909070, 0x00103050,
+	0x442c1205, 0x60606059, 0x80988064, 0x00204060, 0x60402004, 0x71809880,
+	0x70808d86, 0x162d445a, 0x30100600, 0x90907050, 0x10305070, 0x40200400,
+	0x86998060, 0x8699806e, 0x8098806e, 0x00204060, 0x60402002, 0x70869980,
+	0x9880615a, 0x20406080, 0x2f0f0200, 0x92866d4f, 0x5952657a, 0x7a92866d,
+	0x001f3f5e, 0x60402002, 0x70869980, 0x8e70595f, 0x3c597290, 0x0f01001d,
+	0x866d4f2f, 0x52617a92, 0x80988061, 0x00204060, 0x50301003, 0x7a939070,
+	0x80665966, 0x40608096, 0x10020020, 0x90705030, 0x59607290, 0x4359605e,
+	0x06000927, 0x5e4f3518, 0x90706060, 0x60607090, 0x354f5e60, 0x20020018,
+	0x98806040, 0x61506180, 0x60809880, 0x00092440, 0x60402002, 0x61809880,
+	0x9880604a, 0x20406080, 0x2c160400, 0x7050403c, 0x50709090, 0x06001030,
+	0x403c2c17, 0x80604440, 0x40608098, 0x20040020, 0x98806040, 0x7a8d8680,
+	0x2d445966, 0x10070017, 0x90705030, 0x30507090, 0x20040010, 0x98806040,
+	0x98806880, 0x98806880, 0x20406080, 0x40200200, 0x80988060, 0x80604a61,
+	0x40608098, 0x10020020, 0x90705030, 0x38527090, 0x98806144, 0x20406080,
+	0x40200200, 0x80988060, 0x664b4561, 0x60809680, 0x01002040, 0x70503010,
+	0x52709090, 0x98806042, 0x20406080, 0x30100300, 0x90907050, 0x5e435270,
+	0x5e7a807a, 0x02001f3f, 0x6d4f2f0f, 0x7a869586, 0x4b596670, 0x00092238,
+	0x35220906, 0x7050403f, 0x50709090, 0x353f4040, 0x02000922, 0x7a5e3f1f,
+	0x70728692, 0x7a8f8672, 0x001f3f5e, 0x60402003, 0x60809880, 0x98806048,
+	0x20406080, 0x1d120500, 0x90705030, 0x30507090, 0x12070012, 0x4024201d,
+	0x80988060, 0x00204060, 0x60402004, 0x8f869980, 0x465a7086, 0x00061c33,
+	0x30130306, 0x90907050, 0x12305070, 0x40200400, 0x80988060, 0x80988068,
+	0x80988068, 0x00204060, 0x60402002, 0x60809880, 0x98806048, 0x20406080,
+	0x30100200, 0x90907050, 0x40305070, 0x80988060, 0x00204060, 0x60402002,
+	0x60809880, 0x80604040, 0x40608098, 0x10010020, 0x90705030, 0x40507090,
+	0x80988060, 0x00204060, 0x50301003, 0x70909070, 0x5e4f3a50, 0x354f5e60,
+	0x09020018, 0x705a4327, 0x8e929286, 0x4f657280, 0x07001835, 0x301f1809,
+	0x90907050, 0x20305070, 0x0009181f, 0x593c1d03, 0x90989072, 0x7a8d9090,
+	0x18354f65, 0x40200300, 0x80988060, 0x80604860, 0x40608098, 0x0b040020,
+	0x50342c1f, 0x70909070, 0x16273450, 0x20040800, 0x98806040, 0x20406080,
+	0x40200400, 0x80988060, 0x70869480, 0x172d445a, 0x1f0b0500, 0x7050342c,
+	0x50709090, 0x00162734, 0x60402003, 0x68809880, 0x68809880, 0x60809880,
+	0x02002040, 0x80604020, 0x48608098, 0x80988060, 0x00204060, 0x50301002,
+	0x70909070, 0x60403150, 0x60809880, 0x02002040, 0x80604020, 0x40608098,
+	0x9680664b, 0x20406080, 0x30100100, 0x90907050, 0x60405070, 0x60809880,
+	0x03002040, 0x70503010, 0x50709090, 0x403f3531, 0x0922353f, 0x1c020200,
+	0x6d5a4431, 0x948e807a, 0x3f5e7a8e, 0x1009001f, 0x90705030, 0x30507090,
+	0x20060010, 0x97806040, 0x80808086, 0x3d4f657a, 0x03000f28, 0x80604020,
+	0x48608098, 0x80988060, 0x00204060, 0x38220903, 0x7054504b, 0x54709090,
+	0x162d434f, 0x40200800, 0x80988060, 0x00204060, 0x60402004, 0x71809880,
+	0x70869586, 0x172d445a, 0x22090300, 0x54504b38, 0x70909070, 0x2d434f54,
+	0x20020016, 0x98806040, 0x98806880, 0x98806880, 0x20406080, 0x40200200,
+	0x80988060, 0x80604860, 0x40608098, 0x10020020, 0x8e705030, 0x44597290,
+	0x9680664f, 0x20406080, 0x40200200, 0x80988060, 0x70544860, 0x5972908e,
+	0x01001d3c, 0x70503010, 0x52709090, 0x98806651, 0x20406080, 0x30100300,
+	0x90907050, 0x1b305070, 0x181f201f, 0x12030009, 0x524f432c, 0x72665e57,
+	0x60809986, 0x09002040, 0x70503010, 0x50709090, 0x06001030, 0x80604020,
+	0x707a8699, 0x5f6d7070, 0x031f384f, 0x40200200, 0x80988060, 0x80604860,
+	0x40608098, 0x18030020, 0x70654f35, 0x90907470, 0x5a6d7074, 0x00092743,
+	0x60402007, 0x60809880, 0x04002040, 0x80604020, 0x70648098, 0x70869586,
+	0x122c445a, 0x35180200, 0x7070654f, 0x74909074, 0x435a6d70, 0x01000927,
+	0x80604020, 0x80688098, 0x80688098, 0x40608098, 0x20020020, 0x98806040,
+	0x60486080, 0x60809880, 0x02002040, 0x664b2c0d, 0x6d809380, 0x907a6661,
+	0x3c59728e, 0x2002001d, 0x98806040, 0x6d616780, 0x6d868f7a, 0x0012304f,
+	0x4f2f0f01, 0x7a92866d, 0x907a6d66, 0x4060809c, 0x10030020, 0x90705030,
+	0x30507090, 0x1d080010, 0x706d593c, 0x6d61616d, 0x60809880, 0x09002040,
+	0x70503010, 0x50709090, 0x05001030, 0x5e402204, 0x929a937a, 0x86909090,
+	0x2e4b657a, 0x20020012, 0x98806040, 0x60486080, 0x60809880, 0x03002040,
+	0x7a5e3f1f, 0x9b90908e, 0x8690909b, 0x0f2f4f6d, 0x0d030300, 0x40201010,
+	0x80988060, 0x00204060, 0x60402004, 0x60809880, 0x9586705a, 0x3c597086,
+	0x1f02001d, 0x8e7a5e3f, 0x9b9b9090, 0x6d869090, 0x000f2f4f, 0x60402001,
+	0x68809880, 0x68809880, 0x60809880, 0x02002040, 0x80604020, 0x48608098,
+	0x80988060, 0x00204060, 0x3c200302, 0x8f867059, 0x8f808086, 0x4b657a90,
+	0x0200122e, 0x80604020, 0x8080909c, 0x70868f86, 0x0927435a, 0x27090100,
+	0x907a5f43, 0x8b868090, 0x60809986, 0x03002040, 0x70503010, 0x50709090,
+	0x08001030, 0x80604020, 0x80808690, 0x7a909286, 0x001f3f5e, 0x50301009,
+	0x6d868c70, 0x000f2f4f, 0x4b2c0d05, 0x868f7a65, 0x86808080, 0x59728e92,
+	0x02001d3c, 0x80604020, 0x475e7a8e, 0x808e7a5e, 0x00204060, 0x5e3f1f03,
+	0x90908e7a, 0x90909090, 0x2f4f6d86, 0x0b02000f, 0x30302c1f, 0x8060402e,
+	0x40608098, 0x1f040020, 0x8e7a5e3f, 0x5a496080, 0x808e8670, 0x00204060,
+	0x5e3f1f02, 0x90908e7a, 0x90909090, 0x2f4f6d86, 0x1f01000f, 0x8b7a5e3f,
+	0x8b7a667a, 0x8b7a667a, 0x1f3f5e7a, 0x40200200, 0x7a8e8060, 0x7a5e475e,
+	0x4060808e, 0x12030020, 0x705a442c, 0x90909086, 0x4f657a86, 0x00031f38,
+	0x60402002, 0x90939c80, 0x70808e90, 0x162d445a, 0x35190300, 0x8e7a654f,
+	0x807a8e90, 0x40608098, 0x10030020, 0x8c705030, 0x2f4f6d86, 0x1f08000f,
+	0x867a5e3f, 0x90909090, 0x4f657a86, 0x09001835, 0x654b2c0d, 0x435a6d70,
+	0x05000927, 0x70503010, 0x6172908e, 0x806d6160, 0x40608096, 0x1d020020,
+	0x706d593c, 0x4f3c4f65, 0x596d7065, 0x03001d3c, 0x654f3518, 0x70707070,
+	0x6d707070, 0x0927435a, 0x1f030100, 0x50504b38, 0x80614b4b, 0x40608098,
+	0x18040020, 0x70654f35, 0x443c596d, 0x6d706d5a, 0x001d3c59, 0x4f351802,
+	0x70707065, 0x70707070, 0x27435a6d, 0x18010009, 0x70654f35, 0x70655565,
+	0x70655565, 0x18354f65, 0x3c1d0200, 0x65706d59, 0x654f3c4f, 0x3c596d70,
+	0x1704001d, 0x6d5a442d, 0x6d707070, 0x22384f5f, 0x2003000b, 0x98806040,
+	0x70707080, 0x2d445966, 0x09040017, 0x654f3822, 0x69707070, 0x60809880,
+	0x03002040, 0x654b2c0d, 0x435a6d70, 0x08000927, 0x5f4f3518, 0x7070706d,
+	0x4f5f6d70, 0x00092238, 0x381f0309, 0x434f504b, 0x0600162d, 0x70503010,
+	0x66749090, 0x86726660, 0x3f5e7a92, 0x1202001f, 0x504f432c, 0x3828384b,
+	0x434f504b, 0x0300122c, 0x4b382209, 0x50505050, 0x4f505050, 0x00162d43,
+	0x4b2c0d02, 0x66707065, 0x92867266, 0x1f3f5e7a, 0x22090400, 0x4f504b38,
+	0x432d2c43, 0x434f504f, 0x0200122c, 0x4b382209, 0x50505050, 0x4f505050,
+	0x00162d43, 0x38220902, 0x3e4b504b, 0x3e4b504b, 0x384b504b, 0x02000922,
+	0x4f432c12, 0x28384b50, 0x4f504b38, 0x00122c43, 0x432d1705, 0x5050504f,
+	0x2235434f, 0x2004000b, 0x98806040, 0x50506080, 0x172c3c4b, 0x220b0600,
+	0x50504b38, 0x98806050, 0x20406080, 0x1f030300, 0x4f504b38, 0x00162d43,
+	0x35220909, 0x50504f43, 0x434f5050, 0x000b2235, 0x2c1f0b0b, 0x16272f30,
+	0x2f0f0700, 0x94866d4f, 0x8080808e, 0x6d86948e, 0x00183551, 0x2f271603,
+	0x111f2c30, 0x2f302c1f, 0x05001627, 0x302c1f0b, 0x30303030, 0x272f3030,
+	0x10030016, 0x8c705030, 0x8e80808e, 0x516d8694, 0x05001835, 0x302c1f0b,
+	0x1616272f, 0x2f302f27, 0x04001627, 0x302c1f0b, 0x30303030, 0x272f3030,
+	0x0b040016, 0x2c302c1f, 0x2c302c24, 0x2c302c24, 0x04000b1f, 0x302f2716,
+	0x1f111f2c, 0x272f302c, 0x16070016, 0x30302f27, 0x19272f30, 0x20050009,
+	0x98806040, 0x30406080, 0x0012202c, 0x2c1f0b08, 0x60403030, 0x60809880,
+	0x04002040, 0x302c1f0b, 0x0016272f, 0x2719090b, 0x3030302f, 0x19272f30,
+	0x030d0009, 0x090f100d, 0x27090800, 0x80705a43, 0x9090908e, 0x5a70808e,
+	0x000a2743, 0x100f0904, 0x0100030d, 0x0f100d03, 0x03070009, 0x1010100d,
+	0x10101010, 0x0400090f, 0x6d4f2f0f, 0x90909086, 0x5a70808e, 0x000a2743,
+	0x100d0306, 0x0200090f, 0x0f100f09, 0x03060009, 0x1010100d, 0x10101010,
+	0x0600090f, 0x0d100d03, 0x0d100d07, 0x0d100d07, 0x09060003, 0x030d100f,
+	0x0d030100, 0x00090f10, 0x100f0909, 0x090f1010, 0x40200700, 0x7a8e8060,
+	0x0d1f3f5e, 0x030a0003, 0x3f1f100d, 0x808e7a5e, 0x00204060, 0x100d0305,
+	0x0e00090f, 0x10100f09, 0x090f1010, 0x2d161d00, 0x70665944, 0x70707070,
+	0x2d445966, 0x09260016, 0x6d5a4327, 0x70707070, 0x2d445966, 0x1d5f0016,
+	0x706d593c, 0x18354f65, 0x35180f00, 0x6d70654f, 0x001d3c59, 0x3c2c173e,
+	0x5050504b, 0x3c4b5050, 0x2800172c, 0x4f432d16, 0x50505050, 0x172c3c4b,
+	0x2c126000, 0x4b504f43, 0x00092238, 0x3822090f, 0x434f504b, 0x3f00122c,
+	0x302c2012, 0x30303030, 0x0012202c, 0x2f27162a, 0x30303030, 0x0012202c,
+	0x2f271662, 0x0b1f2c30, 0x1f0b1100, 0x272f302c, 0x03410016, 0x1010100d,
+	0x030d1010, 0x0f092c00, 0x10101010, 0x6400030d, 0x0d100f09, 0x03130003,
+	0x090f100d, 0xc300ff00, 0x0f100d03, 0x0bfa0009, 0x2f302c1f, 0xea001627,
+	0x10100d03, 0x0800030d, 0x4b382209, 0x2c434f50, 0x09090012, 0x030d100f,
+	0x2012da00, 0x2c30302c, 0x07000b1f, 0x654f3518, 0x3c596d70, 0x1608001d,
+	0x2c302f27, 0x00091821, 0x201d1258, 0x0009181f, 0x3c2c1779, 0x4b50504b,
+	0x00031f38, 0x5e3f1f06, 0x60808e7a, 0x07002040, 0x4f432d16, 0x353f4b50,
+	0x56000b22, 0x403c2c17, 0x0922353f, 0x2d177700, 0x70665944, 0x2c4b6570,
+	0x2006000d, 0x98806040, 0x20406080, 0x27090600, 0x706d5a43, 0x384f5e66,
+	0x54000922, 0x59442c12, 0x354f5e60, 0x75000118, 0x5a442c12, 0x8c8e8070,
+	0x10305070, 0x40200600, 0x80988060, 0x00204060, 0x4f2f0f06, 0x808e866d,
+	0x354f657a, 0x12530018, 0x70593c20, 0x3f5e7a80, 0x09181f24, 0x18090500,
+	0x121d201f, 0x201d1205, 0x0009181f, 0x201d1205, 0x0009181f, 0x1f180901,
+	0x09181f20, 0x18090300, 0x121d201f, 0x18090300, 0x121d201f, 0x1d120400,
+	0x121d2020, 0x18090100, 0x181f201f, 0x09030009, 0x1f201f18, 0x01000918,
+	0x201f1809, 0x0009181f, 0x201d1205, 0x20202020, 0x181f2020, 0x1d070009,
+	0x8670593c, 0x708c9094, 0x00103050, 0x60402006, 0x60809880, 0x06002040,
+	0x6d4f2f0f, 0x90929086, 0x213f5e7a, 0x17510003, 0x60443c2c, 0x60809680,
+	0x353f4044, 0x03000b22, 0x3f352209, 0x1c2c3c40, 0x3f403c2c, 0x00092235,
+	0x3c2c1603, 0x22353f40, 0x3f352210, 0x22353f40, 0x09010009, 0x403f3522,
+	0x00172c3c, 0x35220b01, 0x2c3c403f, 0x16020016, 0x40403c2c, 0x22172c3c,
+	0x3f403f35, 0x00092235, 0x35220901, 0x353f403f, 0x35221022, 0x353f403f,
+	0x03000922, 0x403c2c16, 0x40404040, 0x353f4040, 0x06000922, 0x80604020,
+	0x70728697, 0x0d2c4b65, 0x40200600, 0x80988060, 0x00204060, 0x43270906,
+	0x80706d5a, 0x4b668096, 0x50000d2c, 0x59442c12, 0x98806460, 0x60606480,
+	0x1f384f5e, 0x18020003, 0x605e4f35, 0x44334459, 0x4f5e6059, 0x02001835,
+	0x59432709, 0x384f5e60, 0x5e4f3523, 0x354f5e60, 0x18010018, 0x605e4f35,
+	0x142c4459, 0x5e4f381f, 0x27435960, 0x43270909, 0x59606059, 0x4f382d44,
+	0x4f5e605e, 0x01001835, 0x5e4f3518, 0x384f5e60, 0x5e4f3523, 0x354f5e60,
+	0x09020018, 0x60594327, 0x60606060, 0x4f5e6060, 0x06001835, 0x80604020,
+	0x50618098, 0x031f384b, 0x40200600, 0x80988060, 0x00204060, 0x432d1607,
+	0x9072594f, 0x3050708e, 0x03080010, 0x030d100d, 0x3c1d4300, 0x80807059,
+	0x80869a86, 0x657a8080, 0x000d2c4b, 0x5e3f1f02, 0x5970807a, 0x80705943,
+	0x1f3f5e7a, 0x2f0f0200, 0x7a806d4f, 0x43324b65, 0x7a807a5f, 0x001f3f5e,
+	0x5e3f1f01, 0x5970807a, 0x4b31303c, 0x6d807a65, 0x0f0f2f4f, 0x806d4f2f,
+	0x445a7080, 0x807a654f, 0x1f3f5e7a, 0x3f1f0100, 0x7a807a5e, 0x43314b65,
+	0x7a807a5f, 0x001f3f5e, 0x4f2f0f02, 0x8080806d, 0x80808080, 0x1f3f5e7a,
+	0x20060500, 0x98806040, 0x2d406080, 0x07000b1f, 0x80604020, 0x40608098,
+	0x16080020, 0x70503427, 0x50709090, 0x07001230, 0x302c2012, 0x1212202c,
+	0x181f201d, 0x203c0009, 0x93806040, 0x9aa59a98, 0x8b989898, 0x10305070,
+	0x40200200, 0x80968060, 0x80604860, 0x40608096, 0x10020020, 0x90705030,
+	0x3d59728e, 0x92866d4f, 0x1f3f5e7a, 0x40200100, 0x80968060, 0x4b504c60,
+	0x908e7050, 0x10305070, 0x664b2c0d, 0x70869480, 0x907a5f59, 0x3c59728e,
+	0x1f01001d, 0x927a5e3f, 0x3a52708e, 0x92866d4f, 0x1f3f5e7a, 0x30100200,
+	0x98907050, 0x9c989898, 0x4060809b, 0x0b040020, 0x60402d1f, 0x60809880,
+	0x00062040, 0x60402008, 0x60809880, 0x09002040, 0x70503012, 0x50709090,
+	0x00162734, 0x3c2c1705, 0x3c4b504b, 0x403c2c2e, 0x0922353f, 0x3c1d3b00,
+	0x80807059, 0x80869a86, 0x657a8080, 0x000d2c4b, 0x60402002, 0x60809880,
+	0x98806048, 0x20406080, 0x2f0f0200, 0x97866d4f, 0x59476180, 0x708e9072,
+	0x00183552, 0x60402001, 0x60809880, 0x56657065, 0x708e9070, 0x03103050,
+	0x70593c20, 0x66809486, 0x7a8f8670, 0x122e4b65, 0x35180100, 0x938e7052,
+	0x59455e7a, 0x708e9072, 0x00183552, 0x4f2f0f02, 0x8080806d, 0x90938080,
+	0x1f3f5e7a, 0x22090300, 0x61504b38, 0x60809680, 0x09002040, 0x80604020,
+	0x40608098, 0x10090020, 0x90705030, 0x4f557090, 0x00122c43, 0x442d1603,
+	0x66706659, 0x59444b59, 0x354f5e60, 0x123b0018, 0x6059442c, 0x80988064,
+	0x5e606064, 0x031f384f, 0x40200200, 0x80988060, 0x80604860, 0x40608098,
+	0x09020020, 0x7a5f4327, 0x516d8692, 0x80938061, 0x0d2c4b66, 0x3f1f0100,
+	0x80927a5e, 0x7a8a7264, 0x80907060, 0x0d2c4b66, 0x2c120100, 0x8e725a44,
+	0x93807a90, 0x384f6680, 0x0100031f, 0x664b2c0d, 0x66809680, 0x93806652,
+	0x2c4b6680, 0x0902000d, 0x60594327, 0x866e6160, 0x4f657a8f, 0x03001835,
+	0x654f3518, 0x8e867270, 0x1d3c5972, 0x40200900, 0x80988060, 0x00204060,
+	0x50301009, 0x7a938e70, 0x3c596d70, 0x0a02001d, 0x705a4327, 0x72808b80,
+	0x806d5465, 0x1f3f5e7a, 0x2c173c00, 0x8060443c, 0x44608098, 0x22353f40,
+	0x2003000b, 0x98806040, 0x60486080, 0x60809880, 0x03002040, 0x70523519,
+	0x5c72908e, 0x7290866d, 0x03203c59, 0x35180100, 0x80907052, 0x8697806a,
+	0x80927a6d, 0x04224060, 0x2f170200, 0x8f7a654b, 0x70868d86, 0x0b223c59,
+	0x20030200, 0x8e72593c, 0x705c728e, 0x5972908e, 0x0003203c, 0x3c2c1603,
+	0x7a655042, 0x516d868f, 0x00092238, 0x5e3f1f03, 0x8f908e7a, 0x2e4b657a,
+	0x20090012, 0x98806040, 0x20406080, 0x2c0d0900, 0x937a654b, 0x60809093,
+	0x02002040, 0x6d513518, 0x8f908f86, 0x7266748c, 0x40608090, 0x123d0020,
+	0x80604023, 0x40608098, 0x09181f24, 0x40200400, 0x80988060, 0x80604860,
+	0x40608098, 0x0d030020, 0x80664b2c, 0x7a678093, 0x4f6d8692, 0x02001230,
+	0x70503010, 0x86768e90, 0x807a8f92, 0x40608098, 0x06030020, 0x6b513820,
+	0x72909c80, 0x132c445a, 0x2e120400, 0x9680664b, 0x927a6780, 0x304f6d86,
+	0x03040012, 0x5f442d1a, 0x70868f7a, 0x0c27435a, 0x3f1f0400, 0x908e7a5e,
+	0x4f657a8f, 0x09001835, 0x80604020, 0x40608098, 0x0d090020, 0x7a654b2c,
+	0x8090908f, 0x00204060, 0x5e3f1f02, 0x7080927a, 0x808e8d7a, 0x5e7a8f86,
+	0x3e001f3f, 0x80604020, 0x40608098, 0x16272f2e, 0x40200400, 0x80988060,
+	0x80604860, 0x40608098, 0x03030020, 0x72593c20, 0x80718690, 0x435f7a92,
+	0x02000927, 0x70503010, 0x8e78908e, 0x80809080, 0x3f5e7a92, 0x1603001f,
+	0x725a442d, 0x7a8f938e, 0x1f384f65, 0x03030004, 0x7a5e3f21, 0x80718692,
+	0x435f7a92, 0x04000927, 0x5a43270c, 0x7a8f8670, 0x2735445f, 0x18040016,
+	0x70654f35, 0x7a8f8672, 0x001f3f5e, 0x60402009, 0x60809880, 0x09002040,
+	0x70503010, 0x7074908e, 0x1d3c596d, 0x3f1f0200, 0x7a8b7a5e, 0x8e7a655f,
+	0x6d869296, 0x00183551, 0x6040203e, 0x60809880, 0x434f4b46, 0x0300162d,
+	0x80604020, 0x50608098, 0x80988066, 0x00204060, 0x4f301204, 0x7c92866d,
+	0x52708e8e, 0x03001935, 0x664b2c0d, 0x8e809080, 0x808e8676, 0x35527090,
+	0x0c020018, 0x705a4327, 0x867a8f86, 0x4b657a8f, 0x0400172f, 0x6d513518,
+	0x8e7c9286, 0x3552708e, 0x09040019, 0x6d513822, 0x657a8d86, 0x434f5056,
+	0x0300162d, 0x4b382209, 0x98806150, 0x20406080, 0x40200900, 0x80988060,
+	0x00204060, 0x50301009, 0x70909070, 0x2c434f54, 0x18020012, 0x70654f35,
+	0x654f4f65, 0x6d7a8072, 0x0a27435a, 0x40203e00, 0x80968060, 0x6d66616d,
+	0x0927435a, 0x40200200, 0x80988060, 0x8f7a6667, 0x4060809a, 0x09040020,
+	0x80614427, 0x808f8697, 0x0d2c4b66, 0x22040300, 0x92806040, 0x806e8686,
+	0x7090868f, 0x00103050, 0x381f0301, 0x95866d51, 0x907a6d86, 0x445a728e,
+	0x0300122c, 0x6144270a, 0x8f869780, 0x2c4b6680, 0x1804000d, 0x7a654f35,
+	0x70728092, 0x5a6d7070, 0x00092743, 0x2d1f0b03, 0x98806040, 0x20406080,
+	0x40200900, 0x80988060, 0x00204060, 0x50301009, 0x70909070, 0x16273450,
+	0x22090300, 0x4b504b38, 0x594b3838, 0x43515e60, 0x3f00162d, 0x72593c1d,
+	0x8086928e, 0x4f6d8680, 0x02000f2f, 0x7a5e3f1f, 0x80809090, 0x8092868d,
+	0x00204060, 0x593c1d05, 0x909d8e72, 0x203c5972, 0x20040003, 0x9c806040,
+	0x72648097, 0x708e9d90, 0x00103050, 0x4b2c0d01, 0x8e937a65, 0x80665a72,
+	0x59708694, 0x03001d3c, 0x593c1d01, 0x909d8e72, 0x203c5972, 0x1f040003,
+	0x907a5e3f, 0x909093a1, 0x6d869090, 0x000f2f4f, 0x40200604, 0x80988060,
+	0x06204060, 0x40200800, 0x80988060, 0x00204060, 0x50301209, 0x70909070,
+	0x00123050, 0x2c1f0b05, 0x1f1f2c30, 0x3f403c2e, 0x00162735, 0x4b2e1240,
+	0x90867a65, 0x6d869090, 0x000f2f4f, 0x4f351802, 0x908e7a65, 0x8c76808e,
+	0x20406080, 0x2e120500, 0x9080664b, 0x304f6d86, 0x1f050012, 0x8e7a5e3f,
+	0x6d5b728c, 0x66809086, 0x000d2c4b, 0x50301001, 0x7a8e8a70, 0x70594b65,
+	0x60808e86, 0x02002040, 0x31211809, 0x9980664b, 0x304f6d86, 0x1f050012,
+	0x8e7a5e3f, 0x90909090, 0x6d869090, 0x000f2f4f, 0x60402005, 0x60809880,
+	0x0b1f2d40, 0x40200700, 0x80988060, 0x00204060, 0x34271608, 0x90907050,
+	0x10305070, 0x0d030600, 0x03030d10, 0x1f201d12, 0x41000a18, 0x4f381f03,
+	0x70706d5f, 0x435a6d70, 0x02000927, 0x4f382209, 0x70707065, 0x6d706566,
+	0x001d3c59, 0x3c200305, 0x6d706d59, 0x0927435a, 0x35180500, 0x7070654f,
+	0x6d5a4e65, 0x3c596d70, 0x01000320, 0x654b2c0d, 0x4f657070, 0x6d5a4438,
+	0x3c596d70, 0x0901001d, 0x443f3522, 0x92867059, 0x27435f7a, 0x18050009,
+	0x70654f35, 0x70707070, 0x5a6d7070, 0x00092743, 0x60402005, 0x61809880,
+	0x1f384b50, 0x20060003, 0x98806040, 0x20406080, 0x2d160700, 0x72594f43,
+	0x50709090, 0x54001030, 0x4335220b, 0x5050504f, 0x162d434f, 0x220b0400,
+	0x50504b38, 0x504b4b50, 0x122c434f, 0x2c120600, 0x4f504f43, 0x00162d43,
+	0x38220906, 0x4b50504b, 0x504f4338, 0x122c434f, 0x1f030200, 0x50504b38,
+	0x2d22384b, 0x4f504f43, 0x00122c43, 0x4f351801, 0x806d615e, 0x516d8694,
+	0x06001935, 0x4b382209, 0x50505050, 0x4f505050, 0x00162d43, 0x60402006,
+	0x72869780, 0x2c4b6570, 0x2006000d, 0x98806040, 0x20406080, 0x27090600,
+	0x706d5a43, 0x6d869780, 0x000f2f4f, 0x27190955, 0x3030302f, 0x0016272f,
+	0x2c1f0b06, 0x2c303030, 0x272f302c, 0x16080016, 0x2f302f27, 0x08001627,
+	0x302c1f0b, 0x271f2c30, 0x272f302f, 0x0b040016, 0x30302c1f, 0x160b1f2c,
+	0x2f302f27, 0x02001627, 0x7a5e3f1f, 0x868f8680, 0x27435a70, 0x0b07000a,
+	0x30302c1f, 0x30303030, 0x16272f30, 0x3c1d0700, 0x94867059, 0x50708c90,
+	0x06001030, 0x80604020, 0x40608098, 0x0f060020, 0x866d4f2f, 0x7a909290,
+	0x0927435f, 0x0f095700, 0x0f101010, 0x03080009, 0x1010100d, 0x0f100d0d,
+	0x090a0009, 0x090f100f, 0x0d030a00, 0x030d1010, 0x0f100f09, 0x03060009,
+	0x0d10100d, 0x09020003, 0x090f100f, 0x40200300, 0x90908060, 0x445a7086,
+	0x0900162d, 0x10100d03, 0x10101010, 0x00090f10, 0x442c1208, 0x8e80705a,
+	0x3050708c, 0x1f060010, 0x8e7a5e3f, 0x20406080, 0x2f0f0600, 0x8e866d4f,
+	0x4f657a80, 0xab001935, 0x6d593c1d, 0x5a6d7070, 0x00172d44, 0x442d171e,
+	0x70706659, 0x0d2c4b65, 0x35180600, 0x6d70654f, 0x001d3c59, 0x43270906,
+	0x66706d5a, 0x22384f5e, 0x12ab0009, 0x504f432c, 0x2d434f50, 0x17200017,
+	0x504b3c2c, 0x1f384b50, 0x09060003, 0x504b3822, 0x122c434f, 0x2d160700,
+	0x4b504f43, 0x0b22353f, 0x2716ad00, 0x2f30302f, 0x22001627, 0x302c2012,
+	0x0b1f2c30, 0x1f0b0800, 0x272f302c, 0x16090016, 0x2c302f27, 0x00091821,
+	0x100f09af, 0x00090f10, 0x100d0324, 0x00030d10, 0x100d030a, 0x0b00090f,
+	0x0d100f09, 0x00550003
+};
+
+// CLUT, RGBA32:
+static const uint32 consolasSdfClut[] __attribute__((aligned(16))) = {
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x04808080, 0x08808080, 0x0c808080,
+	0x10808080, 0x14808080, 0x18808080, 0x1c808080, 0x00808080, 0x00808080,
+	0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080,
+	0x20808080, 0x24808080, 0x28808080, 0x2c808080, 0x30808080, 0x34808080,
+	0x38808080, 0x3c808080, 0x40808080, 0x44808080, 0x48808080, 0x4c808080,
+	0x50808080, 0x54808080, 0x58808080, 0x5c808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x60808080, 0x64808080, 0x68808080, 0x6c808080, 0x70808080, 0x74808080,
+	0x78808080, 0x7c808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080, 0x80808080,
+	0x80808080, 0x80808080, 0x80808080, 0x80808080
+};
+
+// Glyph UVs {u0, v0, u1, v1}, 12:4 fixed-point:
+static const uint16 consolasSdfGlyphs[][4] __attribute__((aligned(16))) = {
+	{ 48, 48, 232, 432 }, { 336, 48, 520, 432 }, { 624, 48, 808, 432 }, { 912, 48, 1096, 432 },
+	{ 1200, 48, 1384, 432 }, { 1488, 48, 1672, 432 }, { 1776, 48, 1960, 432 }, { 2064, 48, 2248, 432 },
+	{ 2352, 48, 2536, 432 }, { 2640, 48, 2824, 432 }, { 2928, 48, 3112, 432 }, { 3216, 48, 3400, 432 },
+	{ 3504, 48, 3688, 432 }, { 3792, 48, 3976, 432 }, { 48, 528, 232, 912 }, { 336, 528, 520, 912 },
+	{ 624, 528, 808, 912 }, { 912, 528, 1096, 912 }, { 1200, 528, 1384, 912 }, { 1488, 528, 1672, 912 },
+	{ 1776, 528, 1960, 912 }, { 2064, 528, 2248, 912 }, { 2352, 528, 2536, 912 }, { 2640, 528, 2824, 912 },
+	{ 2928, 528, 3112, 912 }, { 3216, 528, 3400, 912 }, { 3504, 528, 3688, 912 }, { 3792, 528, 3976, 912 },
+	{ 48, 1008, 232, 1392 }, { 336, 1008, 520, 1392 }, { 624, 1008, 808, 1392 }, { 912, 1008, 1096, 1392 },
+	{ 1200, 1008, 1384, 1392 }, { 1488, 1008, 1672, 1392 }, { 1776, 1008, 1960, 1392 }, { 2064, 1008, 2248, 1392 },
+	{ 2352, 1008, 2536, 1392 }, { 2640, 1008, 2824, 1392 }, { 2928, 1008, 3112, 1392 }, { 3216, 1008, 3400, 1392 },
+	{ 3504, 1008, 3688, 1392 }, { 3792, 1008, 3976, 1392 }, { 48, 1488, 232, 1872 }, { 336, 1488, 520, 1872 },
+	{ 624, 1488, 808, 1872 }, { 912, 1488, 1096, 1872 }, { 1200, 1488, 1384, 1872 }, { 1488, 1488, 1672, 1872 },
+	{ 1776, 1488, 1960, 1872 }, { 2064, 1488, 2248, 1872 }, { 2352, 1488, 2536, 1872 }, { 2640, 1488, 2824, 1872 },
+	{ 2928, 1488, 3112, 1872 }, { 3216, 1488, 3400, 1872 }, { 3504, 1488, 3688, 1872 }, { 3792, 1488, 3976, 1872 },
+	{ 48, 1968, 232, 2352 }, { 336, 1968, 520, 2352 }, { 624, 1968, 808, 2352 }, { 912, 1968, 1096, 2352 },
+	{ 1200, 1968, 1384, 2352 }, { 1488, 1968, 1672, 2352 }, { 1776, 1968, 1960, 2352 }, { 2064, 1968, 2248, 2352 },
+	{ 2352, 1968, 2536, 2352 }, { 2640, 1968, 2824, 2352 }, { 2928, 1968, 3112, 2352 }, { 3216, 1968, 3400, 2352 },
+	{ 3504, 1968, 3688, 2352 }, { 3792, 1968, 3976, 2352 }, { 48, 2448, 232, 2832 }, { 336, 2448, 520, 2832 },
+	{ 624, 2448, 808, 2832 }, { 912, 2448, 1096, 2832 }, { 1200, 2448, 1384, 2832 }, { 1488, 2448, 1672, 2832 },
+	{ 1776, 2448, 1960, 2832 }, { 2064, 2448, 2248, 2832 }, { 2352, 2448, 2536, 2832 }, { 2640, 2448, 2824, 2832 },
+	{ 2928, 2448, 3112, 2832 }, { 3216, 2448, 3400, 2832 }, { 3504, 2448, 3688, 2832 }, { 3792, 2448, 3976, 2832 },
+	{ 48, 2928, 232, 3312 }, { 336, 2928, 520, 3312 }, { 624, 2928, 808, 3312 }, { 912, 2928, 1096, 3312 },
+	{ 1200, 2928, 1384, 3312 }, { 1488, 2928, 1672, 3312 }, { 1776, 2928, 1960, 3312 }, { 2064, 2928, 2248, 3312 },
+	{ 2352, 2928, 2536, 3312 }, { 2640, 2928, 2824, 3312 }, { 2928, 2928, 3112, 3312 }, { 3216, 2928, 3400, 3312 }
+};
+
+// Metrics of each BuiltInFontId {advance, line height}, in pixels:
+static const ubyte consolasSdfMetrics[][2] __attribute__((aligned(16))) = {
+	{ 5, 10 },
+	{ 6, 12 },
+	{ 8, 16 },
+	{ 10, 20 },
+	{ 12, 24 },
+	{ 14, 30 },
+	{ 17, 36 },
+	{ 19, 40 },
+	{ 23, 48 }
+};
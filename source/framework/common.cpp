@@ -50,6 +50,7 @@
 #if USE_CUSTOM_ASSERT
 void ps2AssertFailed(const char * cond, const char * filename, const int lineNum)
 {
+	logFlush(); // Pending messages first.
 	gConsole.setTextColor(0xFF0000FF); // Red text
 
 	gConsole.print(format(
@@ -105,18 +106,17 @@ char * vformat(const char * fmt, va_list vaList)
 }
 
 // ========================================================
-// logPrintf():
+// logOutput():
 // ========================================================
 
-void logPrintf(const char * messageTag, const char * filename, const int lineNum, const char * fmt, ...)
+namespace
 {
-	// Supply defaults if needed:
-	if (messageTag == nullptr) { messageTag = "???"; }
-	if (filename   == nullptr) { filename   = "???"; }
-	if (fmt        == nullptr) { fmt        = "???"; }
 
+// Prints a formatted message to the console. Shared by the immediate and deferred logs.
+void logOutput(const char messageTag, const char * filename, const int lineNum, const char * message)
+{
 	// Set proper text color according to message type:
-	switch (*messageTag)
+	switch (messageTag)
 	{
 	case 'C' : // Comment/info message, white text:
 		gConsole.setTextColor(0xFFFFFFFF);
@@ -130,20 +130,20 @@ void logPrintf(const char * messageTag, const char * filename, const int lineNum
 	default : // Unknown token, but accept it anyway.
 		gConsole.restoreTextColor();
 		break;
-	} // switch (*messageTag)
+	} // switch (messageTag)
 
 	// (Optional) message prefix: "<TAG> filename lineNum : "
 	#if LOG_PRINTF_ADD_MESSAGE_PREFIX
 	const char * trimmedFilename = strrchr(filename, '/');
-	gConsole.print(format("<%s> %-15.14s%-4d: ", messageTag,
+	gConsole.print(format("<%c> %-15.14s%-4d: ", messageTag,
 		(trimmedFilename != nullptr) ? trimmedFilename + 1 : filename, lineNum));
+	#else // !LOG_PRINTF_ADD_MESSAGE_PREFIX
+	(void)filename;
+	(void)lineNum;
 	#endif // LOG_PRINTF_ADD_MESSAGE_PREFIX
 
 	// The message itself:
-	va_list vaList;
-	va_start(vaList, fmt);
-	gConsole.print(vformat(fmt, vaList));
-	va_end(vaList);
+	gConsole.print(message);
 
 	// A default line break is implicit.
 	gConsole.print("\n");
@@ -152,6 +152,540 @@ void logPrintf(const char * messageTag, const char * filename, const int lineNum
 	gConsole.restoreTextColor();
 }
 
+} // namespace {}
+
+// ========================================================
+// logPrintf():
+// ========================================================
+
+void logPrintf(const char * messageTag, const char * filename, const int lineNum, const char * fmt, ...)
+{
+	// Supply defaults if needed:
+	if (messageTag == nullptr) { messageTag = "???"; }
+	if (filename   == nullptr) { filename   = "???"; }
+	if (fmt        == nullptr) { fmt        = "???"; }
+
+	va_list vaList;
+	va_start(vaList, fmt);
+	logOutput(*messageTag, filename, lineNum, vformat(fmt, vaList));
+	va_end(vaList);
+}
+
+// ========================================================
+// Deferred log ring buffer:
+// ========================================================
+
+namespace
+{
+
+//
+// Each record is a LogRecordHeader followed by the arguments, in the order
+// the format string consumes them. Integers and pointers take 4 or 8 bytes,
+// doubles 8 bytes, strings a 16-bit length plus the chars. Records are padded
+// to 4 bytes and never wrap around the end of the ring; a header with a zero
+// tag skips the rest of the ring instead. `tools/log_decoder` reads the same
+// layout, so keep the two in sync.
+//
+static const uint LOG_RING_SIZE       = 16384; // Power of 2
+static const uint LOG_MAX_RECORD_SIZE = 1024;
+static const uint LOG_MAX_STRING_ARG  = 255;
+
+struct LogRecordHeader
+{
+	uint16 size;   // Of the whole record, in bytes.
+	uint8  tag;    // First char of the message tag. Zero for padding.
+	uint8  unused;
+	uint32 fmt;    // Address of the format string.
+	uint32 filename;
+	int32  lineNum;
+};
+
+// Start of a dump file. Sizes tell the decoder how the arguments were stored.
+struct LogDumpHeader
+{
+	char  magic[4]; // "PLOG"
+	uint8 version;
+	uint8 sizeOfLong;
+	uint8 sizeOfSizeT;
+	uint8 sizeOfPointer;
+};
+
+static ubyte logRing[LOG_RING_SIZE] ATTRIBUTE_ALIGNED(16);
+static volatile uint32 logRingWritePos; // Only written by the producer.
+static volatile uint32 logRingReadPos;  // Only written by the consumer.
+static volatile uint   logDroppedCount;
+static volatile bool   logAsyncFlush;
+static FILE * logDumpFile;
+
+// Kinds of arguments a conversion takes:
+enum LogArgType
+{
+	LOG_ARG_NONE,
+	LOG_ARG_INT,
+	LOG_ARG_DOUBLE,
+	LOG_ARG_STRING,
+	LOG_ARG_POINTER
+};
+
+struct LogFormatSpec
+{
+	const char * start;  // The '%'.
+	const char * end;    // One past the conversion char.
+	LogArgType   type;
+	uint         size;   // Bytes, for LOG_ARG_INT.
+	uint         stars;  // '*' width/precision, each an extra int.
+};
+
+// Scans one conversion spec, `fmt` pointing at the '%'.
+void parseLogFormatSpec(const char * fmt, LogFormatSpec & spec)
+{
+	spec.start = fmt++;
+	spec.type  = LOG_ARG_NONE;
+	spec.size  = sizeof(int);
+	spec.stars = 0;
+
+	// Flags, width and precision:
+	while (*fmt != '\0' && strchr("-+ #0123456789.*", *fmt) != nullptr)
+	{
+		if (*fmt++ == '*')
+		{
+			spec.stars++;
+		}
+	}
+
+	// Length modifiers:
+	for (uint longs = 0;; ++fmt)
+	{
+		if      (*fmt == 'l') { spec.size = (++longs == 1) ? sizeof(long) : sizeof(long long); }
+		else if (*fmt == 'q' || *fmt == 'j' || *fmt == 'L') { spec.size = sizeof(long long); }
+		else if (*fmt == 'z' || *fmt == 't') { spec.size = sizeof(size_t); }
+		else if (*fmt != 'h') { break; }
+	}
+
+	switch (*fmt)
+	{
+	case 'd' : case 'i' : case 'u' : case 'o' :
+	case 'x' : case 'X' : case 'c' :
+		spec.type = LOG_ARG_INT;
+		break;
+	case 'e' : case 'E' : case 'f' : case 'F' :
+	case 'g' : case 'G' : case 'a' : case 'A' :
+		spec.type = LOG_ARG_DOUBLE;
+		break;
+	case 's' :
+		spec.type = LOG_ARG_STRING;
+		break;
+	case 'p' :
+		spec.type = LOG_ARG_POINTER;
+		break;
+	default : // "%%", "%n" or malformed. No argument.
+		break;
+	} // switch (*fmt)
+
+	spec.end = (*fmt != '\0') ? fmt + 1 : fmt;
+}
+
+// Appends a value to the record being built, if it fits.
+inline bool logRecordAppend(ubyte * record, uint & used, const void * data, const uint size)
+{
+	if (used + size > LOG_MAX_RECORD_SIZE)
+	{
+		return false;
+	}
+	memcpy(record + used, data, size);
+	used += size;
+	return true;
+}
+
+// Formats a single argument, passing the '*' width/precision values first.
+template<class T>
+inline int logFormatArg(char * out, const uint outSize, const char * spec,
+                        const uint stars, const int * starArgs, const T value)
+{
+	switch (stars)
+	{
+	case 0  : return snprintf(out, outSize, spec, value);
+	case 1  : return snprintf(out, outSize, spec, starArgs[0], value);
+	default : return snprintf(out, outSize, spec, starArgs[0], starArgs[1], value);
+	} // switch (stars)
+}
+
+// Reads a value back from a record.
+inline const ubyte * logRecordRead(const ubyte * ptr, void * data, const uint size)
+{
+	memcpy(data, ptr, size);
+	return ptr + size;
+}
+
+// Copies a whole record into the ring. Single producer.
+bool logRingPush(const ubyte * record, const uint size)
+{
+	uint32 writePos = logRingWritePos;
+	const uint32 readPos = logRingReadPos;
+
+	const uint offset  = writePos & (LOG_RING_SIZE - 1);
+	const uint padding = (offset + size > LOG_RING_SIZE) ? (LOG_RING_SIZE - offset) : 0;
+
+	if ((writePos - readPos) + padding + size > LOG_RING_SIZE)
+	{
+		// Without a background consumer it is safe to make room right here.
+		if (logAsyncFlush)
+		{
+			logDroppedCount++;
+			return false;
+		}
+
+		logFlush();
+		writePos = logRingWritePos;
+	}
+
+	if (padding != 0)
+	{
+		// Only the size and tag, which always fit.
+		LogRecordHeader * skip = rcast<LogRecordHeader *>(&logRing[offset]);
+		skip->size = scast<uint16>(padding);
+		skip->tag  = 0;
+		writePos  += padding;
+	}
+
+	memcpy(&logRing[writePos & (LOG_RING_SIZE - 1)], record, size);
+
+	// The record must be complete before the consumer can see it.
+	__asm__ __volatile__ ("" ::: "memory");
+	logRingWritePos = writePos + size;
+	return true;
+}
+
+// Formats a record back into text, one conversion at a time.
+void logFormatRecord(const LogRecordHeader & header, char * buffer, const uint bufferSize)
+{
+	const ubyte * args = rcast<const ubyte *>(&header + 1);
+	const char  * fmt  = rcast<const char *>(header.fmt);
+	uint used = 0;
+
+	while (*fmt != '\0' && used < bufferSize - 1)
+	{
+		if (*fmt != '%')
+		{
+			buffer[used++] = *fmt++;
+			continue;
+		}
+
+		LogFormatSpec spec;
+		parseLogFormatSpec(fmt, spec);
+		fmt = spec.end;
+
+		int starArgs[2] = { 0, 0 };
+		for (uint s = 0; s < spec.stars && s < 2; ++s)
+		{
+			args = logRecordRead(args, &starArgs[s], sizeof(int));
+		}
+
+		// Copy of the spec, without the length modifiers. They are put back as needed.
+		char specStr[32];
+		uint specLen = 0;
+		for (const char * c = spec.start; c < spec.end - 1 && specLen < sizeof(specStr) - 4; ++c)
+		{
+			if (strchr("hlqjztL", *c) == nullptr)
+			{
+				specStr[specLen++] = *c;
+			}
+		}
+
+		const char conv = *(spec.end - 1);
+		if (spec.type == LOG_ARG_INT && spec.size == sizeof(long long))
+		{
+			specStr[specLen++] = 'l';
+			specStr[specLen++] = 'l';
+		}
+		specStr[specLen++] = conv;
+		specStr[specLen]   = '\0';
+
+		char * out = buffer + used;
+		const uint outSize = bufferSize - used;
+		int written = 0;
+
+		switch (spec.type)
+		{
+		case LOG_ARG_INT :
+			if (spec.size == sizeof(long long))
+			{
+				long long value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			else
+			{
+				int value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			break;
+
+		case LOG_ARG_DOUBLE :
+			{
+				double value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			break;
+
+		case LOG_ARG_STRING :
+			{
+				uint16 length;
+				args = logRecordRead(args, &length, sizeof(length));
+				char str[LOG_MAX_STRING_ARG + 1];
+				args = logRecordRead(args, str, length);
+				str[length] = '\0';
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, scast<const char *>(str));
+			}
+			break;
+
+		case LOG_ARG_POINTER :
+			{
+				void * value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			break;
+
+		default :
+			if (conv == '%')
+			{
+				buffer[used++] = '%';
+			}
+			break;
+		} // switch (spec.type)
+
+		if (spec.type == LOG_ARG_STRING)
+		{
+			// Strings are padded to keep the following arguments aligned.
+			args = rcast<const ubyte *>((rcast<uint32>(args) + 3) & ~3);
+		}
+
+		if (written > 0)
+		{
+			used += (scast<uint>(written) < outSize) ? scast<uint>(written) : outSize - 1;
+		}
+	}
+
+	buffer[used] = '\0';
+}
+
+} // namespace {}
+
+// ========================================================
+// logDeferred():
+// ========================================================
+
+void logDeferred(const char * messageTag, const char * filename, const int lineNum, const char * fmt, ...)
+{
+	// Supply defaults if needed:
+	if (messageTag == nullptr) { messageTag = "???"; }
+	if (filename   == nullptr) { filename   = "???"; }
+	if (fmt        == nullptr) { fmt        = "???"; }
+
+	ubyte record[LOG_MAX_RECORD_SIZE] ATTRIBUTE_ALIGNED(16);
+
+	LogRecordHeader header;
+	header.size     = 0;
+	header.tag      = scast<uint8>(*messageTag);
+	header.unused   = 0;
+	header.fmt      = rcast<uint32>(fmt);
+	header.filename = rcast<uint32>(filename);
+	header.lineNum  = lineNum;
+
+	uint used = sizeof(header);
+	bool fits = true;
+
+	va_list vaList;
+	va_start(vaList, fmt);
+
+	// Walk the format string just to know the types to pull from the va_list.
+	// No number to text conversion is done here.
+	for (const char * f = fmt; *f != '\0' && fits;)
+	{
+		if (*f != '%')
+		{
+			++f;
+			continue;
+		}
+
+		LogFormatSpec spec;
+		parseLogFormatSpec(f, spec);
+		f = spec.end;
+
+		for (uint s = 0; s < spec.stars; ++s)
+		{
+			const int value = va_arg(vaList, int);
+			fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+		}
+
+		switch (spec.type)
+		{
+		case LOG_ARG_INT :
+			if (spec.size == sizeof(long long))
+			{
+				const long long value = va_arg(vaList, long long);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			else
+			{
+				const int value = va_arg(vaList, int);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			break;
+
+		case LOG_ARG_DOUBLE :
+			{
+				const double value = va_arg(vaList, double);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			break;
+
+		case LOG_ARG_STRING :
+			{
+				const char * str = va_arg(vaList, const char *);
+				if (str == nullptr)
+				{
+					str = "(null)";
+				}
+
+				size_t length = strlen(str);
+				if (length > LOG_MAX_STRING_ARG)
+				{
+					length = LOG_MAX_STRING_ARG;
+				}
+
+				const uint16 length16 = scast<uint16>(length);
+				const uint32 zeros    = 0;
+				fits = fits && logRecordAppend(record, used, &length16, sizeof(length16));
+				fits = fits && logRecordAppend(record, used, str, length);
+				fits = fits && logRecordAppend(record, used, &zeros, ((used + 3) & ~3) - used);
+			}
+			break;
+
+		case LOG_ARG_POINTER :
+			{
+				const void * value = va_arg(vaList, const void *);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			break;
+
+		default :
+			break;
+		} // switch (spec.type)
+	}
+
+	va_end(vaList);
+
+	if (!fits)
+	{
+		logDroppedCount++;
+		return;
+	}
+
+	used = (used + 3) & ~3;
+	header.size = scast<uint16>(used);
+	memcpy(record, &header, sizeof(header));
+
+	logRingPush(record, used);
+}
+
+// ========================================================
+// logFlush():
+// ========================================================
+
+void logFlush()
+{
+	uint32 readPos = logRingReadPos;
+	const uint32 writePos = logRingWritePos;
+
+	while (readPos != writePos)
+	{
+		const LogRecordHeader * header =
+			rcast<const LogRecordHeader *>(&logRing[readPos & (LOG_RING_SIZE - 1)]);
+
+		if (header->tag != 0)
+		{
+			if (logDumpFile != nullptr)
+			{
+				fwrite(header, 1, header->size, logDumpFile);
+			}
+			else
+			{
+				char message[2048];
+				logFormatRecord(*header, message, sizeof(message));
+				logOutput(scast<char>(header->tag), rcast<const char *>(header->filename),
+				          header->lineNum, message);
+			}
+		}
+
+		readPos += header->size;
+
+		// Hand the space back to the producer.
+		__asm__ __volatile__ ("" ::: "memory");
+		logRingReadPos = readPos;
+	}
+
+	if (logDroppedCount != 0)
+	{
+		const uint dropped = logDroppedCount;
+		logDroppedCount = 0;
+		logPrintf("W", __FILE__, __LINE__, "%u deferred log messages dropped!", dropped);
+	}
+}
+
+// ========================================================
+// logSetAsyncFlush():
+// ========================================================
+
+void logSetAsyncFlush(const bool enable)
+{
+	logAsyncFlush = enable;
+}
+
+// ========================================================
+// logSetDumpFile():
+// ========================================================
+
+bool logSetDumpFile(const char * filename)
+{
+	// Whatever was pending goes to the previous destination.
+	logFlush();
+
+	if (logDumpFile != nullptr)
+	{
+		fclose(logDumpFile);
+		logDumpFile = nullptr;
+	}
+
+	if (filename == nullptr)
+	{
+		return true;
+	}
+
+	logDumpFile = fopen(filename, "wb");
+	if (logDumpFile == nullptr)
+	{
+		logError("Unable to open log dump file \"%s\"", filename);
+		return false;
+	}
+
+	LogDumpHeader header;
+	header.magic[0]      = 'P';
+	header.magic[1]      = 'L';
+	header.magic[2]      = 'O';
+	header.magic[3]      = 'G';
+	header.version       = 1;
+	header.sizeOfLong    = sizeof(long);
+	header.sizeOfSizeT   = sizeof(size_t);
+	header.sizeOfPointer = sizeof(void *);
+
+	fwrite(&header, 1, sizeof(header), logDumpFile);
+	return true;
+}
+
 // ========================================================
 // die():
 // ========================================================
@@ -160,6 +694,11 @@ void die()
 {
 	fprintf(stderr, "\'die()\' called! Aborting due to a fatal error or assertion failure...\n");
 
+	// Make sure the deferred messages that led here are printed
+	// and that a memory trace in progress is complete on disk.
+	logSetDumpFile(nullptr);
+	memTraceStop();
+
 	if (!gRenderer.isVideoInitialized())
 	{
 		// Early error, before full renderer initialization.
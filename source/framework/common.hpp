@@ -66,7 +66,7 @@ typedef s64 int64;
 typedef u32 uint;
 typedef u8  ubyte;
 
-// Ensure sizes are correct:
+// Ensure sizes are correct. Also used by other files to check the layout of structures.
 #define CT_ASSERT_SIZE(type, size) typedef int ct_assert_ ## type ## _size[(sizeof(type) == (size)) ? 1 : -1]
 CT_ASSERT_SIZE(uint8   ,  1);
 CT_ASSERT_SIZE(uint16  ,  2);
@@ -79,7 +79,6 @@ CT_ASSERT_SIZE(int64   ,  8);
 CT_ASSERT_SIZE(uint    ,  4);
 CT_ASSERT_SIZE(ubyte   ,  1);
 CT_ASSERT_SIZE(qword_t , 16);
-#undef CT_ASSERT_SIZE
 
 // ========================================================
 // Miscellaneous macros:
@@ -137,13 +136,42 @@ void logPrintf(const char * messageTag, const char * filename, int lineNum,
 // This function never returns to the caller.
 void die() __attribute__((noreturn));
 
-// Macros that simplify the use of `logPrintf()`:
-#define logComment(...) ::logPrintf("C", __FILE__, __LINE__, __VA_ARGS__)
-#define logWarning(...) ::logPrintf("W", __FILE__, __LINE__, __VA_ARGS__)
-#define logError(...)   ::logPrintf("E", __FILE__, __LINE__, __VA_ARGS__)
+// Deferred version of `logPrintf()`. Only the format string pointer and the raw argument
+// bytes are copied into a ring buffer (strings are copied). Formatting and printing happen
+// later, in `logFlush()`. The format string and filename must be string literals, since
+// just their addresses are stored. Lock-free with a single producer and a single consumer.
+void logDeferred(const char * messageTag, const char * filename, int lineNum,
+                 const char * fmt, ...) __attribute__((format(printf, 4, 5)));
+
+// Formats and prints all pending deferred messages. Called by the Renderer at the
+// end of every frame and by `die()`. Can also be called from a background thread,
+// as long as it is the only thread doing so.
+void logFlush();
+
+// When the ring is full, the logging thread flushes it by itself. Enable this if
+// `logFlush()` is called by a background thread, then new messages are dropped
+// (and counted) instead, since that thread is the only one allowed to consume.
+void logSetAsyncFlush(bool enable);
+
+// Redirects `logFlush()` to write the raw records to a file instead of formatting them
+// on the EE. Use `tools/log_decoder` with the program's ELF to turn the dump into text.
+// Passing null closes the current dump file and flushes to the console again.
+bool logSetDumpFile(const char * filename);
+
+// Macros that simplify the use of `logPrintf()`.
+// Building with `LOG_DEFERRED` defined routes them through `logDeferred()` instead.
+#if LOG_DEFERRED
+	#define logComment(...) ::logDeferred("C", __FILE__, __LINE__, __VA_ARGS__)
+	#define logWarning(...) ::logDeferred("W", __FILE__, __LINE__, __VA_ARGS__)
+	#define logError(...)   ::logDeferred("E", __FILE__, __LINE__, __VA_ARGS__)
+#else // !LOG_DEFERRED
+	#define logComment(...) ::logPrintf("C", __FILE__, __LINE__, __VA_ARGS__)
+	#define logWarning(...) ::logPrintf("W", __FILE__, __LINE__, __VA_ARGS__)
+	#define logError(...)   ::logPrintf("E", __FILE__, __LINE__, __VA_ARGS__)
+#endif // LOG_DEFERRED
 
 // Logs a fatal error and crashes spectacularly:
-#define fatalError(...) do { ::logPrintf("E", __FILE__, __LINE__, __VA_ARGS__); ::die(); } while (0)
+#define fatalError(...) do { ::logFlush(); ::logPrintf("E", __FILE__, __LINE__, __VA_ARGS__); ::die(); } while (0)
 
 // ========================================================
 // Timer routines:
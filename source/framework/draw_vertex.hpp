@@ -0,0 +1,147 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: draw_vertex.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Vertex formats accepted by the Renderer draw calls.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#ifndef DRAW_VERTEX_HPP
+#define DRAW_VERTEX_HPP
+
+#include "common.hpp"
+#include "ps2_math/math_funcs.hpp"
+#include "ps2_math/vector.hpp"
+#include "ps2_math/aabb.hpp"
+
+//
+// Kept apart from `renderer.hpp` so that the code generating vertexes
+// (MD2 frame assembly, etc) doesn't need the GS headers and can also
+// be built on the development machine (see `tools/md2_bench`).
+// The VU0 paths have plain C++ versions for the other math backends.
+//
+
+// ========================================================
+// struct DrawVertex:
+// ========================================================
+
+struct ATTRIBUTE_ALIGNED(16) DrawVertex
+{
+	Vector position; // Only XYZ are used. W always = 1
+	Vector texCoord; // Only XY used. Z always = 0 and W always = 1
+	Vector color;    // XYZW are used to store the RGBA color
+};
+
+// Packing of a DrawVertex. Forces position.w to 1.
+inline void packDrawVertex(DrawVertex & dv, const Vector & position, const Vector & texCoord, const Vector & color)
+{
+#if PS2MATH_USE_VU0
+	asm volatile (
+		"lqc2    vf4, 0x0(%1)  \n\t" // vf4 = position
+		"lqc2    vf5, 0x0(%2)  \n\t" // vf5 = texCoord
+		"lqc2    vf6, 0x0(%3)  \n\t" // vf6 = color
+		"vmove.w vf4, vf0      \n\t" // vf4.w = 1.0 (set position.w to 1)
+		"sqc2    vf6, 0x20(%0) \n\t" // dv.color    = vf6
+		"sqc2    vf5, 0x10(%0) \n\t" // dv.texCoord = vf5
+		"sqc2    vf4, 0x00(%0) \n\t" // dv.position = vf4
+		: : "r" (&dv), "r" (&position), "r" (&texCoord), "r" (&color)
+	);
+#else // !PS2MATH_USE_VU0
+	dv.position   = position;
+	dv.position.w = 1.0f;
+	dv.texCoord   = texCoord;
+	dv.color      = color;
+#endif // PS2MATH_USE_VU0
+}
+
+// ========================================================
+// struct PackedDrawVertex / PackedVertexFormat:
+// ========================================================
+
+// Compact alternative to DrawVertex, 16 bytes instead of 48.
+// Positions are quantized to int16 and restored at draw time with the
+// scale/bias of a PackedVertexFormat (one per mesh). Texture coordinates
+// are unsigned 4.12 fixed-point and the color is already in the GS
+// RGBA8 range, so the draw loop doesn't have to convert it.
+// The quantization makes a vertex slower to write than a DrawVertex;
+// the gain is in memory size (see `tools/vertex_bench`).
+struct ATTRIBUTE_ALIGNED(16) PackedDrawVertex
+{
+	int16  position[3]; // Quantized XYZ
+	uint16 texCoord[2]; // UV, 4.12 fixed-point
+	ubyte  color[4];    // GS RGBA (RGB 128 = 1.0)
+	uint16 unused;      // Pad to 16 bytes
+};
+
+CT_ASSERT_SIZE(PackedDrawVertex, 16);
+
+// Dequantization for PackedDrawVertex positions: (packed * scale) + bias
+struct ATTRIBUTE_ALIGNED(16) PackedVertexFormat
+{
+	Vector scale;
+	Vector bias;
+
+	// Fixed-point scale of the packed texture coordinates.
+	static const float TEXCOORD_SCALE;
+
+	// Map the given bounds to the full int16 range.
+	void fromBounds(const Aabb & bounds)
+	{
+		const float maxPacked = 32767.0f;
+		bias  = bounds.getCenter();
+		scale = (bounds.maxs - bounds.mins) * (0.5f / maxPacked);
+
+		// Avoid a zero scale on flat meshes; also keeps the
+		// packed space back-face test valid (needs positive scales).
+		if (scale.x <= 0.0f) { scale.x = 1.0f; }
+		if (scale.y <= 0.0f) { scale.y = 1.0f; }
+		if (scale.z <= 0.0f) { scale.z = 1.0f; }
+
+		bias.w  = 1.0f;
+		scale.w = 1.0f;
+	}
+};
+
+// Quantizes a vertex to the packed format. Positions must be
+// inside the bounds `fmt` was built from. The color conversion
+// matches what the draw loop does for DrawVertex.
+inline void packDrawVertex(PackedDrawVertex & pv, const Vector & position, const Vector & texCoord,
+                           const Vector & color, const PackedVertexFormat & fmt)
+{
+	pv.position[0] = scast<int16>(clamp((position.x - fmt.bias.x) / fmt.scale.x, -32767.0f, 32767.0f));
+	pv.position[1] = scast<int16>(clamp((position.y - fmt.bias.y) / fmt.scale.y, -32767.0f, 32767.0f));
+	pv.position[2] = scast<int16>(clamp((position.z - fmt.bias.z) / fmt.scale.z, -32767.0f, 32767.0f));
+	pv.texCoord[0] = scast<uint16>(clamp(texCoord.x, 0.0f, 15.99f) * PackedVertexFormat::TEXCOORD_SCALE);
+	pv.texCoord[1] = scast<uint16>(clamp(texCoord.y, 0.0f, 15.99f) * PackedVertexFormat::TEXCOORD_SCALE);
+	pv.color[0]    = scast<ubyte>(clamp(color.x * 128.0f, 0.0f, 255.0f));
+	pv.color[1]    = scast<ubyte>(clamp(color.y * 128.0f, 0.0f, 255.0f));
+	pv.color[2]    = scast<ubyte>(clamp(color.z * 128.0f, 0.0f, 255.0f));
+	pv.color[3]    = scast<ubyte>(clamp(color.w, 0.0f, 255.0f));
+	pv.unused      = 0;
+}
+
+#endif // DRAW_VERTEX_HPP
@@ -32,6 +32,7 @@
 
 #include "first_person_camera.hpp"
 #include "game_time.hpp"
+#include "ps2_math/fast_math.hpp"
 
 // ========================================================
 
@@ -229,8 +230,8 @@ void FirstPersonCamera::pitch(const float radians)
 
 void FirstPersonCamera::rotate(const float radians)
 {
-	const float sinAng = ps2math::sin(radians);
-	const float cosAng = ps2math::cos(radians);
+	float sinAng, cosAng;
+	ps2math::fast::sinCos(radians, &sinAng, &cosAng);
 
 	// Save off forward components for computation:
 	float xxx = forward.x;
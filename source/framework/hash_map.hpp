@@ -0,0 +1,427 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: hash_map.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Open-addressing hash table template class, for asset and name lookups.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#ifndef HASH_MAP_HPP
+#define HASH_MAP_HPP
+
+#include "common.hpp"
+
+// ========================================================
+// Key hashing and comparison:
+// ========================================================
+
+//
+// HashMap<K, V> calls `hashMapHash(key)` and `hashMapKeyEquals(a, b)`.
+// Overloads for integers, pointers and C strings are provided here.
+// For other key types, declare the two functions in the namespace of
+// the type, so they are found by argument-dependent lookup.
+//
+
+inline uint32 hashMapHash(uint32 x)
+{
+	// Final mix of MurmurHash3; spreads sequential ids over all bits.
+	x ^= x >> 16;
+	x *= 0x85EBCA6B;
+	x ^= x >> 13;
+	x *= 0xC2B2AE35;
+	x ^= x >> 16;
+	return x;
+}
+
+inline uint32 hashMapHash(const int32 x)
+{
+	return hashMapHash(scast<uint32>(x));
+}
+
+inline uint32 hashMapHash(const void * ptr)
+{
+	// Low bits of pointers are mostly zero, but the mix above takes care of it.
+	return hashMapHash(scast<uint32>(rcast<size_t>(ptr)));
+}
+
+inline uint32 hashMapHash(const char * str)
+{
+	// FNV-1a
+	uint32 hash = 2166136261u;
+	while (*str != '\0')
+	{
+		hash ^= scast<ubyte>(*str++);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+template<class T>
+inline bool hashMapKeyEquals(const T & a, const T & b)
+{
+	return a == b;
+}
+
+inline bool hashMapKeyEquals(const char * a, const char * b)
+{
+	return strcmp(a, b) == 0;
+}
+
+// ========================================================
+// template class HashMap<K, V>:
+// ========================================================
+
+//
+// Open addressing with linear probing. The hashes live in their own
+// array, so a probe is a scan over consecutive 32-bit words, and the
+// key is only compared when the full hash matches. Removal shifts the
+// following entries back instead of leaving tombstones, so lookups
+// never slow down after many erases. The table is a power of two and
+// doubles when it gets 3/4 full.
+//
+// Keys and values are constructed with placement new and destroyed on
+// removal, so non-POD types are fine. Entries move when the table grows
+// or an erase shifts them, so don't keep pointers to values across
+// those. For `const char *` keys, the map stores the pointer only;
+// the string must outlive its entry.
+//
+// Iterate with `getBucketCount()`, `isBucketUsed()` and the `*At()` accessors.
+//
+template<class K, class V>
+class HashMap
+{
+public:
+
+	typedef unsigned int size_type;
+	typedef K key_type;
+	typedef V value_type;
+
+	explicit HashMap(MemAllocTag tag = MEM_TAG_GENERIC);
+	~HashMap();
+
+	// Makes room for `count` entries without further growth.
+	void reserve(size_type count);
+	void clear(); // Also frees the memory!
+
+	// Returns true if the key was new. Replaces the value of an existing key.
+	bool insert(const key_type & key, const value_type & val);
+
+	// Returns true if the key was found and removed.
+	bool erase(const key_type & key);
+
+	// Null if not found.
+	const value_type * find(const key_type & key) const;
+	value_type * find(const key_type & key);
+	bool contains(const key_type & key) const;
+
+	// Inserts a default constructed value if the key is not in the map.
+	value_type & operator [] (const key_type & key);
+
+	bool isEmpty() const { return used == 0; }
+	size_type size() const { return used; }
+
+	// Iteration over the buckets, `bucket < getBucketCount()`:
+	size_type getBucketCount() const { return bucketCount; }
+	bool isBucketUsed(size_type bucket) const;
+	const key_type & getKeyAt(size_type bucket) const;
+	const value_type & getValueAt(size_type bucket) const;
+	value_type & getValueAt(size_type bucket);
+
+private:
+
+	// Copy/assign disallowed.
+	HashMap(const HashMap &);
+	HashMap & operator = (const HashMap &);
+
+	struct Entry
+	{
+		key_type   key;
+		value_type value;
+		Entry(const key_type & k, const value_type & v) : key(k), value(v) { }
+	};
+
+	// Stored hashes have the top bit set; zero marks an empty bucket.
+	static uint32 storedHash(const key_type & key) { return hashMapHash(key) | 0x80000000u; }
+
+	int findBucket(const key_type & key, uint32 hash) const;
+	size_type insertNew(const key_type & key, const value_type & val, uint32 hash);
+	void rehash(size_type newBucketCount);
+
+	// Member data:
+	uint32    * hashes;      // Hash of each bucket, zero if empty.
+	Entry     * entries;     // Key/value of each bucket, constructed if the hash is not zero.
+	size_type   bucketCount; // Zero or a power of two.
+	size_type   used;        // Entries in the map.
+	MemAllocTag memTag;
+
+	enum { MINBUCKETS = 16 };
+};
+
+// ========================================================
+// Inline methods of HashMap<K, V>:
+// ========================================================
+
+template<class K, class V>
+HashMap<K, V>::HashMap(const MemAllocTag tag)
+	: hashes(nullptr)
+	, entries(nullptr)
+	, bucketCount(0)
+	, used(0)
+	, memTag(tag)
+{
+	// Construct empty. Allocates on first insertion.
+}
+
+template<class K, class V>
+HashMap<K, V>::~HashMap()
+{
+	clear();
+}
+
+template<class K, class V>
+void HashMap<K, V>::reserve(const size_type count)
+{
+	size_type newBucketCount = (bucketCount != 0) ? bucketCount : size_type(MINBUCKETS);
+	while (count > (newBucketCount - (newBucketCount >> 2)))
+	{
+		newBucketCount <<= 1;
+	}
+	if (newBucketCount > bucketCount)
+	{
+		rehash(newBucketCount);
+	}
+}
+
+template<class K, class V>
+void HashMap<K, V>::clear()
+{
+	for (size_type b = 0; b < bucketCount; ++b)
+	{
+		if (hashes[b] != 0)
+		{
+			memDestroy(&entries[b]);
+		}
+	}
+
+	memFree(memTag, hashes);
+	memFree(memTag, entries);
+	hashes      = nullptr;
+	entries     = nullptr;
+	bucketCount = 0;
+	used        = 0;
+}
+
+template<class K, class V>
+bool HashMap<K, V>::insert(const key_type & key, const value_type & val)
+{
+	const uint32 hash = storedHash(key);
+	const int bucket  = findBucket(key, hash);
+	if (bucket >= 0)
+	{
+		entries[bucket].value = val;
+		return false;
+	}
+
+	insertNew(key, val, hash);
+	return true;
+}
+
+template<class K, class V>
+bool HashMap<K, V>::erase(const key_type & key)
+{
+	int found = findBucket(key, storedHash(key));
+	if (found < 0)
+	{
+		return false;
+	}
+
+	const size_type mask = bucketCount - 1;
+	size_type hole = scast<size_type>(found);
+	memDestroy(&entries[hole]);
+	hashes[hole] = 0;
+	--used;
+
+	// Shift back the entries after the hole that would
+	// otherwise become unreachable from their home bucket.
+	for (size_type b = (hole + 1) & mask; hashes[b] != 0; b = (b + 1) & mask)
+	{
+		const size_type home = hashes[b] & mask;
+		const bool canMove = (hole <= b) ? (home <= hole || home > b) : (home <= hole && home > b);
+		if (canMove)
+		{
+			memConstruct(&entries[hole], entries[b]);
+			hashes[hole] = hashes[b];
+			memDestroy(&entries[b]);
+			hashes[b] = 0;
+			hole = b;
+		}
+	}
+	return true;
+}
+
+template<class K, class V>
+const typename HashMap<K, V>::value_type * HashMap<K, V>::find(const key_type & key) const
+{
+	const int bucket = findBucket(key, storedHash(key));
+	return (bucket >= 0) ? &entries[bucket].value : nullptr;
+}
+
+template<class K, class V>
+typename HashMap<K, V>::value_type * HashMap<K, V>::find(const key_type & key)
+{
+	const int bucket = findBucket(key, storedHash(key));
+	return (bucket >= 0) ? &entries[bucket].value : nullptr;
+}
+
+template<class K, class V>
+bool HashMap<K, V>::contains(const key_type & key) const
+{
+	return findBucket(key, storedHash(key)) >= 0;
+}
+
+template<class K, class V>
+typename HashMap<K, V>::value_type & HashMap<K, V>::operator [] (const key_type & key)
+{
+	const uint32 hash = storedHash(key);
+	const int bucket  = findBucket(key, hash);
+	if (bucket >= 0)
+	{
+		return entries[bucket].value;
+	}
+	return entries[insertNew(key, value_type(), hash)].value;
+}
+
+template<class K, class V>
+bool HashMap<K, V>::isBucketUsed(const size_type bucket) const
+{
+	ps2assert(bucket < bucketCount);
+	return hashes[bucket] != 0;
+}
+
+template<class K, class V>
+const typename HashMap<K, V>::key_type & HashMap<K, V>::getKeyAt(const size_type bucket) const
+{
+	ps2assert(isBucketUsed(bucket));
+	return entries[bucket].key;
+}
+
+template<class K, class V>
+const typename HashMap<K, V>::value_type & HashMap<K, V>::getValueAt(const size_type bucket) const
+{
+	ps2assert(isBucketUsed(bucket));
+	return entries[bucket].value;
+}
+
+template<class K, class V>
+typename HashMap<K, V>::value_type & HashMap<K, V>::getValueAt(const size_type bucket)
+{
+	ps2assert(isBucketUsed(bucket));
+	return entries[bucket].value;
+}
+
+template<class K, class V>
+int HashMap<K, V>::findBucket(const key_type & key, const uint32 hash) const
+{
+	if (used == 0)
+	{
+		return -1;
+	}
+
+	// The table is never full, so this always hits an empty bucket.
+	const size_type mask = bucketCount - 1;
+	for (size_type b = hash & mask; hashes[b] != 0; b = (b + 1) & mask)
+	{
+		if (hashes[b] == hash && hashMapKeyEquals(entries[b].key, key))
+		{
+			return scast<int>(b);
+		}
+	}
+	return -1;
+}
+
+template<class K, class V>
+typename HashMap<K, V>::size_type HashMap<K, V>::insertNew(const key_type & key, const value_type & val, const uint32 hash)
+{
+	// Grow at 3/4 full. `key` is never an entry of this map, since it is new, but `val`
+	// can be the value of another entry (`map.insert(k2, map[k1])`), which rehash() frees.
+	if ((used + 1) > (bucketCount - (bucketCount >> 2)))
+	{
+		const value_type valCopy(val);
+		rehash((bucketCount != 0) ? (bucketCount << 1) : size_type(MINBUCKETS));
+		return insertNew(key, valCopy, hash);
+	}
+
+	const size_type mask = bucketCount - 1;
+	size_type b = hash & mask;
+	while (hashes[b] != 0)
+	{
+		b = (b + 1) & mask;
+	}
+
+	new (&entries[b], MemPlacement()) Entry(key, val);
+	hashes[b] = hash;
+	++used;
+	return b;
+}
+
+template<class K, class V>
+void HashMap<K, V>::rehash(const size_type newBucketCount)
+{
+	ps2assert((newBucketCount & (newBucketCount - 1)) == 0);
+
+	uint32 * oldHashes  = hashes;
+	Entry  * oldEntries = entries;
+	const size_type oldBucketCount = bucketCount;
+
+	hashes      = memClearedAlloc<uint32>(memTag, newBucketCount);
+	entries     = memAlloc<Entry>(memTag, newBucketCount);
+	bucketCount = newBucketCount;
+
+	const size_type mask = bucketCount - 1;
+	for (size_type ob = 0; ob < oldBucketCount; ++ob)
+	{
+		if (oldHashes[ob] == 0)
+		{
+			continue;
+		}
+
+		size_type b = oldHashes[ob] & mask;
+		while (hashes[b] != 0)
+		{
+			b = (b + 1) & mask;
+		}
+
+		memConstruct(&entries[b], oldEntries[ob]);
+		hashes[b] = oldHashes[ob];
+		memDestroy(&oldEntries[ob]);
+	}
+
+	memFree(memTag, oldHashes);
+	memFree(memTag, oldEntries);
+}
+
+#endif // HASH_MAP_HPP
@@ -61,11 +61,8 @@ const Color4b       BACKGROUND_COLOR   = { 10,  70,  40,  75  }; // Olive green
 // ========================================================
 
 InGameConsole::InGameConsole()
-	: currentTextColor(DEFAULT_TEXT_COLOR)
-	, currentLine(&lines[0])
-	, linesUsed(1) // lines[0] is taken.
 {
-	memset(lines, 0, sizeof(lines));
+	clear();
 }
 
 // ========================================================
@@ -93,14 +90,27 @@ void InGameConsole::print(const char * str)
 			}
 		}
 
+		// The next char overwrites the oldest one in the ring. Drop
+		// whichever old lines started at or before it. The current line
+		// is never dropped, since it is much shorter than the ring.
+		while (endCharPos - lineAt(firstLinePos).firstChar >= MAX_SCROLLBACK_CHARS)
+		{
+			ps2assert(&lineAt(firstLinePos) != line);
+			firstLinePos++;
+			scroll(0); // Re-clamp if scrolled back.
+		}
+
 		ps2assert(line->charsUsed < MAX_CHARS_PER_LINE);
-		Char & lineChar = line->chars[line->charsUsed++];
+		Char & lineChar = charAt(endCharPos++);
+		line->charsUsed++;
 		lineChar.chr = *str;
 		lineChar.r = currentTextColor.r;
 		lineChar.g = currentTextColor.g;
 		lineChar.b = currentTextColor.b;
 		// Alpha channel is ignored to save space.
 	}
+
+	cacheDirty = true;
 }
 
 // ========================================================
@@ -109,15 +119,23 @@ void InGameConsole::print(const char * str)
 
 InGameConsole::Line * InGameConsole::allocNewLine()
 {
-	if (linesUsed == MAX_TEXT_LINES)
+	if (endLinePos - firstLinePos == MAX_SCROLLBACK_LINES)
 	{
-		// Remove line 0 (the oldest) and shift the array:
-		linesUsed--;
-		memmove(&lines[0], &lines[1], linesUsed * sizeof(Line));
+		// Recycle the slot of the oldest line.
+		firstLinePos++;
 	}
 
-	currentLine = &lines[linesUsed++];
+	currentLine = &lineAt(endLinePos++);
+	currentLine->firstChar = endCharPos;
 	currentLine->charsUsed = 0;
+	cacheDirty = true;
+
+	// Keep the same text in view if scrolled back.
+	if (scrollOffset != 0)
+	{
+		scroll(1);
+	}
+
 	return currentLine;
 }
 
@@ -127,7 +145,7 @@ InGameConsole::Line * InGameConsole::allocNewLine()
 
 void InGameConsole::draw() const
 {
-	if (linesUsed <= 1 && lines[0].charsUsed == 0)
+	if (isEmpty())
 	{
 		return; // Just one empty line. Draws nothing.
 	}
@@ -140,24 +158,45 @@ void InGameConsole::draw() const
 	};
 	gRenderer.drawRectFilled(rect, BACKGROUND_COLOR);
 
-	// Draw text lines on top of the window background:
+	// Replay the text drawn last time if nothing changed.
+	// Cost is then the same no matter how much text is shown.
+	if (!cacheDirty && cachedTextScale == gRenderer.getGlobalTextScale())
+	{
+		gRenderer.drawTextPacket(cachedPacket, cachedQwords);
+		return;
+	}
+
+	gRenderer.beginTextPacket();
+
+	// Draw the visible text lines on top of the window background:
+	const uint32 lastLine  = endLinePos - scrollOffset;
+	const uint32 firstLine = lastLine - getVisibleLineCount();
+
 	Vec2f pos = { TEXT_START_OFFSET, TEXT_START_OFFSET };
-	for (uint l = 0; l < linesUsed; ++l)
+	for (uint32 l = firstLine; l != lastLine; ++l)
 	{
-		for (uint c = 0; c < lines[l].charsUsed; ++c)
+		const Line & line = lineAt(l);
+		for (uint32 c = 0; c < line.charsUsed; ++c)
 		{
+			const Char & lineChar = charAt(line.firstChar + c);
+
 			Color4b color;
-			color.r = lines[l].chars[c].r;
-			color.g = lines[l].chars[c].g;
-			color.b = lines[l].chars[c].b;
+			color.r = lineChar.r;
+			color.g = lineChar.g;
+			color.b = lineChar.b;
 			color.a = 255;
-			gRenderer.drawChar(pos, color, TEXT_CHAR_FONT, lines[l].chars[c].chr);
+			gRenderer.drawChar(pos, color, TEXT_CHAR_FONT, lineChar.chr);
 		}
 
 		// Manually break the line, since the '\n' was not added to the Line chars.
 		pos.x = TEXT_START_OFFSET;
 		gRenderer.drawText(pos, DEFAULT_TEXT_COLOR, TEXT_CHAR_FONT, "\n");
 	}
+
+	// If it didn't fit, stays dirty and the text is drawn directly again next frame.
+	cachedQwords    = gRenderer.endTextPacket(cachedPacket, CACHED_PACKET_QWORDS);
+	cachedTextScale = gRenderer.getGlobalTextScale();
+	cacheDirty      = (cachedQwords == 0);
 }
 
 // ========================================================
@@ -167,10 +206,18 @@ void InGameConsole::draw() const
 void InGameConsole::clear()
 {
 	currentTextColor = DEFAULT_TEXT_COLOR;
+	firstLinePos     = 0;
+	endLinePos       = 1; // lines[0] is taken.
+	endCharPos       = 0;
+	scrollOffset     = 0;
 	currentLine      = &lines[0];
-	linesUsed        = 1; // lines[0] is taken.
 
-	memset(lines, 0, sizeof(lines));
+	currentLine->firstChar = 0;
+	currentLine->charsUsed = 0;
+
+	cacheDirty      = true;
+	cachedTextScale = 0.0f;
+	cachedQwords    = 0;
 }
 
 // ========================================================
@@ -179,11 +226,79 @@ void InGameConsole::clear()
 
 int InGameConsole::getHeight() const
 {
-	if (linesUsed <= 1 && lines[0].charsUsed == 0)
+	if (isEmpty())
 	{
 		return 0; // Just one empty line. Draws nothing.
 	}
-	return (linesUsed + 1) * TEXT_CHAR_HEIGHT;
+	return (getVisibleLineCount() + 1) * TEXT_CHAR_HEIGHT;
+}
+
+// ========================================================
+// InGameConsole::isEmpty():
+// ========================================================
+
+bool InGameConsole::isEmpty() const
+{
+	return (endLinePos - firstLinePos) <= 1 && currentLine->charsUsed == 0;
+}
+
+// ========================================================
+// InGameConsole::getVisibleLineCount():
+// ========================================================
+
+uint InGameConsole::getVisibleLineCount() const
+{
+	const uint linesAvailable = getLineCount() - scrollOffset;
+	return (linesAvailable < MAX_VISIBLE_LINES) ? linesAvailable : MAX_VISIBLE_LINES;
+}
+
+// ========================================================
+// InGameConsole::getLineCount():
+// ========================================================
+
+uint InGameConsole::getLineCount() const
+{
+	return endLinePos - firstLinePos;
+}
+
+// ========================================================
+// InGameConsole::scroll():
+// ========================================================
+
+void InGameConsole::scroll(const int numLines)
+{
+	// Can scroll back until the oldest line is the top of the window.
+	const uint lineCount = getLineCount();
+	const int  maxScroll = (lineCount > MAX_VISIBLE_LINES) ? scast<int>(lineCount - MAX_VISIBLE_LINES) : 0;
+
+	int newOffset = scast<int>(scrollOffset) + numLines;
+	if (newOffset < 0)
+	{
+		newOffset = 0;
+	}
+	else if (newOffset > maxScroll)
+	{
+		newOffset = maxScroll;
+	}
+
+	if (scast<uint>(newOffset) != scrollOffset)
+	{
+		scrollOffset = newOffset;
+		cacheDirty   = true;
+	}
+}
+
+// ========================================================
+// InGameConsole::scrollToBottom():
+// ========================================================
+
+void InGameConsole::scrollToBottom()
+{
+	if (scrollOffset != 0)
+	{
+		scrollOffset = 0;
+		cacheDirty   = true;
+	}
 }
 
 // ========================================================
@@ -251,6 +366,9 @@ void InGameConsole::setTextColor(Color4b) { }
 void InGameConsole::setTextColor(uint32)  { }
 void InGameConsole::restoreTextColor()    { }
 void InGameConsole::preloadFonts()        { }
+void InGameConsole::scroll(int)           { }
+void InGameConsole::scrollToBottom()      { }
+uint InGameConsole::getLineCount() const  { return 0; }
 
 #endif // INGAME_CONSOLE_STDOUT_SIMPLE
 
@@ -68,6 +68,14 @@ public:
 	// If this is not explicitly called, fonts are loaded on-demand.
 	void preloadFonts();
 
+	// Scroll the visible window back into the scrollback (positive)
+	// or towards the latest line (negative). Clamped to the text available.
+	void scroll(int numLines);
+	void scrollToBottom();
+
+	// Number of lines currently kept in the scrollback.
+	uint getLineCount() const;
+
 private:
 
 	// Copy/assign disallowed.
@@ -76,12 +84,20 @@ private:
 
 #ifndef INGAME_CONSOLE_STDOUT_SIMPLE
 
-	// Max sizes of statically allocated arrays.
-	// Max chars per line should be adjusted to roughly match
-	// the number of chars we can fit in the screen with the
-	// font selected for use with the console.
-	static const uint MAX_TEXT_LINES     = 20;
-	static const uint MAX_CHARS_PER_LINE = 80;
+	// Scrollback is stored in two rings: one of chars and one of lines
+	// pointing into it. Line and char positions only ever increase, the
+	// ring slot is the position modulo the ring size, so the oldest text
+	// is overwritten in place and nothing gets moved around. Sizes must be
+	// powers of 2. Max chars per line should be adjusted to roughly match
+	// the number of chars we can fit in the screen with the console font.
+	static const uint MAX_SCROLLBACK_LINES = 2048;
+	static const uint MAX_SCROLLBACK_CHARS = 32768;
+	static const uint MAX_VISIBLE_LINES    = 20;
+	static const uint MAX_CHARS_PER_LINE   = 80;
+
+	// GS packet data of the visible text, replayed every
+	// frame until the text changes. Sized for a full screen.
+	static const uint CACHED_PACKET_QWORDS = 4096;
 
 	// One byte for the character itself plus its RGB color.
 	struct ATTRIBUTE_PACKED Char
@@ -90,26 +106,48 @@ private:
 		ubyte r, g, b;
 	};
 
-	// A line is a fixed-length array of characters.
-	struct ATTRIBUTE_ALIGNED(16) Line
+	// A line is a range of the chars ring.
+	struct Line
 	{
-		uint charsUsed;
-		Char chars[MAX_CHARS_PER_LINE];
+		uint32 firstChar; // Char position, not ring slot.
+		uint32 charsUsed;
 	};
 
-	// Makes room for another line of text,
-	// possibly throwing away the oldest line.
+	// Starts a new line of text, possibly throwing away the oldest line.
 	Line * allocNewLine();
 
+	// Ring slot accessors:
+	Line       & lineAt(uint32 pos)       { return lines[pos & (MAX_SCROLLBACK_LINES - 1)]; }
+	const Line & lineAt(uint32 pos) const { return lines[pos & (MAX_SCROLLBACK_LINES - 1)]; }
+	Char       & charAt(uint32 pos)       { return chars[pos & (MAX_SCROLLBACK_CHARS - 1)]; }
+	const Char & charAt(uint32 pos) const { return chars[pos & (MAX_SCROLLBACK_CHARS - 1)]; }
+
+	bool isEmpty() const;
+	uint getVisibleLineCount() const;
+
 	// Text color state:
 	Color4b currentTextColor;
 
-	// Pointer to current line in the `lines[]` array. Never null.
+	// Pointer to current (newest) line in the `lines[]` ring. Never null.
 	Line * currentLine;
 
-	// Pool of text lines and total used:
-	uint linesUsed;
-	Line lines[MAX_TEXT_LINES];
+	// Positions of the oldest line kept, one past the newest line
+	// and one past the last char written. Scroll is in lines from the bottom.
+	uint32 firstLinePos;
+	uint32 endLinePos;
+	uint32 endCharPos;
+	uint   scrollOffset;
+
+	// Rendered text cache. Rebuilt by `draw()` when the text,
+	// scroll or text scale change, otherwise just replayed.
+	mutable bool    cacheDirty;
+	mutable float   cachedTextScale;
+	mutable uint    cachedQwords;
+	mutable qword_t cachedPacket[CACHED_PACKET_QWORDS] ATTRIBUTE_ALIGNED(16);
+
+	// The rings:
+	Line lines[MAX_SCROLLBACK_LINES];
+	Char chars[MAX_SCROLLBACK_CHARS];
 
 #endif // INGAME_CONSOLE_STDOUT_SIMPLE
 };
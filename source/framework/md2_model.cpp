@@ -74,6 +74,84 @@ stdMd2Anims[MD2ANIM_COUNT] ATTRIBUTE_ALIGNED(16) =
 	{ 198,   198,   5 }  // Boom
 };
 
+//
+// The 162 precomputed MD2 vertex normals, AKA Quake's `anorms.h`.
+// In Quake's coordinate system (z-up), so y and z must be swapped.
+//
+const float md2Anorms[Md2LightTable::NUM_NORMALS][3] =
+{
+	{-0.525731f,  0.000000f,  0.850651f }, {-0.442863f,  0.238856f,  0.864188f }, {-0.295242f,  0.000000f,  0.955423f },
+	{-0.309017f,  0.500000f,  0.809017f }, {-0.162460f,  0.262866f,  0.951056f }, { 0.000000f,  0.000000f,  1.000000f },
+	{ 0.000000f,  0.850651f,  0.525731f }, {-0.147621f,  0.716567f,  0.681718f }, { 0.147621f,  0.716567f,  0.681718f },
+	{ 0.000000f,  0.525731f,  0.850651f }, { 0.309017f,  0.500000f,  0.809017f }, { 0.525731f,  0.000000f,  0.850651f },
+	{ 0.295242f,  0.000000f,  0.955423f }, { 0.442863f,  0.238856f,  0.864188f }, { 0.162460f,  0.262866f,  0.951056f },
+	{-0.681718f,  0.147621f,  0.716567f }, {-0.809017f,  0.309017f,  0.500000f }, {-0.587785f,  0.425325f,  0.688191f },
+	{-0.850651f,  0.525731f,  0.000000f }, {-0.864188f,  0.442863f,  0.238856f }, {-0.716567f,  0.681718f,  0.147621f },
+	{-0.688191f,  0.587785f,  0.425325f }, {-0.500000f,  0.809017f,  0.309017f }, {-0.238856f,  0.864188f,  0.442863f },
+	{-0.425325f,  0.688191f,  0.587785f }, {-0.716567f,  0.681718f, -0.147621f }, {-0.500000f,  0.809017f, -0.309017f },
+	{-0.525731f,  0.850651f,  0.000000f }, { 0.000000f,  0.850651f, -0.525731f }, {-0.238856f,  0.864188f, -0.442863f },
+	{ 0.000000f,  0.955423f, -0.295242f }, {-0.262866f,  0.951056f, -0.162460f }, { 0.000000f,  1.000000f,  0.000000f },
+	{ 0.000000f,  0.955423f,  0.295242f }, {-0.262866f,  0.951056f,  0.162460f }, { 0.238856f,  0.864188f,  0.442863f },
+	{ 0.262866f,  0.951056f,  0.162460f }, { 0.500000f,  0.809017f,  0.309017f }, { 0.238856f,  0.864188f, -0.442863f },
+	{ 0.262866f,  0.951056f, -0.162460f }, { 0.500000f,  0.809017f, -0.309017f }, { 0.850651f,  0.525731f,  0.000000f },
+	{ 0.716567f,  0.681718f,  0.147621f }, { 0.716567f,  0.681718f, -0.147621f }, { 0.525731f,  0.850651f,  0.000000f },
+	{ 0.425325f,  0.688191f,  0.587785f }, { 0.864188f,  0.442863f,  0.238856f }, { 0.688191f,  0.587785f,  0.425325f },
+	{ 0.809017f,  0.309017f,  0.500000f }, { 0.681718f,  0.147621f,  0.716567f }, { 0.587785f,  0.425325f,  0.688191f },
+	{ 0.955423f,  0.295242f,  0.000000f }, { 1.000000f,  0.000000f,  0.000000f }, { 0.951056f,  0.162460f,  0.262866f },
+	{ 0.850651f, -0.525731f,  0.000000f }, { 0.955423f, -0.295242f,  0.000000f }, { 0.864188f, -0.442863f,  0.238856f },
+	{ 0.951056f, -0.162460f,  0.262866f }, { 0.809017f, -0.309017f,  0.500000f }, { 0.681718f, -0.147621f,  0.716567f },
+	{ 0.850651f,  0.000000f,  0.525731f }, { 0.864188f,  0.442863f, -0.238856f }, { 0.809017f,  0.309017f, -0.500000f },
+	{ 0.951056f,  0.162460f, -0.262866f }, { 0.525731f,  0.000000f, -0.850651f }, { 0.681718f,  0.147621f, -0.716567f },
+	{ 0.681718f, -0.147621f, -0.716567f }, { 0.850651f,  0.000000f, -0.525731f }, { 0.809017f, -0.309017f, -0.500000f },
+	{ 0.864188f, -0.442863f, -0.238856f }, { 0.951056f, -0.162460f, -0.262866f }, { 0.147621f,  0.716567f, -0.681718f },
+	{ 0.309017f,  0.500000f, -0.809017f }, { 0.425325f,  0.688191f, -0.587785f }, { 0.442863f,  0.238856f, -0.864188f },
+	{ 0.587785f,  0.425325f, -0.688191f }, { 0.688191f,  0.587785f, -0.425325f }, {-0.147621f,  0.716567f, -0.681718f },
+	{-0.309017f,  0.500000f, -0.809017f }, { 0.000000f,  0.525731f, -0.850651f }, {-0.525731f,  0.000000f, -0.850651f },
+	{-0.442863f,  0.238856f, -0.864188f }, {-0.295242f,  0.000000f, -0.955423f }, {-0.162460f,  0.262866f, -0.951056f },
+	{ 0.000000f,  0.000000f, -1.000000f }, { 0.295242f,  0.000000f, -0.955423f }, { 0.162460f,  0.262866f, -0.951056f },
+	{-0.442863f, -0.238856f, -0.864188f }, {-0.309017f, -0.500000f, -0.809017f }, {-0.162460f, -0.262866f, -0.951056f },
+	{ 0.000000f, -0.850651f, -0.525731f }, {-0.147621f, -0.716567f, -0.681718f }, { 0.147621f, -0.716567f, -0.681718f },
+	{ 0.000000f, -0.525731f, -0.850651f }, { 0.309017f, -0.500000f, -0.809017f }, { 0.442863f, -0.238856f, -0.864188f },
+	{ 0.162460f, -0.262866f, -0.951056f }, { 0.238856f, -0.864188f, -0.442863f }, { 0.500000f, -0.809017f, -0.309017f },
+	{ 0.425325f, -0.688191f, -0.587785f }, { 0.716567f, -0.681718f, -0.147621f }, { 0.688191f, -0.587785f, -0.425325f },
+	{ 0.587785f, -0.425325f, -0.688191f }, { 0.000000f, -0.955423f, -0.295242f }, { 0.000000f, -1.000000f,  0.000000f },
+	{ 0.262866f, -0.951056f, -0.162460f }, { 0.000000f, -0.850651f,  0.525731f }, { 0.000000f, -0.955423f,  0.295242f },
+	{ 0.238856f, -0.864188f,  0.442863f }, { 0.262866f, -0.951056f,  0.162460f }, { 0.500000f, -0.809017f,  0.309017f },
+	{ 0.716567f, -0.681718f,  0.147621f }, { 0.525731f, -0.850651f,  0.000000f }, {-0.238856f, -0.864188f, -0.442863f },
+	{-0.500000f, -0.809017f, -0.309017f }, {-0.262866f, -0.951056f, -0.162460f }, {-0.850651f, -0.525731f,  0.000000f },
+	{-0.716567f, -0.681718f, -0.147621f }, {-0.716567f, -0.681718f,  0.147621f }, {-0.525731f, -0.850651f,  0.000000f },
+	{-0.500000f, -0.809017f,  0.309017f }, {-0.238856f, -0.864188f,  0.442863f }, {-0.262866f, -0.951056f,  0.162460f },
+	{-0.864188f, -0.442863f,  0.238856f }, {-0.809017f, -0.309017f,  0.500000f }, {-0.688191f, -0.587785f,  0.425325f },
+	{-0.681718f, -0.147621f,  0.716567f }, {-0.442863f, -0.238856f,  0.864188f }, {-0.587785f, -0.425325f,  0.688191f },
+	{-0.309017f, -0.500000f,  0.809017f }, {-0.147621f, -0.716567f,  0.681718f }, {-0.425325f, -0.688191f,  0.587785f },
+	{-0.162460f, -0.262866f,  0.951056f }, { 0.442863f, -0.238856f,  0.864188f }, { 0.162460f, -0.262866f,  0.951056f },
+	{ 0.309017f, -0.500000f,  0.809017f }, { 0.147621f, -0.716567f,  0.681718f }, { 0.000000f, -0.525731f,  0.850651f },
+	{ 0.425325f, -0.688191f,  0.587785f }, { 0.587785f, -0.425325f,  0.688191f }, { 0.688191f, -0.587785f,  0.425325f },
+	{-0.955423f,  0.295242f,  0.000000f }, {-0.951056f,  0.162460f,  0.262866f }, {-1.000000f,  0.000000f,  0.000000f },
+	{-0.850651f,  0.000000f,  0.525731f }, {-0.955423f, -0.295242f,  0.000000f }, {-0.951056f, -0.162460f,  0.262866f },
+	{-0.864188f,  0.442863f, -0.238856f }, {-0.951056f,  0.162460f, -0.262866f }, {-0.809017f,  0.309017f, -0.500000f },
+	{-0.864188f, -0.442863f, -0.238856f }, {-0.951056f, -0.162460f, -0.262866f }, {-0.809017f, -0.309017f, -0.500000f },
+	{-0.681718f,  0.147621f, -0.716567f }, {-0.681718f, -0.147621f, -0.716567f }, {-0.850651f,  0.000000f, -0.525731f },
+	{-0.688191f,  0.587785f, -0.425325f }, {-0.587785f,  0.425325f, -0.688191f }, {-0.425325f,  0.688191f, -0.587785f },
+	{-0.425325f, -0.688191f, -0.587785f }, {-0.587785f, -0.425325f, -0.688191f }, {-0.688191f, -0.587785f, -0.425325f }
+};
+
+// Same as above, but converted to our y-up vectors on first use.
+Vector md2Normals[Md2LightTable::NUM_NORMALS] ATTRIBUTE_ALIGNED(16);
+bool   md2NormalsInitialized = false;
+
+void initMd2Normals()
+{
+	for (uint n = 0; n < Md2LightTable::NUM_NORMALS; ++n)
+	{
+		md2Normals[n].x = md2Anorms[n][0];
+		md2Normals[n].y = md2Anorms[n][2];
+		md2Normals[n].z = md2Anorms[n][1];
+		md2Normals[n].w = 0.0f;
+	}
+	md2NormalsInitialized = true;
+}
+
 } // namespace {}
 
 // ================================================================================================
@@ -132,6 +210,65 @@ void Md2AnimState::clear()
 	interp     = 0;
 }
 
+// ================================================================================================
+// Md2LightTable implementation:
+// ================================================================================================
+
+// ========================================================
+// Md2LightTable::setAmbient():
+// ========================================================
+
+void Md2LightTable::setAmbient(const Color4f & ambient)
+{
+	const Vector ambientColor(ambient.r, ambient.g, ambient.b, 1.0f);
+	for (uint n = 0; n < NUM_NORMALS; ++n)
+	{
+		colors[n] = ambientColor;
+	}
+}
+
+// ========================================================
+// Md2LightTable::addLight():
+// ========================================================
+
+void Md2LightTable::addLight(const Vector & dirToLight, const Color4f & color)
+{
+	// Texture modulation maps 1.0 to 128, so this is the brightest we can go.
+	const float maxIntensity = 1.99f;
+
+	if (!md2NormalsInitialized)
+	{
+		initMd2Normals();
+	}
+
+	for (uint n = 0; n < NUM_NORMALS; ++n)
+	{
+		const float nDotL = dotProduct3(md2Normals[n], dirToLight);
+		if (nDotL <= 0.0f)
+		{
+			continue; // Facing away from the light.
+		}
+
+		colors[n].x = ps2math::min(colors[n].x + color.r * nDotL, maxIntensity);
+		colors[n].y = ps2math::min(colors[n].y + color.g * nDotL, maxIntensity);
+		colors[n].z = ps2math::min(colors[n].z + color.b * nDotL, maxIntensity);
+	}
+}
+
+// ========================================================
+// Md2LightTable::getNormal():
+// ========================================================
+
+const Vector & Md2LightTable::getNormal(const uint normalIndex)
+{
+	ps2assert(normalIndex < NUM_NORMALS);
+	if (!md2NormalsInitialized)
+	{
+		initMd2Normals();
+	}
+	return md2Normals[normalIndex];
+}
+
 // ================================================================================================
 // Md2Model implementation:
 // ================================================================================================
@@ -271,25 +408,124 @@ bool Md2Model::initFromMemory(const ubyte * data, const uint sizeBytes, const fl
 		computeAabbForFrame(f);
 	}
 
+	// Quantization for packed vertexes must cover every frame:
+	Aabb allFramesAabb;
+	allFramesAabb.clear();
+	for (uint f = 0; f < md2FrameCount; ++f)
+	{
+		allFramesAabb.mins = min3PerElement(md2FrameBounds[f].mins, allFramesAabb.mins);
+		allFramesAabb.maxs = max3PerElement(md2FrameBounds[f].maxs, allFramesAabb.maxs);
+	}
+	md2PackedFormat.fromBounds(allFramesAabb);
+
 	// Finish by setting up animation frame numbers:
 	setUpAminations();
 	logComment("MD2 import completed!");
 	return true;
 }
 
+// ========================================================
+// Vertex writers for the frame assembly:
+// ========================================================
+
+//
+// Lets the same assembly loops output either vertex format.
+// The templated loops are only instantiated in this file.
+//
+struct Md2DrawVertexWriter
+{
+	DrawVertex * restrict verts;
+
+	void write(const uint v, const Vector & pos, const Vector & uv, const Vector & color) const
+	{
+		packDrawVertex(verts[v], pos, uv, color);
+	}
+	void nextTriangle()
+	{
+		verts += 3;
+	}
+};
+
+struct Md2PackedVertexWriter
+{
+	PackedDrawVertex * restrict verts;
+	const PackedVertexFormat  * format;
+
+	void write(const uint v, const Vector & pos, const Vector & uv, const Vector & color) const
+	{
+		packDrawVertex(verts[v], pos, uv, color, *format);
+	}
+	void nextTriangle()
+	{
+		verts += 3;
+	}
+};
+
+// ========================================================
+// Md2Model::assembleFrame():
+// ========================================================
+
+void Md2Model::assembleFrame(const uint frameIndex, const uint skinWidth, const uint skinHeight,
+                             const Color4f & vertColor, DrawVertex * restrict drawVerts,
+                             const Md2LightTable * lightTable) const
+{
+	ps2assert(drawVerts != nullptr);
+	Md2DrawVertexWriter writer = { drawVerts };
+	assembleFrameImpl(frameIndex, skinWidth, skinHeight, vertColor, lightTable, writer);
+}
+
 // ========================================================
 // Md2Model::assembleFrame():
 // ========================================================
 
 void Md2Model::assembleFrame(const uint frameIndex, const uint skinWidth, const uint skinHeight,
-                             const Color4f & vertColor, DrawVertex * restrict drawVerts) const
+                             const Color4f & vertColor, PackedDrawVertex * restrict drawVerts,
+                             const Md2LightTable * lightTable) const
+{
+	ps2assert(drawVerts != nullptr);
+	Md2PackedVertexWriter writer = { drawVerts, &md2PackedFormat };
+	assembleFrameImpl(frameIndex, skinWidth, skinHeight, vertColor, lightTable, writer);
+}
+
+// ========================================================
+// Md2Model::assembleFrameInterpolated():
+// ========================================================
+
+void Md2Model::assembleFrameInterpolated(const uint frameA, const uint frameB, const float interp, const uint skinWidth,
+                                         const uint skinHeight, const Color4f & vertColor, DrawVertex * restrict drawVerts,
+                                         const Md2LightTable * lightTable) const
+{
+	ps2assert(drawVerts != nullptr);
+	Md2DrawVertexWriter writer = { drawVerts };
+	assembleFrameInterpolatedImpl(frameA, frameB, interp, skinWidth, skinHeight, vertColor, lightTable, writer);
+}
+
+// ========================================================
+// Md2Model::assembleFrameInterpolated():
+// ========================================================
+
+void Md2Model::assembleFrameInterpolated(const uint frameA, const uint frameB, const float interp, const uint skinWidth,
+                                         const uint skinHeight, const Color4f & vertColor, PackedDrawVertex * restrict drawVerts,
+                                         const Md2LightTable * lightTable) const
+{
+	ps2assert(drawVerts != nullptr);
+	Md2PackedVertexWriter writer = { drawVerts, &md2PackedFormat };
+	assembleFrameInterpolatedImpl(frameA, frameB, interp, skinWidth, skinHeight, vertColor, lightTable, writer);
+}
+
+// ========================================================
+// Md2Model::assembleFrameImpl():
+// ========================================================
+
+template<class WRITER>
+void Md2Model::assembleFrameImpl(const uint frameIndex, const uint skinWidth, const uint skinHeight,
+                                 const Color4f & vertColor, const Md2LightTable * lightTable, WRITER & writer) const
 {
 	// Validation:
 	ps2assert(md2Header    != nullptr);
 	ps2assert(md2TexCoords != nullptr);
 	ps2assert(md2Triangles != nullptr);
 	ps2assert(md2Keyframes != nullptr);
-	ps2assert(drawVerts    != nullptr);
 
 	const Keyframe & frame = getKeyframe(frameIndex);
 	const Vector vColor(vertColor.r, vertColor.g, vertColor.b, vertColor.a);
@@ -318,28 +554,38 @@ void Md2Model::assembleFrame(const uint frameIndex, const uint skinWidth, const
 			xyzPos.z = ((frame.scale[1] * vert.v[1]) + frame.translate[1]) * md2Scale;
 			xyzPos.y = ((frame.scale[2] * vert.v[2]) + frame.translate[2]) * md2Scale;
 
-			// Store the new DrawVertex:
-			packDrawVertex(drawVerts[v], xyzPos, Vector(uvX, uvY, 0.0f, 1.0f), vColor);
+			// Store the new vertex:
+			if (lightTable != nullptr)
+			{
+				const Vector & light = lightTable->getColor(vert.normalIndex);
+				const Vector litColor(vColor.x * light.x, vColor.y * light.y, vColor.z * light.z, vColor.w);
+				writer.write(v, xyzPos, Vector(uvX, uvY, 0.0f, 1.0f), litColor);
+			}
+			else
+			{
+				writer.write(v, xyzPos, Vector(uvX, uvY, 0.0f, 1.0f), vColor);
+			}
 		}
 
 		// Advance 3 vertexes (one triangle).
-		drawVerts += 3;
+		writer.nextTriangle();
 	}
 }
 
 // ========================================================
-// Md2Model::assembleFrameInterpolated():
+// Md2Model::assembleFrameInterpolatedImpl():
 // ========================================================
 
-void Md2Model::assembleFrameInterpolated(const uint frameA, const uint frameB, const float interp, const uint skinWidth,
-                                         const uint skinHeight, const Color4f & vertColor, DrawVertex * restrict drawVerts) const
+template<class WRITER>
+void Md2Model::assembleFrameInterpolatedImpl(const uint frameA, const uint frameB, const float interp, const uint skinWidth,
+                                             const uint skinHeight, const Color4f & vertColor, const Md2LightTable * lightTable,
+                                             WRITER & writer) const
 {
 	// Validation:
 	ps2assert(md2Header    != nullptr);
 	ps2assert(md2TexCoords != nullptr);
 	ps2assert(md2Triangles != nullptr);
 	ps2assert(md2Keyframes != nullptr);
-	ps2assert(drawVerts    != nullptr);
 
 	const Keyframe & keyFrameA = getKeyframe(frameA);
 	const Keyframe & keyFrameB = getKeyframe(frameB);
@@ -376,12 +622,23 @@ void Md2Model::assembleFrameInterpolated(const uint frameA, const uint frameB, c
 			Vector xyzPos;
 			lerpScale(xyzPos, vecA, vecB, interp, md2Scale);
 
-			// Store the new DrawVertex:
-			packDrawVertex(drawVerts[v], xyzPos, Vector(uvX, uvY, 0.0f, 1.0f), vColor);
+			// Store the new vertex. Normals are not interpolated,
+			// we just use the one from the nearest keyframe.
+			if (lightTable != nullptr)
+			{
+				const uint normalIndex = (interp < 0.5f) ? vertA.normalIndex : vertB.normalIndex;
+				const Vector & light = lightTable->getColor(normalIndex);
+				const Vector litColor(vColor.x * light.x, vColor.y * light.y, vColor.z * light.z, vColor.w);
+				writer.write(v, xyzPos, Vector(uvX, uvY, 0.0f, 1.0f), litColor);
+			}
+			else
+			{
+				writer.write(v, xyzPos, Vector(uvX, uvY, 0.0f, 1.0f), vColor);
+			}
 		}
 
 		// Advance 3 vertexes (one triangle).
-		drawVerts += 3;
+		writer.nextTriangle();
 	}
 }
 
@@ -441,6 +698,18 @@ void Md2Model::setUpAminations()
 	// Insert last animation:
 	strncpy(animInfo.name, currentAnim, sizeof(animInfo.name));
 	md2Anims.pushBack(animInfo);
+
+	// Index by name. Done last, since `md2Anims` might move while growing.
+	// If a name repeats, the first anim wins, same as a linear search would.
+	md2AnimsByName.clear();
+	md2AnimsByName.reserve(md2Anims.size());
+	for (uint i = 0; i < md2Anims.size(); ++i)
+	{
+		if (!md2AnimsByName.contains(md2Anims[i].name))
+		{
+			md2AnimsByName.insert(md2Anims[i].name, i);
+		}
+	}
 }
 
 // ========================================================
@@ -496,15 +765,13 @@ void Md2Model::printAnimList() const
 bool Md2Model::findAnimByName(const char * name, uint & start, uint & end, uint & fps) const
 {
 	ps2assert(name != nullptr);
-	for (uint i = 0; i < md2Anims.size(); ++i)
+	const uint * index = md2AnimsByName.find(name);
+	if (index != nullptr)
 	{
-		if (strcmp(md2Anims[i].name, name) == 0)
-		{
-			start = md2Anims[i].start;
-			end   = md2Anims[i].end;
-			fps   = getAnimFpsForRange(start, end);
-			return true;
-		}
+		start = md2Anims[*index].start;
+		end   = md2Anims[*index].end;
+		fps   = getAnimFpsForRange(start, end);
+		return true;
 	}
 	// Not fount.
 	start = end = fps = 0;
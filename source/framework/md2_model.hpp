@@ -35,7 +35,8 @@
 
 #include "common.hpp"
 #include "array.hpp"
-#include "renderer.hpp"
+#include "hash_map.hpp"
+#include "draw_vertex.hpp"
 
 // ========================================================
 // MD2 constants:
@@ -101,6 +102,43 @@ public:
 	void clear();
 };
 
+// ========================================================
+// class Md2LightTable:
+// ========================================================
+
+// Per-vertex lighting for MD2 models. Each MD2 vertex stores an index
+// into a fixed table of 162 precomputed normals (Quake's `anorms.h`),
+// so instead of lighting every vertex we light the 162 normals once per
+// light, then vertex assembly just fetches the color by index.
+// Light colors are used to modulate the texture, so 1.0 is "unlit",
+// values below darken and values above brighten (clamped to ~2.0).
+class Md2LightTable
+{
+public:
+
+	static const uint NUM_NORMALS = 162;
+
+	// Sets all entries to the ambient color.
+	Md2LightTable() { setAmbient(makeColor4f(1.0f, 1.0f, 1.0f)); }
+
+	// Resets all entries to the ambient color. Call this before adding lights.
+	void setAmbient(const Color4f & ambient);
+
+	// Accumulates a directional light into the table. `dirToLight` must be
+	// a normalized vector pointing towards the light, in model space.
+	void addLight(const Vector & dirToLight, const Color4f & color);
+
+	// Light color for an MD2 `Vertex::normalIndex`.
+	const Vector & getColor(const uint normalIndex) const { return colors[normalIndex]; }
+
+	// Access the MD2 normals table (already in our y-up coordinate system).
+	static const Vector & getNormal(uint normalIndex);
+
+private:
+
+	Vector colors[NUM_NORMALS];
+};
+
 // ========================================================
 // class Md2Model:
 // ========================================================
@@ -119,13 +157,29 @@ public:
 
 	// Generates a vertex array for a given animation frame.
 	// `drawVerts[]` must be `triangleCount * 3` elements in size.
+	// If a light table is provided, vertex colors are `vertColor` modulated by the light.
 	void assembleFrame(uint frameIndex, uint skinWidth, uint skinHeight,
-	                   const Color4f & vertColor, DrawVertex * drawVerts) const;
+	                   const Color4f & vertColor, DrawVertex * drawVerts,
+	                   const Md2LightTable * lightTable = nullptr) const;
 
 	// Generated a vertex array for a given frame, from the compressed MD2 frame data.
 	// `drawVerts[]` must be `triangleCount * 3` elements in size.
+	// If a light table is provided, vertex colors are `vertColor` modulated by the light.
 	void assembleFrameInterpolated(uint frameA, uint frameB, float interp, uint skinWidth, uint skinHeight,
-	                               const Color4f & vertColor, DrawVertex * drawVerts) const;
+	                               const Color4f & vertColor, DrawVertex * drawVerts,
+	                               const Md2LightTable * lightTable = nullptr) const;
+
+	// Same as the above, but outputting the compact vertex format. Positions
+	// are quantized with `getPackedVertexFormat()`, which covers all frames.
+	void assembleFrame(uint frameIndex, uint skinWidth, uint skinHeight,
+	                   const Color4f & vertColor, PackedDrawVertex * drawVerts,
+	                   const Md2LightTable * lightTable = nullptr) const;
+	void assembleFrameInterpolated(uint frameA, uint frameB, float interp, uint skinWidth, uint skinHeight,
+	                               const Color4f & vertColor, PackedDrawVertex * drawVerts,
+	                               const Md2LightTable * lightTable = nullptr) const;
+
+	// Dequantization for the vertexes generated by the packed `assembleFrame*`.
+	const PackedVertexFormat & getPackedVertexFormat() const { return md2PackedFormat; }
 
 	// Prints a list of animations to the console.
 	void printAnimList() const;
@@ -240,6 +294,14 @@ private:
 	const Keyframe & getKeyframe(uint frameIndex) const;
 	const Vertex & getFrameVertex(uint frameIndex, uint vertexIndex) const;
 
+	// Shared by the DrawVertex and PackedDrawVertex outputs:
+	template<class WRITER>
+	void assembleFrameImpl(uint frameIndex, uint skinWidth, uint skinHeight,
+	                       const Color4f & vertColor, const Md2LightTable * lightTable, WRITER & writer) const;
+	template<class WRITER>
+	void assembleFrameInterpolatedImpl(uint frameA, uint frameB, float interp, uint skinWidth, uint skinHeight,
+	                                   const Color4f & vertColor, const Md2LightTable * lightTable, WRITER & writer) const;
+
 private:
 
 	// Pointers to extensional data:
@@ -257,9 +319,15 @@ private:
 	// Scaling applied to model vertexes; (1.0) by default.
 	float md2Scale;
 
+	// Scale/bias of the packed vertexes (bounds of all frames).
+	PackedVertexFormat md2PackedFormat;
+
 	// Data owned by Md2Model:
 	Array<Anim> md2Anims;
 	Array<Aabb> md2FrameBounds;
+
+	// Anim name => index in `md2Anims`. Keys point to the names in `md2Anims`.
+	HashMap<const char *, uint> md2AnimsByName;
 };
 
 #endif // MD2_MODEL_HPP
@@ -33,35 +33,633 @@
 #include "common.hpp"
 #include "memory.hpp"
 
+#include <stdint.h> // uintptr_t
+#include <time.h>   // clock(), for the trace timestamps on the host
+
+#if MEM_USE_TLSF
+	#include "tlsf_allocator.hpp"
+#endif // MEM_USE_TLSF
+
+// ========================================================
+// Allocation trace:
+// ========================================================
+
+// Trace records store 32 bits addresses, which is all the EE has.
+// Narrowed through uintptr_t so that host builds with 64 bits pointers compile.
+static inline uint32 memTraceAddress(const void * ptr)
+{
+	return scast<uint32>(rcast<uintptr_t>(ptr));
+}
+
+// PC of the code that called the current allocation function.
+#define MEM_CALLER_PC() memTraceAddress(__builtin_return_address(0))
+
+#if MEM_TRACE
+
+enum MemTraceOp
+{
+	MEM_OP_MALLOC  = 1,
+	MEM_OP_FREE    = 2,
+	MEM_OP_REALLOC = 3  // `oldAddress` is the block resized; equal to `address` when done in place.
+};
+
+// One heap operation. Addresses, sizes and alignments are the ones
+// the heap saw, so they include the MEM_TRACKING headers if enabled.
+// NOTE: `tools/mem_trace_analyzer` has a copy of this, keep the two in sync.
+struct MemTraceRecord
+{
+	uint32 timestamp;  // CPU cycles (COUNT register), wraps around every ~14 seconds.
+	uint32 address;    // Block returned by or passed to the heap.
+	uint32 oldAddress; // Block passed to realloc. Zero for other ops.
+	uint32 sizeBytes;  // Zero for free if not known.
+	uint32 callerPc;
+	uint16 alignment;
+	uint8  tag;
+	uint8  op;
+};
+
+CT_ASSERT_SIZE(MemTraceRecord, 24);
+
+// Start of a trace file.
+struct MemTraceHeader
+{
+	char   magic[4]; // "PMEM"
+	uint16 version;
+	uint16 recordSize;
+	uint32 cpuClockHz;
+};
+
+static const uint MEM_TRACE_BUFFER_SIZE = 1024; // In records, 24KB.
+#if defined(_EE)
+static const uint32 MEM_TRACE_CLOCK_HZ = 294912000; // EE CPU clock.
+#else // !_EE
+static const uint32 MEM_TRACE_CLOCK_HZ = CLOCKS_PER_SEC;
+#endif // _EE
+
+static MemTraceRecord memTraceBuffer[MEM_TRACE_BUFFER_SIZE] ATTRIBUTE_ALIGNED(16);
+static uint   memTraceCount;
+static FILE * memTraceFile;
+
+static inline uint32 memTraceTimestamp()
+{
+#if defined(_EE)
+	uint32 count;
+	__asm__ __volatile__ ("mfc0 %0, $9" : "=r" (count));
+	return count;
+#else // !_EE
+	return scast<uint32>(clock());
+#endif // _EE
+}
+
+static void memTraceRecord(const MemTraceOp op, const MemAllocTag tag, const void * address,
+                           const void * oldAddress, const size_t sizeBytes, const size_t alignment,
+                           const uint32 callerPc)
+{
+	if (memTraceFile == nullptr)
+	{
+		return;
+	}
+
+	MemTraceRecord & rec = memTraceBuffer[memTraceCount];
+	rec.timestamp  = memTraceTimestamp();
+	rec.address    = memTraceAddress(address);
+	rec.oldAddress = memTraceAddress(oldAddress);
+	rec.sizeBytes  = sizeBytes;
+	rec.callerPc   = callerPc;
+	rec.alignment  = alignment;
+	rec.tag        = tag;
+	rec.op         = op;
+
+	if (++memTraceCount == MEM_TRACE_BUFFER_SIZE)
+	{
+		memTraceFlush();
+	}
+}
+
+#define MEM_TRACE_RECORD(op, tag, address, oldAddress, sizeBytes, alignment, callerPc) \
+	memTraceRecord((op), (tag), (address), (oldAddress), (sizeBytes), (alignment), (callerPc))
+
+// ========================================================
+// memTraceStart():
+// ========================================================
+
+bool memTraceStart(const char * filename)
+{
+	ps2assert(filename != nullptr);
+	memTraceStop();
+
+	FILE * file = fopen(filename, "wb");
+	if (file == nullptr)
+	{
+		logError("Unable to open memory trace file \"%s\"", filename);
+		return false;
+	}
+
+	MemTraceHeader header;
+	header.magic[0]   = 'P';
+	header.magic[1]   = 'M';
+	header.magic[2]   = 'E';
+	header.magic[3]   = 'M';
+	header.version    = 1;
+	header.recordSize = sizeof(MemTraceRecord);
+	header.cpuClockHz = MEM_TRACE_CLOCK_HZ;
+	fwrite(&header, 1, sizeof(header), file);
+
+	memTraceCount = 0;
+	memTraceFile  = file; // Start recording.
+
+	logComment("Recording memory trace to \"%s\"...", filename);
+	return true;
+}
+
+// ========================================================
+// memTraceStop():
+// ========================================================
+
+void memTraceStop()
+{
+	if (memTraceFile == nullptr)
+	{
+		return;
+	}
+
+	memTraceFlush();
+
+	// Stop recording before closing, fclose() might free.
+	FILE * file = memTraceFile;
+	memTraceFile = nullptr;
+	fclose(file);
+}
+
+// ========================================================
+// memTraceFlush():
+// ========================================================
+
+void memTraceFlush()
+{
+	if (memTraceFile == nullptr || memTraceCount == 0)
+	{
+		return;
+	}
+
+	// Reset first, in case writing the file ends up allocating.
+	const uint count = memTraceCount;
+	memTraceCount = 0;
+	fwrite(memTraceBuffer, sizeof(MemTraceRecord), count, memTraceFile);
+}
+
+#else // !MEM_TRACE
+
+// Only uses `callerPc`, so the parameters that pass it along don't warn as unused.
+#define MEM_TRACE_RECORD(op, tag, address, oldAddress, sizeBytes, alignment, callerPc) ((void)(callerPc))
+
+bool memTraceStart(const char *) { return false; }
+void memTraceStop()  { }
+void memTraceFlush() { }
+
+#endif // MEM_TRACE
+
+// ========================================================
+// Heap backend:
+// ========================================================
+
+#if MEM_USE_TLSF
+
+// The main heap takes all it can get from the C heap, up to a max, minus
+// some slack left for newlib itself (stdio buffers and such) and the PS2SDK
+// libraries that call malloc directly. Both are set by memSetMainHeapReserve().
+static const size_t MEM_HEAP_MIN_RESERVE  = 4 * 1024 * 1024;
+static const size_t MEM_HEAP_RESERVE_STEP = 256 * 1024;
+static size_t memHeapMaxReserve = MEM_HEAP_DEFAULT_MAX_RESERVE;
+static size_t memHeapCSlack     = MEM_HEAP_DEFAULT_C_SLACK;
+
+// No constructors, so these are usable by allocations made by static constructors.
+static TlsfAllocator memMainHeap;
+static TlsfAllocator memTagArenas[MEM_TAG_COUNT];
+
+static void memReserveMainHeap()
+{
+	// No logging in here, since printf itself might allocate.
+	size_t reserveBytes = memHeapMaxReserve;
+	void * memory = nullptr;
+	while (reserveBytes >= MEM_HEAP_MIN_RESERVE)
+	{
+		if ((memory = memalign(DEFAULT_MEM_ALIGNMENT, reserveBytes)) != nullptr)
+		{
+			break;
+		}
+		reserveBytes -= MEM_HEAP_RESERVE_STEP;
+	}
+
+	if (memory != nullptr)
+	{
+		free(memory);
+		memory = nullptr;
+		if (reserveBytes - memHeapCSlack >= MEM_HEAP_MIN_RESERVE)
+		{
+			reserveBytes -= memHeapCSlack;
+			memory = memalign(DEFAULT_MEM_ALIGNMENT, reserveBytes);
+		}
+	}
+
+	if (memory == nullptr)
+	{
+		fatalError("Unable to reserve memory for the main heap!");
+	}
+
+	memMainHeap.init(memory, reserveBytes);
+}
+
+bool memSetMainHeapReserve(const size_t maxReserveBytes, const size_t cHeapSlackBytes)
+{
+	if (memMainHeap.isInitialized() || maxReserveBytes < MEM_HEAP_MIN_RESERVE)
+	{
+		return false;
+	}
+
+	memHeapMaxReserve = maxReserveBytes;
+	memHeapCSlack     = cHeapSlackBytes;
+	return true;
+}
+
+size_t memGetMainHeapSize()
+{
+	return memMainHeap.isInitialized() ? memMainHeap.getHeapSize() : 0;
+}
+
+static TlsfAllocator & memHeapForPtr(const void * ptr)
+{
+	// Arenas are inside the main heap, so check them first.
+	for (uint t = 0; t < MEM_TAG_COUNT; ++t)
+	{
+		if (memTagArenas[t].isInitialized() && memTagArenas[t].contains(ptr))
+		{
+			return memTagArenas[t];
+		}
+	}
+
+	ps2assert(memMainHeap.contains(ptr) && "Pointer not allocated by memTagMalloc!");
+	return memMainHeap;
+}
+
+static inline void * memHeapAlloc(const MemAllocTag tag, const size_t alignment, const size_t sizeBytes)
+{
+	if (!memMainHeap.isInitialized())
+	{
+		memReserveMainHeap();
+	}
+
+	TlsfAllocator & heap = memTagArenas[tag].isInitialized() ? memTagArenas[tag] : memMainHeap;
+	return heap.allocate(sizeBytes, alignment);
+}
+
+// TLSF resizes in place when it can, so `oldSizeBytes` is not needed here.
+static inline void * memHeapRealloc(const MemAllocTag tag, void * oldPtr, size_t /* oldSizeBytes */,
+                                    const size_t newSizeBytes, const size_t alignment)
+{
+	if (oldPtr == nullptr)
+	{
+		return memHeapAlloc(tag, alignment, newSizeBytes);
+	}
+	return memHeapForPtr(oldPtr).reallocate(oldPtr, newSizeBytes, alignment);
+}
+
+static inline void memHeapFree(void * ptr)
+{
+	if (ptr != nullptr)
+	{
+		memHeapForPtr(ptr).release(ptr);
+	}
+}
+
+bool memCreateTagArena(const MemAllocTag tag, const size_t sizeBytes)
+{
+	if (memTagArenas[tag].isInitialized())
+	{
+		return false;
+	}
+
+	void * memory = memHeapAlloc(MEM_TAG_GENERIC, DEFAULT_MEM_ALIGNMENT, sizeBytes);
+	if (memory == nullptr)
+	{
+		return false;
+	}
+
+	memTagArenas[tag].init(memory, sizeBytes);
+	return true;
+}
+
+#else // !MEM_USE_TLSF
+
+static inline void * memHeapAlloc(MemAllocTag, const size_t alignment, const size_t sizeBytes)
+{
+	return memalign(alignment, sizeBytes);
+}
+
+// The C realloc only keeps the default alignment, so a block with a known
+// size and a stricter alignment is moved by hand. `oldSizeBytes` is zero
+// when the size of the old block is not known.
+static inline void * memHeapRealloc(MemAllocTag, void * oldPtr, const size_t oldSizeBytes,
+                                    const size_t newSizeBytes, const size_t alignment)
+{
+	if (oldPtr == nullptr || oldSizeBytes == 0 || alignment <= DEFAULT_MEM_ALIGNMENT)
+	{
+		return realloc(oldPtr, newSizeBytes);
+	}
+
+	void * newPtr = memalign(alignment, newSizeBytes);
+	if (newPtr != nullptr)
+	{
+		memcpy(newPtr, oldPtr, (oldSizeBytes < newSizeBytes) ? oldSizeBytes : newSizeBytes);
+		free(oldPtr);
+	}
+	return newPtr;
+}
+
+static inline void memHeapFree(void * ptr)
+{
+	free(ptr);
+}
+
+bool memCreateTagArena(MemAllocTag, size_t)
+{
+	// Arenas need MEM_USE_TLSF.
+	return false;
+}
+
+bool memSetMainHeapReserve(size_t, size_t)
+{
+	// Everything goes to the C heap.
+	return false;
+}
+
+size_t memGetMainHeapSize()
+{
+	return 0;
+}
+
+#endif // MEM_USE_TLSF
+
+#if MEM_TRACKING
+
+// ========================================================
+// Tag names:
+// ========================================================
+
+// NOTE: New tags added to `MemAllocTag` should be updated here !!!
+static const char * const memTagNames[MEM_TAG_COUNT] =
+{
+	"GENERIC",
+	"CPP_NEW",
+	"GEOMETRY",
+	"TEXTURE",
+	"PARTICLE",
+	"RENDERER",
+	"FRAME"
+};
+
 // ========================================================
 // Tag counters:
 // ========================================================
 
 struct MemTagCounters
 {
-	uint bytesAllocated;
-	uint mallocCount;
-	uint reallocCount;
-	uint freeCount;
+	MemTagStats stats;
+	bool assertOverBudget;
+	bool overBudget; // Warn only once each time the budget is crossed.
 };
 
 static MemTagCounters memoryTags[MEM_TAG_COUNT] ATTRIBUTE_ALIGNED(16);
 
+MemAllocTag memCurrentNewTag = MEM_TAG_CPP_NEW;
+
+// ========================================================
+// Allocation header:
+// ========================================================
+
+// Stored right before each pointer returned to the caller.
+// The block starts `headerSpace` bytes before the user pointer,
+// which is the alignment of the allocation (min 8 bytes).
+struct MemAllocHeader
+{
+	uint32 sizeBytes;
+	uint16 headerSpace;
+	uint8  tag;
+	uint8  magic;
+};
+
+CT_ASSERT_SIZE(MemAllocHeader, 8);
+
+static const uint8 MEM_HEADER_MAGIC = 0xA5;
+
+static inline MemAllocHeader * getAllocHeader(void * ptr)
+{
+	MemAllocHeader * header = scast<MemAllocHeader *>(ptr) - 1;
+	ps2assert(header->magic == MEM_HEADER_MAGIC && "Bad pointer or heap corruption!");
+	return header;
+}
+
+// ========================================================
+// memTrackAlloc() / memTrackFree():
+// ========================================================
+
+static void memTrackAlloc(const MemAllocTag tag, const size_t blockBytes)
+{
+	MemTagCounters & counters = memoryTags[tag];
+	MemTagStats & stats = counters.stats;
+
+	stats.liveBytes += blockBytes;
+	stats.liveAllocs++;
+	if (stats.liveBytes > stats.peakBytes)
+	{
+		stats.peakBytes = stats.liveBytes;
+	}
+
+	if (stats.budgetBytes != 0 && stats.liveBytes > stats.budgetBytes && !counters.overBudget)
+	{
+		// Set first, since logging might allocate again.
+		counters.overBudget = true;
+		logWarning("Memory tag %s over budget: %s of %s", memTagNames[tag],
+		           formatMemoryUnit(stats.liveBytes), formatMemoryUnit(stats.budgetBytes));
+		ps2assert(!counters.assertOverBudget && "Memory budget exceeded!");
+	}
+}
+
+static void memTrackFree(const MemAllocTag tag, const size_t blockBytes)
+{
+	MemTagCounters & counters = memoryTags[tag];
+	MemTagStats & stats = counters.stats;
+
+	ps2assert(stats.liveBytes >= blockBytes && stats.liveAllocs != 0);
+	stats.liveBytes -= blockBytes;
+	stats.liveAllocs--;
+
+	if (counters.overBudget && stats.liveBytes <= stats.budgetBytes)
+	{
+		counters.overBudget = false;
+	}
+}
+
+// ========================================================
+// memTrackedMalloc() / memTrackedFree():
+// ========================================================
+
+static void * memTrackedMalloc(const MemAllocTag tag, const size_t sizeBytes, const size_t alignment,
+                               const uint32 callerPc)
+{
+	ps2assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+	ps2assert(alignment <= 0x8000);
+
+	const size_t headerSpace = (alignment < sizeof(MemAllocHeader)) ? sizeof(MemAllocHeader) : alignment;
+
+	ubyte * block = scast<ubyte *>(memHeapAlloc(tag, headerSpace, headerSpace + sizeBytes));
+	if (block == nullptr)
+	{
+		fatalError("Failed to allocate %u bytes!", sizeBytes);
+	}
+
+	MemAllocHeader * header = rcast<MemAllocHeader *>(block + headerSpace) - 1;
+	header->sizeBytes   = sizeBytes;
+	header->headerSpace = headerSpace;
+	header->tag         = tag;
+	header->magic       = MEM_HEADER_MAGIC;
+
+	memTrackAlloc(tag, headerSpace + sizeBytes);
+	MEM_TRACE_RECORD(MEM_OP_MALLOC, tag, block, nullptr, headerSpace + sizeBytes, headerSpace, callerPc);
+	return block + headerSpace;
+}
+
+static void memTrackedFree(void * ptr, const uint32 callerPc)
+{
+	MemAllocHeader * header = getAllocHeader(ptr);
+	const MemAllocTag tag   = scast<MemAllocTag>(header->tag);
+	const size_t blockBytes = header->headerSpace + header->sizeBytes;
+	ubyte * block = scast<ubyte *>(ptr) - header->headerSpace;
+
+	header->magic = 0; // Catch double frees.
+	memTrackFree(tag, blockBytes);
+	MEM_TRACE_RECORD(MEM_OP_FREE, tag, block, nullptr, blockBytes, 0, callerPc);
+	memHeapFree(block);
+}
+
 // ========================================================
 // memTagMalloc():
 // ========================================================
 
 void * memTagMalloc(const MemAllocTag tag, const size_t sizeBytes, const size_t alignment)
 {
-	memoryTags[tag].mallocCount++;
-	memoryTags[tag].bytesAllocated += (sizeBytes + alignment);
+	memoryTags[tag].stats.mallocCount++;
+	return memTrackedMalloc(tag, sizeBytes, alignment, MEM_CALLER_PC());
+}
+
+// ========================================================
+// memTagRealloc():
+// ========================================================
+
+void * memTagRealloc(const MemAllocTag tag, void * oldPtr, const size_t newSizeBytes)
+{
+	if (oldPtr == nullptr)
+	{
+		memoryTags[tag].stats.reallocCount++;
+		return memTrackedMalloc(tag, newSizeBytes, DEFAULT_MEM_ALIGNMENT, MEM_CALLER_PC());
+	}
+
+	// Same tag and alignment as the original. The header moves with the
+	// block, so the heap can resize it in place whenever there is room.
+	MemAllocHeader * oldHeader = getAllocHeader(oldPtr);
+	const MemAllocTag oldTag   = scast<MemAllocTag>(oldHeader->tag);
+	const size_t headerSpace   = oldHeader->headerSpace;
+	const size_t oldBlockBytes = headerSpace + oldHeader->sizeBytes;
+	const size_t newBlockBytes = headerSpace + newSizeBytes;
+	ubyte * oldBlock = scast<ubyte *>(oldPtr) - headerSpace;
+
+	ubyte * block = scast<ubyte *>(memHeapRealloc(oldTag, oldBlock, oldBlockBytes, newBlockBytes, headerSpace));
+	if (block == nullptr)
+	{
+		fatalError("Failed to re-allocate %u bytes!", newSizeBytes);
+	}
+
+	MemAllocHeader * header = rcast<MemAllocHeader *>(block + headerSpace) - 1;
+	header->sizeBytes = newSizeBytes;
+
+	memoryTags[oldTag].stats.reallocCount++;
+	memTrackFree(oldTag, oldBlockBytes);
+	memTrackAlloc(oldTag, newBlockBytes);
+	MEM_TRACE_RECORD(MEM_OP_REALLOC, oldTag, block, oldBlock, newBlockBytes, headerSpace, MEM_CALLER_PC());
+
+	return block + headerSpace;
+}
+
+// ========================================================
+// memTagFree():
+// ========================================================
+
+void memTagFree(const MemAllocTag /* tag */, void * ptr)
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+
+	// Accounted to the tag it was allocated with, which can
+	// differ from `tag` for objects created inside a ScopedMemTag.
+	memoryTags[getAllocHeader(ptr)->tag].stats.freeCount++;
+	memTrackedFree(ptr, MEM_CALLER_PC());
+}
+
+// ========================================================
+// memSetTagBudget():
+// ========================================================
+
+void memSetTagBudget(const MemAllocTag tag, const size_t maxBytes, const bool assertOnOverflow)
+{
+	memoryTags[tag].stats.budgetBytes = maxBytes;
+	memoryTags[tag].assertOverBudget  = assertOnOverflow;
+	memoryTags[tag].overBudget        = false;
+}
+
+// ========================================================
+// memGetTagStats():
+// ========================================================
+
+bool memGetTagStats(const MemAllocTag tag, MemTagStats * stats)
+{
+	ps2assert(stats != nullptr);
+	*stats = memoryTags[tag].stats;
+	return true;
+}
+
+#else // !MEM_TRACKING
+
+// Largest alignment the framework asks for (STBI_MALLOC).
+static const size_t MEM_MAX_REALLOC_ALIGN = 128;
+
+// Alignment of an address, from DEFAULT_MEM_ALIGNMENT up to MEM_MAX_REALLOC_ALIGN.
+static inline size_t memPtrAlignment(const void * ptr)
+{
+	const size_t address = scast<size_t>(rcast<uintptr_t>(ptr));
+	size_t alignment = DEFAULT_MEM_ALIGNMENT;
+	while (alignment < MEM_MAX_REALLOC_ALIGN && (address & (alignment * 2 - 1)) == 0)
+	{
+		alignment *= 2;
+	}
+	return alignment;
+}
 
-	void * memory = memalign(alignment, sizeBytes);
+// ========================================================
+// memTagMalloc():
+// ========================================================
+
+void * memTagMalloc(const MemAllocTag tag, const size_t sizeBytes, const size_t alignment)
+{
+	void * memory = memHeapAlloc(tag, alignment, sizeBytes);
 	if (memory == nullptr)
 	{
 		fatalError("Failed to allocate %u bytes!", sizeBytes);
 	}
 
+	MEM_TRACE_RECORD(MEM_OP_MALLOC, tag, memory, nullptr, sizeBytes, alignment, MEM_CALLER_PC());
+	(void)tag;
 	return memory;
 }
 
@@ -71,14 +669,17 @@ void * memTagMalloc(const MemAllocTag tag, const size_t sizeBytes, const size_t
 
 void * memTagRealloc(const MemAllocTag tag, void * oldPtr, const size_t newSizeBytes)
 {
-	memoryTags[tag].reallocCount++;
-
-	void * memory = realloc(oldPtr, newSizeBytes);
+	// Without the header the old alignment is unknown, so keep
+	// whatever alignment the old address has, up to MEM_MAX_REALLOC_ALIGN.
+	const size_t alignment = (oldPtr != nullptr) ? memPtrAlignment(oldPtr) : DEFAULT_MEM_ALIGNMENT;
+	void * memory = memHeapRealloc(tag, oldPtr, 0, newSizeBytes, alignment);
 	if (memory == nullptr)
 	{
 		fatalError("Failed to re-allocate %u bytes!", newSizeBytes);
 	}
 
+	MEM_TRACE_RECORD(MEM_OP_REALLOC, tag, memory, oldPtr, newSizeBytes, alignment, MEM_CALLER_PC());
+	(void)tag;
 	return memory;
 }
 
@@ -88,11 +689,143 @@ void * memTagRealloc(const MemAllocTag tag, void * oldPtr, const size_t newSizeB
 
 void memTagFree(const MemAllocTag tag, void * ptr)
 {
-	memoryTags[tag].freeCount++;
+	if (ptr != nullptr)
+	{
+		MEM_TRACE_RECORD(MEM_OP_FREE, tag, ptr, nullptr, 0, 0, MEM_CALLER_PC());
+	}
 
-	free(ptr);
+	(void)tag;
+	memHeapFree(ptr);
+}
+
+// ========================================================
+// memSetTagBudget():
+// ========================================================
+
+void memSetTagBudget(MemAllocTag, size_t, bool)
+{
+	// Budgets need MEM_TRACKING.
+}
+
+// ========================================================
+// memGetTagStats():
+// ========================================================
+
+bool memGetTagStats(MemAllocTag, MemTagStats * stats)
+{
+	ps2assert(stats != nullptr);
+	memset(stats, 0, sizeof(*stats));
+	return false;
+}
+
+#endif // MEM_TRACKING
+
+// ================================================================================================
+// FrameAllocator implementation:
+// ================================================================================================
+
+// ========================================================
+// FrameAllocator::FrameAllocator():
+// ========================================================
+
+FrameAllocator::FrameAllocator()
+	: memory(nullptr)
+	, frameBase(nullptr)
+	, frameSize(0)
+	, frameUsed(0)
+	, framePeak(0)
+	, peak(0)
+	, frameIndex(0)
+	, failedAllocs(0)
+{
+}
+
+// ========================================================
+// FrameAllocator::~FrameAllocator():
+// ========================================================
+
+FrameAllocator::~FrameAllocator()
+{
+	memFree(MEM_TAG_FRAME, memory);
+}
+
+// ========================================================
+// FrameAllocator::init():
+// ========================================================
+
+void FrameAllocator::init(const size_t bytesPerFrame)
+{
+	ps2assert(memory == nullptr && "FrameAllocator already initialized!");
+	ps2assert(bytesPerFrame != 0);
+
+	// Keep both halves aligned to a cache line.
+	frameSize  = (bytesPerFrame + 63) & ~63;
+	memory     = memAlloc<ubyte>(MEM_TAG_FRAME, frameSize * 2, 64);
+	frameBase  = memory;
+	frameUsed  = 0;
+	frameIndex = 0;
+
+	logComment("Frame allocator initialized with 2x %s", formatMemoryUnit(frameSize));
+}
+
+// ========================================================
+// FrameAllocator::beginFrame():
+// ========================================================
+
+void FrameAllocator::beginFrame()
+{
+	if (memory == nullptr)
+	{
+		return; // Nothing allocated yet.
+	}
+
+	frameIndex ^= 1;
+	frameBase   = memory + (frameIndex * frameSize);
+	frameUsed   = 0;
+	framePeak   = 0;
+}
+
+// ========================================================
+// FrameAllocator::allocBytes():
+// ========================================================
+
+void * FrameAllocator::allocBytes(const size_t sizeBytes, const size_t alignment)
+{
+	ps2assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	if (memory == nullptr)
+	{
+		init(DEFAULT_FRAME_SIZE);
+	}
+
+	const size_t start = (frameUsed + alignment - 1) & ~(alignment - 1);
+	if (start + sizeBytes > frameSize)
+	{
+		logWarning("Frame allocator out of memory! %u bytes requested, %u free.",
+		           scast<uint>(sizeBytes), scast<uint>(frameSize - frameUsed));
+		failedAllocs++;
+		return nullptr;
+	}
+
+	frameUsed = start + sizeBytes;
+	if (frameUsed > framePeak)
+	{
+		framePeak = frameUsed;
+		if (framePeak > peak)
+		{
+			peak = framePeak;
+		}
+	}
+
+	return frameBase + start;
 }
 
+// ========================================================
+// FrameAllocator global instance:
+// ========================================================
+
+FrameAllocator gFrameAllocator;
+
 // ========================================================
 // formatMemoryUnit():
 // ========================================================
@@ -173,43 +906,52 @@ const char * formatMemoryUnit(const size_t memorySizeInBytes, const bool abbrevi
 
 const char * getMemTagsStr()
 {
-	// NOTE: New tags added to `MemAllocTag` should be updated here !!!
-	static const char * tagNames[MEM_TAG_COUNT] =
-	{
-		"GENERIC",
-		"CPP_NEW",
-		"GEOMETRY",
-		"TEXTURE",
-		"PARTICLE",
-		"RENDERER"
-	};
-
 	static char buffer[2048];
 	int charsLeft = 2048, written = 0;
 	char * pStr = buffer;
 
+	#if MEM_TRACKING
 	written = snprintf(pStr, charsLeft,
-		"| tag name | total mem | mallocs | reallocs | frees\n");
+		"| tag name | live      | peak      | budget    | allocs | frees\n");
 	charsLeft -= written, pStr += written;
 
 	size_t usedRam = 0;
 	for (uint t = 0; t < MEM_TAG_COUNT; ++t)
 	{
+		const MemTagStats & stats = memoryTags[t].stats;
 		written = snprintf(pStr, charsLeft,
-			"| %-8s | %-9s | %-7u | %-8u | %-5u\n",
-			tagNames[t],
-			formatMemoryUnit(memoryTags[t].bytesAllocated),
-			memoryTags[t].mallocCount,
-			memoryTags[t].reallocCount,
-			memoryTags[t].freeCount);
+			"| %-8s | %-9s | %-9s | %-9s | %-6u | %-5u\n",
+			memTagNames[t],
+			formatMemoryUnit(stats.liveBytes),
+			formatMemoryUnit(stats.peakBytes),
+			(stats.budgetBytes != 0) ? formatMemoryUnit(stats.budgetBytes) : "-",
+			stats.liveAllocs,
+			stats.freeCount);
 		charsLeft -= written, pStr += written;
 
-		usedRam += memoryTags[t].bytesAllocated;
+		usedRam += stats.liveBytes;
 	}
 
 	written = snprintf(pStr, charsLeft, "RAM  used: ~%s\n",
 			formatMemoryUnit(usedRam, false));
 	charsLeft -= written, pStr += written;
+	#else // !MEM_TRACKING
+	written = snprintf(pStr, charsLeft, "Memory tracking disabled (MEM_TRACKING=0)\n");
+	charsLeft -= written, pStr += written;
+	#endif // MEM_TRACKING
+
+	#if MEM_USE_TLSF
+	written = snprintf(pStr, charsLeft, "Heap used: %s of %s, peak %s\n",
+			formatMemoryUnit(memMainHeap.getUsedBytes()),
+			formatMemoryUnit(memMainHeap.getHeapSize()),
+			formatMemoryUnit(memMainHeap.getPeakUsed()));
+	charsLeft -= written, pStr += written;
+	#endif // MEM_USE_TLSF
+
+	written = snprintf(pStr, charsLeft, "Frame mem peak: %s of %s\n",
+			formatMemoryUnit(gFrameAllocator.getPeak()),
+			formatMemoryUnit(gFrameAllocator.getFrameSize()));
+	charsLeft -= written, pStr += written;
 
 	extern uint gVRamUsedBytes;
 	written = snprintf(pStr, charsLeft, "VRAM used: ~%s\n",
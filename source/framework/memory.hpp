@@ -45,6 +45,7 @@ enum MemAllocTag
 	MEM_TAG_TEXTURE,   // Textures/images allocated on the heap.
 	MEM_TAG_PARTICLES, // Particle emitters.
 	MEM_TAG_RENDERER,  // Renderer misc & render packets.
+	MEM_TAG_FRAME,     // The two halves of the FrameAllocator.
 
 	// Internal use.
 	MEM_TAG_COUNT
@@ -66,6 +67,123 @@ void * memTagMalloc(MemAllocTag tag, size_t sizeBytes, size_t alignment);
 void * memTagRealloc(MemAllocTag tag, void * oldPtr, size_t newSizeBytes);
 void   memTagFree(MemAllocTag tag, void * ptr);
 
+// ========================================================
+// Memory tracking:
+// ========================================================
+
+//
+// With MEM_TRACKING=1 every allocation carries a small header with its
+// size and tag, so the live bytes, peak and count of allocations of each
+// tag are exact, and tags can be given a budget. Realloc/free account to
+// the tag the memory was allocated with. When MEM_TRACKING is not set, the
+// functions above go straight to the heap with no extra cost.
+//
+
+struct MemTagStats
+{
+	size_t   liveBytes;    // Currently allocated, including headers and alignment.
+	size_t   peakBytes;    // High-water mark of `liveBytes`.
+	size_t   budgetBytes;  // Zero if the tag has no budget.
+	unsigned liveAllocs;   // Allocations not yet freed.
+	unsigned mallocCount;
+	unsigned reallocCount;
+	unsigned freeCount;
+};
+
+// Max live bytes for a tag. Zero removes the budget (the default).
+// Going over budget logs a warning, or fails an assertion if `assertOnOverflow`.
+void memSetTagBudget(MemAllocTag tag, size_t maxBytes, bool assertOnOverflow = false);
+
+// Returns false (and zeroed stats) if MEM_TRACKING is off.
+bool memGetTagStats(MemAllocTag tag, MemTagStats * stats);
+
+#if MEM_TRACKING
+// Tag of the plain `operator new`. Changed by ScopedMemTag.
+extern MemAllocTag memCurrentNewTag;
+inline MemAllocTag memGetNewTag() { return memCurrentNewTag; }
+#else // !MEM_TRACKING
+inline MemAllocTag memGetNewTag() { return MEM_TAG_CPP_NEW; }
+#endif // MEM_TRACKING
+
+//
+// Makes plain `new` allocations inside its scope use the given
+// tag instead of MEM_TAG_CPP_NEW. Scopes can be nested.
+// Compiles to nothing if MEM_TRACKING is off.
+//
+class ScopedMemTag
+{
+public:
+
+	#if MEM_TRACKING
+	explicit ScopedMemTag(const MemAllocTag tag) : prevTag(memCurrentNewTag) { memCurrentNewTag = tag; }
+	~ScopedMemTag() { memCurrentNewTag = prevTag; }
+	#else // !MEM_TRACKING
+	explicit ScopedMemTag(MemAllocTag) { }
+	#endif // MEM_TRACKING
+
+private:
+
+	// Copy/assign disallowed.
+	ScopedMemTag(const ScopedMemTag &);
+	ScopedMemTag & operator = (const ScopedMemTag &);
+
+	#if MEM_TRACKING
+	const MemAllocTag prevTag;
+	#endif // MEM_TRACKING
+};
+
+// ========================================================
+// General purpose heap:
+// ========================================================
+
+//
+// With MEM_USE_TLSF=1 the allocation functions above are backed by a
+// TLSF allocator (see tlsf_allocator.hpp) over one big block reserved
+// from the C heap on the first allocation: constant time malloc and free,
+// with less fragmentation than newlib's allocator. Otherwise they go to
+// the C library.
+//
+
+// Defaults for memSetMainHeapReserve().
+const size_t MEM_HEAP_DEFAULT_MAX_RESERVE = 30 * 1024 * 1024;
+const size_t MEM_HEAP_DEFAULT_C_SLACK     = 1024 * 1024;
+
+// Sets how much the main heap reserves: as much as the C heap can give, up to
+// `maxReserveBytes`, minus `cHeapSlackBytes` left to the code that calls malloc
+// directly (newlib's stdio, PS2SDK libraries). Only works before the first
+// allocation; returns false after that, or without MEM_USE_TLSF.
+bool memSetMainHeapReserve(size_t maxReserveBytes, size_t cHeapSlackBytes);
+
+// Size of the main heap. Zero before the first allocation or without MEM_USE_TLSF.
+size_t memGetMainHeapSize();
+
+// Reserve a separate heap of `sizeBytes` for a tag, carved out of the main
+// heap. Allocations with that tag then come from this arena only, so it is
+// also a hard cap on the tag. Returns false without MEM_USE_TLSF, if the tag
+// already has an arena or if there is not enough memory.
+bool memCreateTagArena(MemAllocTag tag, size_t sizeBytes);
+
+// ========================================================
+// Allocation trace:
+// ========================================================
+
+//
+// With MEM_TRACE=1, every call that reaches the heap is recorded with
+// a timestamp, tag, size, alignment, address and the PC of the caller.
+// Records are buffered and written to the file given to `memTraceStart()`
+// when the buffer fills, on `memTraceFlush()` and on `memTraceStop()`.
+// Nothing is recorded while no trace file is open. The trace is replayed
+// on the development machine by `tools/mem_trace_analyzer`.
+// All three are no-ops if MEM_TRACE is not set.
+//
+bool memTraceStart(const char * filename);
+void memTraceStop();
+void memTraceFlush();
+
+// ========================================================
+// Templated allocation helpers:
+// ========================================================
+
 //
 // Templated helper functions.
 // Allocate in terms of `T` instances.
@@ -104,12 +222,12 @@ inline void memFree(MemAllocTag tag, void * ptr)
 // ========================================================
 
 //
-// With implicit MEM_TAG_CPP_NEW:
+// With implicit MEM_TAG_CPP_NEW (or the tag of the current ScopedMemTag):
 //
 
 inline void * operator new (size_t size)
 {
-	return memTagMalloc(MEM_TAG_CPP_NEW, size, DEFAULT_MEM_ALIGNMENT);
+	return memTagMalloc(memGetNewTag(), size, DEFAULT_MEM_ALIGNMENT);
 }
 
 inline void operator delete (void * ptr)
@@ -122,7 +240,7 @@ inline void operator delete (void * ptr)
 
 inline void * operator new[] (size_t size)
 {
-	return memTagMalloc(MEM_TAG_CPP_NEW, size, DEFAULT_MEM_ALIGNMENT);
+	return memTagMalloc(memGetNewTag(), size, DEFAULT_MEM_ALIGNMENT);
 }
 
 inline void operator delete[] (void * ptr)
@@ -170,6 +288,107 @@ inline void deleteArray(MemAllocTag tag, T * ptr, size_t count)
 	}
 }
 
+//
+// Placement construction, for containers and pools that manage their
+// own memory. Not using the placement new from <new> because that
+// header clashes with the operators above.
+//
+
+struct MemPlacement { };
+
+inline void * operator new (size_t, void * where, MemPlacement)
+{
+	return where;
+}
+
+inline void operator delete (void *, void *, MemPlacement)
+{
+}
+
+template<class T>
+inline void memConstruct(T * where)
+{
+	new (where, MemPlacement()) T();
+}
+
+template<class T>
+inline void memConstruct(T * where, const T & value)
+{
+	new (where, MemPlacement()) T(value);
+}
+
+template<class T>
+inline void memDestroy(T * obj)
+{
+	obj->~T();
+}
+
+// ========================================================
+// class FrameAllocator:
+// ========================================================
+
+//
+// Linear (bump) allocator for transient data that only lives for the
+// frame being built, like scratch vertexes and sort buffers. Double-buffered:
+// `beginFrame()` switches halves and resets the new one, so the previous frame's
+// data stays valid while its DMA might still be reading it. There's no free;
+// scratch memory used inside a function can be given back with `getMark()/rewind()`.
+// NOT thread-safe!
+//
+class FrameAllocator
+{
+public:
+
+	// Size of each half if `init()` is not called before the first allocation.
+	static const size_t DEFAULT_FRAME_SIZE = 64 * 1024;
+
+	 FrameAllocator();
+	~FrameAllocator();
+
+	// Allocates the two halves with MEM_TAG_FRAME. Optional, can only be called once.
+	void init(size_t bytesPerFrame);
+
+	// Switch to the other half and reset it. Called by `Renderer::beginFrame()`.
+	void beginFrame();
+
+	// Returns null if the current frame is out of memory.
+	void * allocBytes(size_t sizeBytes, size_t alignment = DEFAULT_MEM_ALIGNMENT);
+
+	template<class T>
+	T * alloc(size_t elementCount, size_t alignment = DEFAULT_MEM_ALIGNMENT)
+	{
+		return reinterpret_cast<T *>(allocBytes(elementCount * sizeof(T), alignment));
+	}
+
+	// Everything allocated after `getMark()` is released by `rewind()`.
+	size_t getMark() const { return frameUsed; }
+	void rewind(const size_t mark) { if (mark < frameUsed) { frameUsed = mark; } }
+
+	// Usage stats. Peak is the high-water mark since startup.
+	size_t getFrameSize()     const { return frameSize;    }
+	size_t getFrameUsed()     const { return frameUsed;    }
+	size_t getFramePeak()     const { return framePeak;    }
+	size_t getPeak()          const { return peak;         }
+	unsigned getFailedAllocs() const { return failedAllocs; }
+
+private:
+
+	// Copy/assign disallowed.
+	FrameAllocator(const FrameAllocator &);
+	FrameAllocator & operator = (const FrameAllocator &);
+
+	unsigned char * memory;    // Both halves, one allocation.
+	unsigned char * frameBase; // Half in use by the current frame.
+	size_t   frameSize;
+	size_t   frameUsed;
+	size_t   framePeak;
+	size_t   peak;
+	unsigned frameIndex;
+	unsigned failedAllocs;
+};
+
+extern FrameAllocator gFrameAllocator;
+
 // ========================================================
 // Misc helpers:
 // ========================================================
@@ -0,0 +1,342 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: object_pool.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Fixed-size object pool with free-list reuse and generational handles.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#ifndef OBJECT_POOL_HPP
+#define OBJECT_POOL_HPP
+
+#include "common.hpp"
+
+// ========================================================
+// struct PoolHandle:
+// ========================================================
+
+//
+// Weak reference to an object in an ObjectPool. The generation of
+// the slot is bumped every time its object is released, so a handle
+// kept after that no longer resolves, even if the slot got reused.
+// Generation zero is never used, so a zeroed handle is null.
+//
+struct PoolHandle
+{
+	uint16 index;
+	uint16 generation;
+
+	bool isNull() const { return generation == 0; }
+	bool operator == (const PoolHandle & other) const { return index == other.index && generation == other.generation; }
+	bool operator != (const PoolHandle & other) const { return !(*this == other); }
+};
+
+const PoolHandle NULL_POOL_HANDLE = { 0, 0 };
+
+// ========================================================
+// template class ObjectPool<T>:
+// ========================================================
+
+//
+// Fixed capacity pool of T instances, set once by `init()`.
+// Unlike Array<T>, constructors and destructors ARE called:
+// `allocate()` default-constructs the object and `release()`
+// destroys it. Released slots go into a free list and are reused
+// by the next allocation, most recently freed first.
+//
+// Objects never move, so plain pointers to them stay valid until
+// released. Live objects can be iterated with `size()` and `[]`,
+// which go through a packed list of the slots in use, so the holes
+// left by released objects are skipped. Releasing an object moves
+// the last one in that list into its place, so the iteration order
+// is not stable across releases.
+//
+template<class T>
+class ObjectPool
+{
+public:
+
+	typedef unsigned int size_type;
+	typedef T value_type;
+
+	 ObjectPool();
+	~ObjectPool();
+
+	// Allocates memory for `maxObjects`. Previous contents are destroyed.
+	void init(size_type maxObjects, MemAllocTag tag = MEM_TAG_GENERIC);
+
+	// Destroys all objects and frees the memory.
+	void shutdown();
+
+	// Destroys all objects but keeps the memory for reuse.
+	void clear();
+
+	// Returns null if the pool is full. Handle is optional.
+	value_type * allocate(PoolHandle * outHandle = nullptr);
+
+	// Destroys the object and returns its slot to the free list. Null is ignored.
+	void release(value_type * obj);
+	void release(PoolHandle handle);
+
+	// Null if the handle is null or stale.
+	value_type * get(PoolHandle handle) const;
+	PoolHandle getHandle(const value_type * obj) const;
+
+	// Test if the object belongs to this pool and is live.
+	bool owns(const value_type * obj) const;
+
+	bool isEmpty()  const { return used == 0;     }
+	bool isFull()   const { return used == total; }
+	size_type size()     const { return used;  }
+	size_type capacity() const { return total; }
+
+	// Dense iteration of the live objects, `index < size()`.
+	const value_type & operator [] (size_type index) const;
+	value_type & operator [] (size_type index);
+
+private:
+
+	// Copy/assign disallowed.
+	ObjectPool(const ObjectPool &);
+	ObjectPool & operator = (const ObjectPool &);
+
+	size_type slotOf(const value_type * obj) const;
+	void releaseSlot(size_type slot);
+
+	// Member data:
+	value_type * objects;     // Storage for `total` objects; only the live slots are constructed.
+	uint16     * generations; // Current generation of each slot.
+	uint16     * slotLinks;   // Live slot: position in `liveSlots`. Free slot: next free slot.
+	uint16     * liveSlots;   // Packed list of the `used` slots in use.
+	size_type    total;       // Capacity.
+	size_type    used;        // Live objects.
+	size_type    freeHead;    // First free slot or `total` if full.
+	MemAllocTag  memTag;
+};
+
+// ========================================================
+// Inline methods of ObjectPool<T>:
+// ========================================================
+
+template<class T>
+ObjectPool<T>::ObjectPool()
+	: objects(nullptr)
+	, generations(nullptr)
+	, slotLinks(nullptr)
+	, liveSlots(nullptr)
+	, total(0)
+	, used(0)
+	, freeHead(0)
+	, memTag(MEM_TAG_GENERIC)
+{
+	// Construct empty. Call init() before use.
+}
+
+template<class T>
+ObjectPool<T>::~ObjectPool()
+{
+	shutdown();
+}
+
+template<class T>
+void ObjectPool<T>::init(const size_type maxObjects, const MemAllocTag tag)
+{
+	ps2assert(maxObjects != 0 && maxObjects <= 0xFFFF);
+	shutdown();
+
+	memTag  = tag;
+	total   = maxObjects;
+	objects = scast<value_type *>(memTagMalloc(tag, total * sizeof(T), DEFAULT_MEM_ALIGNMENT));
+
+	// The three uint16 arrays share a single block:
+	generations = memAlloc<uint16>(tag, total * 3);
+	slotLinks   = generations + total;
+	liveSlots   = slotLinks   + total;
+
+	for (size_type s = 0; s < total; ++s)
+	{
+		generations[s] = 1;
+		slotLinks[s]   = scast<uint16>(s + 1);
+	}
+	used     = 0;
+	freeHead = 0;
+}
+
+template<class T>
+void ObjectPool<T>::shutdown()
+{
+	if (objects == nullptr)
+	{
+		return;
+	}
+
+	clear();
+	memTagFree(memTag, objects);
+	memFree(memTag, generations);
+
+	objects     = nullptr;
+	generations = nullptr;
+	slotLinks   = nullptr;
+	liveSlots   = nullptr;
+	total       = 0;
+	freeHead    = 0;
+}
+
+template<class T>
+void ObjectPool<T>::clear()
+{
+	while (used != 0)
+	{
+		releaseSlot(liveSlots[used - 1]);
+	}
+}
+
+template<class T>
+typename ObjectPool<T>::value_type * ObjectPool<T>::allocate(PoolHandle * outHandle)
+{
+	ps2assert(objects != nullptr && "ObjectPool not initialized!");
+	if (freeHead == total)
+	{
+		return nullptr;
+	}
+
+	const size_type slot = freeHead;
+	freeHead = slotLinks[slot];
+
+	slotLinks[slot] = scast<uint16>(used);
+	liveSlots[used++] = scast<uint16>(slot);
+
+	if (outHandle != nullptr)
+	{
+		outHandle->index      = scast<uint16>(slot);
+		outHandle->generation = generations[slot];
+	}
+	value_type * obj = &objects[slot];
+	memConstruct(obj);
+	return obj;
+}
+
+template<class T>
+void ObjectPool<T>::release(value_type * obj)
+{
+	if (obj != nullptr)
+	{
+		ps2assert(owns(obj) && "Object not allocated by this pool or already released!");
+		releaseSlot(slotOf(obj));
+	}
+}
+
+template<class T>
+void ObjectPool<T>::release(const PoolHandle handle)
+{
+	value_type * obj = get(handle);
+	if (obj != nullptr)
+	{
+		releaseSlot(handle.index);
+	}
+}
+
+template<class T>
+typename ObjectPool<T>::value_type * ObjectPool<T>::get(const PoolHandle handle) const
+{
+	if (handle.isNull() || handle.index >= total || generations[handle.index] != handle.generation)
+	{
+		return nullptr;
+	}
+	return &objects[handle.index];
+}
+
+template<class T>
+PoolHandle ObjectPool<T>::getHandle(const value_type * obj) const
+{
+	if (!owns(obj))
+	{
+		return NULL_POOL_HANDLE;
+	}
+
+	const size_type slot = slotOf(obj);
+	PoolHandle handle;
+	handle.index      = scast<uint16>(slot);
+	handle.generation = generations[slot];
+	return handle;
+}
+
+template<class T>
+bool ObjectPool<T>::owns(const value_type * obj) const
+{
+	if (obj < objects || obj >= objects + total)
+	{
+		return false;
+	}
+
+	// A live slot's link points back at it from the live list.
+	const size_type slot = slotOf(obj);
+	return slotLinks[slot] < used && liveSlots[slotLinks[slot]] == slot;
+}
+
+template<class T>
+const typename ObjectPool<T>::value_type & ObjectPool<T>::operator [] (const size_type index) const
+{
+	ps2assert(index < used);
+	return objects[liveSlots[index]];
+}
+
+template<class T>
+typename ObjectPool<T>::value_type & ObjectPool<T>::operator [] (const size_type index)
+{
+	ps2assert(index < used);
+	return objects[liveSlots[index]];
+}
+
+template<class T>
+typename ObjectPool<T>::size_type ObjectPool<T>::slotOf(const value_type * obj) const
+{
+	return scast<size_type>(obj - objects);
+}
+
+template<class T>
+void ObjectPool<T>::releaseSlot(const size_type slot)
+{
+	memDestroy(&objects[slot]);
+
+	// Any handles to the old object are stale from now on.
+	if (++generations[slot] == 0)
+	{
+		generations[slot] = 1;
+	}
+
+	// Move the last live slot into the hole in the packed list:
+	const size_type pos  = slotLinks[slot];
+	const size_type last = liveSlots[--used];
+	liveSlots[pos]  = scast<uint16>(last);
+	slotLinks[last] = scast<uint16>(pos);
+
+	slotLinks[slot] = scast<uint16>(freeHead);
+	freeHead = slot;
+}
+
+#endif // OBJECT_POOL_HPP
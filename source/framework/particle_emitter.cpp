@@ -32,43 +32,81 @@
 
 #include "particle_emitter.hpp"
 #include "ps2_math/frustum.hpp"
-#include "quick_sort.hpp"
+#include "radix_sort.hpp"
+#include "scratchpad.hpp"
 #include "game_time.hpp"
 
 // ========================================================
-// ParticleEmitter shared static data:
+// Particle constants and local helpers:
 // ========================================================
 
-uint16     * ParticleEmitter::particleIndexBuffer  = nullptr;
-DrawVertex * ParticleEmitter::particleVertexBuffer = nullptr;
-static const uint MAX_PARTICLES_PER_EMITTER        = 1024;
+// Emission LOD: full rate up to the near distance from the eye, then
+// scaled down linearly until the far distance, where the minimum applies.
+static const float PRT_LOD_NEAR_DIST = 8.0f;
+static const float PRT_LOD_FAR_DIST  = 24.0f;
+static const float PRT_LOD_MIN_SCALE = 0.25f;
+
+// Simulation LOD: emitters with a smaller emission scale than
+// these are only integrated every 2nd or every 4th frame.
+static const float PRT_LOD_HALF_RATE_SCALE    = 0.75f;
+static const float PRT_LOD_QUARTER_RATE_SCALE = 0.4f;
+
+// Longest time step of one integration. The air resistance damping is
+// `1 - dt`, so emitters catching up after being off-screen integrate
+// the elapsed time in steps of up to this size.
+static const float PRT_MAX_SIM_STEP_SEC = 0.125f;
+
+// Particles live for the emitter's life cycle plus up to this much.
+static const uint PRT_LIFE_JITTER_MS = 500;
+
+// Number of float/uint streams in a ParticleArrays.
+static const uint PARTICLE_STREAM_COUNT = 9;
+
+// End of the list of free pool ranges.
+static const uint PRT_FREE_LIST_END = ~0u;
+
+// Streams are padded to a multiple of 4 particles (one quadword),
+// so the 4-wide update never has to deal with a partial tail.
+static inline uint roundUpToQuadword(const uint count)
+{
+	return (count + 3) & ~3u;
+}
+
+// Horizontal min/max of the four lanes of a Vector.
+static inline float minOf4(const Vector & v)
+{
+	const float a = (v.x < v.y) ? v.x : v.y;
+	const float b = (v.z < v.w) ? v.z : v.w;
+	return (a < b) ? a : b;
+}
+static inline float maxOf4(const Vector & v)
+{
+	const float a = (v.x > v.y) ? v.x : v.y;
+	const float b = (v.z > v.w) ? v.z : v.w;
+	return (a > b) ? a : b;
+}
+
+// Particle color in the GS format stored by `ParticleArrays::color`.
+// Same conversion done by the renderer: RGB scaled by 128, alpha as is.
+static inline uint32 packParticleColor(const Color4f & color)
+{
+	const uint32 r = scast<uint32>(clamp(color.r * 128.0f, 0.0f, 255.0f));
+	const uint32 g = scast<uint32>(clamp(color.g * 128.0f, 0.0f, 255.0f));
+	const uint32 b = scast<uint32>(clamp(color.b * 128.0f, 0.0f, 255.0f));
+	const uint32 a = scast<uint32>(clamp(color.a, 0.0f, 255.0f));
+	return r | (g << 8) | (b << 16) | (a << 24);
+}
 
 // ========================================================
 // ParticleEmitter::ParticleEmitter():
 // ========================================================
 
 ParticleEmitter::ParticleEmitter()
-	: particles(nullptr)
+	: poolOffset(0)
+	, particleCapacity(0)
 	, spriteTexture(nullptr)
-	, ibPtr(nullptr)
-	, vbPtr(nullptr)
 {
-	// One time initialization of shared data:
-	//
-	if (particleIndexBuffer == nullptr)
-	{
-		particleIndexBuffer = memClearedAlloc<uint16>(MEM_TAG_GEOMETRY, (MAX_PARTICLES_PER_EMITTER * 6));
-		logComment("Initialized PRT index buffer.");
-	}
-	if (particleVertexBuffer == nullptr)
-	{
-		particleVertexBuffer = memClearedAlloc<DrawVertex>(MEM_TAG_GEOMETRY, (MAX_PARTICLES_PER_EMITTER * 4));
-		logComment("Initialized PRT vertex buffer.");
-	}
-
-	ibPtr = particleIndexBuffer;
-	vbPtr = particleVertexBuffer;
-
+	memset(&particles, 0, sizeof(particles));
 	setDefaults();
 }
 
@@ -78,7 +116,10 @@ ParticleEmitter::ParticleEmitter()
 
 ParticleEmitter::~ParticleEmitter()
 {
-	memFree(MEM_TAG_PARTICLES, particles);
+	if (particles.posX != nullptr)
+	{
+		gParticleManager.freeRange(poolOffset, particleCapacity);
+	}
 }
 
 // ========================================================
@@ -87,11 +128,20 @@ ParticleEmitter::~ParticleEmitter()
 
 void ParticleEmitter::allocateParticles()
 {
-	ps2assert(particles == nullptr && "Deallocate first!");
+	ps2assert(particles.posX == nullptr && "Deallocate first!");
 	ps2assert(maxParticles != 0 && "Set a max particle amount!");
-	ps2assert(maxParticles <= MAX_PARTICLES_PER_EMITTER);
 
-	particles = memAlloc<Particle>(MEM_TAG_PARTICLES, maxParticles);
+	// Particles live in the shared pool. The emitter's streams
+	// are just views into its range of the pool streams.
+	particleCapacity = gParticleManager.allocRange(maxParticles, poolOffset);
+	if (particleCapacity < maxParticles)
+	{
+		// allocRange() has logged the error. Limit the emitter to what it got.
+		maxParticles = particleCapacity;
+		minParticles = (minParticles < particleCapacity) ? minParticles : particleCapacity;
+	}
+
+	gParticleManager.getRangeArrays(poolOffset, particles);
 }
 
 // ========================================================
@@ -102,8 +152,14 @@ void ParticleEmitter::freeParticles()
 {
 	activeParticleCount = 0;
 
-	memFree(MEM_TAG_PARTICLES, particles);
-	particles = nullptr;
+	if (particles.posX != nullptr)
+	{
+		gParticleManager.freeRange(poolOffset, particleCapacity);
+	}
+
+	poolOffset       = 0;
+	particleCapacity = 0;
+	memset(&particles, 0, sizeof(particles));
 }
 
 // ========================================================
@@ -112,7 +168,7 @@ void ParticleEmitter::freeParticles()
 
 void ParticleEmitter::setDefaults()
 {
-	if (particles != nullptr)
+	if (particles.posX != nullptr)
 	{
 		freeParticles();
 	}
@@ -136,9 +192,19 @@ void ParticleEmitter::setDefaults()
 	minParticles              = 1;
 	maxParticles              = 1;
 	activeParticleCount       = 0;
+	particleAllowance         = ~0u;
+	priority                  = 0;
+	lodScale                  = 1.0f;
+	lodDistanceSqr            = 0.0f;
+	lastSimTimeMs             = 0;
+	simInterval               = 1;
+	simFrameCounter           = 0;
 	enabled                   = true;
 	simulateAirResistance     = false;
 	oneTimeEmission           = false;
+
+	bounds.mins = emitterOrigin;
+	bounds.maxs = emitterOrigin;
 }
 
 // ========================================================
@@ -147,7 +213,7 @@ void ParticleEmitter::setDefaults()
 
 void ParticleEmitter::updateParticles()
 {
-	if (particles == nullptr)
+	if (particles.posX == nullptr)
 	{
 		allocateParticles();
 	}
@@ -156,49 +222,48 @@ void ParticleEmitter::updateParticles()
 	ps2assert(activeParticleCount <= maxParticles);
 
 	// Shortcut variables:
-	const float deltaTimeSec  = gTime.deltaTimeSeconds;
-	const uint  currentTimeMs = gTime.currentTimeMillis;
-
-	// First move the ones that are no longer active to the end
-	// and mark those that will start to fade away:
-	uint num = 0;
-	Particle * particle = particles;
-	for (uint i = 0; i < activeParticleCount; ++i, ++particle)
+	const uint currentTimeMs = gTime.currentTimeMillis;
+	const uint spawnLimit    = (particleAllowance < maxParticles) ? particleAllowance : maxParticles;
+
+	// First get rid of the ones that are no longer active.
+	// The allowance is a hard limit, so the particles over it
+	// are dropped too, instead of living on outside the budget.
+	killExpiredParticles(currentTimeMs);
+	if (activeParticleCount > spawnLimit)
 	{
-		if (particle->durationMs > currentTimeMs)
-		{
-			if (num != i)
-			{
-				ps2assert(num < maxParticles);
-				particles[num] = *particle;
-			}
-			++num;
-		}
+		activeParticleCount = spawnLimit;
 	}
 
-	// Update active count:
-	activeParticleCount = num;
-	ps2assert(activeParticleCount <= maxParticles);
-
-	// Update the ones still active:
-	for (uint i = 0; i < activeParticleCount; ++i)
+	// Then update the ones still alive. Distant emitters integrate
+	// less often, with the time elapsed since the last integration.
+	// Emitters are only updated while visible, so this also catches
+	// up the particles of an emitter that was off-screen for a while.
+	// Nothing lives longer than the life cycle, so that's the most
+	// time there is to catch up.
+	if (++simFrameCounter >= simInterval)
 	{
-		particle = &particles[i];
-
-		// Update velocity with respect to gravity (constant acceleration):
-		particle->velocity += gravityVec * deltaTimeSec;
+		const uint maxLifeMs = particleLifeCycleMs + PRT_LIFE_JITTER_MS;
+		uint elapsedMs = currentTimeMs - lastSimTimeMs;
+		if (elapsedMs > maxLifeMs)
+		{
+			elapsedMs = maxLifeMs;
+		}
 
-		// Update velocity with respect to wind
-		// (acceleration based on difference of vectors):
-		if (simulateAirResistance)
+		float remainingSec = elapsedMs * 0.001f;
+		while (remainingSec > 0.0f)
 		{
-			particle->velocity += (windVelocityVec - particle->velocity) * deltaTimeSec;
+			const float stepSec = (remainingSec < PRT_MAX_SIM_STEP_SEC) ? remainingSec : PRT_MAX_SIM_STEP_SEC;
+			integrateParticles(stepSec);
+			remainingSec -= stepSec;
 		}
 
-		// Finally, update position with respect to velocity:
-		particle->position += particle->velocity * deltaTimeSec;
+		lastSimTimeMs   = currentTimeMs;
+		simFrameCounter = 0;
 	}
 
+	// Spawning is limited by the share of the global budget as well.
+	const uint minActive  = (minParticles < spawnLimit) ? minParticles : spawnLimit;
+
 	// Return early if this is a one-time emitter and
 	// it has already burned its particle budget.
 	if (isOneTimeEmitterFinished())
@@ -208,29 +273,47 @@ void ParticleEmitter::updateParticles()
 
 	// Emit new particles in accordance to the flow rate.
 	// Also emit new ones if we have less particles active than the minimum required.
-	if ((currentTimeMs - lastUpdateMs) > particleReleaseIntervalMs || activeParticleCount < minParticles)
+	if ((currentTimeMs - lastUpdateMs) > particleReleaseIntervalMs || activeParticleCount < minActive)
 	{
 		lastUpdateMs = currentTimeMs;
+		const uint32 packedColor = packParticleColor(baseColor);
+
+		// Emit new particles at specified flow rate, scaled by the distance LOD:
+		uint releaseAmount = scast<uint>(particleReleaseAmount * lodScale);
+		if (releaseAmount == 0)
+		{
+			releaseAmount = 1;
+		}
 
-		// Emit new particles at specified flow rate:
-		for (uint i = 0; i < particleReleaseAmount; ++i)
+		for (uint i = 0; i < releaseAmount; ++i)
 		{
 			// Do we have any free particles to put back to work?
-			if (activeParticleCount < maxParticles)
+			if (activeParticleCount < spawnLimit)
 			{
-				particle = &particles[activeParticleCount];
-				particle->position   = emitterOrigin;
-				particle->velocity   = particleVelocityVec;
-				particle->size       = randomFloat(minParticleSize, maxParticleSize);
-				particle->durationMs = currentTimeMs + particleLifeCycleMs + randomInt(0, 500);
-
+				Vector velocity = particleVelocityVec;
 				if (velocityVar != 0.0f)
 				{
-					particle->velocity += getRandVector() * velocityVar;
+					velocity += getRandVector() * velocityVar;
 				}
 
+				const uint p = activeParticleCount;
+				particles.posX[p]     = emitterOrigin.x;
+				particles.posY[p]     = emitterOrigin.y;
+				particles.posZ[p]     = emitterOrigin.z;
+				particles.velX[p]     = velocity.x;
+				particles.velY[p]     = velocity.y;
+				particles.velZ[p]     = velocity.z;
+				particles.size[p]     = randomFloat(minParticleSize, maxParticleSize);
+				particles.expiryMs[p] = currentTimeMs + particleLifeCycleMs + randomInt(0, PRT_LIFE_JITTER_MS);
+				particles.color[p]    = packedColor;
+
 				++activeParticleCount;
 				++particlesEmitted;
+
+				// Integration keeps the bounds, new ones just spawned at the origin.
+				// Grow it now so the bounds stay conservative in between.
+				bounds.mins = min3PerElement(bounds.mins, emitterOrigin);
+				bounds.maxs = max3PerElement(bounds.maxs, emitterOrigin);
 			}
 			else
 			{
@@ -242,138 +325,290 @@ void ParticleEmitter::updateParticles()
 }
 
 // ========================================================
-// ParticleEmitter::drawParticles():
+// ParticleEmitter::killExpiredParticles():
 // ========================================================
 
-void ParticleEmitter::drawParticles(const Matrix & viewMatrix, const Vector & eyePos)
+void ParticleEmitter::killExpiredParticles(const uint currentTimeMs)
 {
-	if (!hasParticlesToDraw())
+	const uint * restrict expiry = particles.expiryMs;
+	uint i = 0;
+
+	// Draw order is rebuilt by the sort every frame, so a dead particle
+	// is simply replaced by the last active one. This only costs a move per
+	// expired particle, instead of shifting every live particle down.
+	while (i < activeParticleCount)
 	{
-		return;
+		// Fast path: skip over four live particles at once.
+		if ((i + 4) <= activeParticleCount)
+		{
+			const uint allAlive = (expiry[i + 0] > currentTimeMs) & (expiry[i + 1] > currentTimeMs) &
+			                      (expiry[i + 2] > currentTimeMs) & (expiry[i + 3] > currentTimeMs);
+			if (allAlive)
+			{
+				i += 4;
+				continue;
+			}
+		}
+
+		if (expiry[i] > currentTimeMs)
+		{
+			++i;
+			continue;
+		}
+
+		// Expired. Pull the last active into its slot and test it again.
+		--activeParticleCount;
+		if (i != activeParticleCount)
+		{
+			moveParticle(i, activeParticleCount);
+		}
 	}
 
-	// Sort the particles according to the distance of each from the viewer.
-	// This is necessary to ensure proper transparency rendering and
-	// also because particles are rendered with depth-writing disabled.
-	//
-	sortActiveParticles(eyePos);
+	ps2assert(activeParticleCount <= maxParticles);
+}
+
+// ========================================================
+// ParticleEmitter::moveParticle():
+// ========================================================
+
+void ParticleEmitter::moveParticle(const uint dest, const uint src)
+{
+	ps2assert(dest < maxParticles);
+	ps2assert(src  < maxParticles);
+
+	particles.posX[dest]     = particles.posX[src];
+	particles.posY[dest]     = particles.posY[src];
+	particles.posZ[dest]     = particles.posZ[src];
+	particles.velX[dest]     = particles.velX[src];
+	particles.velY[dest]     = particles.velY[src];
+	particles.velZ[dest]     = particles.velZ[src];
+	particles.size[dest]     = particles.size[src];
+	particles.expiryMs[dest] = particles.expiryMs[src];
+	particles.color[dest]    = particles.color[src];
+}
 
-	// Orient particle billboards to face the viewer:
-	const float * view = toFloatPtr(viewMatrix);
-	const Vector rightVec(view[0], view[4], view[8], 1.0f);
-	const Vector upVec   (view[1], view[5], view[9], 1.0f);
+// ========================================================
+// integrateParticleAxis():
+// ========================================================
 
-	uint16     * restrict indexPtr  = ibPtr;
-	DrawVertex * restrict vertexPtr = vbPtr;
+//
+// Integrates one axis of the particle streams, four particles per step:
+//
+//   vel = (vel * params.x) + forces.AXIS
+//   pos = pos + (vel * params.y)
+//
+// With `params = { velocity damping, delta time }`. The forces
+// vector holds the velocity change from gravity and wind per axis.
+// `count` must be a multiple of 4 and both streams 16 bytes aligned.
+// `laneMin/laneMax` accumulate the per-lane min/max of the new positions.
+//
+#if PS2MATH_USE_SSE2
 
-	const uint16 baseIndexes[6] ATTRIBUTE_ALIGNED(16) = { 0, 1, 2, 2, 3, 0 };
-	uint vertexesUsed = 0;
-	uint indexesUsed  = 0;
+// Host fallbacks, so the particle code can be exercised off the console.
+static inline void integrateParticleAxis(float * restrict pos, float * restrict vel, const uint count,
+                                         const float damping, const float deltaTime, const float force,
+                                         float * laneMin, float * laneMax)
+{
+	const __m128 vDamping = _mm_set1_ps(damping);
+	const __m128 vDelta   = _mm_set1_ps(deltaTime);
+	const __m128 vForce   = _mm_set1_ps(force);
+	__m128 vMin = _mm_load_ps(laneMin);
+	__m128 vMax = _mm_load_ps(laneMax);
 
-	for (uint i = 0; i < activeParticleCount; ++i)
+	for (uint i = 0; i < count; i += 4)
 	{
-		const Particle & particle = particles[i];
+		__m128 v = _mm_load_ps(vel + i);
+		__m128 p = _mm_load_ps(pos + i);
+		v = _mm_add_ps(_mm_mul_ps(v, vDamping), vForce);
+		p = _mm_add_ps(p, _mm_mul_ps(v, vDelta));
+		vMin = _mm_min_ps(vMin, p);
+		vMax = _mm_max_ps(vMax, p);
+		_mm_store_ps(vel + i, v);
+		_mm_store_ps(pos + i, p);
+	}
 
-		// Make a billboard for the particle:
-		//
-		Billboard billboard;
-		makeBillboardFacingCameraPlane(billboard, upVec, rightVec,
-			particle.position, baseColor, particle.size, particle.size);
+	_mm_store_ps(laneMin, vMin);
+	_mm_store_ps(laneMax, vMax);
+}
 
-		// Add its vertexes & indexes to the draw batch:
-		//
-		ps2assert((indexesUsed  + 6) <= (MAX_PARTICLES_PER_EMITTER * 6));
-		ps2assert((vertexesUsed + 4) <= (MAX_PARTICLES_PER_EMITTER * 4));
+#define INTEGRATE_PARTICLE_AXIS(axis, pos, vel, count, params, forces, laneMin, laneMax) \
+	integrateParticleAxis((pos), (vel), (count), (params).x, (params).y, (forces).axis, \
+	                      &(laneMin).x, &(laneMax).x)
 
-		// Copy the 6 indexes (two triangles):
-		for (uint i = 0; i < 6; ++i)
-		{
-			indexPtr[i] = baseIndexes[i] + vertexesUsed;
-		}
-		indexesUsed += 6;
-		indexPtr    += 6;
+#elif !PS2MATH_USE_VU0
+
+static inline void integrateParticleAxis(float * restrict pos, float * restrict vel, const uint count,
+                                         const float damping, const float deltaTime, const float force,
+                                         float * laneMin, float * laneMax)
+{
+	// `count` is a multiple of 4; keep the lanes in locals like the 4-wide paths.
+	float mins[4] = { laneMin[0], laneMin[1], laneMin[2], laneMin[3] };
+	float maxs[4] = { laneMax[0], laneMax[1], laneMax[2], laneMax[3] };
 
-		// Expand the four edges of the billboard quadrilateral:
-		for (uint v = 0; v < 4; ++v)
+	for (uint i = 0; i < count; i += 4)
+	{
+		for (uint lane = 0; lane < 4; ++lane)
 		{
-			packDrawVertex(vertexPtr[v], billboard.points[v], billboard.texCoords[v], billboard.color);
+			const float v = (vel[i + lane] * damping) + force;
+			const float p = pos[i + lane] + (v * deltaTime);
+			vel[i + lane] = v;
+			pos[i + lane] = p;
+			mins[lane] = (p < mins[lane]) ? p : mins[lane];
+			maxs[lane] = (p > maxs[lane]) ? p : maxs[lane];
 		}
-		vertexesUsed += 4;
-		vertexPtr    += 4;
 	}
 
-	if (spriteTexture != nullptr)
+	for (uint lane = 0; lane < 4; ++lane)
 	{
-		gRenderer.setTexture(*spriteTexture);
+		laneMin[lane] = mins[lane];
+		laneMax[lane] = maxs[lane];
 	}
-
-	// Finally, issue the draw call for all particles in this emitter.
-	// Particles don't need to be back-face culled, since they consist
-	// of camera-facing billboarded quadrilaterals.
-	gRenderer.drawIndexedTrianglesUnculled(ibPtr, indexesUsed, vbPtr, vertexesUsed);
 }
 
-// ========================================================
-// struct PrtQSortPredicate:
-// ========================================================
+#define INTEGRATE_PARTICLE_AXIS(axis, pos, vel, count, params, forces, laneMin, laneMax) \
+	integrateParticleAxis((pos), (vel), (count), (params).x, (params).y, (forces).axis, \
+	                      &(laneMin).x, &(laneMax).x)
+
+#else // PS2MATH_USE_VU0
+
+// `axis` selects the `forces` component added: vaddx, vaddy or vaddz.
+#define INTEGRATE_PARTICLE_AXIS(axis, pos, vel, count, params, forces, laneMin, laneMax) \
+	for (uint i = 0; i < (count); i += 4) \
+	{ \
+		asm volatile ( \
+			"lqc2         vf10, 0x0(%2)       \n\t" /* vf10 = params */ \
+			"lqc2         vf11, 0x0(%3)       \n\t" /* vf11 = forces */ \
+			"lqc2         vf12, 0x0(%4)       \n\t" /* vf12 = lane mins */ \
+			"lqc2         vf13, 0x0(%5)       \n\t" /* vf13 = lane maxs */ \
+			"lqc2         vf1,  0x0(%0)       \n\t" /* vf1  = 4 positions */ \
+			"lqc2         vf2,  0x0(%1)       \n\t" /* vf2  = 4 velocities */ \
+			"vmulx.xyzw   vf2,  vf2,  vf10    \n\t" /* vel *= damping */ \
+			"vadd" #axis ".xyzw vf2, vf2, vf11 \n\t" /* vel += force */ \
+			"vmulay.xyzw  ACC,  vf2,  vf10    \n\t" /* ACC  = vel * dt */ \
+			"vmaddw.xyzw  vf1,  vf1,  vf0     \n\t" /* pos  = ACC + pos */ \
+			"vmini.xyzw   vf12, vf12, vf1     \n\t" \
+			"vmax.xyzw    vf13, vf13, vf1     \n\t" \
+			"sqc2         vf1,  0x0(%0)       \n\t" \
+			"sqc2         vf2,  0x0(%1)       \n\t" \
+			"sqc2         vf12, 0x0(%4)       \n\t" \
+			"sqc2         vf13, 0x0(%5)       \n\t" \
+			: : "r" ((pos) + i), "r" ((vel) + i), "r" (&(params)), "r" (&(forces)), \
+			    "r" (&(laneMin)), "r" (&(laneMax)) \
+			: "memory" \
+		); \
+	}
+
+#endif // PS2MATH_USE_SSE2
 
-// I use this as predicate for `quickSort()` in `sortActiveParticles`.
-// No idea why GCC doesn't allow it to be nested inside the function, but it doesn't!
-struct PrtQSortPredicate
+// Run the integration of one axis over `count` particles.
+static void integrateParticleBlock(const uint axis, float * pos, float * vel, const uint count,
+                                   const Vector & params, const Vector & forces,
+                                   Vector & laneMin, Vector & laneMax)
 {
-	Vector cameraPosition;
-	int operator() (const Particle & prtA, const Particle & prtB) const
+	switch (axis)
 	{
-		const float aDistSqr = distanceSqr(prtA.position, cameraPosition);
-		const float bDistSqr = distanceSqr(prtB.position, cameraPosition);
-		if (aDistSqr < bDistSqr) { return  1; }
-		if (aDistSqr > bDistSqr) { return -1; }
-		return 0;
-	}
-};
+	case 0 :
+		INTEGRATE_PARTICLE_AXIS(x, pos, vel, count, params, forces, laneMin, laneMax);
+		break;
+	case 1 :
+		INTEGRATE_PARTICLE_AXIS(y, pos, vel, count, params, forces, laneMin, laneMax);
+		break;
+	default :
+		INTEGRATE_PARTICLE_AXIS(z, pos, vel, count, params, forces, laneMin, laneMax);
+		break;
+	} // switch (axis)
+}
 
 // ========================================================
-// ParticleEmitter::sortActiveParticles():
+// ParticleEmitter::integrateParticles():
 // ========================================================
 
-void ParticleEmitter::sortActiveParticles(const Vector & eyePos)
+void ParticleEmitter::integrateParticles(const float deltaTimeSec)
 {
-#if 1
-
-	// My custom `quickSort` outperformed `qsort` in the tests
-	// I've ran. Will stick to it until proved otherwise.
-	//
-	PrtQSortPredicate pred;
-	pred.cameraPosition = eyePos;
-	quickSort(particles, activeParticleCount, pred);
+	// Bounds always contain the origin, since that's where new particles spawn.
+	const float halfSize = maxParticleSize * 0.5f;
+	bounds.mins = emitterOrigin;
+	bounds.maxs = emitterOrigin;
 
-#else
+	if (activeParticleCount == 0)
+	{
+		bounds.mins -= Vector(halfSize, halfSize, halfSize, 0.0f);
+		bounds.maxs += Vector(halfSize, halfSize, halfSize, 0.0f);
+		return;
+	}
 
-	// This is a hack to allow passing additional data to `qsort`.
-	// This static var is set before the call, just below.
-	static Vector cameraPosition;
+	// Park the padding slots of the last quadword at the origin, so
+	// they don't widen the bounds with stale positions of dead particles.
+	const uint count = roundUpToQuadword(activeParticleCount);
+	for (uint p = activeParticleCount; p < count; ++p)
+	{
+		particles.posX[p] = emitterOrigin.x;
+		particles.posY[p] = emitterOrigin.y;
+		particles.posZ[p] = emitterOrigin.z;
+		particles.velX[p] = 0.0f;
+		particles.velY[p] = 0.0f;
+		particles.velZ[p] = 0.0f;
+	}
 
-	// Nested sort predicate for `qsort`:
-	struct ParticleSortHelper
+	// Velocity update is folded into `vel = vel * damping + force`.
+	// Gravity is applied first, then the air resistance moves the
+	// velocity towards the wind velocity:
+	//
+	//   vel += gravity * dt
+	//   vel += (wind - vel) * dt  =>  vel * (1 - dt) + wind * dt
+	//
+	Vector params;
+	Vector forces;
+	if (simulateAirResistance)
 	{
-		static int sortByCameraDist(const void * a, const void * b)
-		{
-			const Particle * prtA = rcast<const Particle *>(a);
-			const Particle * prtB = rcast<const Particle *>(b);
+		const float damping = 1.0f - deltaTimeSec;
+		params = Vector(damping, deltaTimeSec, 0.0f, 0.0f);
+		forces = (gravityVec * (deltaTimeSec * damping)) + (windVelocityVec * deltaTimeSec);
+	}
+	else
+	{
+		params = Vector(1.0f, deltaTimeSec, 0.0f, 0.0f);
+		forces = gravityVec * deltaTimeSec;
+	}
 
-			const float aDistSqr = distanceSqr(prtA->position, cameraPosition);
-			const float bDistSqr = distanceSqr(prtB->position, cameraPosition);
+	// Per-lane min/max of each axis, seeded with the origin.
+	Vector minX(emitterOrigin.x, emitterOrigin.x, emitterOrigin.x, emitterOrigin.x);
+	Vector minY(emitterOrigin.y, emitterOrigin.y, emitterOrigin.y, emitterOrigin.y);
+	Vector minZ(emitterOrigin.z, emitterOrigin.z, emitterOrigin.z, emitterOrigin.z);
+	Vector maxX(minX), maxY(minY), maxZ(minZ);
+
+	// Padding slots past the last active particle are
+	// integrated too, but they are never read back.
+	// Runs in place: each stream is read and written once, in order,
+	// so staging it through the Scratch Pad would only trade the cache
+	// misses for DMA waits, with two transfers per block on each channel.
+	integrateParticleBlock(0, particles.posX, particles.velX, count, params, forces, minX, maxX);
+	integrateParticleBlock(1, particles.posY, particles.velY, count, params, forces, minY, maxY);
+	integrateParticleBlock(2, particles.posZ, particles.velZ, count, params, forces, minZ, maxZ);
+
+	// Reduce the lanes and grow by the sprite size:
+	bounds.mins.x = minOf4(minX) - halfSize;
+	bounds.mins.y = minOf4(minY) - halfSize;
+	bounds.mins.z = minOf4(minZ) - halfSize;
+	bounds.maxs.x = maxOf4(maxX) + halfSize;
+	bounds.maxs.y = maxOf4(maxY) + halfSize;
+	bounds.maxs.z = maxOf4(maxZ) + halfSize;
+}
 
-			if (aDistSqr < bDistSqr) { return  1; }
-			if (aDistSqr > bDistSqr) { return -1; }
-			return 0;
-		}
-	};
+#undef INTEGRATE_PARTICLE_AXIS
 
-	cameraPosition = eyePos;
-	qsort(particles, activeParticleCount, sizeof(Particle), &ParticleSortHelper::sortByCameraDist);
+// ========================================================
+// ParticleEmitter::submitParticles():
+// ========================================================
+
+void ParticleEmitter::submitParticles() const
+{
+	if (!hasParticlesToDraw())
+	{
+		return;
+	}
 
-#endif
+	gParticleManager.submit(poolOffset, activeParticleCount, spriteTexture);
 }
 
 // ========================================================
@@ -382,7 +617,7 @@ void ParticleEmitter::sortActiveParticles(const Vector & eyePos)
 
 bool ParticleEmitter::hasParticlesToDraw() const
 {
-	return particles != nullptr && activeParticleCount != 0;
+	return particles.posX != nullptr && activeParticleCount != 0;
 }
 
 // ========================================================
@@ -391,7 +626,83 @@ bool ParticleEmitter::hasParticlesToDraw() const
 
 bool ParticleEmitter::isVisible(const Frustum & frustum) const
 {
-	return frustum.testPoint(emitterOrigin);
+	// Particles drift away from the origin, so test
+	// the running bounds of all the particles alive.
+	return frustum.testAabb(bounds);
+}
+
+// ========================================================
+// ParticleEmitter::updateLod():
+// ========================================================
+
+void ParticleEmitter::updateLod(const Vector & eyePos)
+{
+	// Distance from the eye to the nearest point of the bounds, zero inside.
+	// Long trails of particles stay at full detail while any part is near.
+	const Vector nearest = min3PerElement(max3PerElement(eyePos, bounds.mins), bounds.maxs);
+	const float  dx = nearest.x - eyePos.x;
+	const float  dy = nearest.y - eyePos.y;
+	const float  dz = nearest.z - eyePos.z;
+	lodDistanceSqr  = (dx * dx) + (dy * dy) + (dz * dz);
+
+	if (lodDistanceSqr <= (PRT_LOD_NEAR_DIST * PRT_LOD_NEAR_DIST))
+	{
+		lodScale = 1.0f;
+	}
+	else if (lodDistanceSqr >= (PRT_LOD_FAR_DIST * PRT_LOD_FAR_DIST))
+	{
+		lodScale = PRT_LOD_MIN_SCALE;
+	}
+	else
+	{
+		const float t = (ps2math::sqrt(lodDistanceSqr) - PRT_LOD_NEAR_DIST) / (PRT_LOD_FAR_DIST - PRT_LOD_NEAR_DIST);
+		lodScale = lerp(1.0f, PRT_LOD_MIN_SCALE, t);
+	}
+
+	if (lodScale >= PRT_LOD_HALF_RATE_SCALE)
+	{
+		simInterval = 1;
+	}
+	else if (lodScale >= PRT_LOD_QUARTER_RATE_SCALE)
+	{
+		simInterval = 2;
+	}
+	else
+	{
+		simInterval = 4;
+	}
+}
+
+// ========================================================
+// ParticleEmitter::getDesiredParticleCount():
+// ========================================================
+
+uint ParticleEmitter::getDesiredParticleCount() const
+{
+	const uint desired = scast<uint>(maxParticles * lodScale);
+	return (desired != 0) ? desired : 1;
+}
+
+// ========================================================
+// ParticleEmitter::setEmitterOrigin():
+// ========================================================
+
+void ParticleEmitter::setEmitterOrigin(const Vector & origin)
+{
+	emitterOrigin = origin;
+
+	// Keep the bounds conservative if the emitter moves between updates.
+	// With no particles alive, the bounds just follow the origin.
+	if (activeParticleCount == 0)
+	{
+		bounds.mins = origin;
+		bounds.maxs = origin;
+	}
+	else
+	{
+		bounds.mins = min3PerElement(bounds.mins, origin);
+		bounds.maxs = max3PerElement(bounds.maxs, origin);
+	}
 }
 
 // ========================================================
@@ -404,6 +715,8 @@ void ParticleEmitter::resetEmitter()
 	particlesEmitted    = 0;
 	lastUpdateMs        = 0;
 	enabled             = true;
+	bounds.mins         = emitterOrigin;
+	bounds.maxs         = emitterOrigin;
 }
 
 // ========================================================
@@ -415,10 +728,21 @@ void ParticleEmitter::setMinMaxParticles(uint min, uint max)
 	ps2assert(max != 0);
 	ps2assert(min <= max);
 
-	if (max > MAX_PARTICLES_PER_EMITTER)
+	// One emitter can take up to the whole pool.
+	const uint poolCapacity = gParticleManager.getPoolCapacity();
+	if (max > poolCapacity)
+	{
+		logWarning("Max amount of particles per emitter is the pool size, %u!", poolCapacity);
+		max = poolCapacity;
+		min = (min < max) ? min : max;
+	}
+
+	// Can't grow past the pool range already allocated.
+	if (particles.posX != nullptr && max > particleCapacity)
 	{
-		logWarning("Max amount of particles per emitter is %u!", MAX_PARTICLES_PER_EMITTER);
-		max = MAX_PARTICLES_PER_EMITTER;
+		logWarning("Emitter already allocated for %u particles!", particleCapacity);
+		max = particleCapacity;
+		min = (min < max) ? min : max;
 	}
 
 	minParticles = min;
@@ -453,3 +777,536 @@ Vector ParticleEmitter::getRandVector()
 	// Compute matching X and Y for Z:
 	return Vector(ps2math::cos(t) * r, ps2math::sin(t) * r, z, 1.0f);
 }
+
+// ================================================================================================
+// ParticleManager implementation:
+// ================================================================================================
+
+// ========================================================
+// ParticleManager::ParticleManager():
+// ========================================================
+
+ParticleManager::ParticleManager()
+	: poolMemory(nullptr)
+	, poolCapacity(DEFAULT_POOL_CAPACITY)
+	, freeListHead(PRT_FREE_LIST_END)
+	, rangesAllocated(0)
+	, batches(nullptr)
+	, batchCount(0)
+	, textureGroupCount(0)
+	, emitterQueue(nullptr)
+	, emitterQueueCount(0)
+	, queueCapacity(0)
+	, particleBudget(DEFAULT_PARTICLE_BUDGET)
+	, particlesRequested(0)
+	, particlesGranted(0)
+	, additiveBlending(false)
+{
+	memset(&pool, 0, sizeof(pool));
+}
+
+// ========================================================
+// ParticleManager::~ParticleManager():
+// ========================================================
+
+ParticleManager::~ParticleManager()
+{
+	memFree(MEM_TAG_PARTICLES, poolMemory);
+	memFree(MEM_TAG_PARTICLES, batches);
+	memFree(MEM_TAG_PARTICLES, emitterQueue);
+}
+
+// ========================================================
+// ParticleManager::initPool():
+// ========================================================
+
+void ParticleManager::initPool()
+{
+	ps2assert(poolMemory == nullptr);
+
+	// One block for all the streams. Cleared so that the padding
+	// slots processed by the 4-wide update hold valid floats.
+	float * mem = memClearedAlloc<float>(MEM_TAG_PARTICLES, poolCapacity * PARTICLE_STREAM_COUNT);
+
+	poolMemory    = mem;
+	pool.posX     = mem; mem += poolCapacity;
+	pool.posY     = mem; mem += poolCapacity;
+	pool.posZ     = mem; mem += poolCapacity;
+	pool.velX     = mem; mem += poolCapacity;
+	pool.velY     = mem; mem += poolCapacity;
+	pool.velZ     = mem; mem += poolCapacity;
+	pool.size     = mem; mem += poolCapacity;
+	pool.expiryMs = rcast<uint *>(mem); mem += poolCapacity;
+	pool.color    = rcast<uint32 *>(mem);
+
+	// All free, as a single range:
+	pool.expiryMs[0] = poolCapacity;
+	pool.expiryMs[1] = PRT_FREE_LIST_END;
+	freeListHead     = 0;
+
+	logComment("Initialized particle pool with %u particles.", poolCapacity);
+}
+
+// ========================================================
+// ParticleManager::reservePool():
+// ========================================================
+
+void ParticleManager::reservePool(const uint capacity)
+{
+	ps2assert(rangesAllocated == 0 && "Particle ranges still allocated!");
+	ps2assert(capacity != 0 && capacity <= MAX_POOL_CAPACITY);
+
+	const uint rounded = roundUpToQuadword(capacity);
+	if (rounded == poolCapacity)
+	{
+		return;
+	}
+
+	memFree(MEM_TAG_PARTICLES, poolMemory);
+	memset(&pool, 0, sizeof(pool));
+	poolMemory   = nullptr;
+	poolCapacity = rounded;
+	freeListHead = PRT_FREE_LIST_END;
+}
+
+// ========================================================
+// ParticleManager::linkFreeRange():
+// ========================================================
+
+void ParticleManager::linkFreeRange(const uint prevOffset, const uint offset)
+{
+	if (prevOffset == PRT_FREE_LIST_END)
+	{
+		freeListHead = offset;
+	}
+	else
+	{
+		pool.expiryMs[prevOffset + 1] = offset;
+	}
+}
+
+// ========================================================
+// ParticleManager::growQueues():
+// ========================================================
+
+void ParticleManager::growQueues(const uint minCapacity)
+{
+	// Doubling, so a level loading its emitters reallocates a few times only.
+	uint capacity = (queueCapacity != 0) ? (queueCapacity * 2) : 32;
+	while (capacity < minCapacity)
+	{
+		capacity *= 2;
+	}
+
+	batches       = memRealloc<Batch>(MEM_TAG_PARTICLES, batches, capacity);
+	emitterQueue  = memRealloc<ParticleEmitter *>(MEM_TAG_PARTICLES, emitterQueue, capacity);
+	queueCapacity = capacity;
+}
+
+// ========================================================
+// ParticleManager::allocRange():
+// ========================================================
+
+uint ParticleManager::allocRange(const uint count, uint & offset)
+{
+	if (poolMemory == nullptr)
+	{
+		initPool();
+	}
+
+	// Ranges start at a quadword boundary and are padded,
+	// so each emitter can run the 4-wide update on its own.
+	const uint rounded = roundUpToQuadword(count);
+
+	// First fit, remembering the largest range in case none fits.
+	uint prev = PRT_FREE_LIST_END;
+	uint curr = freeListHead;
+	uint largestPrev = PRT_FREE_LIST_END;
+	uint largest     = PRT_FREE_LIST_END;
+	while (curr != PRT_FREE_LIST_END && pool.expiryMs[curr] < rounded)
+	{
+		if (largest == PRT_FREE_LIST_END || pool.expiryMs[curr] > pool.expiryMs[largest])
+		{
+			largestPrev = prev;
+			largest     = curr;
+		}
+		prev = curr;
+		curr = pool.expiryMs[curr + 1];
+	}
+
+	if (curr == PRT_FREE_LIST_END)
+	{
+		logError("Particle pool out of space for %u particles! Largest free range is %u of %u.",
+		         rounded, (largest != PRT_FREE_LIST_END) ? pool.expiryMs[largest] : 0, poolCapacity);
+		if (largest == PRT_FREE_LIST_END)
+		{
+			offset = 0;
+			return 0;
+		}
+		prev = largestPrev;
+		curr = largest;
+	}
+
+	// Take the front of the range, the rest stays in the list.
+	const uint rangeCount = pool.expiryMs[curr];
+	const uint granted    = (rangeCount < rounded) ? rangeCount : rounded;
+	uint next = pool.expiryMs[curr + 1];
+	if (rangeCount > granted)
+	{
+		const uint rest = curr + granted;
+		pool.expiryMs[rest]     = rangeCount - granted;
+		pool.expiryMs[rest + 1] = next;
+		next = rest;
+	}
+	linkFreeRange(prev, next);
+
+	// The list links would read as live particles.
+	pool.expiryMs[curr]     = 0;
+	pool.expiryMs[curr + 1] = 0;
+
+	offset = curr;
+	++rangesAllocated;
+
+	// Room to queue and submit every emitter owning a range:
+	if (rangesAllocated > queueCapacity)
+	{
+		growQueues(rangesAllocated);
+	}
+	return granted;
+}
+
+// ========================================================
+// ParticleManager::freeRange():
+// ========================================================
+
+void ParticleManager::freeRange(const uint offset, const uint count)
+{
+	if (count == 0)
+	{
+		return; // allocRange() had nothing to give.
+	}
+
+	ps2assert(rangesAllocated != 0);
+	ps2assert((offset + count) <= poolCapacity);
+	ps2assert((offset & 3) == 0 && (count & 3) == 0);
+
+	// Find the free neighbors of the range:
+	uint prev = PRT_FREE_LIST_END;
+	uint next = freeListHead;
+	while (next != PRT_FREE_LIST_END && next < offset)
+	{
+		prev = next;
+		next = pool.expiryMs[next + 1];
+	}
+	ps2assert(next != offset && "Particle range freed twice!");
+
+	// Merge with the range after it:
+	uint rangeCount = count;
+	if (next != PRT_FREE_LIST_END && (offset + count) == next)
+	{
+		rangeCount += pool.expiryMs[next];
+		next = pool.expiryMs[next + 1];
+	}
+
+	// And with the one before it, or link in as a new range:
+	if (prev != PRT_FREE_LIST_END && (prev + pool.expiryMs[prev]) == offset)
+	{
+		pool.expiryMs[prev]     += rangeCount;
+		pool.expiryMs[prev + 1]  = next;
+	}
+	else
+	{
+		pool.expiryMs[offset]     = rangeCount;
+		pool.expiryMs[offset + 1] = next;
+		linkFreeRange(prev, offset);
+	}
+
+	--rangesAllocated;
+}
+
+// ========================================================
+// ParticleManager::getRangeArrays():
+// ========================================================
+
+void ParticleManager::getRangeArrays(const uint offset, ParticleArrays & arrays) const
+{
+	ps2assert(poolMemory != nullptr);
+	ps2assert(offset <= poolCapacity);
+
+	arrays.posX     = pool.posX     + offset;
+	arrays.posY     = pool.posY     + offset;
+	arrays.posZ     = pool.posZ     + offset;
+	arrays.velX     = pool.velX     + offset;
+	arrays.velY     = pool.velY     + offset;
+	arrays.velZ     = pool.velZ     + offset;
+	arrays.size     = pool.size     + offset;
+	arrays.expiryMs = pool.expiryMs + offset;
+	arrays.color    = pool.color    + offset;
+}
+
+// ========================================================
+// ParticleManager::submit():
+// ========================================================
+
+void ParticleManager::submit(const uint offset, const uint count, const Texture * texture)
+{
+	// Find the texture group or start a new one.
+	// Few distinct textures per frame, so a linear search is fine.
+	uint group = 0;
+	while (group < textureGroupCount && textureGroups[group] != texture)
+	{
+		++group;
+	}
+	if (group == textureGroupCount)
+	{
+		if (textureGroupCount == MAX_TEXTURE_GROUPS)
+		{
+			logWarning("Too many particle textures in a frame! Max is %u.", MAX_TEXTURE_GROUPS);
+			return;
+		}
+		textureGroups[textureGroupCount++] = texture;
+	}
+
+	// Only if submitting more than once per range.
+	if (batchCount == queueCapacity)
+	{
+		growQueues(batchCount + 1);
+	}
+
+	Batch & batch = batches[batchCount++];
+	batch.offset  = offset;
+	batch.count   = count;
+	batch.group   = group;
+}
+
+// ========================================================
+// ParticleManager::queueEmitter():
+// ========================================================
+
+void ParticleManager::queueEmitter(ParticleEmitter * emitter)
+{
+	ps2assert(emitter != nullptr);
+
+	// Only if queueing emitters that got no range.
+	if (emitterQueueCount == queueCapacity)
+	{
+		growQueues(emitterQueueCount + 1);
+	}
+
+	emitterQueue[emitterQueueCount++] = emitter;
+}
+
+// ========================================================
+// ParticleManager::updateEmitters():
+// ========================================================
+
+void ParticleManager::updateEmitters(const Vector & eyePos)
+{
+	for (uint e = 0; e < emitterQueueCount; ++e)
+	{
+		emitterQueue[e]->updateLod(eyePos);
+	}
+
+	// Order by priority, nearest first for the same priority.
+	// Only a handful of emitters, so an insertion sort will do.
+	for (uint i = 1; i < emitterQueueCount; ++i)
+	{
+		ParticleEmitter * emitter = emitterQueue[i];
+		uint j = i;
+		while (j > 0)
+		{
+			const ParticleEmitter * prev = emitterQueue[j - 1];
+			const bool before = (emitter->getPriority() > prev->getPriority()) ||
+			                    (emitter->getPriority() == prev->getPriority() &&
+			                     emitter->getLodDistanceSqr() < prev->getLodDistanceSqr());
+			if (!before)
+			{
+				break;
+			}
+			emitterQueue[j] = emitterQueue[j - 1];
+			--j;
+		}
+		emitterQueue[j] = emitter;
+	}
+
+	// Hand out the budget in that order. Emitters past the budget
+	// drop the particles over their allowance in `updateParticles()`.
+	uint remaining     = particleBudget;
+	particlesRequested = 0;
+	particlesGranted   = 0;
+
+	for (uint e = 0; e < emitterQueueCount; ++e)
+	{
+		ParticleEmitter * emitter = emitterQueue[e];
+		const uint desired = emitter->getDesiredParticleCount();
+		const uint granted = (desired < remaining) ? desired : remaining;
+
+		emitter->setParticleAllowance(granted);
+		remaining          -= granted;
+		particlesRequested += desired;
+		particlesGranted   += granted;
+	}
+
+	for (uint e = 0; e < emitterQueueCount; ++e)
+	{
+		emitterQueue[e]->updateParticles();
+		emitterQueue[e]->submitParticles();
+	}
+
+	emitterQueueCount = 0;
+}
+
+// ========================================================
+// Particle sort keys:
+// ========================================================
+
+// Texture group in the top bits of the sort key, so the sort groups by
+// texture first, then back-to-front inside each group. The distance
+// gets the remaining bits, dropping the lowest bits of the mantissa.
+static const uint PRT_KEY_GROUP_SHIFT = 26;
+
+static inline uint32 makeParticleSortKey(const uint group, const float distSqr)
+{
+	ps2assert(group < (1u << (32 - PRT_KEY_GROUP_SHIFT)));
+	return (group << PRT_KEY_GROUP_SHIFT) | (radixKeyFromFloatDescending(distSqr) >> (32 - PRT_KEY_GROUP_SHIFT));
+}
+
+// ========================================================
+// ParticleManager::drawAllParticles():
+// ========================================================
+
+void ParticleManager::drawAllParticles(const Vector & eyePos)
+{
+	if (batchCount == 0)
+	{
+		return;
+	}
+
+	uint totalParticles = 0;
+	for (uint b = 0; b < batchCount; ++b)
+	{
+		totalParticles += batches[b].count;
+	}
+
+	// Sort keys and draw order, plus their radix sort scratch, sized for
+	// this frame's submissions. Up to ~1300 particles sort in the Scratch
+	// Pad, larger counts fall back to memory from the frame allocator.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	uint32 * sortKeys  = sprOrFrameAlloc<uint32>(totalParticles * 2);
+	uint16 * drawOrder = sprOrFrameAlloc<uint16>(totalParticles * 2);
+
+	if (sortKeys == nullptr || drawOrder == nullptr)
+	{
+		gFrameAllocator.rewind(frameMark);
+		batchCount        = 0;
+		textureGroupCount = 0;
+		return;
+	}
+
+	uint32 * sortKeysScratch  = sortKeys  + totalParticles;
+	uint16 * drawOrderScratch = drawOrder + totalParticles;
+
+	uint groupStart[MAX_TEXTURE_GROUPS + 1];
+	uint particleCount = 0;
+
+	if (additiveBlending)
+	{
+		// Additive blending is order independent, so no sorting.
+		// Just lay the indexes out grouped by texture.
+		for (uint g = 0; g < textureGroupCount; ++g)
+		{
+			groupStart[g] = particleCount;
+			for (uint b = 0; b < batchCount; ++b)
+			{
+				if (batches[b].group != g)
+				{
+					continue;
+				}
+				const uint end = batches[b].offset + batches[b].count;
+				for (uint p = batches[b].offset; p < end; ++p)
+				{
+					drawOrder[particleCount++] = scast<uint16>(p);
+				}
+			}
+		}
+	}
+	else
+	{
+		// Single sort for all particles of the frame. Each texture group
+		// is sorted back-to-front. Particles are rendered with depth-writing
+		// disabled, so this is necessary for proper transparency rendering.
+		for (uint b = 0; b < batchCount; ++b)
+		{
+			const uint end = batches[b].offset + batches[b].count;
+			for (uint p = batches[b].offset; p < end; ++p)
+			{
+				const float dx = pool.posX[p] - eyePos.x;
+				const float dy = pool.posY[p] - eyePos.y;
+				const float dz = pool.posZ[p] - eyePos.z;
+
+				sortKeys[particleCount]  = makeParticleSortKey(batches[b].group, (dx * dx) + (dy * dy) + (dz * dz));
+				drawOrder[particleCount] = scast<uint16>(p);
+				++particleCount;
+			}
+		}
+
+		// Radix sort the keys, carrying the pool indexes along:
+		radixSort32(sortKeys, drawOrder, sortKeysScratch, drawOrderScratch, particleCount);
+
+		uint g = 0;
+		for (uint i = 0; i < particleCount; ++i)
+		{
+			const uint group = sortKeys[i] >> PRT_KEY_GROUP_SHIFT;
+			while (g <= group)
+			{
+				groupStart[g++] = i;
+			}
+		}
+		while (g < textureGroupCount)
+		{
+			groupStart[g++] = particleCount;
+		}
+	}
+	groupStart[textureGroupCount] = particleCount;
+
+	if (additiveBlending)
+	{
+		gRenderer.setPrimAdditiveBlending(true);
+	}
+
+	// One texture bind and one draw per texture group:
+	for (uint g = 0; g < textureGroupCount; ++g)
+	{
+		const uint count = groupStart[g + 1] - groupStart[g];
+		if (count == 0)
+		{
+			continue;
+		}
+
+		if (textureGroups[g] != nullptr)
+		{
+			gRenderer.setTexture(*textureGroups[g]);
+		}
+
+		// Particles don't need to be back-face culled, since they
+		// are rendered as camera-facing sprites.
+		gRenderer.drawSpritesFacingCamera(pool.posX, pool.posY, pool.posZ, pool.size,
+			pool.color, drawOrder + groupStart[g], count, makeColor4f(1.0f, 1.0f, 1.0f));
+	}
+
+	if (additiveBlending)
+	{
+		gRenderer.setPrimAdditiveBlending(false);
+	}
+
+	gFrameAllocator.rewind(frameMark);
+	batchCount        = 0;
+	textureGroupCount = 0;
+}
+
+// ========================================================
+// ParticleManager global instance:
+// ========================================================
+
+ParticleManager gParticleManager;
@@ -37,15 +37,23 @@
 class Frustum;
 
 // ========================================================
-// struct Particle:
+// struct ParticleArrays:
 // ========================================================
 
-struct Particle
+// Particles are stored as a structure-of-arrays, one stream per component,
+// so that the update can process four of them at a time with VU0.
+// All streams are 16 bytes aligned and padded to a multiple of 4 particles.
+struct ParticleArrays
 {
-	Vector position;   // Current world position of this particle.
-	Vector velocity;   // Current velocity of this particle.
-	float  size;       // Size/scale of this particle.
-	uint   durationMs; // Time this particle will go inactive, in milliseconds.
+	float  * posX;     // Current world position of each particle.
+	float  * posY;
+	float  * posZ;
+	float  * velX;     // Current velocity of each particle.
+	float  * velY;
+	float  * velZ;
+	float  * size;     // Size/scale of each particle.
+	uint   * expiryMs; // Time each particle will go inactive, in milliseconds.
+	uint32 * color;    // GS RGBA of each particle (RGB 128 = 1.0).
 };
 
 // ========================================================
@@ -69,10 +77,12 @@ public:
 
 	// Update the particle emitter and particles alive.
 	// Should be called every frame for particles in the view.
+	// Emitters out of view are not updated and their particles
+	// freeze; they catch up with the elapsed time once back in view.
 	void updateParticles();
 
-	// Effectively renders all batched particles. Depth writing should be already disabled.
-	void drawParticles(const Matrix & viewMatrix, const Vector & eyePos);
+	// Queue the active particles for `ParticleManager::drawAllParticles()`.
+	void submitParticles() const;
 
 	// Check if there are pending particles to be rendered.
 	bool hasParticlesToDraw() const;
@@ -80,6 +90,30 @@ public:
 	// Approximate test for the emitter bounds against a frustum.
 	bool isVisible(const Frustum & frustum) const;
 
+	// Conservative bounds of the emitter origin and all its particles,
+	// refreshed every time the particles are integrated.
+	const Aabb & getBounds() const { return bounds; }
+
+	// Update the emission and simulation rates from the distance to the eye.
+	// Called by the ParticleManager before the particle budget is distributed.
+	void updateLod(const Vector & eyePos);
+
+	// Number of particles this emitter would like to have alive, given its LOD.
+	uint getDesiredParticleCount() const;
+
+	// Emission scale [0,1] and squared distance from the eye to the bounds from the last `updateLod()`.
+	float getLodScale() const { return lodScale; }
+	float getLodDistanceSqr() const { return lodDistanceSqr; }
+
+	// Max particles alive granted by the ParticleManager budget for this frame.
+	// Particles over it are dropped by the next `updateParticles()`.
+	void setParticleAllowance(const uint allowance) { particleAllowance = allowance; }
+	uint getParticleAllowance() const { return particleAllowance; }
+
+	// Emitters with higher priority get their share of the budget first. Default = 0.
+	void setPriority(const uint prio) { priority = prio; }
+	uint getPriority() const { return priority; }
+
 	// Reset the particle emitter to its initial state.
 	void resetEmitter();
 
@@ -116,7 +150,7 @@ public:
 	const Vector & getParticleVelocity() const { return particleVelocityVec; }
 
 	// Get/set particle emitter origin (in world coordinates):
-	void setEmitterOrigin(const Vector & origin) { emitterOrigin = origin; }
+	void setEmitterOrigin(const Vector & origin);
 	const Vector & getEmitterOrigin() const { return emitterOrigin; }
 
 	// Get/set gravity force applied to particles:
@@ -156,30 +190,28 @@ private:
 	ParticleEmitter(const ParticleEmitter &);
 	ParticleEmitter & operator = (const ParticleEmitter &);
 
-	// Sort particle based on distance from viewer. Called pre rendering.
-	void sortActiveParticles(const Vector & eyePos);
+	// Remove expired particles and integrate the ones still alive.
+	void killExpiredParticles(uint currentTimeMs);
+	void integrateParticles(float deltaTimeSec);
+
+	// Copy particle `src` over `dest` in all the streams.
+	void moveParticle(uint dest, uint src);
 
 	// Generates a random vector where X, Y, and Z components are between -1 and 1.
 	static Vector getRandVector();
 
 private:
 
-	// Shared state for all emitters:
-	static uint16     * particleIndexBuffer;  // Two triangles per particle quadrilateral
-	static DrawVertex * particleVertexBuffer; // Four vertexes per particle quadrilateral
-
-	// Array of particles. Size equal to `maxParticles`.
+	// Particle streams. Views into this emitter's range of the ParticleManager pool.
+	// Size equal to `maxParticles` rounded up to 4 (`particleCapacity`).
 	// Active particles are always at the front, from index 0 to `activeParticleCount-1`
-	Particle * particles;
+	ParticleArrays particles;
+	uint poolOffset;
+	uint particleCapacity;
 
 	// Reference to an external texture. Not owned by ParticleEmitter.
 	const Texture * spriteTexture;
 
-	// To avoid accessing the globals, keep a local copy
-	// of each pointer in the hopes of better data locality.
-	uint16     * ibPtr;
-	DrawVertex * vbPtr;
-
 	// Maximum number of active particles at any given time.
 	uint maxParticles;
 
@@ -195,6 +227,18 @@ private:
 	// Number of particles emitted since creation or reset.
 	uint particlesEmitted;
 
+	// Share of the ParticleManager budget and priority to get it.
+	uint particleAllowance;
+	uint priority;
+
+	// Distance LOD. Emission is scaled by `lodScale` and the particles are
+	// integrated every `simInterval` frames, with the time since `lastSimTimeMs`.
+	float lodScale;
+	float lodDistanceSqr;
+	uint  lastSimTimeMs;
+	uint  simInterval;
+	uint  simFrameCounter;
+
 	// Amount of time each particle lives, in milliseconds:
 	uint particleLifeCycleMs;
 
@@ -210,6 +254,9 @@ private:
 	// Emitter origin (point) in world space:
 	Vector emitterOrigin;
 
+	// Bounds of the origin plus the particles, used for culling.
+	Aabb bounds;
+
 	// Particle velocity, gravity and wind vectors:
 	Vector gravityVec;
 	Vector particleVelocityVec;
@@ -237,6 +284,131 @@ private:
 	bool oneTimeEmission;
 };
 
+// ========================================================
+// class ParticleManager:
+// ========================================================
+
+//
+// Owns the storage of all particles and draws them.
+// Emitters spawn and simulate particles inside a range of the
+// shared pool and submit them every frame. All submitted particles
+// are then sorted once and drawn with one draw call per sprite texture.
+//
+class ParticleManager
+{
+public:
+
+	// Particles shared by all the emitters, unless `reservePool()` is called.
+	// The draw order is sorted as 16-bit pool indexes, hence the max.
+	static const uint DEFAULT_POOL_CAPACITY = 8192;
+	static const uint MAX_POOL_CAPACITY     = 65536;
+
+	// Distinct sprite textures per frame. The texture
+	// group goes in the top 6 bits of the sort keys.
+	static const uint MAX_TEXTURE_GROUPS = 64;
+
+	// Default max particles alive in all emitters updated in a frame.
+	static const uint DEFAULT_PARTICLE_BUDGET = 3072;
+
+	 ParticleManager();
+	~ParticleManager();
+
+	// Sets the size of the pool, in particles (rounded up to 4). Only allowed
+	// while no ranges are allocated, e.g. when loading a level. The pool itself
+	// is allocated by the first `allocRange()`.
+	void reservePool(uint capacity);
+	uint getPoolCapacity() const { return poolCapacity; }
+
+	// Reserve a range of `count` particles (rounded up to 4) for an emitter.
+	// Freed ranges are reused (address-ordered first fit) and merged with their
+	// free neighbors. If no free range is big enough, an error is logged and the
+	// largest one is returned instead, so the count reserved can be less than
+	// requested, or even zero.
+	uint allocRange(uint count, uint & offset);
+	void freeRange(uint offset, uint count);
+
+	// Get the streams of a range given by `allocRange()`.
+	void getRangeArrays(uint offset, ParticleArrays & arrays) const;
+
+	// Queue particles from the pool for drawing this frame.
+	void submit(uint offset, uint count, const Texture * texture);
+
+	// Queue a visible emitter for `updateEmitters()` this frame.
+	void queueEmitter(ParticleEmitter * emitter);
+
+	// Updates the LOD of the queued emitters, splits the particle budget between
+	// them by priority (nearest first on ties), then updates and submits each.
+	void updateEmitters(const Vector & eyePos);
+
+	// Global budget of particles alive, shared by the emitters updated each frame.
+	void setParticleBudget(const uint budget) { particleBudget = budget; }
+	uint getParticleBudget() const { return particleBudget; }
+
+	// Budget stats from the last `updateEmitters()`. Requested above
+	// granted means the budget is under pressure and emission was cut.
+	uint getParticlesRequested() const { return particlesRequested; }
+	uint getParticlesGranted()   const { return particlesGranted;   }
+
+	// Renders all the particles submitted since the last call and clears the
+	// submissions. Depth writing should be already disabled. Each texture group
+	// is sorted back-to-front from `eyePos`, unless additive blending is on.
+	void drawAllParticles(const Vector & eyePos);
+
+	// Additive blending is order independent, so particles are not sorted.
+	// Off by default (normal alpha blending, sorted).
+	void setAdditiveBlending(const bool additive) { additiveBlending = additive; }
+	bool isAdditiveBlending() const { return additiveBlending; }
+
+private:
+
+	// Copy/assign disallowed.
+	ParticleManager(const ParticleManager &);
+	ParticleManager & operator = (const ParticleManager &);
+
+	void initPool();
+	void linkFreeRange(uint prevOffset, uint offset);
+	void growQueues(uint minCapacity);
+
+	// A range of particles submitted by an emitter.
+	struct Batch
+	{
+		uint offset;
+		uint count;
+		uint group; // Index into `textureGroups`
+	};
+
+	// All the particles. `poolMemory` is the single allocation backing all
+	// streams. The free ranges form a list sorted by offset, kept inside the
+	// free particles themselves: `expiryMs[offset]` is the size of the range
+	// and `expiryMs[offset + 1]` the offset of the next one.
+	ParticleArrays pool;
+	void * poolMemory;
+	uint   poolCapacity;
+	uint   freeListHead;
+	uint   rangesAllocated;
+
+	// Submissions for the current frame and their distinct textures:
+	Batch *         batches;
+	const Texture * textureGroups[MAX_TEXTURE_GROUPS];
+	uint            batchCount;
+	uint            textureGroupCount;
+
+	// Emitters to update this frame and the budget split between them.
+	// Every emitter that draws owns a range and submits it once a frame,
+	// so the queue and the batches grow with the ranges allocated.
+	ParticleEmitter ** emitterQueue;
+	uint emitterQueueCount;
+	uint queueCapacity;
+	uint particleBudget;
+	uint particlesRequested;
+	uint particlesGranted;
+
+	bool additiveBlending;
+};
+
+// Global particle manager instance:
+extern ParticleManager gParticleManager;
+
 // ========================================================
 // struct Billboard:
 // ========================================================
@@ -0,0 +1,389 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: profile.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Hierarchical CPU profiler with scoped markers, frame history and trace export.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#include "profile.hpp"
+
+#if !defined(_EE)
+	#include <time.h>
+#endif // _EE
+
+// ========================================================
+// Profiler state:
+// ========================================================
+
+#if defined(_EE)
+static const uint32 PROFILE_TICKS_PER_SECOND = 294912000; // EE CPU clock.
+#else // !_EE
+static const uint32 PROFILE_TICKS_PER_SECOND = 1000000000;
+#endif // _EE
+
+// About 128KB.
+static ProfileFrame profFrames[PROFILE_HISTORY];
+
+static uint   profFrameIndex;     // Frame being recorded.
+static uint   profFramesRecorded; // Completed frames in the history.
+static bool   profFrameOpen;      // False until the first profileNewFrame().
+static uint32 profFrameStart;     // Raw timer at the start of the frame being recorded.
+static uint64 profTimeline;       // 64 bits time of `profFrameStart`.
+
+// Indexes of the open samples. Entries for dropped samples are PROFILE_MAX_SAMPLES.
+static uint16 profOpenSamples[PROFILE_MAX_DEPTH];
+static uint   profDepth; // Can go past PROFILE_MAX_DEPTH, those are just counted.
+
+// Colors of the bar graph, handed out to top-level marker names as they show up.
+static const uint PROFILE_GRAPH_COLORS = 8;
+static const char * profGraphNames[PROFILE_GRAPH_COLORS];
+static const Color4b profGraphColors[PROFILE_GRAPH_COLORS] =
+{
+	{ 230,  80,  60, 200 },
+	{  80, 200,  80, 200 },
+	{  70, 130, 230, 200 },
+	{ 230, 200,  60, 200 },
+	{ 190,  90, 220, 200 },
+	{  60, 200, 200, 200 },
+	{ 240, 140,  40, 200 },
+	{ 200, 200, 200, 200 }
+};
+
+// ========================================================
+// profileTicks():
+// ========================================================
+
+uint32 profileTicks()
+{
+#if defined(_EE)
+
+	uint32 count;
+	__asm__ __volatile__ ("mfc0 %0, $9" : "=r" (count));
+	return count;
+
+#else // !_EE
+
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return scast<uint32>(scast<uint64>(ts.tv_sec) * 1000000000u + ts.tv_nsec);
+
+#endif // _EE
+}
+
+// ========================================================
+// profileTicksPerSecond():
+// ========================================================
+
+uint32 profileTicksPerSecond()
+{
+	return PROFILE_TICKS_PER_SECOND;
+}
+
+// ========================================================
+// profileTicksToMs():
+// ========================================================
+
+float profileTicksToMs(const uint32 ticks)
+{
+	return scast<float>(ticks) * (1000.0f / scast<float>(PROFILE_TICKS_PER_SECOND));
+}
+
+// ========================================================
+// profileNewFrame():
+// ========================================================
+
+void profileNewFrame()
+{
+	const uint32 now = profileTicks();
+	if (profFrameOpen)
+	{
+		ProfileFrame & frame = profFrames[profFrameIndex];
+		frame.durationTicks = now - profFrameStart;
+
+		// Markers left open are closed with the frame.
+		for (uint d = 0; d < profDepth && d < PROFILE_MAX_DEPTH; ++d)
+		{
+			if (profOpenSamples[d] < PROFILE_MAX_SAMPLES)
+			{
+				frame.samples[profOpenSamples[d]].end = frame.durationTicks;
+			}
+		}
+
+		profTimeline  += frame.durationTicks;
+		profFrameIndex = (profFrameIndex + 1) % PROFILE_HISTORY;
+		if (profFramesRecorded < PROFILE_HISTORY - 1)
+		{
+			++profFramesRecorded;
+		}
+	}
+
+	ProfileFrame & frame = profFrames[profFrameIndex];
+	frame.startTicks     = profTimeline;
+	frame.durationTicks  = 0;
+	frame.sampleCount    = 0;
+	frame.droppedSamples = 0;
+
+	profFrameStart = now;
+	profFrameOpen  = true;
+	profDepth      = 0;
+}
+
+// ========================================================
+// profileBegin():
+// ========================================================
+
+void profileBegin(const char * name)
+{
+	if (!profFrameOpen)
+	{
+		return;
+	}
+
+	ProfileFrame & frame = profFrames[profFrameIndex];
+	uint16 sampleIndex = PROFILE_MAX_SAMPLES;
+
+	if (frame.sampleCount < PROFILE_MAX_SAMPLES && profDepth < PROFILE_MAX_DEPTH)
+	{
+		sampleIndex = scast<uint16>(frame.sampleCount++);
+		ProfileSample & sample = frame.samples[sampleIndex];
+		sample.name  = name;
+		sample.depth = profDepth;
+		sample.end   = 0;
+		sample.start = profileTicks() - profFrameStart; // Last, to leave the bookkeeping out.
+	}
+	else
+	{
+		++frame.droppedSamples;
+	}
+
+	if (profDepth < PROFILE_MAX_DEPTH)
+	{
+		profOpenSamples[profDepth] = sampleIndex;
+	}
+	++profDepth;
+}
+
+// ========================================================
+// profileEnd():
+// ========================================================
+
+void profileEnd()
+{
+	const uint32 now = profileTicks();
+	if (!profFrameOpen || profDepth == 0)
+	{
+		return;
+	}
+
+	--profDepth;
+	if (profDepth < PROFILE_MAX_DEPTH && profOpenSamples[profDepth] < PROFILE_MAX_SAMPLES)
+	{
+		profFrames[profFrameIndex].samples[profOpenSamples[profDepth]].end = now - profFrameStart;
+	}
+}
+
+// ========================================================
+// profileGetFrame():
+// ========================================================
+
+const ProfileFrame * profileGetFrame(const uint framesAgo)
+{
+	if (framesAgo >= profFramesRecorded)
+	{
+		return nullptr;
+	}
+	return &profFrames[(profFrameIndex + PROFILE_HISTORY - 1 - framesAgo) % PROFILE_HISTORY];
+}
+
+// ========================================================
+// profileDrawGraph():
+// ========================================================
+
+static Color4b profileGraphColor(const char * name)
+{
+	uint i;
+	for (i = 0; i < PROFILE_GRAPH_COLORS && profGraphNames[i] != nullptr; ++i)
+	{
+		if (profGraphNames[i] == name)
+		{
+			return profGraphColors[i];
+		}
+	}
+
+	// New name. Once all colors are taken, the last one is shared.
+	if (i == PROFILE_GRAPH_COLORS)
+	{
+		return profGraphColors[PROFILE_GRAPH_COLORS - 1];
+	}
+	profGraphNames[i] = name;
+	return profGraphColors[i];
+}
+
+void profileDrawGraph(const Rect4i & rect, uint frameCount, const float budgetMs)
+{
+	if (frameCount > profFramesRecorded)
+	{
+		frameCount = profFramesRecorded;
+	}
+	if (frameCount == 0 || budgetMs <= 0.0f)
+	{
+		return;
+	}
+
+	gRenderer.drawRectFilled(rect, makeColor4b(0, 0, 0, 100));
+
+	const float pixelsPerMs = rect.height / (budgetMs * 2.0f);
+	const int   barWidth    = (rect.width / scast<int>(frameCount) > 1) ? rect.width / scast<int>(frameCount) : 1;
+	const int   bottom      = rect.y + rect.height;
+
+	for (uint f = 0; f < frameCount; ++f)
+	{
+		// Oldest frame on the left.
+		const ProfileFrame * frame = profileGetFrame(frameCount - 1 - f);
+		const int x = rect.x + scast<int>(f) * barWidth;
+
+		int height = scast<int>(profileTicksToMs(frame->durationTicks) * pixelsPerMs);
+		if (height > rect.height) { height = rect.height; }
+		const Rect4i total = { x, bottom - height, barWidth - 1, height };
+		gRenderer.drawRectFilled(total, makeColor4b(90, 90, 90, 200));
+
+		// Top-level markers stacked from the bottom.
+		int y = bottom;
+		for (uint s = 0; s < frame->sampleCount; ++s)
+		{
+			const ProfileSample & sample = frame->samples[s];
+			if (sample.depth != 0)
+			{
+				continue;
+			}
+
+			int h = scast<int>(profileTicksToMs(sample.end - sample.start) * pixelsPerMs);
+			if (h > y - rect.y) { h = y - rect.y; }
+			if (h <= 0) { continue; }
+
+			y -= h;
+			const Rect4i bar = { x, y, barWidth - 1, h };
+			gRenderer.drawRectFilled(bar, profileGraphColor(sample.name));
+		}
+	}
+
+	// Frame budget line, at half the height.
+	const Rect4i budgetLine = { rect.x, bottom - scast<int>(budgetMs * pixelsPerMs), rect.width, 1 };
+	gRenderer.drawRectFilled(budgetLine, makeColor4b(255, 255, 255, 255));
+}
+
+// ========================================================
+// profileDrawFrameTimes():
+// ========================================================
+
+void profileDrawFrameTimes(Vec2f & pos, const BuiltInFontId fontId)
+{
+	const ProfileFrame * frame = profileGetFrame(0);
+	if (frame == nullptr)
+	{
+		return;
+	}
+
+	const Color4b white = { 255, 255, 255, 255 };
+
+	for (uint s = 0; s < frame->sampleCount; ++s)
+	{
+		const ProfileSample & sample = frame->samples[s];
+		const Color4b color = (sample.depth == 0) ? profileGraphColor(sample.name) : white;
+
+		// Indent by two spaces per nesting level.
+		gRenderer.drawText(pos, color, fontId, format("%*s%s: %.2f ms\n", scast<int>(sample.depth * 2), "",
+			sample.name, profileTicksToMs(sample.end - sample.start)));
+	}
+
+	uint64 totalTicks = 0;
+	uint32 maxTicks   = 0;
+	for (uint f = 0; f < profFramesRecorded; ++f)
+	{
+		const uint32 ticks = profileGetFrame(f)->durationTicks;
+		totalTicks += ticks;
+		if (ticks > maxTicks) { maxTicks = ticks; }
+	}
+
+	gRenderer.drawText(pos, white, fontId, format("Frame avg: %.2f ms, max: %.2f ms\n",
+		profileTicksToMs(scast<uint32>(totalTicks / profFramesRecorded)), profileTicksToMs(maxTicks)));
+
+	if (frame->droppedSamples != 0)
+	{
+		gRenderer.drawText(pos, makeColor4b(255, 80, 80), fontId,
+			format("Dropped samples: %u\n", frame->droppedSamples));
+	}
+}
+
+// ========================================================
+// profileExportChromeTrace():
+// ========================================================
+
+bool profileExportChromeTrace(const char * filename)
+{
+	ps2assert(filename != nullptr);
+
+	FILE * file = fopen(filename, "wt");
+	if (file == nullptr)
+	{
+		logError("Unable to open profiler trace file \"%s\"", filename);
+		return false;
+	}
+
+	// Microseconds, the unit of the trace format.
+	const double usPerTick = 1000000.0 / PROFILE_TICKS_PER_SECOND;
+
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"EE\"}}");
+
+	// Oldest first.
+	uint sampleCount = 0;
+	for (uint f = profFramesRecorded; f-- > 0;)
+	{
+		const ProfileFrame * frame = profileGetFrame(f);
+		const double frameStart = frame->startTicks * usPerTick;
+
+		fprintf(file, ",\n{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f,"
+		        "\"args\":{\"samples\":%u,\"dropped\":%u}}", frameStart, frame->durationTicks * usPerTick,
+		        frame->sampleCount, frame->droppedSamples);
+
+		for (uint s = 0; s < frame->sampleCount; ++s)
+		{
+			const ProfileSample & sample = frame->samples[s];
+			fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"dur\":%.3f}",
+			        sample.name, frameStart + sample.start * usPerTick, (sample.end - sample.start) * usPerTick);
+		}
+		sampleCount += frame->sampleCount;
+	}
+
+	fprintf(file, "\n]}\n");
+	fclose(file);
+
+	logComment("Wrote %u frames, %u samples to profiler trace \"%s\".", profFramesRecorded, sampleCount, filename);
+	return true;
+}
@@ -4,7 +4,7 @@
 // File: profile.hpp
 // Author: Guilherme R. Lampert
 // Created on: 10/04/15
-// Brief: Very simple macros to aid profiling and benchmarking the application.
+// Brief: Hierarchical CPU profiler with scoped markers, frame history and trace export.
 //
 // License:
 //  This source code is released under the MIT License.
@@ -36,70 +36,126 @@
 #include "common.hpp"
 #include "renderer.hpp"
 
+//
+// Scoped, nestable CPU markers timed with the EE COUNT register (CPU cycles),
+// or with a monotonic clock when built on the development machine.
+// Samples are kept for the last PROFILE_HISTORY frames in a ring buffer, which
+// can be drawn on screen as a bar graph or exported to a Chrome trace file
+// (open it in `chrome://tracing` or https://ui.perfetto.dev).
 //
 // Define `PROFILE_ENABLED` to non-zero before
 // including this file to enable the profiling
 // macros. If that is not defined, the macros
-// default to no-ops.
+// default to no-ops. The functions below are
+// always available.
 //
 #if PROFILE_ENABLED
 
 // ========================================================
 
-#define PROFILE_DECL(prof, printName) ProfileTimes prof = { 0,0,0, printName }
+#define PROFILE_CONCAT_(a, b) a ## b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
 
-#define PROFILE_BEGIN(prof) \
-do { \
-	(prof).start = clockMilliseconds(); \
-} while (0)
+// Times the enclosing scope. `name` must be a string literal, only the pointer is stored.
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profScope_, __LINE__)(name)
 
-#define PROFILE_END(prof) \
-do { \
-	(prof).end   = clockMilliseconds(); \
-	(prof).delta = (prof).end - (prof).start; \
-} while (0)
+// For blocks that don't match a scope. Every BEGIN must have an END in the same frame.
+#define PROFILE_BEGIN(name) profileBegin(name)
+#define PROFILE_END()       profileEnd()
 
-#define PROFILE_PRINT(pos, ...) profilePrintN((pos), __VA_ARGS__, nullptr)
+// Closes the current frame and opens the next. Once at the top of the main loop.
+#define PROFILE_NEW_FRAME() profileNewFrame()
 
 // ========================================================
 
-struct ProfileTimes
+#else // !PROFILE_ENABLED
+
+// All macros are no-ops:
+#define PROFILE_SCOPE(name)
+#define PROFILE_BEGIN(name)
+#define PROFILE_END()
+#define PROFILE_NEW_FRAME()
+
+#endif // PROFILE_ENABLED
+
+// ========================================================
+// Profiler samples:
+// ========================================================
+
+enum
+{
+	PROFILE_MAX_SAMPLES = 128, // Per frame. Samples past this are dropped and counted.
+	PROFILE_MAX_DEPTH   = 16,  // Nesting deeper than this is dropped too.
+	PROFILE_HISTORY     = 64   // Frames kept, including the one being recorded.
+};
+
+struct ProfileSample
 {
-	// In milliseconds!
-	uint start;
-	uint end;
-	uint delta;
-	const char * name;
+	const char * name;  // String literal given to the marker.
+	uint32 start;       // Ticks since the start of the frame.
+	uint32 end;         // Ditto. Samples still open at the end of the frame end with it.
+	uint32 depth;       // Zero for top-level markers.
 };
 
-inline void profilePrintN(Vec2f & pos, const ProfileTimes * first, ...)
+// Samples are stored in the order the markers were opened,
+// so a parent always comes before its children.
+struct ProfileFrame
 {
-	const Color4b white = { 255, 255, 255, 255 };
+	uint64 startTicks;  // Since the first frame. Extended to 64 bits, never wraps.
+	uint32 durationTicks;
+	uint32 sampleCount;
+	uint32 droppedSamples;
+	ProfileSample samples[PROFILE_MAX_SAMPLES];
+};
 
-	va_list vaList;
-	const ProfileTimes * ptr = first;
+// ========================================================
+// Profiler functions:
+// ========================================================
 
-	va_start(vaList, first);
-	while (ptr != nullptr)
-	{
-		gRenderer.drawText(pos, white, FONT_CONSOLAS_24,
-			format("%s ms: %u\n", ptr->name, ptr->delta));
+// Raw timer: EE cycles (294.912 MHz) or nanoseconds on a dev machine.
+// It is 32 bits, so it wraps around (every ~14.5 seconds on the PS2),
+// but differences between two close readings are always valid.
+uint32 profileTicks();
+uint32 profileTicksPerSecond();
+float  profileTicksToMs(uint32 ticks);
 
-		ptr = va_arg(vaList, const ProfileTimes *);
-	}
-	va_end(vaList);
-}
+// Markers. Usually called through the macros above.
+void profileNewFrame();
+void profileBegin(const char * name);
+void profileEnd();
 
-// ========================================================
+// Completed frames, zero being the most recent one.
+// Null if fewer frames than that were recorded so far.
+const ProfileFrame * profileGetFrame(uint framesAgo);
 
-#else // !PROFILE_ENABLED
+// Stacked bar graph of the last `frameCount` frames inside `rect`, oldest on the left.
+// One color per top-level marker, the remaining frame time in grey. The graph is two
+// frame budgets tall and the budget is marked with a line. Must be called in 2D mode.
+void profileDrawGraph(const Rect4i & rect, uint frameCount, float budgetMs);
 
-// All macros are no-ops:
-#define PROFILE_DECL(prof, printName)
-#define PROFILE_BEGIN(prof)
-#define PROFILE_END(prof)
-#define PROFILE_PRINT(...)
+// Text list of the markers of the last frame, indented by nesting depth,
+// followed by the frame time average and max over the history.
+void profileDrawFrameTimes(Vec2f & pos, BuiltInFontId fontId);
 
-#endif // PROFILE_ENABLED
+// Writes the completed frames in the history to a JSON file in the Chrome
+// trace event format. Markers become complete ("X") events in microseconds,
+// and each frame is an event too, so spikes are easy to find.
+bool profileExportChromeTrace(const char * filename);
+
+// ========================================================
+// class ProfileScope:
+// ========================================================
+
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char * name) { profileBegin(name); }
+	~ProfileScope() { profileEnd(); }
+
+private:
+	// Copy/assign disallowed.
+	ProfileScope(const ProfileScope &);
+	ProfileScope & operator = (const ProfileScope &);
+};
 
 #endif // PROFILE_HPP
@@ -34,6 +34,7 @@
 #define PS2MATH_AABB_HPP
 
 #include "vector.hpp"
+#include "xform_batch.hpp"
 
 // ========================================================
 // struct Aabb:
@@ -75,7 +76,11 @@ struct PS2MATH_ALIGNED(16) Aabb
 	// Scale the vertexes of this AABB.
 	Aabb & scale(float s);
 
-	// Transform the points defining this bounds by a given matrix.
+	// Grow the bounds to also enclose another box.
+	Aabb & merge(const Aabb & other);
+
+	// Transform the bounds by a given affine matrix. The result encloses
+	// the 8 transformed corners of the box (see `transformAabbs()`).
 	Aabb & transform(const Matrix & mat);
 
 	// Get a transformed copy of this Aabb.
@@ -230,16 +235,20 @@ inline Aabb & Aabb::scale(const float s)
 	return *this;
 }
 
-inline Aabb & Aabb::transform(const Matrix & mat)
+inline Aabb & Aabb::merge(const Aabb & other)
 {
-	Vector tmp;
-
-	tmp = mat * mins;
-	mins = tmp;
-
-	tmp = mat * maxs;
-	maxs = tmp;
+	mins.x = ps2math::min(mins.x, other.mins.x);
+	mins.y = ps2math::min(mins.y, other.mins.y);
+	mins.z = ps2math::min(mins.z, other.mins.z);
+	maxs.x = ps2math::max(maxs.x, other.maxs.x);
+	maxs.y = ps2math::max(maxs.y, other.maxs.y);
+	maxs.z = ps2math::max(maxs.z, other.maxs.z);
+	return *this;
+}
 
+inline Aabb & Aabb::transform(const Matrix & mat)
+{
+	transformAabbs(this, mat, this, 1);
 	return *this;
 }
 
@@ -0,0 +1,388 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: fast_math.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Fast approximations of the trigonometric functions and reciprocal square root.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#include "fast_math.hpp"
+
+namespace ps2math
+{
+namespace fast
+{
+
+// ========================================================
+// Local helpers / constant tables:
+// ========================================================
+
+namespace
+{
+
+#if PS2MATH_USE_VU0
+
+// Loaded with lqc2, so these have to be quadword aligned.
+const PS2MATH_ALIGNED(16) float sinCosTable[3][4] =
+{
+	{ INV_TWOPI,   0.25f,       0.5f,        0.0f        },
+	{ SIN_TURN_C1, SIN_TURN_C3, SIN_TURN_C5, SIN_TURN_C7 },
+	{ SIN_TURN_C9, 0.0f,        0.0f,        0.0f        }
+};
+
+const PS2MATH_ALIGNED(16) float atanTable[3][4] =
+{
+	{ ATAN_C1, ATAN_C3,  ATAN_C5,        ATAN_C7     },
+	{ ATAN_C9, ATAN_C11, PS2MATH_HALFPI, PS2MATH_PI  },
+	{ 1e-30f,  0.0f,     0.0f,           0.0f        }
+};
+
+const PS2MATH_ALIGNED(16) float rsqrtTable[4] = { 2.38924456f, 0.703952253f, 0.0f, 0.0f };
+const PS2MATH_ALIGNED(16) unsigned int rsqrtMagic[4] = { 0x5F1FFFF9, 0x5F1FFFF9, 0x5F1FFFF9, 0x5F1FFFF9 };
+
+inline void sinCosQuad(float * s, float * c, const float * x)
+{
+	// Same as cosTurns(), for the sine in vf3/vf5/vf7
+	// and the cosine in vf2/vf4/vf6, interleaved.
+	asm volatile (
+		"lqc2         vf20, 0x00(%3)    \n\t" // vf20 = 1/2PI, 0.25, 0.5
+		"lqc2         vf21, 0x10(%3)    \n\t" // vf21 = C1, C3, C5, C7
+		"lqc2         vf22, 0x20(%3)    \n\t" // vf22 = C9
+		"lqc2         vf1,  0x00(%2)    \n\t" // vf1  = x
+		"vmulx.xyzw   vf2,  vf1,  vf20  \n\t" // vf2  = turns
+		"vsuby.xyzw   vf3,  vf2,  vf20  \n\t" // vf3  = turns - 0.25
+		"vabs.xyzw    vf2,  vf2         \n\t"
+		"vabs.xyzw    vf3,  vf3         \n\t"
+		"vftoi0.xyzw  vf4,  vf2         \n\t"
+		"vftoi0.xyzw  vf5,  vf3         \n\t"
+		"vitof0.xyzw  vf4,  vf4         \n\t"
+		"vitof0.xyzw  vf5,  vf5         \n\t"
+		"vsub.xyzw    vf2,  vf2,  vf4   \n\t" // Fraction of a turn
+		"vsub.xyzw    vf3,  vf3,  vf5   \n\t"
+		"vsubz.xyzw   vf2,  vf2,  vf20  \n\t"
+		"vsubz.xyzw   vf3,  vf3,  vf20  \n\t"
+		"vabs.xyzw    vf2,  vf2         \n\t"
+		"vabs.xyzw    vf3,  vf3         \n\t"
+		"vsuby.xyzw   vf2,  vf2,  vf20  \n\t" // vf2  = t (cosine)
+		"vsuby.xyzw   vf3,  vf3,  vf20  \n\t" // vf3  = t (sine)
+		"vmul.xyzw    vf4,  vf2,  vf2   \n\t"
+		"vmul.xyzw    vf5,  vf3,  vf3   \n\t"
+		"vmulx.xyzw   vf6,  vf4,  vf22  \n\t"
+		"vmulx.xyzw   vf7,  vf5,  vf22  \n\t"
+		"vaddw.xyzw   vf6,  vf6,  vf21  \n\t"
+		"vaddw.xyzw   vf7,  vf7,  vf21  \n\t"
+		"vmul.xyzw    vf6,  vf6,  vf4   \n\t"
+		"vmul.xyzw    vf7,  vf7,  vf5   \n\t"
+		"vaddz.xyzw   vf6,  vf6,  vf21  \n\t"
+		"vaddz.xyzw   vf7,  vf7,  vf21  \n\t"
+		"vmul.xyzw    vf6,  vf6,  vf4   \n\t"
+		"vmul.xyzw    vf7,  vf7,  vf5   \n\t"
+		"vaddy.xyzw   vf6,  vf6,  vf21  \n\t"
+		"vaddy.xyzw   vf7,  vf7,  vf21  \n\t"
+		"vmul.xyzw    vf6,  vf6,  vf4   \n\t"
+		"vmul.xyzw    vf7,  vf7,  vf5   \n\t"
+		"vaddx.xyzw   vf6,  vf6,  vf21  \n\t"
+		"vaddx.xyzw   vf7,  vf7,  vf21  \n\t"
+		"vmul.xyzw    vf6,  vf6,  vf2   \n\t" // vf6  = cos(x)
+		"vmul.xyzw    vf7,  vf7,  vf3   \n\t" // vf7  = sin(x)
+		"sqc2         vf7,  0x00(%0)    \n\t"
+		"sqc2         vf6,  0x00(%1)    \n\t"
+		: : "r" (s), "r" (c), "r" (x), "r" (sinCosTable)
+		: "memory"
+	);
+}
+
+inline void atan2Quad(float * out, const float * y, const float * x)
+{
+	// Polynomial on the VU0, with one divide per lane through Q.
+	// The quadrant fix-ups are blends of the float bits with lane
+	// masks in the 128-bit GPRs: for positive floats, the integer
+	// compare of the bits is the same as the float compare. Zeros
+	// are tested on the absolute values, so -0 isn't negative, as
+	// in the scalar atan2().
+	asm volatile (
+		"lqc2         vf20, 0x00(%3)    \n\t" // vf20 = C1, C3, C5, C7
+		"lqc2         vf21, 0x10(%3)    \n\t" // vf21 = C9, C11, PI/2, PI
+		"lqc2         vf22, 0x20(%3)    \n\t" // vf22 = 1e-30
+		"lqc2         vf1,  0x00(%1)    \n\t" // vf1  = y
+		"lqc2         vf2,  0x00(%2)    \n\t" // vf2  = x
+		"vsub.xyzw    vf11, vf0,  vf0   \n\t" // vf11 = 0
+		"vabs.xyzw    vf3,  vf1         \n\t" // vf3  = |y|
+		"vabs.xyzw    vf4,  vf2         \n\t" // vf4  = |x|
+		"vmax.xyzw    vf5,  vf3,  vf4   \n\t"
+		"vmini.xyzw   vf6,  vf3,  vf4   \n\t"
+		"vaddx.xyzw   vf5,  vf5,  vf22  \n\t"
+		"vdiv         Q,    vf6x, vf5x  \n\t"
+		"vwaitq                         \n\t"
+		"vaddq.x      vf7,  vf11, Q     \n\t"
+		"vdiv         Q,    vf6y, vf5y  \n\t"
+		"vwaitq                         \n\t"
+		"vaddq.y      vf7,  vf11, Q     \n\t"
+		"vdiv         Q,    vf6z, vf5z  \n\t"
+		"vwaitq                         \n\t"
+		"vaddq.z      vf7,  vf11, Q     \n\t"
+		"vdiv         Q,    vf6w, vf5w  \n\t"
+		"vwaitq                         \n\t"
+		"vaddq.w      vf7,  vf11, Q     \n\t" // vf7  = a = min / max
+		"vmul.xyzw    vf8,  vf7,  vf7   \n\t" // vf8  = a * a
+		"vmuly.xyzw   vf9,  vf8,  vf21  \n\t"
+		"vaddx.xyzw   vf9,  vf9,  vf21  \n\t"
+		"vmul.xyzw    vf9,  vf9,  vf8   \n\t"
+		"vaddw.xyzw   vf9,  vf9,  vf20  \n\t"
+		"vmul.xyzw    vf9,  vf9,  vf8   \n\t"
+		"vaddz.xyzw   vf9,  vf9,  vf20  \n\t"
+		"vmul.xyzw    vf9,  vf9,  vf8   \n\t"
+		"vaddy.xyzw   vf9,  vf9,  vf20  \n\t"
+		"vmul.xyzw    vf9,  vf9,  vf8   \n\t"
+		"vaddx.xyzw   vf9,  vf9,  vf20  \n\t"
+		"vmul.xyzw    vf9,  vf9,  vf7   \n\t" // vf9  = r = atan(a)
+		"vaddz.xyzw   vf10, vf11, vf21  \n\t"
+		"vsub.xyzw    vf10, vf10, vf9   \n\t" // vf10 = PI/2 - r
+		"qmfc2        $8,   vf3         \n\t"
+		"qmfc2        $9,   vf4         \n\t"
+		"pcgtw        $10,  $8,   $9    \n\t" // |y| > |x|
+		"qmfc2        $8,   vf9         \n\t"
+		"qmfc2        $9,   vf10        \n\t"
+		"pand         $9,   $9,   $10   \n\t"
+		"pnor         $10,  $10,  $0    \n\t"
+		"pand         $8,   $8,   $10   \n\t"
+		"por          $8,   $8,   $9    \n\t"
+		"qmtc2        $8,   vf9         \n\t"
+		"vaddw.xyzw   vf10, vf11, vf21  \n\t"
+		"vsub.xyzw    vf10, vf10, vf9   \n\t" // vf10 = PI - r
+		"qmfc2        $9,   vf10        \n\t"
+		"qmfc2        $10,  vf2         \n\t"
+		"qmfc2        $11,  vf4         \n\t"
+		"psraw        $10,  $10,  31    \n\t"
+		"pcgtw        $11,  $11,  $0    \n\t"
+		"pand         $10,  $10,  $11   \n\t" // x < 0, false for -0
+		"pand         $9,   $9,   $10   \n\t"
+		"pnor         $10,  $10,  $0    \n\t"
+		"pand         $8,   $8,   $10   \n\t"
+		"por          $8,   $8,   $9    \n\t"
+		"qmfc2        $9,   vf1         \n\t"
+		"qmfc2        $11,  vf3         \n\t"
+		"psrlw        $9,   $9,   31    \n\t"
+		"psllw        $9,   $9,   31    \n\t"
+		"pcgtw        $11,  $11,  $0    \n\t"
+		"pand         $9,   $9,   $11   \n\t"
+		"por          $8,   $8,   $9    \n\t" // Sign of y, if y isn't zero
+		"sq           $8,   0x00(%0)    \n\t"
+		: : "r" (out), "r" (y), "r" (x), "r" (atanTable)
+		: "$8", "$9", "$10", "$11", "memory"
+	);
+}
+
+inline void rsqrtQuad(float * out, const float * x)
+{
+	// Integer estimate in the 128-bit GPRs, Newton step on the VU0.
+	asm volatile (
+		"lqc2         vf20, 0x00(%2)    \n\t" // vf20 = 2.389, 0.704
+		"lq           $9,   0x00(%3)    \n\t" // $9   = magic
+		"lqc2         vf1,  0x00(%1)    \n\t" // vf1  = x
+		"qmfc2        $8,   vf1         \n\t"
+		"psrlw        $8,   $8,   1     \n\t"
+		"psubw        $8,   $9,   $8    \n\t"
+		"qmtc2        $8,   vf2         \n\t" // vf2  = y estimate
+		"vsub.xyzw    vf11, vf0,  vf0   \n\t"
+		"vmul.xyzw    vf3,  vf2,  vf2   \n\t"
+		"vmul.xyzw    vf3,  vf3,  vf1   \n\t" // vf3  = x * y * y
+		"vaddx.xyzw   vf4,  vf11, vf20  \n\t"
+		"vsub.xyzw    vf4,  vf4,  vf3   \n\t"
+		"vmul.xyzw    vf4,  vf4,  vf2   \n\t"
+		"vmuly.xyzw   vf4,  vf4,  vf20  \n\t"
+		"sqc2         vf4,  0x00(%0)    \n\t"
+		: : "r" (out), "r" (x), "r" (rsqrtTable), "r" (rsqrtMagic)
+		: "$8", "$9", "memory"
+	);
+}
+
+#elif PS2MATH_USE_SSE2
+
+inline __m128 sse2Abs(const __m128 v)
+{
+	return _mm_and_ps(v, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+}
+
+inline __m128 sse2CosTurns(const __m128 turns)
+{
+	const __m128 f  = _mm_sub_ps(turns, _mm_cvtepi32_ps(_mm_cvttps_epi32(turns)));
+	const __m128 t  = _mm_sub_ps(sse2Abs(_mm_sub_ps(f, _mm_set1_ps(0.5f))), _mm_set1_ps(0.25f));
+	const __m128 t2 = _mm_mul_ps(t, t);
+	__m128 p = _mm_add_ps(_mm_mul_ps(t2, _mm_set1_ps(SIN_TURN_C9)), _mm_set1_ps(SIN_TURN_C7));
+	p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(SIN_TURN_C5));
+	p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(SIN_TURN_C3));
+	p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(SIN_TURN_C1));
+	return _mm_mul_ps(p, t);
+}
+
+inline void sinCosQuad(float * s, float * c, const float * x)
+{
+	const __m128 turns = _mm_mul_ps(_mm_load_ps(x), _mm_set1_ps(INV_TWOPI));
+	_mm_store_ps(s, sse2CosTurns(sse2Abs(_mm_sub_ps(turns, _mm_set1_ps(0.25f)))));
+	_mm_store_ps(c, sse2CosTurns(sse2Abs(turns)));
+}
+
+inline void atan2Quad(float * out, const float * y, const float * x)
+{
+	const __m128 vy = _mm_load_ps(y);
+	const __m128 vx = _mm_load_ps(x);
+	const __m128 ay = sse2Abs(vy);
+	const __m128 ax = sse2Abs(vx);
+	const __m128 a  = _mm_div_ps(_mm_min_ps(ax, ay), _mm_add_ps(_mm_max_ps(ax, ay), _mm_set1_ps(1e-30f)));
+	const __m128 s  = _mm_mul_ps(a, a);
+
+	__m128 r = _mm_add_ps(_mm_mul_ps(s, _mm_set1_ps(ATAN_C11)), _mm_set1_ps(ATAN_C9));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(ATAN_C7));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(ATAN_C5));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(ATAN_C3));
+	r = _mm_add_ps(_mm_mul_ps(r, s), _mm_set1_ps(ATAN_C1));
+	r = _mm_mul_ps(r, a);
+
+	// Quadrant fix-ups with lane masks.
+	const __m128 zero = _mm_setzero_ps();
+	__m128 m = _mm_cmpgt_ps(ay, ax);
+	r = _mm_or_ps(_mm_andnot_ps(m, r), _mm_and_ps(m, _mm_sub_ps(_mm_set1_ps(PS2MATH_HALFPI), r)));
+	m = _mm_cmplt_ps(vx, zero);
+	r = _mm_or_ps(_mm_andnot_ps(m, r), _mm_and_ps(m, _mm_sub_ps(_mm_set1_ps(PS2MATH_PI), r)));
+	m = _mm_cmplt_ps(vy, zero);
+	r = _mm_or_ps(_mm_andnot_ps(m, r), _mm_and_ps(m, _mm_sub_ps(zero, r)));
+	_mm_store_ps(out, r);
+}
+
+inline void rsqrtQuad(float * out, const float * x)
+{
+	const __m128 v   = _mm_load_ps(x);
+	const __m128 y   = _mm_rsqrt_ps(v);
+	const __m128 yyx = _mm_mul_ps(_mm_mul_ps(y, y), v);
+	_mm_store_ps(out, _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), yyx)));
+}
+
+#else // PS2MATH_BACKEND_SCALAR
+
+inline void sinCosQuad(float * s, float * c, const float * x)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		fast::sinCos(x[i], &s[i], &c[i]);
+	}
+}
+
+inline void atan2Quad(float * out, const float * y, const float * x)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		out[i] = fast::atan2(y[i], x[i]);
+	}
+}
+
+inline void rsqrtQuad(float * out, const float * x)
+{
+	for (int i = 0; i < 4; ++i)
+	{
+		out[i] = fast::rsqrt(x[i]);
+	}
+}
+
+#endif // PS2MATH_USE_VU0
+
+} // namespace {}
+
+// ========================================================
+// fast::sinCos():
+// ========================================================
+
+void sinCos(float * s, float * c, const float * x, const unsigned int count)
+{
+	unsigned int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		sinCosQuad(s + i, c + i, x + i);
+	}
+
+	// Leftovers go through a padded quad.
+	if (i < count)
+	{
+		PS2MATH_ALIGNED(16) float tx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		PS2MATH_ALIGNED(16) float ts[4];
+		PS2MATH_ALIGNED(16) float tc[4];
+		const unsigned int n = count - i;
+		for (unsigned int j = 0; j < n; ++j) { tx[j] = x[i + j]; }
+		sinCosQuad(ts, tc, tx);
+		for (unsigned int j = 0; j < n; ++j) { s[i + j] = ts[j]; c[i + j] = tc[j]; }
+	}
+}
+
+// ========================================================
+// fast::atan2():
+// ========================================================
+
+void atan2(float * out, const float * y, const float * x, const unsigned int count)
+{
+	unsigned int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		atan2Quad(out + i, y + i, x + i);
+	}
+
+	if (i < count)
+	{
+		PS2MATH_ALIGNED(16) float ty[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		PS2MATH_ALIGNED(16) float tx[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		PS2MATH_ALIGNED(16) float tr[4];
+		const unsigned int n = count - i;
+		for (unsigned int j = 0; j < n; ++j) { ty[j] = y[i + j]; tx[j] = x[i + j]; }
+		atan2Quad(tr, ty, tx);
+		for (unsigned int j = 0; j < n; ++j) { out[i + j] = tr[j]; }
+	}
+}
+
+// ========================================================
+// fast::rsqrt():
+// ========================================================
+
+void rsqrt(float * out, const float * x, const unsigned int count)
+{
+	unsigned int i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		rsqrtQuad(out + i, x + i);
+	}
+
+	if (i < count)
+	{
+		PS2MATH_ALIGNED(16) float tx[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+		PS2MATH_ALIGNED(16) float tr[4];
+		const unsigned int n = count - i;
+		for (unsigned int j = 0; j < n; ++j) { tx[j] = x[i + j]; }
+		rsqrtQuad(tr, tx);
+		for (unsigned int j = 0; j < n; ++j) { out[i + j] = tr[j]; }
+	}
+}
+
+} // namespace fast {}
+} // namespace ps2math {}
@@ -0,0 +1,198 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: fast_math.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Fast approximations of the trigonometric functions and reciprocal square root.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#ifndef PS2MATH_FAST_MATH_HPP
+#define PS2MATH_FAST_MATH_HPP
+
+#include "math_funcs.hpp"
+
+//
+// Approximations for the hot paths of gameplay and rendering code,
+// where the C library functions are too slow (they are all software
+// double precision on the EE). Polynomial coefficients are minimax
+// fits, evaluated in single precision. The error bounds below were
+// measured over every float in the given ranges by the host tester in
+// `tools/fast_math_tester/`. Run it again after changing any of this.
+//
+// The batch versions do four values per iteration, on the VU0 or with SSE2.
+// Arrays must be 16 bytes aligned, but `count` doesn't have to be a
+// multiple of 4. Outputs can be the same arrays as the inputs.
+//
+
+namespace ps2math
+{
+namespace fast
+{
+
+// ========================================================
+// Polynomial coefficients:
+// ========================================================
+
+// sin(2*PI*t) for t in [-0.25, 0.25] (a quarter turn), odd powers of t.
+const float SIN_TURN_C1 =   6.2831853f;
+const float SIN_TURN_C3 = -41.3416919f;
+const float SIN_TURN_C5 =  81.6032657f;
+const float SIN_TURN_C7 = -76.5982074f;
+const float SIN_TURN_C9 =  39.873228f;
+
+// atan(a) for a in [0, 1], odd powers of a.
+const float ATAN_C1  =  0.999999567f;
+const float ATAN_C3  = -0.333226093f;
+const float ATAN_C5  =  0.197536887f;
+const float ATAN_C7  = -0.126400018f;
+const float ATAN_C9  =  0.0630594209f;
+const float ATAN_C11 = -0.0155716002f;
+
+const float INV_TWOPI = 0.159154943091895335768883763372514f;
+
+// ========================================================
+// Sine and cosine:
+// ========================================================
+
+//
+// Cosine of an angle in turns (1 turn = 2*PI radians). `turns` must be
+// positive and below 2^31. The fraction of a turn is folded into a
+// quarter turn centered on zero, where the cosine becomes a sine:
+// cos(2*PI*f) = sin(2*PI*(|f - 0.5| - 0.25)).
+//
+inline float cosTurns(const float turns)
+{
+	const float f  = turns - static_cast<float>(static_cast<int>(turns));
+	const float t  = ps2math::abs(f - 0.5f) - 0.25f;
+	const float t2 = t * t;
+	return t * (SIN_TURN_C1 + t2 * (SIN_TURN_C3 + t2 * (SIN_TURN_C5 + t2 * (SIN_TURN_C7 + t2 * SIN_TURN_C9))));
+}
+
+//
+// Max absolute error: 8.2e-7 for |x| <= 2*PI, 1.2e-5 for |x| <= 100
+// and 8.3e-4 for |x| <= 1e4. The range reduction is done in turns
+// with a single float, so precision degrades with the magnitude of
+// the angle. Keep angles wrapped for best results.
+//
+inline float cos(const float x)
+{
+	return cosTurns(ps2math::abs(x) * INV_TWOPI);
+}
+
+inline float sin(const float x)
+{
+	return cosTurns(ps2math::abs(x * INV_TWOPI - 0.25f));
+}
+
+inline void sinCos(const float x, float * s, float * c)
+{
+	const float turns = x * INV_TWOPI;
+	(*s) = cosTurns(ps2math::abs(turns - 0.25f));
+	(*c) = cosTurns(ps2math::abs(turns));
+}
+
+// Batch sinCos().
+void sinCos(float * s, float * c, const float * x, unsigned int count);
+
+// ========================================================
+// Arc tangent:
+// ========================================================
+
+//
+// Same quadrants as atan2f(), result in [-PI, PI]. Max absolute error: 1.1e-5
+// (about 0.0006 degrees). atan2(0, 0) is 0. The sign of a zero `y` is ignored,
+// so atan2(-0, -1) is PI instead of -PI.
+//
+inline float atan2(const float y, const float x)
+{
+	const float ax = ps2math::abs(x);
+	const float ay = ps2math::abs(y);
+
+	// Ratio in [0, 1]. The tiny bias avoids the 0/0 without a branch.
+	const float a = ps2math::min(ax, ay) / (ps2math::max(ax, ay) + 1e-30f);
+	const float s = a * a;
+	float r = a * (ATAN_C1 + s * (ATAN_C3 + s * (ATAN_C5 + s * (ATAN_C7 + s * (ATAN_C9 + s * ATAN_C11)))));
+
+	if (ay > ax)  { r = PS2MATH_HALFPI - r; }
+	if (x < 0.0f) { r = PS2MATH_PI - r;     }
+	return (y < 0.0f) ? -r : r;
+}
+
+// Batch atan2().
+void atan2(float * out, const float * y, const float * x, unsigned int count);
+
+// ========================================================
+// Reciprocal square root:
+// ========================================================
+
+//
+// 1 / sqrt(x) for x > 0. On the EE this is the FPU `rsqrt.s`, with no
+// Newton-Raphson step. Its error can only be measured on the console,
+// with the tester built by the ps2sdk, and that hasn't been done yet.
+// With SSE2, the 12 bits `rsqrtss` estimate plus a Newton-Raphson
+// step, max relative error 2.5e-7. Elsewhere, the
+// integer estimate with the tuned constants of Moroz et al. ("Fast
+// calculation of inverse square root with the use of magic constant",
+// 2018) plus one Newton-Raphson step, max relative error 6.5e-4.
+//
+inline float rsqrt(const float x)
+{
+#if PS2MATH_USE_VU0
+
+	float r;
+	const float one = 1.0f;
+	asm volatile (
+		"rsqrt.s %0, %1, %2 \n\t"
+		: "=&f" (r) : "f" (one), "f" (x)
+	);
+	return r;
+
+#elif PS2MATH_USE_SSE2
+
+	const __m128 v = _mm_set_ss(x);
+	const __m128 y = _mm_rsqrt_ss(v);
+	const __m128 yyx = _mm_mul_ss(_mm_mul_ss(y, y), v);
+	return _mm_cvtss_f32(_mm_mul_ss(_mm_mul_ss(_mm_set_ss(0.5f), y), _mm_sub_ss(_mm_set_ss(3.0f), yyx)));
+
+#else // PS2MATH_BACKEND_SCALAR
+
+	union { float f; unsigned int i; } y;
+	y.f = x;
+	y.i = 0x5F1FFFF9 - (y.i >> 1);
+	return 0.703952253f * y.f * (2.38924456f - x * y.f * y.f);
+
+#endif // PS2MATH_USE_VU0
+}
+
+// Batch rsqrt(). The VU0 version uses the integer estimate, so its
+// error is that of the scalar backend (6.5e-4), not of `rsqrt.s`.
+void rsqrt(float * out, const float * x, unsigned int count);
+
+} // namespace fast {}
+} // namespace ps2math {}
+
+#endif // PS2MATH_FAST_MATH_HPP
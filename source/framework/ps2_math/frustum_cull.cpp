@@ -0,0 +1,383 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: frustum_cull.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Batched frustum culling of axis-aligned bounding boxes.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#include "../common.hpp" // For the helpers used by aabb.hpp
+#include "frustum_cull.hpp"
+
+// ========================================================
+// Local helpers:
+// ========================================================
+
+// Scalar test of one box against the `planeCount` planes of `active`.
+// Returns false as soon as it is outside a plane. Bit k of `crossed`
+// is set if the box crosses plane k.
+static inline bool cullOneBox(const float (*active)[2][4], const unsigned int planeCount,
+                              const float cx, const float cy, const float cz,
+                              const float ex, const float ey, const float ez, unsigned int * crossed)
+{
+	unsigned int bits = 0;
+	for (unsigned int k = 0; k < planeCount; ++k)
+	{
+		const float * p = active[k][0];
+		const float * a = active[k][1];
+		const float d = p[0] * cx + p[1] * cy + p[2] * cz + p[3];
+		const float r = a[0] * ex + a[1] * ey + a[2] * ez;
+		if ((d + r) <= 0.0f)
+		{
+			return false;
+		}
+		bits |= static_cast<unsigned int>((d - r) <= 0.0f) << k;
+	}
+	(*crossed) = bits;
+	return true;
+}
+
+// Crossed bits of the compacted planes back to a Frustum plane mask.
+static inline unsigned int crossedToPlaneMask(const unsigned int crossed, const unsigned char * planeIndex, const unsigned int planeCount)
+{
+	unsigned int mask = 0;
+	for (unsigned int k = 0; k < planeCount; ++k)
+	{
+		if (crossed & (1u << k))
+		{
+			mask |= 1u << planeIndex[k];
+		}
+	}
+	return mask;
+}
+
+// Copies the planes set in `planeMask` to the front of `active`,
+// so the loops below can just walk them. Returns the count.
+static inline unsigned int gatherPlanes(const FrustumCullPlanes & planes, const unsigned int planeMask,
+                                        float (*active)[2][4], unsigned char planeIndex[6])
+{
+	unsigned int planeCount = 0;
+	for (unsigned int i = 0; i < 6; ++i)
+	{
+		if (planeMask & (1u << i))
+		{
+			memcpy(active[planeCount], planes.planes[i], sizeof(planes.planes[i]));
+			planeIndex[planeCount++] = static_cast<unsigned char>(i);
+		}
+	}
+	return planeCount;
+}
+
+// ========================================================
+// FrustumCullPlanes::setFrustum():
+// ========================================================
+
+void FrustumCullPlanes::setFrustum(const Frustum & frustum)
+{
+	for (int i = 0; i < 6; ++i)
+	{
+		planes[i][0][0] = frustum.p[i][Frustum::A];
+		planes[i][0][1] = frustum.p[i][Frustum::B];
+		planes[i][0][2] = frustum.p[i][Frustum::C];
+		planes[i][0][3] = frustum.p[i][Frustum::D];
+		planes[i][1][0] = ps2math::abs(frustum.p[i][Frustum::A]);
+		planes[i][1][1] = ps2math::abs(frustum.p[i][Frustum::B]);
+		planes[i][1][2] = ps2math::abs(frustum.p[i][Frustum::C]);
+		planes[i][1][3] = 0.0f;
+	}
+}
+
+// ========================================================
+// AabbSoA::setMemory():
+// ========================================================
+
+void AabbSoA::setMemory(float * memory, const unsigned int maxCount)
+{
+	ps2assert((reinterpret_cast<size_t>(memory) & 15) == 0);
+
+	const unsigned int n = paddedCount(maxCount);
+	centerX = memory;
+	centerY = centerX + n;
+	centerZ = centerY + n;
+	extentX = centerZ + n;
+	extentY = extentX + n;
+	extentZ = extentY + n;
+}
+
+// ========================================================
+// AabbSoA::setBox():
+// ========================================================
+
+void AabbSoA::setBox(const unsigned int index, const Vector & mins, const Vector & maxs)
+{
+	centerX[index] = (maxs.x + mins.x) * 0.5f;
+	centerY[index] = (maxs.y + mins.y) * 0.5f;
+	centerZ[index] = (maxs.z + mins.z) * 0.5f;
+	extentX[index] = (maxs.x - mins.x) * 0.5f;
+	extentY[index] = (maxs.y - mins.y) * 0.5f;
+	extentZ[index] = (maxs.z - mins.z) * 0.5f;
+}
+
+// ========================================================
+// cullAabb():
+// ========================================================
+
+bool cullAabb(const FrustumCullPlanes & planes, const Aabb & aabb, const unsigned int planeMask, unsigned int * childPlaneMask)
+{
+	ps2assert(childPlaneMask != nullptr);
+
+	PS2MATH_ALIGNED(16) float active[6][2][4];
+	unsigned char planeIndex[6];
+	const unsigned int planeCount = gatherPlanes(planes, planeMask, active, planeIndex);
+
+	unsigned int crossed = 0;
+	const bool visible = cullOneBox(active, planeCount,
+	                                (aabb.maxs.x + aabb.mins.x) * 0.5f,
+	                                (aabb.maxs.y + aabb.mins.y) * 0.5f,
+	                                (aabb.maxs.z + aabb.mins.z) * 0.5f,
+	                                (aabb.maxs.x - aabb.mins.x) * 0.5f,
+	                                (aabb.maxs.y - aabb.mins.y) * 0.5f,
+	                                (aabb.maxs.z - aabb.mins.z) * 0.5f,
+	                                &crossed);
+
+	(*childPlaneMask) = crossedToPlaneMask(crossed, planeIndex, planeCount);
+	return visible;
+}
+
+// ========================================================
+// cullAabbs():
+// ========================================================
+
+unsigned int cullAabbs(const FrustumCullPlanes & planes, const AabbSoA & boxes, const unsigned int count,
+                       const unsigned int planeMask, unsigned int * visibleBits, unsigned char * childPlaneMasks)
+{
+	ps2assert(visibleBits != nullptr);
+
+	const unsigned int bitWords = cullBitWords(count);
+	for (unsigned int w = 0; w < bitWords; ++w)
+	{
+		visibleBits[w] = 0;
+	}
+
+	PS2MATH_ALIGNED(16) float activePlanes[6][2][4];
+	unsigned char planeIndex[6];
+	const unsigned int planeCount = gatherPlanes(planes, planeMask, activePlanes, planeIndex);
+
+	// Parent fully inside; nothing to test.
+	if (planeCount == 0)
+	{
+		for (unsigned int i = 0; i < count; ++i)
+		{
+			visibleBits[i >> 5] |= 1u << (i & 31);
+			if (childPlaneMasks != nullptr)
+			{
+				childPlaneMasks[i] = 0;
+			}
+		}
+		return count;
+	}
+
+	unsigned int visibleCount = 0;
+
+#if PS2MATH_USE_VU0
+
+	// Lane masks written by the asm: [0] is all ones for the boxes
+	// in front of every plane, [1+k] is all ones for the boxes fully
+	// in front of active plane k (i.e. that don't cross it).
+	PS2MATH_ALIGNED(16) int laneMasks[7][4];
+
+	for (unsigned int i = 0; i < count; i += 4)
+	{
+		// Four boxes, one per lane, in vf1-vf6. vf10 = (1,1,1,1) to add the
+		// plane D. For each plane: vf9 = distance of the centers, vf11 = the
+		// extents projected on the plane normal. A lane is culled if
+		// d + r <= 0 and crosses the plane if d - r <= 0. The sign tests
+		// are integer compares of the float bits in the 128-bit GPRs.
+		const float * pPlanes = activePlanes[0][0];
+		int * pMasks = laneMasks[1];
+		unsigned int n = planeCount;
+		asm volatile (
+			"lqc2         vf1,  0x00(%3)    \n\t" // vf1  = center x
+			"lqc2         vf2,  0x00(%4)    \n\t" // vf2  = center y
+			"lqc2         vf3,  0x00(%5)    \n\t" // vf3  = center z
+			"lqc2         vf4,  0x00(%6)    \n\t" // vf4  = extent x
+			"lqc2         vf5,  0x00(%7)    \n\t" // vf5  = extent y
+			"lqc2         vf6,  0x00(%8)    \n\t" // vf6  = extent z
+			"vsub.xyzw    vf10, vf0,  vf0   \n\t"
+			"vaddw.xyzw   vf10, vf10, vf0   \n\t" // vf10 = (1,1,1,1)
+			"pnor         $9,   $0,   $0    \n\t" // $9   = all lanes visible
+			"1:                             \n\t"
+			"lqc2         vf7,  0x00(%0)    \n\t" // vf7  = A,B,C,D
+			"lqc2         vf8,  0x10(%0)    \n\t" // vf8  = |A|,|B|,|C|
+			"vmulax.xyzw  ACC,  vf1,  vf7   \n\t"
+			"vmadday.xyzw ACC,  vf2,  vf7   \n\t"
+			"vmaddaz.xyzw ACC,  vf3,  vf7   \n\t"
+			"vmaddw.xyzw  vf9,  vf10, vf7   \n\t" // vf9  = d
+			"vmulax.xyzw  ACC,  vf4,  vf8   \n\t"
+			"vmadday.xyzw ACC,  vf5,  vf8   \n\t"
+			"vmaddz.xyzw  vf11, vf6,  vf8   \n\t" // vf11 = r
+			"addiu        %2,   %2,   -1    \n\t"
+			"addiu        %0,   %0,   0x20  \n\t"
+			"vadd.xyzw    vf12, vf9,  vf11  \n\t"
+			"vsub.xyzw    vf13, vf9,  vf11  \n\t"
+			"qmfc2        $8,   vf12        \n\t"
+			"qmfc2        $10,  vf13        \n\t"
+			"pcgtw        $8,   $8,   $0    \n\t" // d + r > 0
+			"pcgtw        $10,  $10,  $0    \n\t" // d - r > 0
+			"pand         $9,   $9,   $8    \n\t"
+			"sq           $10,  0x00(%1)    \n\t"
+			"addiu        %1,   %1,   0x10  \n\t"
+			"bnez         %2,   1b          \n\t"
+			"sq           $9,   0x00(%9)    \n\t"
+			: "+r" (pPlanes), "+r" (pMasks), "+r" (n)
+			: "r" (boxes.centerX + i), "r" (boxes.centerY + i), "r" (boxes.centerZ + i),
+			  "r" (boxes.extentX + i), "r" (boxes.extentY + i), "r" (boxes.extentZ + i),
+			  "r" (laneMasks[0])
+			: "$8", "$9", "$10", "memory"
+		);
+
+		const unsigned int lanes = ((count - i) < 4) ? (count - i) : 4;
+		for (unsigned int l = 0; l < lanes; ++l)
+		{
+			if (laneMasks[0][l] == 0)
+			{
+				if (childPlaneMasks != nullptr)
+				{
+					childPlaneMasks[i + l] = 0;
+				}
+				continue;
+			}
+
+			visibleBits[(i + l) >> 5] |= 1u << ((i + l) & 31);
+			++visibleCount;
+
+			if (childPlaneMasks != nullptr)
+			{
+				unsigned int crossed = 0;
+				for (unsigned int k = 0; k < planeCount; ++k)
+				{
+					crossed |= ((laneMasks[1 + k][l] == 0) ? 1u : 0u) << k;
+				}
+				childPlaneMasks[i + l] = static_cast<unsigned char>(crossedToPlaneMask(crossed, planeIndex, planeCount));
+			}
+		}
+	}
+
+#elif PS2MATH_USE_SSE2
+
+	// Each plane coefficient splatted to all lanes, once for the whole batch.
+	__m128 splat[6][7];
+	for (unsigned int k = 0; k < planeCount; ++k)
+	{
+		for (unsigned int j = 0; j < 7; ++j)
+		{
+			splat[k][j] = _mm_set1_ps(activePlanes[k][j >> 2][j & 3]);
+		}
+	}
+
+	const __m128 zero = _mm_setzero_ps();
+	for (unsigned int i = 0; i < count; i += 4)
+	{
+		const __m128 cx = _mm_load_ps(boxes.centerX + i);
+		const __m128 cy = _mm_load_ps(boxes.centerY + i);
+		const __m128 cz = _mm_load_ps(boxes.centerZ + i);
+		const __m128 ex = _mm_load_ps(boxes.extentX + i);
+		const __m128 ey = _mm_load_ps(boxes.extentY + i);
+		const __m128 ez = _mm_load_ps(boxes.extentZ + i);
+
+		// Bit per lane: culled boxes and, per plane, crossing boxes.
+		int outside = 0;
+		int crossing[6];
+		for (unsigned int k = 0; k < planeCount; ++k)
+		{
+			const __m128 * p = splat[k];
+			const __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, p[0]), _mm_mul_ps(cy, p[1])),
+			                            _mm_add_ps(_mm_mul_ps(cz, p[2]), p[3]));
+			const __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, p[4]), _mm_mul_ps(ey, p[5])),
+			                            _mm_mul_ps(ez, p[6]));
+
+			outside |= _mm_movemask_ps(_mm_cmple_ps(_mm_add_ps(d, r), zero));
+			crossing[k] = _mm_movemask_ps(_mm_cmple_ps(_mm_sub_ps(d, r), zero));
+
+			// All four outside already?
+			if (outside == 0xF)
+			{
+				break;
+			}
+		}
+
+		const unsigned int lanes = ((count - i) < 4) ? (count - i) : 4;
+		for (unsigned int l = 0; l < lanes; ++l)
+		{
+			if (outside & (1 << l))
+			{
+				if (childPlaneMasks != nullptr)
+				{
+					childPlaneMasks[i + l] = 0;
+				}
+				continue;
+			}
+
+			visibleBits[(i + l) >> 5] |= 1u << ((i + l) & 31);
+			++visibleCount;
+
+			if (childPlaneMasks != nullptr)
+			{
+				// Visible lanes went through every plane.
+				unsigned int crossed = 0;
+				for (unsigned int k = 0; k < planeCount; ++k)
+				{
+					crossed |= ((crossing[k] >> l) & 1) << k;
+				}
+				childPlaneMasks[i + l] = static_cast<unsigned char>(crossedToPlaneMask(crossed, planeIndex, planeCount));
+			}
+		}
+	}
+
+#else // PS2MATH_BACKEND_SCALAR
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		unsigned int crossed;
+		const bool visible = cullOneBox(activePlanes, planeCount,
+		                                boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i],
+		                                boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i], &crossed);
+		if (visible)
+		{
+			visibleBits[i >> 5] |= 1u << (i & 31);
+			++visibleCount;
+		}
+		if (childPlaneMasks != nullptr)
+		{
+			childPlaneMasks[i] = visible ? static_cast<unsigned char>(crossedToPlaneMask(crossed, planeIndex, planeCount)) : 0;
+		}
+	}
+
+#endif // PS2MATH_USE_VU0
+
+	return visibleCount;
+}
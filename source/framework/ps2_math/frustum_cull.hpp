@@ -0,0 +1,132 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: frustum_cull.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Batched frustum culling of axis-aligned bounding boxes.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#ifndef PS2MATH_FRUSTUM_CULL_HPP
+#define PS2MATH_FRUSTUM_CULL_HPP
+
+#include "aabb.hpp"
+#include "frustum.hpp"
+
+// ========================================================
+// Frustum plane masks:
+// ========================================================
+
+//
+// Bit N set means plane N of `Frustum::p` must be tested.
+// A box that is fully inside a plane doesn't need to test that
+// plane again for anything it contains, so the mask output by
+// cullAabbs() for a parent box can be used as the input mask
+// of its children. A mask of zero means fully inside the frustum.
+//
+enum
+{
+	FRUSTUM_NO_PLANES  = 0x00,
+	FRUSTUM_ALL_PLANES = 0x3F
+};
+
+// ========================================================
+// struct FrustumCullPlanes:
+// ========================================================
+
+// The planes of a Frustum laid out for the batch test.
+// Each plane is (A,B,C,D) followed by (|A|,|B|,|C|,0).
+struct PS2MATH_ALIGNED(16) FrustumCullPlanes
+{
+	FrustumCullPlanes() { }
+	explicit FrustumCullPlanes(const Frustum & frustum) { setFrustum(frustum); }
+
+	// Must be called again after every `Frustum::update()`.
+	void setFrustum(const Frustum & frustum);
+
+	float planes[6][2][4];
+};
+
+// ========================================================
+// struct AabbSoA:
+// ========================================================
+
+//
+// Boxes as separate arrays of centers and extents (half sizes),
+// so that four boxes can be tested per iteration, one per SIMD lane.
+// The memory is provided by the caller. Each array is padded to a
+// multiple of four boxes; the padding is never written nor tested.
+//
+struct AabbSoA
+{
+	float * centerX;
+	float * centerY;
+	float * centerZ;
+	float * extentX;
+	float * extentY;
+	float * extentZ;
+
+	static unsigned int paddedCount(const unsigned int count)  { return (count + 3) & ~3u; }
+	static unsigned int floatsNeeded(const unsigned int count) { return paddedCount(count) * 6; }
+
+	// `memory` must be 16 bytes aligned and hold `floatsNeeded(maxCount)` floats.
+	void setMemory(float * memory, unsigned int maxCount);
+
+	void setBox(unsigned int index, const Vector & mins, const Vector & maxs);
+	void setBox(unsigned int index, const Aabb & aabb) { setBox(index, aabb.mins, aabb.maxs); }
+};
+
+// ========================================================
+// Batch frustum culling:
+// ========================================================
+
+// Number of words needed in the `visibleBits` array of cullAabbs().
+inline unsigned int cullBitWords(const unsigned int count) { return (count + 31) >> 5; }
+
+// Reads back the result of cullAabbs() for box `index`.
+inline bool isAabbVisible(const unsigned int * visibleBits, const unsigned int index)
+{
+	return ((visibleBits[index >> 5] >> (index & 31)) & 1) != 0;
+}
+
+//
+// Tests `count` boxes against the planes selected by `planeMask`.
+// Bit `i` of `visibleBits` is set if box `i` is partly or fully inside,
+// with the same results as `Frustum::testAabb()`. Returns the number of
+// visible boxes.
+//
+// If `childPlaneMasks` is not null, it receives for each visible box
+// the subset of `planeMask` that the box crosses, to be used when
+// culling whatever is inside that box. Culled boxes get zero.
+//
+unsigned int cullAabbs(const FrustumCullPlanes & planes, const AabbSoA & boxes, unsigned int count,
+                       unsigned int planeMask, unsigned int * visibleBits, unsigned char * childPlaneMasks = nullptr);
+
+// Single box version of cullAabbs(), for the parent box of a batch.
+// Returns true if visible and the planes it crosses in `childPlaneMask`.
+bool cullAabb(const FrustumCullPlanes & planes, const Aabb & aabb, unsigned int planeMask, unsigned int * childPlaneMask);
+
+#endif // PS2MATH_FRUSTUM_CULL_HPP
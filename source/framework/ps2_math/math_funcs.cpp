@@ -46,6 +46,8 @@ namespace ps2math
 
 float mod(float a, float b)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		".set push                 \n\t"
@@ -75,6 +77,12 @@ float mod(float a, float b)
 		: "$8", "$9", "$10", "$11", "$12", "$f8"
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return ::fmodf(a, b);
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -83,6 +91,8 @@ float mod(float a, float b)
 
 float asin(float x)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		".set noreorder             \n\t"
@@ -149,6 +159,12 @@ float asin(float x)
 		: "$f1", "$f2", "$f3", "$f4", "$f5", "$f6", "$f7", "$f8"
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return ::asinf(x);
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -157,6 +173,8 @@ float asin(float x)
 
 float cos(float x)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		"lui     $9,  0x3f00        \n\t"
@@ -213,6 +231,12 @@ float cos(float x)
 		: "$f1", "$f2", "$f3", "$f4", "$f5", "$f6", "$f7", "$f8", "$f9", "$8", "$9", "$10"
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return ::cosf(x);
+
+#endif // PS2MATH_USE_VU0
 }
 
 } // namespace ps2math {}
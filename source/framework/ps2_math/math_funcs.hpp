@@ -44,6 +44,38 @@
 // Ensures structure/class is properly aligned to a give boundary.
 #define PS2MATH_ALIGNED(alignment) __attribute__((aligned(alignment)))
 
+// ========================================================
+// Backend selection:
+// ========================================================
+
+//
+// VU0 inline assembly on the PS2, SSE2 intrinsics on a dev machine that
+// has them, plain C++ everywhere else. Define PS2MATH_BACKEND to one of
+// the values below to force a backend (e.g. the scalar one on x86, to
+// compare results). All three give the same results, within float error;
+// the VU0 sine/cosine/asin are faster approximations than the C library's.
+//
+#define PS2MATH_BACKEND_SCALAR 0
+#define PS2MATH_BACKEND_SSE2   1
+#define PS2MATH_BACKEND_VU0    2
+
+#ifndef PS2MATH_BACKEND
+	#if defined(_EE)
+		#define PS2MATH_BACKEND PS2MATH_BACKEND_VU0
+	#elif defined(__SSE2__)
+		#define PS2MATH_BACKEND PS2MATH_BACKEND_SSE2
+	#else
+		#define PS2MATH_BACKEND PS2MATH_BACKEND_SCALAR
+	#endif
+#endif // PS2MATH_BACKEND
+
+#define PS2MATH_USE_VU0  (PS2MATH_BACKEND == PS2MATH_BACKEND_VU0)
+#define PS2MATH_USE_SSE2 (PS2MATH_BACKEND == PS2MATH_BACKEND_SSE2)
+
+#if PS2MATH_USE_SSE2
+	#include <emmintrin.h>
+#endif // PS2MATH_USE_SSE2
+
 namespace ps2math
 {
 
@@ -58,55 +90,102 @@ float mod(float a, float b);
 
 inline float abs(float x)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		"abs.s %0, %1 \n\t"
 		: "=&f" (r) : "f" (x)
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return ::fabsf(x);
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
 inline float min(float a, float b)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		"min.s %0, %1, %2 \n\t"
 		: "=&f" (r) : "f" (a), "f" (b)
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return (a < b) ? a : b;
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
 inline float max(float a, float b)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		"max.s %0, %1, %2 \n\t"
 		: "=&f" (r) : "f" (a), "f" (b)
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return (a > b) ? a : b;
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
 inline float sqrt(float x)
 {
+#if PS2MATH_USE_VU0
+
 	float r;
 	asm volatile (
 		"sqrt.s %0, %1 \n\t"
 		: "=&f" (r) : "f" (x)
 	);
 	return r;
+
+#else // !PS2MATH_USE_VU0
+
+	return ::sqrtf(x);
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
 inline float invSqrt(float x)
 {
+#if PS2MATH_USE_VU0
+
+	// One FPU op instead of a sqrt.s followed by a div.s.
+	float r;
+	const float one = 1.0f;
+	asm volatile (
+		"rsqrt.s %0, %1, %2 \n\t"
+		: "=&f" (r) : "f" (one), "f" (x)
+	);
+	return r;
+
+#else // !PS2MATH_USE_VU0
+
 	return 1.0f / ps2math::sqrt(x);
+
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
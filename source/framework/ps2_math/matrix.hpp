@@ -97,7 +97,7 @@ inline Matrix::Matrix(const float data[][4])
 
 inline Matrix::Matrix(const Matrix & other)
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	asm volatile (
 		"lq $6, 0x00(%1) \n\t"
@@ -112,16 +112,23 @@ inline Matrix::Matrix(const Matrix & other)
 		: "$6", "$7", "$8", "$9"
 	);
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	_mm_store_ps(elem[0], _mm_load_ps(other.elem[0]));
+	_mm_store_ps(elem[1], _mm_load_ps(other.elem[1]));
+	_mm_store_ps(elem[2], _mm_load_ps(other.elem[2]));
+	_mm_store_ps(elem[3], _mm_load_ps(other.elem[3]));
+
+#else // PS2MATH_BACKEND_SCALAR
 
 	memcpy(elem, other.elem, sizeof(float) * 16);
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline Matrix & Matrix::operator = (const Matrix & other)
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	asm volatile (
 		"lq $6, 0x00(%1) \n\t"
@@ -137,17 +144,25 @@ inline Matrix & Matrix::operator = (const Matrix & other)
 	);
 	return *this;
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	_mm_store_ps(elem[0], _mm_load_ps(other.elem[0]));
+	_mm_store_ps(elem[1], _mm_load_ps(other.elem[1]));
+	_mm_store_ps(elem[2], _mm_load_ps(other.elem[2]));
+	_mm_store_ps(elem[3], _mm_load_ps(other.elem[3]));
+	return *this;
+
+#else // PS2MATH_BACKEND_SCALAR
 
 	memcpy(elem, other.elem, sizeof(float) * 16);
 	return *this;
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline void Matrix::makeIdentity()
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	asm volatile (
 		"vsub.xyzw  vf4, vf0, vf0 \n\t"
@@ -162,14 +177,14 @@ inline void Matrix::makeIdentity()
 		: : "r" (elem)
 	);
 
-#else
+#else // !PS2MATH_USE_VU0
 
 	elem[0][0] = 1.0f;  elem[0][1] = 0.0f;  elem[0][2] = 0.0f;  elem[0][3] = 0.0f;
 	elem[1][0] = 0.0f;  elem[1][1] = 1.0f;  elem[1][2] = 0.0f;  elem[1][3] = 0.0f;
 	elem[2][0] = 0.0f;  elem[2][1] = 0.0f;  elem[2][2] = 1.0f;  elem[2][3] = 0.0f;
 	elem[3][0] = 0.0f;  elem[3][1] = 0.0f;  elem[3][2] = 0.0f;  elem[3][3] = 1.0f;
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline void Matrix::makeTranslation(const float x, const float y, const float z)
@@ -308,9 +323,26 @@ inline Matrix operator * (const float s, const Matrix & M)
 	              M(3,0) * s, M(3,1) * s, M(3,2) * s, M(3,3) * s);
 }
 
+#if PS2MATH_USE_SSE2
+namespace ps2math
+{
+
+// V.x * M[0] + V.y * M[1] + V.z * M[2] + V.w * M[3], with V in an SSE register.
+inline __m128 sse2Transform(const Matrix & M, const __m128 v)
+{
+	__m128 r = _mm_mul_ps(_mm_load_ps(M.elem[0]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(M.elem[1]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(M.elem[2]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(M.elem[3]), _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+	return r;
+}
+
+} // namespace ps2math {}
+#endif // PS2MATH_USE_SSE2
+
 inline Matrix operator * (const Matrix & M1, const Matrix & M2) // Matrix multiply
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	Matrix result;
 	asm volatile (
@@ -346,7 +378,17 @@ inline Matrix operator * (const Matrix & M1, const Matrix & M2) // Matrix multip
 	);
 	return result;
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	// Row i of the result is row i of M1 transformed by M2.
+	Matrix result;
+	_mm_store_ps(result.elem[0], ps2math::sse2Transform(M2, _mm_load_ps(M1.elem[0])));
+	_mm_store_ps(result.elem[1], ps2math::sse2Transform(M2, _mm_load_ps(M1.elem[1])));
+	_mm_store_ps(result.elem[2], ps2math::sse2Transform(M2, _mm_load_ps(M1.elem[2])));
+	_mm_store_ps(result.elem[3], ps2math::sse2Transform(M2, _mm_load_ps(M1.elem[3])));
+	return result;
+
+#else // PS2MATH_BACKEND_SCALAR
 
 	Matrix result;
 	for (int i = 0; i < 4; ++i)
@@ -363,12 +405,12 @@ inline Matrix operator * (const Matrix & M1, const Matrix & M2) // Matrix multip
 	}
 	return result;
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline Vector operator * (const Matrix & M, const Vector & V) // Transform point
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	Vector result;
 	asm volatile (
@@ -386,7 +428,11 @@ inline Vector operator * (const Matrix & M, const Vector & V) // Transform point
 	);
 	return result;
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	return ps2math::sse2Store(ps2math::sse2Transform(M, ps2math::sse2Load(V)));
+
+#else // PS2MATH_BACKEND_SCALAR
 
     Vector result;
 	result.x = M(0,0) * V.x + M(1,0) * V.y + M(2,0) * V.z + M(3,0) * V.w;
@@ -395,7 +441,7 @@ inline Vector operator * (const Matrix & M, const Vector & V) // Transform point
 	result.w = M(0,3) * V.x + M(1,3) * V.y + M(2,3) * V.z + M(3,3) * V.w;
     return result;
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline Matrix transpose(const Matrix & M)
@@ -105,9 +105,54 @@ inline Vector operator / (const Vector & v, const float s)
 	return Vector(v.x / s, v.y / s, v.z / s, 1.0f);
 }
 
+#if PS2MATH_USE_SSE2
+namespace ps2math
+{
+
+// Load/store a whole Vector in one SSE register.
+inline __m128 sse2Load(const Vector & v)
+{
+	return _mm_load_ps(&v.x);
+}
+
+inline Vector sse2Store(const __m128 r)
+{
+	Vector v;
+	_mm_store_ps(&v.x, r);
+	return v;
+}
+
+// Dot product of the XYZ components, result in the lowest lane.
+inline __m128 sse2Dot3(const __m128 a, const __m128 b)
+{
+	const __m128 m = _mm_mul_ps(a, b);
+	const __m128 y = _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1));
+	const __m128 z = _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2));
+	return _mm_add_ss(_mm_add_ss(m, y), z);
+}
+
+} // namespace ps2math {}
+#endif // PS2MATH_USE_SSE2
+
 inline Vector crossProduct(const Vector & v1, const Vector & v2)
 {
+#if PS2MATH_USE_SSE2
+
+	// (a * b.yzx - a.yzx * b).yzx
+	const __m128 a = ps2math::sse2Load(v1);
+	const __m128 b = ps2math::sse2Load(v2);
+	const __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+	Vector result = ps2math::sse2Store(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+	result.w = 1.0f;
+	return result;
+
+#else // !PS2MATH_USE_SSE2
+
 	return Vector(v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x, 1.0f);
+
+#endif // PS2MATH_USE_SSE2
 }
 
 inline float dotProduct4(const Vector & v1, const Vector & v2)
@@ -122,7 +167,19 @@ inline float dotProduct3(const Vector & v1, const Vector & v2)
 
 inline Vector normalize(const Vector & v)
 {
+#if PS2MATH_USE_SSE2
+
+	const __m128 a = ps2math::sse2Load(v);
+	const __m128 len = _mm_sqrt_ss(ps2math::sse2Dot3(a, a));
+	Vector result = ps2math::sse2Store(_mm_div_ps(a, _mm_shuffle_ps(len, len, _MM_SHUFFLE(0, 0, 0, 0))));
+	result.w = 1.0f;
+	return result;
+
+#else // !PS2MATH_USE_SSE2
+
 	return v / v.length();
+
+#endif // PS2MATH_USE_SSE2
 }
 
 inline float * toFloatPtr(Vector & v)
@@ -153,7 +210,7 @@ inline Vector max3PerElement(const Vector & vec0, const Vector & vec1)
 
 inline void lerp(Vector & v0, const Vector & v1, const Vector & v2, const float t)
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	asm volatile (
 		"lqc2      vf4, 0x0(%1)  \n\t" // vf4 = v1
@@ -168,19 +225,26 @@ inline void lerp(Vector & v0, const Vector & v1, const Vector & v2, const float
 		: "$8"
 	);
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	const __m128 a = ps2math::sse2Load(v1);
+	const __m128 b = ps2math::sse2Load(v2);
+	_mm_store_ps(&v0.x, _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(t))));
+	// v0.w is undefined!
+
+#else // PS2MATH_BACKEND_SCALAR
 
 	v0.x = v1.x + t * (v2.x - v1.x);
 	v0.y = v1.y + t * (v2.y - v1.y);
 	v0.z = v1.z + t * (v2.z - v1.z);
 	// v0.w is undefined!
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline void lerpScale(Vector & v0, const Vector & v1, const Vector & v2, const float t, const float s)
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	asm volatile (
 		"mfc1      $8,  %3       \n\t"
@@ -198,7 +262,15 @@ inline void lerpScale(Vector & v0, const Vector & v1, const Vector & v2, const f
 		: "$8", "$9"
 	);
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	const __m128 a = ps2math::sse2Load(v1);
+	const __m128 b = ps2math::sse2Load(v2);
+	const __m128 r = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), _mm_set1_ps(t)));
+	_mm_store_ps(&v0.x, _mm_mul_ps(r, _mm_set1_ps(s)));
+	// v0.w is undefined!
+
+#else // PS2MATH_BACKEND_SCALAR
 
 	v0.x = v1.x + t * (v2.x - v1.x);
 	v0.y = v1.y + t * (v2.y - v1.y);
@@ -208,12 +280,12 @@ inline void lerpScale(Vector & v0, const Vector & v1, const Vector & v2, const f
 	v0.z *= s;
 	// v0.w is undefined!
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline float distanceSqr(const Vector & a, const Vector & b)
 {
-#if 1
+#if PS2MATH_USE_VU0
 
 	register float dist;
 	asm volatile (
@@ -231,11 +303,16 @@ inline float distanceSqr(const Vector & a, const Vector & b)
 	);
 	return dist;
 
-#else
+#elif PS2MATH_USE_SSE2
+
+	const __m128 d = _mm_sub_ps(ps2math::sse2Load(a), ps2math::sse2Load(b));
+	return _mm_cvtss_f32(ps2math::sse2Dot3(d, d));
+
+#else // PS2MATH_BACKEND_SCALAR
 
 	return (a - b).lengthSqr();
 
-#endif
+#endif // PS2MATH_USE_VU0
 }
 
 inline Vector lerp(const Vector & v1, const Vector & v2, const float t)
@@ -342,12 +419,12 @@ inline Vector Vector::cross(const Vector & rhs) const
 
 inline Vector Vector::normalized() const
 {
-	return (*this) / length();
+	return normalize(*this);
 }
 
 inline void Vector::normalizeSelf()
 {
-	(*this) /= length();
+	(*this) = normalize(*this);
 }
 
 inline void Vector::clampLength(const float minLength, const float maxLength)
@@ -0,0 +1,271 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: xform_batch.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Batched point and bounding box transforms.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#include "../common.hpp" // For the helpers used by aabb.hpp
+#include "xform_batch.hpp"
+#include "aabb.hpp"
+
+// ========================================================
+// Local helpers:
+// ========================================================
+
+#if PS2MATH_USE_SSE2
+
+// in.x * r0 + in.y * r1 + in.z * r2 + in.w * r3
+static inline __m128 sse2TransformRows(const __m128 r0, const __m128 r1, const __m128 r2, const __m128 r3, const __m128 v)
+{
+	__m128 r = _mm_mul_ps(r0, _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+	r = _mm_add_ps(r, _mm_mul_ps(r1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+	r = _mm_add_ps(r, _mm_mul_ps(r2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+	r = _mm_add_ps(r, _mm_mul_ps(r3, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+	return r;
+}
+
+#endif // PS2MATH_USE_SSE2
+
+// ========================================================
+// transformPoints():
+// ========================================================
+
+void transformPoints(Vector * out, const Matrix & m, const void * in, const unsigned int inStride, const unsigned int count)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	const unsigned char * src = reinterpret_cast<const unsigned char *>(in);
+
+#if PS2MATH_USE_VU0
+
+	// Matrix stays in vf4-vf7. The next point is loaded
+	// while the FMAC is still working on the current one.
+	unsigned int n = count;
+	asm volatile (
+		"lqc2         vf4,  0x00(%3)   \n\t"
+		"lqc2         vf5,  0x10(%3)   \n\t"
+		"lqc2         vf6,  0x20(%3)   \n\t"
+		"lqc2         vf7,  0x30(%3)   \n\t"
+		"lqc2         vf8,  0x00(%1)   \n\t" // vf8 = first point
+		"1:                            \n\t"
+		"vmulax.xyzw  ACC,  vf4,  vf8  \n\t"
+		"vmadday.xyzw ACC,  vf5,  vf8  \n\t"
+		"vmaddaz.xyzw ACC,  vf6,  vf8  \n\t"
+		"vmaddw.xyzw  vf9,  vf7,  vf8  \n\t" // vf9 = m * vf8
+		"addiu        %2,   %2,   -1   \n\t"
+		"beqz         %2,   2f         \n\t"
+		"addu         %1,   %1,   %4   \n\t"
+		"lqc2         vf8,  0x00(%1)   \n\t" // vf8 = next point
+		"2:                            \n\t"
+		"sqc2         vf9,  0x00(%0)   \n\t"
+		"addiu        %0,   %0,   0x10 \n\t"
+		"bnez         %2,   1b         \n\t"
+		: "+r" (out), "+r" (src), "+r" (n)
+		: "r" (&m), "r" (inStride)
+		: "memory"
+	);
+
+#elif PS2MATH_USE_SSE2
+
+	const __m128 r0 = _mm_load_ps(m.elem[0]);
+	const __m128 r1 = _mm_load_ps(m.elem[1]);
+	const __m128 r2 = _mm_load_ps(m.elem[2]);
+	const __m128 r3 = _mm_load_ps(m.elem[3]);
+	for (unsigned int i = 0; i < count; ++i, src += inStride)
+	{
+		const __m128 v = _mm_load_ps(reinterpret_cast<const float *>(src));
+		_mm_store_ps(&out[i].x, sse2TransformRows(r0, r1, r2, r3, v));
+	}
+
+#else // PS2MATH_BACKEND_SCALAR
+
+	for (unsigned int i = 0; i < count; ++i, src += inStride)
+	{
+		out[i] = m * (*reinterpret_cast<const Vector *>(src));
+	}
+
+#endif // PS2MATH_USE_VU0
+}
+
+// ========================================================
+// transformProjectPoints():
+// ========================================================
+
+void transformProjectPoints(Vector * out, const Matrix & m, const void * in, const unsigned int inStride, const unsigned int count)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	const unsigned char * src = reinterpret_cast<const unsigned char *>(in);
+
+#if PS2MATH_USE_VU0
+
+	// Same as above, plus the divide. The next point
+	// is loaded while the DIV unit computes Q.
+	unsigned int n = count;
+	asm volatile (
+		"lqc2         vf4,  0x00(%3)   \n\t"
+		"lqc2         vf5,  0x10(%3)   \n\t"
+		"lqc2         vf6,  0x20(%3)   \n\t"
+		"lqc2         vf7,  0x30(%3)   \n\t"
+		"lqc2         vf8,  0x00(%1)   \n\t" // vf8 = first point
+		"1:                            \n\t"
+		"vmulax.xyzw  ACC,  vf4,  vf8  \n\t"
+		"vmadday.xyzw ACC,  vf5,  vf8  \n\t"
+		"vmaddaz.xyzw ACC,  vf6,  vf8  \n\t"
+		"vmaddw.xyzw  vf9,  vf7,  vf8  \n\t" // vf9 = m * vf8
+		"vdiv         Q,    vf0w, vf9w \n\t" // Q   = 1 / vf9.w
+		"addiu        %2,   %2,   -1   \n\t"
+		"beqz         %2,   2f         \n\t"
+		"addu         %1,   %1,   %4   \n\t"
+		"lqc2         vf8,  0x00(%1)   \n\t" // vf8 = next point
+		"2:                            \n\t"
+		"vwaitq                        \n\t"
+		"vmulq.xyz    vf9,  vf9,  Q    \n\t" // vf9.xyz *= Q
+		"vmulq.w      vf9,  vf0,  Q    \n\t" // vf9.w    = Q
+		"sqc2         vf9,  0x00(%0)   \n\t"
+		"addiu        %0,   %0,   0x10 \n\t"
+		"bnez         %2,   1b         \n\t"
+		: "+r" (out), "+r" (src), "+r" (n)
+		: "r" (&m), "r" (inStride)
+		: "memory"
+	);
+
+#elif PS2MATH_USE_SSE2
+
+	const __m128 r0  = _mm_load_ps(m.elem[0]);
+	const __m128 r1  = _mm_load_ps(m.elem[1]);
+	const __m128 r2  = _mm_load_ps(m.elem[2]);
+	const __m128 r3  = _mm_load_ps(m.elem[3]);
+	const __m128 one = _mm_set1_ps(1.0f);
+	for (unsigned int i = 0; i < count; ++i, src += inStride)
+	{
+		const __m128 v = sse2TransformRows(r0, r1, r2, r3, _mm_load_ps(reinterpret_cast<const float *>(src)));
+		const __m128 q = _mm_div_ps(one, _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+		_mm_store_ps(&out[i].x, _mm_mul_ps(v, q));
+		_mm_store_ss(&out[i].w, q);
+	}
+
+#else // PS2MATH_BACKEND_SCALAR
+
+	for (unsigned int i = 0; i < count; ++i, src += inStride)
+	{
+		const Vector v = m * (*reinterpret_cast<const Vector *>(src));
+		const float q = 1.0f / v.w;
+		out[i] = Vector(v.x * q, v.y * q, v.z * q, q);
+	}
+
+#endif // PS2MATH_USE_VU0
+}
+
+// ========================================================
+// transformAabbs():
+// ========================================================
+
+void transformAabbs(Aabb * out, const Matrix & m, const Aabb * in, const unsigned int count)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+#if PS2MATH_USE_VU0
+
+	// Matrix in vf4-vf7, its absolute value in vf10-vf12 and 0.5 in vf15.x.
+	const float half = 0.5f;
+	unsigned int n = count;
+	asm volatile (
+		"mfc1         $8,   %4          \n\t"
+		"qmtc2        $8,   vf15        \n\t"
+		"lqc2         vf4,  0x00(%3)    \n\t"
+		"lqc2         vf5,  0x10(%3)    \n\t"
+		"lqc2         vf6,  0x20(%3)    \n\t"
+		"lqc2         vf7,  0x30(%3)    \n\t"
+		"vabs.xyz     vf10, vf4         \n\t"
+		"vabs.xyz     vf11, vf5         \n\t"
+		"vabs.xyz     vf12, vf6         \n\t"
+		"1:                             \n\t"
+		"lqc2         vf8,  0x00(%1)    \n\t" // vf8  = mins
+		"lqc2         vf9,  0x10(%1)    \n\t" // vf9  = maxs
+		"vadd.xyz     vf13, vf9,  vf8   \n\t"
+		"vsub.xyz     vf14, vf9,  vf8   \n\t"
+		"vmulx.xyz    vf13, vf13, vf15  \n\t" // vf13 = center
+		"vmulx.xyz    vf14, vf14, vf15  \n\t" // vf14 = extents
+		"vmove.w      vf13, vf0         \n\t"
+		"vmulax.xyzw  ACC,  vf4,  vf13  \n\t"
+		"vmadday.xyzw ACC,  vf5,  vf13  \n\t"
+		"vmaddaz.xyzw ACC,  vf6,  vf13  \n\t"
+		"vmaddw.xyzw  vf16, vf7,  vf13  \n\t" // vf16 = m * center
+		"vmulax.xyz   ACC,  vf10, vf14  \n\t"
+		"vmadday.xyz  ACC,  vf11, vf14  \n\t"
+		"vmaddz.xyz   vf17, vf12, vf14  \n\t" // vf17 = abs(m) * extents
+		"addiu        %2,   %2,   -1    \n\t"
+		"addiu        %1,   %1,   0x20  \n\t"
+		"vsub.xyz     vf18, vf16, vf17  \n\t"
+		"vadd.xyz     vf19, vf16, vf17  \n\t"
+		"vmove.w      vf18, vf0         \n\t"
+		"vmove.w      vf19, vf0         \n\t"
+		"sqc2         vf18, 0x00(%0)    \n\t"
+		"sqc2         vf19, 0x10(%0)    \n\t"
+		"addiu        %0,   %0,   0x20  \n\t"
+		"bnez         %2,   1b          \n\t"
+		: "+r" (out), "+r" (in), "+r" (n)
+		: "r" (&m), "f" (half)
+		: "$8", "memory"
+	);
+
+#else // !PS2MATH_USE_VU0
+
+	// Absolute value of the rotation and scale part, for the extents.
+	Matrix absM;
+	for (int i = 0; i < 4; ++i)
+	{
+		for (int j = 0; j < 4; ++j)
+		{
+			absM(i, j) = (i < 3 && j < 3) ? ps2math::abs(m(i, j)) : 0.0f;
+		}
+	}
+
+	for (unsigned int i = 0; i < count; ++i)
+	{
+		const Vector center  = (in[i].maxs + in[i].mins) * 0.5f;
+		const Vector extents = (in[i].maxs - in[i].mins) * 0.5f;
+		const Vector tCenter  = m * center;
+		const Vector tExtents = absM * extents;
+		out[i].mins = tCenter - tExtents;
+		out[i].maxs = tCenter + tExtents;
+	}
+
+#endif // PS2MATH_USE_VU0
+}
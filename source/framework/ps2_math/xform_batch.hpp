@@ -0,0 +1,82 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: xform_batch.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Batched point and bounding box transforms.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+#ifndef PS2MATH_XFORM_BATCH_HPP
+#define PS2MATH_XFORM_BATCH_HPP
+
+#include "matrix.hpp"
+
+struct Aabb;
+
+// ========================================================
+// Batched transforms:
+// ========================================================
+
+//
+// Same as `m * in[i]` for each point, but the matrix is loaded
+// only once for the whole batch and, on the VU0, the load of the next
+// point overlaps the math of the current one. Input points are read
+// `inStride` bytes apart, so the position of an interleaved vertex can
+// be passed directly. They must be 16 bytes aligned and W is used as is
+// (so it should be 1). The output is a tightly packed array of Vectors.
+// `out` can be the same array as `in` if the stride is `sizeof(Vector)`.
+//
+void transformPoints(Vector * out, const Matrix & m, const void * in, unsigned int inStride, unsigned int count);
+
+//
+// transformPoints() followed by the perspective divide:
+// out.xyz = xyz / w and out.w = 1 / w (the "Q" of the GS).
+// W is not tested for zero. Points behind the eye get a negative Q.
+//
+void transformProjectPoints(Vector * out, const Matrix & m, const void * in, unsigned int inStride, unsigned int count);
+
+//
+// Transforms each box and outputs the bounds of its 8 transformed
+// corners, so the result is still a valid AABB after a rotation.
+// Done with the transformed center plus the extents transformed by
+// the absolute value of the matrix, so `m` must be affine
+// (last column 0,0,0,1). `out` can be the same array as `in`.
+//
+void transformAabbs(Aabb * out, const Matrix & m, const Aabb * in, unsigned int count);
+
+// Shorthand for tightly packed Vector arrays.
+inline void transformPoints(Vector * out, const Matrix & m, const Vector * in, const unsigned int count)
+{
+	transformPoints(out, m, in, sizeof(Vector), count);
+}
+
+inline void transformProjectPoints(Vector * out, const Matrix & m, const Vector * in, const unsigned int count)
+{
+	transformProjectPoints(out, m, in, sizeof(Vector), count);
+}
+
+#endif // PS2MATH_XFORM_BATCH_HPP
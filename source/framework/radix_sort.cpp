@@ -0,0 +1,179 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: radix_sort.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: LSD radix sort for integer and float keys with an attached 16-bit value.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#include "radix_sort.hpp"
+
+// Number of buckets for each 8-bit digit.
+static const uint RADIX_BUCKETS = 256;
+
+// Below this many elements an insertion sort beats the histogram setup.
+static const uint RADIX_MIN_COUNT = 32;
+
+// ========================================================
+// insertionSortKeys():
+// ========================================================
+
+template<class KEY>
+static void insertionSortKeys(KEY * keys, uint16 * values, const uint count)
+{
+	for (uint i = 1; i < count; ++i)
+	{
+		const KEY key = keys[i];
+		const uint16 value = (values != nullptr) ? values[i] : 0;
+
+		// Strict compare keeps it stable.
+		uint j = i;
+		for (; j > 0 && keys[j - 1] > key; --j)
+		{
+			keys[j] = keys[j - 1];
+			if (values != nullptr)
+			{
+				values[j] = values[j - 1];
+			}
+		}
+
+		keys[j] = key;
+		if (values != nullptr)
+		{
+			values[j] = value;
+		}
+	}
+}
+
+// ========================================================
+// radixSortImpl():
+// ========================================================
+
+template<class KEY>
+static void radixSortImpl(KEY * keys, uint16 * values, KEY * scratchKeys, uint16 * scratchValues, const uint count)
+{
+	ps2assert(keys != nullptr);
+	ps2assert(scratchKeys != nullptr);
+	ps2assert(values == nullptr || scratchValues != nullptr);
+
+	if (count < RADIX_MIN_COUNT)
+	{
+		insertionSortKeys(keys, values, count);
+		return;
+	}
+
+	static const uint PASSES = sizeof(KEY);
+
+	// Histograms for all digits are gathered in a single read of the keys.
+	uint32 histograms[PASSES][RADIX_BUCKETS] ATTRIBUTE_ALIGNED(16);
+	memset(histograms, 0, sizeof(histograms));
+
+	for (uint i = 0; i < count; ++i)
+	{
+		const KEY key = keys[i];
+		for (uint pass = 0; pass < PASSES; ++pass)
+		{
+			++histograms[pass][(key >> (pass * 8)) & 0xFF];
+		}
+	}
+
+	KEY    * srcKeys   = keys;
+	uint16 * srcValues = values;
+	KEY    * dstKeys   = scratchKeys;
+	uint16 * dstValues = (values != nullptr) ? scratchValues : nullptr;
+
+	for (uint pass = 0; pass < PASSES; ++pass)
+	{
+		const uint shift = pass * 8;
+		uint32 * offsets = histograms[pass];
+
+		// Every key lands in the same bucket: the pass would just copy.
+		if (offsets[(srcKeys[0] >> shift) & 0xFF] == count)
+		{
+			continue;
+		}
+
+		// Bucket counts to starting offsets:
+		uint32 sum = 0;
+		for (uint b = 0; b < RADIX_BUCKETS; ++b)
+		{
+			const uint32 bucketCount = offsets[b];
+			offsets[b] = sum;
+			sum += bucketCount;
+		}
+
+		// Scatter in input order, which is what keeps it stable.
+		if (srcValues != nullptr)
+		{
+			for (uint i = 0; i < count; ++i)
+			{
+				const KEY key = srcKeys[i];
+				const uint32 dest = offsets[(key >> shift) & 0xFF]++;
+				dstKeys[dest]   = key;
+				dstValues[dest] = srcValues[i];
+			}
+		}
+		else
+		{
+			for (uint i = 0; i < count; ++i)
+			{
+				const KEY key = srcKeys[i];
+				dstKeys[offsets[(key >> shift) & 0xFF]++] = key;
+			}
+		}
+
+		swap(srcKeys,   dstKeys);
+		swap(srcValues, dstValues);
+	}
+
+	// Odd number of passes done, result is in the scratch buffers.
+	if (srcKeys != keys)
+	{
+		memcpy(keys, srcKeys, count * sizeof(KEY));
+		if (values != nullptr)
+		{
+			memcpy(values, srcValues, count * sizeof(uint16));
+		}
+	}
+}
+
+// ========================================================
+// radixSort32():
+// ========================================================
+
+void radixSort32(uint32 * keys, uint16 * values, uint32 * scratchKeys, uint16 * scratchValues, const uint count)
+{
+	radixSortImpl(keys, values, scratchKeys, scratchValues, count);
+}
+
+// ========================================================
+// radixSort16():
+// ========================================================
+
+void radixSort16(uint16 * keys, uint16 * values, uint16 * scratchKeys, uint16 * scratchValues, const uint count)
+{
+	radixSortImpl(keys, values, scratchKeys, scratchValues, count);
+}
@@ -0,0 +1,86 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: radix_sort.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: LSD radix sort for integer and float keys with an attached 16-bit value.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include "common.hpp"
+
+// ========================================================
+// Radix sort keys:
+// ========================================================
+
+// Maps a float to an unsigned integer with the same ordering, so floats
+// can be radix sorted as integers. Positive floats get the sign bit set,
+// negative ones get all bits flipped, so they sort in reverse.
+inline uint32 radixKeyFromFloat(const float f)
+{
+	union { float f; uint32 u; } bits;
+	bits.f = f;
+	const uint32 mask = scast<uint32>(-scast<int32>(bits.u >> 31)) | 0x80000000;
+	return bits.u ^ mask;
+}
+
+// Inverse of `radixKeyFromFloat()`.
+inline float floatFromRadixKey(const uint32 key)
+{
+	union { float f; uint32 u; } bits;
+	const uint32 mask = ((key >> 31) - 1) | 0x80000000;
+	bits.u = key ^ mask;
+	return bits.f;
+}
+
+// Key that sorts floats from largest to smallest (e.g. back-to-front by distance).
+inline uint32 radixKeyFromFloatDescending(const float f)
+{
+	return ~radixKeyFromFloat(f);
+}
+
+// ========================================================
+// radixSort32() / radixSort16():
+// ========================================================
+
+//
+// Stable LSD radix sorts, one 8-bit digit per pass. Each key carries
+// a 16-bit value along (usually the index of the element the key was
+// made from), so `values` holds the sorted order of the elements.
+// `values` may be null to sort only the keys.
+//
+// Sorting ping-pongs between the arrays and the scratch buffers, which
+// must have room for `count` entries, but the result always ends up back
+// in `keys` and `values`. Passes where all keys have the same digit are
+// skipped, so keys with a few significant bits sort in fewer passes.
+// Very small arrays are insertion sorted instead.
+//
+void radixSort32(uint32 * keys, uint16 * values, uint32 * scratchKeys, uint16 * scratchValues, uint count);
+void radixSort16(uint16 * keys, uint16 * values, uint16 * scratchKeys, uint16 * scratchValues, uint count);
+
+#endif // RADIX_SORT_HPP
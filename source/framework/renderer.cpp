@@ -31,6 +31,8 @@
 // ================================================================================================
 
 #include "renderer.hpp"
+#include "scratchpad.hpp"
+#include "ps2_math/xform_batch.hpp"
 
 // C/C++ libraries:
 #include <cctype>
@@ -51,15 +53,6 @@
 //
 enum
 {
-	// 16 Kilobytes (16384 bytes).
-	SCRATCH_PAD_SIZE_BYTES = 0x4000,
-
-	// 1024 128bit quadwords.
-	SCRATCH_PAD_SIZE_QWORDS = SCRATCH_PAD_SIZE_BYTES / sizeof(qword_t),
-
-	// The Scratch Pad (SPR) R/W memory is at a fixed address.
-	SCRATCH_PAD_ADDRESS = 0x70000000,
-
 	// ORing a pointer with this mask sets it to Uncached Accelerated (UCAB) space.
 	UCAB_MEM_MASK = 0x30000000
 };
@@ -86,6 +79,25 @@ enum
 	DMATAG_END(_dma_tag_, (qwordPtr) - _dma_tag_ - 1, 0, 0, 0); \
 	_dma_tag_ = nullptr
 
+//
+// Text sprite list helpers:
+//
+
+// Registers written for each text glyph vertex (the glyph sprite has 2).
+#define TEXT_UV_XYZ_REGLIST \
+	(((uint64)GIF_REG_UV) << 0 | ((uint64)GIF_REG_XYZ2) << 4)
+
+// Pixel center offsets for the top-left and bottom-right corners of
+// 2D rectangles, same as the ones used by the draw library.
+static const float TEXT_START_OFFSET = 2047.5625f;
+static const float TEXT_END_OFFSET   = 2048.5625f;
+
+// Float to 12:4 fixed-point, as used by the GS for XY coordinates.
+static inline int toFixed4(const float f)
+{
+	return scast<int>(f * 16.0f);
+}
+
 // ================================================================================================
 // RenderPacket implementation:
 // ================================================================================================
@@ -127,13 +139,15 @@ void RenderPacket::init(const uint quadwords, const Type packetType)
 
 	if (type == SPR) // Use Scratch Pad memory:
 	{
-		if (quadwords > SCRATCH_PAD_SIZE_QWORDS)
+		// Taken from the Scratch Pad stack and never given back,
+		// so create SPR packets before any scoped SPR allocations.
+		qwordBuffer = gScratchPad.alloc<qword_t>(quadwords);
+		if (qwordBuffer == nullptr)
 		{
-			fatalError("Scratch Pad memory can only fit up to %u quadwords!", SCRATCH_PAD_SIZE_QWORDS);
+			fatalError("Scratch Pad memory can only fit %u more quadwords!", gScratchPad.getBytesFree() / 16);
 		}
 
-		rcast<uint32 *>(qwordBuffer) = SCRATCH_PAD_ADDRESS;
-		qwordCount = SCRATCH_PAD_SIZE_QWORDS;
+		qwordCount = quadwords;
 	}
 	else // Allocate from global heap:
 	{
@@ -223,15 +237,27 @@ Renderer::Renderer()
 	: currentFramePacket(nullptr)
 	, currentFrameQwPtr(nullptr)
 	, dmaTagDraw2d(nullptr)
+	, textListStart(nullptr)
+	, textListPtr(nullptr)
+	, textPacketStart(nullptr)
+	, textPacketFlushes(0)
 	, currentTex(nullptr)
 	, frameIndex(0)
 	, vramUserTextureStart(0)
 	, drawCount2d(0)
 	, drawCount3d(0)
 	, trisCount3d(0)
+	, spriteCount3d(0)
+	, glyphCount2d(0)
+	, qwordCount2d(0)
+	, prevQwordCount2d(0)
+	, textCacheHits(0)
+	, textCacheMisses(0)
+	, textCacheBytes(0)
 	, texSwitches(0)
 	, pipeFlushes(0)
 	, globalTextScale(1.0f)
+	, sdfFontPixels(nullptr)
 	, inMode2d(false)
 	, inMode3d(false)
 {
@@ -249,6 +275,7 @@ Renderer::Renderer()
 
 Renderer::~Renderer()
 {
+	memFree(MEM_TAG_RENDERER, sdfFontPixels); // Was allocated with `memClearedAlloc()`
 	rendererInitialized = false;
 	videoInitialized    = false;
 }
@@ -329,6 +356,7 @@ bool Renderer::initVideoGraphics(const int scrW, const int scrH, const int vidMo
 	invModelMatrix.makeIdentity();
 	vpMatrix.makeIdentity();
 	mvpMatrix.makeIdentity();
+	screenMvpMatrix.makeIdentity(); // Updated by setModelMatrix()
 
 	eyePosition = Vector(0.0f, 0.0f, 0.0f, 1.0f);
 	eyePosModelSpace = eyePosition;
@@ -449,14 +477,27 @@ void Renderer::beginFrame()
 	ps2assert(!inMode3d && "Missing end3d() call!");
 	ps2assert(frameIndex == 0 || frameIndex == 1);
 
+	// 2D packet size is only known after the 2D
+	// passes, so the stats show the previous frame's.
+	prevQwordCount2d = qwordCount2d;
+
 	drawCount2d = 0;
 	drawCount3d = 0;
 	trisCount3d = 0;
+	spriteCount3d = 0;
+	glyphCount2d = 0;
+	qwordCount2d = 0;
+	textCacheHits = 0;
+	textCacheMisses = 0;
+	textCacheBytes = 0;
 	texSwitches = 0;
 	pipeFlushes = 0;
 
 	currentFramePacket = &framePackets[frameIndex];
 	currentFrameQwPtr  = currentFramePacket->getQwordPtr();
+
+	// Transient allocations from two frames ago can now be recycled.
+	gFrameAllocator.beginFrame();
 }
 
 // ========================================================
@@ -477,6 +518,9 @@ void Renderer::endFrame()
 	dma_channel_send_chain(DMA_CHANNEL_GIF, currentFramePacket->getQwordPtr(),
 		currentFramePacket->getDisplacement(currentFrameQwPtr), 0, 0);
 
+	// Print the deferred log messages while the GS draws the frame.
+	logFlush();
+
 	// V-Sync wait:
 	graph_wait_vsync();
 	draw_wait_finish();
@@ -549,8 +593,17 @@ void Renderer::resetFrameStates()
 	drawCount2d = 0;
 	drawCount3d = 0;
 	trisCount3d = 0;
+	spriteCount3d = 0;
+	glyphCount2d = 0;
+	qwordCount2d = 0;
+	prevQwordCount2d = 0;
+	textCacheHits = 0;
+	textCacheMisses = 0;
+	textCacheBytes = 0;
 	texSwitches = 0;
 	pipeFlushes = 0;
+	textListPtr = nullptr;
+	textPacketStart = nullptr;
 	inMode2d    = false;
 	inMode3d    = false;
 
@@ -558,6 +611,7 @@ void Renderer::resetFrameStates()
 	invModelMatrix.makeIdentity();
 	vpMatrix.makeIdentity();
 	mvpMatrix.makeIdentity();
+	screenMvpMatrix.makeIdentity(); // Updated by setModelMatrix()
 
 	eyePosition = Vector(0.0f, 0.0f, 0.0f, 1.0f);
 	eyePosModelSpace = eyePosition;
@@ -659,6 +713,8 @@ void Renderer::setTexture(const Texture & tex)
 		return; // Avoid redundant state changes.
 	}
 
+	flushTextList();
+
 	currentTex = ccast<Texture *>(&tex);
 	ps2assert(currentTex->getPixels() != nullptr && "No pixel data associated with texture!");
 	ps2assert(currentTex->getTexBuffer().address == uint(vramUserTextureStart));
@@ -679,6 +735,16 @@ void Renderer::setTexture(const Texture & tex)
 	qword_t * q = textureUploadPacket[frameIndex].getQwordPtr();
 
 	q = draw_texture_transfer(q, pixels, width, height, psm, vramUserTextureStart, width);
+
+	// Palettized textures also carry their CLUT (16x16 RGBA32 colors for 8-bit):
+	const uint32 * clutColors = currentTex->getClutColors();
+	if (clutColors != nullptr)
+	{
+		ps2assert(psm == GS_PSM_8 && "Only 8-bit CLUTs are supported!");
+		q = draw_texture_transfer(q, ccast<uint32 *>(clutColors), 16, 16,
+				GS_PSM_32, currentTex->getTexClut().address, 64);
+	}
+
 	q = draw_texture_flush(q);
 
 	dma_channel_send_chain(DMA_CHANNEL_GIF, textureUploadPacket[frameIndex].getQwordPtr(),
@@ -792,6 +858,29 @@ void Renderer::setPrimBlending(const bool enable)
 	primDesc.blending = enable ? DRAW_ENABLE : DRAW_DISABLE;
 }
 
+// ========================================================
+// Renderer::setPrimAdditiveBlending():
+// ========================================================
+
+void Renderer::setPrimAdditiveBlending(const bool enable)
+{
+	ps2assert(currentFrameQwPtr != nullptr);
+
+	// GS blend equation: ((A - B) * C >> 7) + D
+	// Default alpha blending is (Cs - Cd) * As + Cd,
+	// additive drops the B term: (Cs - 0) * As + Cd.
+	blend_t blend;
+	blend.color1      = BLEND_COLOR_SOURCE;
+	blend.color2      = enable ? BLEND_COLOR_ZERO : BLEND_COLOR_DEST;
+	blend.alpha       = BLEND_ALPHA_SOURCE;
+	blend.color3      = BLEND_COLOR_DEST;
+	blend.fixed_alpha = 0x80;
+
+	BEGIN_DMA_TAG(currentFrameQwPtr);
+	currentFrameQwPtr = draw_alpha_blending(currentFrameQwPtr, 0, &blend);
+	END_DMA_TAG(currentFrameQwPtr);
+}
+
 // ========================================================
 // Renderer::setPrimAntialiasing():
 // ========================================================
@@ -843,6 +932,19 @@ void Renderer::setPrimBaseColor(const ubyte r, const ubyte g, const ubyte b, con
 // Vertex transformation and clipping routines (raw text include):
 #include "vertex_xform.h"
 
+// Used by the batched draws when neither the Scratch Pad nor the frame
+// allocator have room for the transformed positions. The draw then goes
+// one batch of XFORM_BATCH_VERTS at a time through these, never dropped.
+static Vector           xformFallbackPositions[XFORM_BATCH_VERTS * 2];
+static DrawVertex       xformFallbackVerts[XFORM_BATCH_VERTS];
+static PackedDrawVertex xformFallbackPackedVerts[XFORM_BATCH_VERTS];
+
+static void warnXformFallback(const char * drawName, const uint vertCount)
+{
+	logWarning("%s: No memory to transform %u vertexes, drawing in batches of %u.",
+	           drawName, vertCount, XFORM_BATCH_VERTS);
+}
+
 // ========================================================
 // Renderer::begin3d():
 // ========================================================
@@ -898,6 +1000,7 @@ void Renderer::setModelMatrix(const Matrix & m)
 {
 	modelMatrix = m;
 	mvpMatrix   = modelMatrix * vpMatrix;
+	makeScreenMvpMatrix(screenMvpMatrix, mvpMatrix);
 
 	inverseMatrix(&invModelMatrix, &modelMatrix);
 	applyXForm(&eyePosModelSpace, &invModelMatrix, &eyePosition);
@@ -937,22 +1040,28 @@ void Renderer::drawUnindexedTriangles(const DrawVertex * restrict verts, const u
 		fatalError("drawUnindexedTriangles(%u) => vertCount must be evenly divisible by 3!", vertCount);
 	}
 
+	// Positions are transformed and projected a batch of triangles at a time.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	Vector * restrict tPositions = sprOrFrameAlloc<Vector>(XFORM_BATCH_VERTS);
+	if (tPositions == nullptr)
+	{
+		warnXformFallback("drawUnindexedTriangles", vertCount);
+		tPositions = xformFallbackPositions;
+	}
+
 	DRAW3D_PROLOGUE();
 
 	uint trisSentToGs = 0;
-	const uint triCount = vertCount / 3;
-
-	for (uint t = 0; t < triCount; ++t)
+	for (uint first = 0; first < vertCount; first += XFORM_BATCH_VERTS)
 	{
-		const DrawVertex & v0 = verts[(t * 3) + 0];
-		const DrawVertex & v1 = verts[(t * 3) + 1];
-		const DrawVertex & v2 = verts[(t * 3) + 2];
-		XFORM_TRIANGLE(v0, v1, v2); // Includes clipping and back-face culling.
-		++trisSentToGs;
+		trisSentToGs += drawTriangleBatch(packetPtr, verts + first, xformBatchSize(first, vertCount),
+		                                  screenMvpMatrix, eyePosModelSpace, tPositions);
 	}
 
 	DRAW3D_EPILOGUE();
 	trisCount3d += trisSentToGs;
+	gFrameAllocator.rewind(frameMark);
 }
 
 // ========================================================
@@ -974,6 +1083,27 @@ void Renderer::drawIndexedTriangles(const uint16 * restrict indexes, const uint
 		fatalError("drawIndexedTriangles(%u) => indexCount must be evenly divisible by 3!", indexCount);
 	}
 
+	// Each vertex is transformed and projected once, even if shared by several triangles.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	Vector * restrict tPositions = sprOrFrameAlloc<Vector>(vertCount);
+	if (tPositions == nullptr)
+	{
+		// Out of room: expand the triangles a batch at a time and draw them unindexed.
+		warnXformFallback("drawIndexedTriangles", vertCount);
+		for (uint first = 0; first < indexCount; first += XFORM_BATCH_VERTS)
+		{
+			const uint batchVerts = xformBatchSize(first, indexCount);
+			for (uint i = 0; i < batchVerts; ++i)
+			{
+				xformFallbackVerts[i] = verts[indexes[first + i]];
+			}
+			drawUnindexedTriangles(xformFallbackVerts, batchVerts);
+		}
+		return;
+	}
+	transformProjectPoints(tPositions, screenMvpMatrix, &verts->position, sizeof(DrawVertex), vertCount);
+
 	DRAW3D_PROLOGUE();
 
 	uint trisSentToGs = 0;
@@ -981,15 +1111,20 @@ void Renderer::drawIndexedTriangles(const uint16 * restrict indexes, const uint
 
 	for (uint t = 0; t < triCount; ++t)
 	{
-		const DrawVertex & v0 = verts[indexes[(t * 3) + 0]];
-		const DrawVertex & v1 = verts[indexes[(t * 3) + 1]];
-		const DrawVertex & v2 = verts[indexes[(t * 3) + 2]];
-		XFORM_TRIANGLE(v0, v1, v2); // Includes clipping and back-face culling.
+		const uint index0 = indexes[(t * 3) + 0];
+		const uint index1 = indexes[(t * 3) + 1];
+		const uint index2 = indexes[(t * 3) + 2];
+		const DrawVertex & v0 = verts[index0];
+		const DrawVertex & v1 = verts[index1];
+		const DrawVertex & v2 = verts[index2];
+		TRIANGLE_BACK_FACE_CULL(v0.position, v1.position, v2.position);
+		EMIT_PROJECTED_TRIANGLE(v0, v1, v2, tPositions[index0], tPositions[index1], tPositions[index2]);
 		++trisSentToGs;
 	}
 
 	DRAW3D_EPILOGUE();
 	trisCount3d += trisSentToGs;
+	gFrameAllocator.rewind(frameMark);
 }
 
 // ========================================================
@@ -1013,6 +1148,37 @@ void Renderer::drawIndexedTriangles(const uint16 * restrict indexes, const uint
 		fatalError("drawIndexedTriangles(%u) => indexCount must be evenly divisible by 3!", indexCount);
 	}
 
+	// The packed XYZ positions are expanded to aligned Vectors for the
+	// back-face test, then each one is transformed and projected once.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	Vector * restrict mPositions = sprOrFrameAlloc<Vector>(positionCount * 2);
+	if (mPositions == nullptr)
+	{
+		// Out of room: expand the triangles a batch at a time and draw them unindexed.
+		warnXformFallback("drawIndexedTriangles", positionCount);
+		const Vector vColor(baseColor.r, baseColor.g, baseColor.b, baseColor.a);
+		for (uint first = 0; first < indexCount; first += XFORM_BATCH_VERTS)
+		{
+			const uint batchVerts = xformBatchSize(first, indexCount);
+			for (uint i = 0; i < batchVerts; ++i)
+			{
+				const uint index = indexes[first + i];
+				xformFallbackVerts[i].position = Vector(positions[index][0], positions[index][1], positions[index][2], 1.0f);
+				setTexcColor(xformFallbackVerts[i], Vector(texCoords[index][0], texCoords[index][1], 0.0f, 1.0f), vColor);
+			}
+			drawUnindexedTriangles(xformFallbackVerts, batchVerts);
+		}
+		return;
+	}
+	Vector * restrict tPositions = mPositions + positionCount;
+
+	for (uint p = 0; p < positionCount; ++p)
+	{
+		mPositions[p] = Vector(positions[p][0], positions[p][1], positions[p][2], 1.0f);
+	}
+	transformProjectPoints(tPositions, screenMvpMatrix, mPositions, positionCount);
+
 	DRAW3D_PROLOGUE();
 
 	uint trisSentToGs = 0;
@@ -1020,48 +1186,143 @@ void Renderer::drawIndexedTriangles(const uint16 * restrict indexes, const uint
 	const Vector vColor(baseColor.r, baseColor.g, baseColor.b, baseColor.a);
 
 	DrawVertex v0, v1, v2;
-	Vector tPos0, tPos1, tPos2;
-
 	for (uint t = 0; t < triCount; ++t)
 	{
 		const uint index0 = indexes[(t * 3) + 0];
 		const uint index1 = indexes[(t * 3) + 1];
 		const uint index2 = indexes[(t * 3) + 2];
 
-		v0.position.x = positions[index0][0];
-		v0.position.y = positions[index0][1];
-		v0.position.z = positions[index0][2];
-		v0.position.w = 1.0f;
+		TRIANGLE_BACK_FACE_CULL(mPositions[index0], mPositions[index1], mPositions[index2]);
 
-		v1.position.x = positions[index1][0];
-		v1.position.y = positions[index1][1];
-		v1.position.z = positions[index1][2];
-		v1.position.w = 1.0f;
-
-		v2.position.x = positions[index2][0];
-		v2.position.y = positions[index2][1];
-		v2.position.z = positions[index2][2];
-		v2.position.w = 1.0f;
-
-		// I know this looks shady... And it is!
-		// Look at the implementation in `vertex_xform.h` for details.
-		TRIANGLE_BACK_FACE_CULL(v0.position, v1.position, v2.position);
-		TRIANGLE_XFORM_SCR_CLIP(v0.position, v1.position, v2.position);
-
-		// Conv to fixed point & add to GS render packet:
-		//
+		// Only the texture coords and color of the DrawVertexes are used by `emitVert()`:
 		setTexcColor(v0, Vector(texCoords[index0][0], texCoords[index0][1], 0.0f, 1.0f), vColor);
 		setTexcColor(v1, Vector(texCoords[index1][0], texCoords[index1][1], 0.0f, 1.0f), vColor);
 		setTexcColor(v2, Vector(texCoords[index2][0], texCoords[index2][1], 0.0f, 1.0f), vColor);
-		emitVert(packetPtr, tPos0, q0, v0);
-		emitVert(packetPtr, tPos1, q1, v1);
-		emitVert(packetPtr, tPos2, q2, v2);
+		EMIT_PROJECTED_TRIANGLE(v0, v1, v2, tPositions[index0], tPositions[index1], tPositions[index2]);
+
+		++trisSentToGs;
+	}
+
+	DRAW3D_EPILOGUE();
+	trisCount3d += trisSentToGs;
+	gFrameAllocator.rewind(frameMark);
+}
+
+// ========================================================
+// Renderer::drawUnindexedTriangles():
+// ========================================================
+
+void Renderer::drawUnindexedTriangles(const PackedDrawVertex * restrict verts, const uint vertCount,
+                                      const PackedVertexFormat & fmt)
+{
+	ps2assert(verts != nullptr);
+	ps2assert(vertCount != 0);
+	ps2assert(inMode3d && "3D mode required!");
+
+	// We are expecting triangles!
+	if (vertCount % 3)
+	{
+		fatalError("drawUnindexedTriangles(%u) => vertCount must be evenly divisible by 3!", vertCount);
+	}
+
+	// Unpacked and projected positions of a batch of triangles.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	Vector * restrict qPositions = sprOrFrameAlloc<Vector>(XFORM_BATCH_VERTS * 2);
+	if (qPositions == nullptr)
+	{
+		warnXformFallback("drawUnindexedTriangles", vertCount);
+		qPositions = xformFallbackPositions;
+	}
+	Vector * restrict tPositions = qPositions + XFORM_BATCH_VERTS;
+
+	Matrix packedMvp;
+	Vector eyePosPacked;
+	makePackedMvpMatrix(packedMvp, fmt, screenMvpMatrix);
+	makePackedEyePosition(eyePosPacked, fmt, eyePosModelSpace);
+
+	DRAW3D_PROLOGUE();
+
+	uint trisSentToGs = 0;
+	for (uint first = 0; first < vertCount; first += XFORM_BATCH_VERTS)
+	{
+		trisSentToGs += drawPackedTriangleBatch(packetPtr, verts + first, xformBatchSize(first, vertCount),
+		                                        packedMvp, eyePosPacked, qPositions, tPositions);
+	}
+
+	DRAW3D_EPILOGUE();
+	trisCount3d += trisSentToGs;
+	gFrameAllocator.rewind(frameMark);
+}
+
+// ========================================================
+// Renderer::drawIndexedTriangles():
+// ========================================================
+
+void Renderer::drawIndexedTriangles(const uint16 * restrict indexes, const uint indexCount,
+                                    const PackedDrawVertex * restrict verts, const uint vertCount,
+                                    const PackedVertexFormat & fmt)
+{
+	ps2assert(indexes    != nullptr);
+	ps2assert(indexCount != 0);
+	ps2assert(verts      != nullptr);
+	ps2assert(vertCount  != 0);
+	ps2assert(inMode3d && "3D mode required!");
+
+	// We are expecting triangles!
+	if (indexCount % 3)
+	{
+		fatalError("drawIndexedTriangles(%u) => indexCount must be evenly divisible by 3!", indexCount);
+	}
+
+	// Each vertex is unpacked, transformed and projected once, even if shared by several triangles.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	Vector * restrict qPositions = sprOrFrameAlloc<Vector>(vertCount * 2);
+	if (qPositions == nullptr)
+	{
+		// Out of room: expand the triangles a batch at a time and draw them unindexed.
+		warnXformFallback("drawIndexedTriangles", vertCount);
+		for (uint first = 0; first < indexCount; first += XFORM_BATCH_VERTS)
+		{
+			const uint batchVerts = xformBatchSize(first, indexCount);
+			for (uint i = 0; i < batchVerts; ++i)
+			{
+				xformFallbackPackedVerts[i] = verts[indexes[first + i]];
+			}
+			drawUnindexedTriangles(xformFallbackPackedVerts, batchVerts, fmt);
+		}
+		return;
+	}
+	Vector * restrict tPositions = qPositions + vertCount;
 
+	Matrix packedMvp;
+	Vector eyePosPacked;
+	makePackedMvpMatrix(packedMvp, fmt, screenMvpMatrix);
+	makePackedEyePosition(eyePosPacked, fmt, eyePosModelSpace);
+
+	unpackVerts(qPositions, verts, vertCount);
+	transformProjectPoints(tPositions, packedMvp, qPositions, vertCount);
+
+	DRAW3D_PROLOGUE();
+
+	uint trisSentToGs = 0;
+	const uint triCount = indexCount / 3;
+
+	for (uint t = 0; t < triCount; ++t)
+	{
+		const uint index0 = indexes[(t * 3) + 0];
+		const uint index1 = indexes[(t * 3) + 1];
+		const uint index2 = indexes[(t * 3) + 2];
+		EMIT_PACKED_TRIANGLE(verts[index0], verts[index1], verts[index2],
+			qPositions[index0], qPositions[index1], qPositions[index2],
+			tPositions[index0], tPositions[index1], tPositions[index2]);
 		++trisSentToGs;
 	}
 
 	DRAW3D_EPILOGUE();
 	trisCount3d += trisSentToGs;
+	gFrameAllocator.rewind(frameMark);
 }
 
 // ========================================================
@@ -1083,6 +1344,44 @@ void Renderer::drawIndexedTrianglesUnculled(const uint16 * restrict indexes, con
 		fatalError("drawIndexedTrianglesUnculled(%u) => indexCount must be evenly divisible by 3!", indexCount);
 	}
 
+	// Each vertex is transformed and projected once, even if shared by several triangles.
+	ScopedSprAlloc sprScope;
+	const size_t frameMark = gFrameAllocator.getMark();
+	Vector * restrict tPositions = sprOrFrameAlloc<Vector>(vertCount);
+	if (tPositions == nullptr)
+	{
+		// Out of room: transform the triangle corners a batch at a time.
+		warnXformFallback("drawIndexedTrianglesUnculled", vertCount);
+		Vector * restrict cPositions = xformFallbackPositions;
+		Vector * restrict pPositions = xformFallbackPositions + XFORM_BATCH_VERTS;
+
+		DRAW3D_PROLOGUE();
+
+		uint trisSentToGs = 0;
+		for (uint first = 0; first < indexCount; first += XFORM_BATCH_VERTS)
+		{
+			const uint16 * restrict batch = indexes + first;
+			const uint batchVerts = xformBatchSize(first, indexCount);
+			for (uint i = 0; i < batchVerts; ++i)
+			{
+				cPositions[i] = verts[batch[i]].position;
+			}
+			transformProjectPoints(pPositions, screenMvpMatrix, cPositions, batchVerts);
+
+			for (uint v = 0; v < batchVerts; v += 3)
+			{
+				EMIT_PROJECTED_TRIANGLE(verts[batch[v + 0]], verts[batch[v + 1]], verts[batch[v + 2]],
+					pPositions[v + 0], pPositions[v + 1], pPositions[v + 2]);
+				++trisSentToGs;
+			}
+		}
+
+		DRAW3D_EPILOGUE();
+		trisCount3d += trisSentToGs;
+		return;
+	}
+	transformProjectPoints(tPositions, screenMvpMatrix, &verts->position, sizeof(DrawVertex), vertCount);
+
 	DRAW3D_PROLOGUE();
 
 	uint trisSentToGs = 0;
@@ -1090,15 +1389,124 @@ void Renderer::drawIndexedTrianglesUnculled(const uint16 * restrict indexes, con
 
 	for (uint t = 0; t < triCount; ++t)
 	{
-		const DrawVertex & v0 = verts[indexes[(t * 3) + 0]];
-		const DrawVertex & v1 = verts[indexes[(t * 3) + 1]];
-		const DrawVertex & v2 = verts[indexes[(t * 3) + 2]];
-		XFORM_TRIANGLE_NO_BF_CULL(v0, v1, v2); // Includes off-screen clipping, but no back-face culling.
+		const uint index0 = indexes[(t * 3) + 0];
+		const uint index1 = indexes[(t * 3) + 1];
+		const uint index2 = indexes[(t * 3) + 2];
+		const DrawVertex & v0 = verts[index0];
+		const DrawVertex & v1 = verts[index1];
+		const DrawVertex & v2 = verts[index2];
+		EMIT_PROJECTED_TRIANGLE(v0, v1, v2, tPositions[index0], tPositions[index1], tPositions[index2]);
 		++trisSentToGs;
 	}
 
 	DRAW3D_EPILOGUE();
 	trisCount3d += trisSentToGs;
+	gFrameAllocator.rewind(frameMark);
+}
+
+// ========================================================
+// Renderer::drawSpritesFacingCamera():
+// ========================================================
+
+void Renderer::drawSpritesFacingCamera(const float * restrict posX, const float * restrict posY,
+                                       const float * restrict posZ, const float * restrict sizes,
+                                       const uint32 * restrict colors, const uint16 * restrict drawOrder,
+                                       const uint count, const Color4f & color)
+{
+	ps2assert(posX  != nullptr);
+	ps2assert(posY  != nullptr);
+	ps2assert(posZ  != nullptr);
+	ps2assert(sizes != nullptr);
+	ps2assert(inMode3d && "3D mode required!");
+
+	if (count == 0)
+	{
+		return;
+	}
+
+	// Projected size of one world unit at w=1, in raster units. The first two
+	// columns of the MVP are the camera right/up axes scaled by the projection,
+	// so this also holds if the model matrix scales.
+	const float projScaleX = Vector(mvpMatrix(0, 0), mvpMatrix(1, 0), mvpMatrix(2, 0), 0.0f).length();
+	const float projScaleY = Vector(mvpMatrix(0, 1), mvpMatrix(1, 1), mvpMatrix(2, 1), 0.0f).length();
+	const float halfScaleX = projScaleX * GS_RASTER_SCALE_X * 0.5f;
+	const float halfScaleY = projScaleY * GS_RASTER_SCALE_Y * 0.5f;
+
+	// Visible area in raster units, for the off-screen rejection.
+	const float scrHalfW = getScreenWidth()  * 0.5f;
+	const float scrHalfH = getScreenHeight() * 0.5f;
+	const float scrMinX  = GS_RASTER_SCALE_X - scrHalfW;
+	const float scrMaxX  = GS_RASTER_SCALE_X + scrHalfW;
+	const float scrMinY  = GS_RASTER_SCALE_Y - scrHalfH;
+	const float scrMaxY  = GS_RASTER_SCALE_Y + scrHalfH;
+
+	// Color for the whole batch if no per-sprite colors, converted only once:
+	Vector vColor(color.r, color.g, color.b, color.a);
+	int tColorFixed[4] ATTRIBUTE_ALIGNED(16);
+	ftoi0XYZW(&vColor, tColorFixed);
+
+	color_t gsColor;
+	gsColor.r = scast<ubyte>(tColorFixed[0]);
+	gsColor.g = scast<ubyte>(tColorFixed[1]);
+	gsColor.b = scast<ubyte>(tColorFixed[2]);
+	gsColor.a = scast<ubyte>(tColorFixed[3]);
+
+	// Same as DRAW3D_PROLOGUE(), but the batch is a list of GS sprites:
+	BEGIN_DMA_TAG(currentFrameQwPtr);
+	if (currentTex != nullptr)
+	{
+		setTextureBufferSampling();
+	}
+	prim_t spritePrim = primDesc;
+	spritePrim.type   = PRIM_SPRITE;
+	uint64 * restrict packetPtr = rcast<uint64 *>(draw_prim_start(currentFrameQwPtr, 0, &spritePrim, &primColor));
+
+	uint spritesSentToGs = 0;
+	for (uint i = 0; i < count; ++i)
+	{
+		const uint p = (drawOrder != nullptr) ? drawOrder[i] : i;
+		const Vector center(posX[p], posY[p], posZ[p], 1.0f);
+
+		// Only the center point is transformed.
+		Vector tPos;
+		applyXForm(&tPos, &mvpMatrix, &center);
+
+		// Behind or too close to the eye?
+		if (tPos.w <= SPRITE_MIN_W)
+		{
+			continue;
+		}
+
+		const float q = 1.0f / tPos.w;
+		scaleVert(&tPos, q);
+
+		// Perspective size, clamped so that far sprites don't vanish
+		// and sprites right in front of the camera don't fill the screen.
+		const float halfW = clamp(sizes[p] * halfScaleX * q, SPRITE_MIN_HALF_SIZE, SPRITE_MAX_HALF_SIZE);
+		const float halfH = clamp(sizes[p] * halfScaleY * q, SPRITE_MIN_HALF_SIZE, SPRITE_MAX_HALF_SIZE);
+
+		// Off-screen rejection:
+		if ((tPos.x + halfW) < scrMinX || (tPos.x - halfW) > scrMaxX ||
+		    (tPos.y + halfH) < scrMinY || (tPos.y - halfH) > scrMaxY)
+		{
+			continue;
+		}
+
+		if (colors != nullptr)
+		{
+			const uint32 c = colors[p];
+			gsColor.r = scast<ubyte>(c & 0xFF);
+			gsColor.g = scast<ubyte>((c >>  8) & 0xFF);
+			gsColor.b = scast<ubyte>((c >> 16) & 0xFF);
+			gsColor.a = scast<ubyte>((c >> 24) & 0xFF);
+		}
+
+		emitSprite(packetPtr, tPos, halfW, halfH, q, gsColor);
+		++spritesSentToGs;
+	}
+
+	DRAW3D_EPILOGUE();
+	spriteCount3d += spritesSentToGs;
 }
 
 // ========================================================
@@ -1110,10 +1518,13 @@ void Renderer::drawLine(const Vector & from, const Vector & to, const Color4f &
 	setPrimTopology(PRIM_LINE);
 	setPrimTextureMapping(false);
 
+	Vector points[2] = { from, to };
+	transformProjectPoints(points, screenMvpMatrix, points, 2);
+
 	BEGIN_DMA_TAG(currentFrameQwPtr);
 	qword_t * restrict packetPtr = draw_prim_start(currentFrameQwPtr, 0, &primDesc, &primColor);
 
-	emitLine(packetPtr, mvpMatrix, from, to, color);
+	emitLine(packetPtr, points[0], points[1], makeGsLineColor(color));
 
 	currentFrameQwPtr = draw_prim_end(packetPtr, 2, DRAW_RGBAQ_REGLIST);
 	END_DMA_TAG(currentFrameQwPtr);
@@ -1132,17 +1543,20 @@ void Renderer::drawAabb(const Aabb & aabb, const Color4f & color)
 	setPrimTopology(PRIM_LINE);
 	setPrimTextureMapping(false);
 
+	// The 8 corners are projected once, instead of once per edge.
 	Vector points[8];
 	aabb.toPoints(points);
+	transformProjectPoints(points, screenMvpMatrix, points, 8);
+	const color_t gsColor = makeGsLineColor(color);
 
 	BEGIN_DMA_TAG(currentFrameQwPtr);
 	qword_t * restrict packetPtr = draw_prim_start(currentFrameQwPtr, 0, &primDesc, &primColor);
 
 	for (int i = 0; i < 4; ++i)
 	{
-		emitLine(packetPtr, mvpMatrix, points[i],     points[(i + 1) & 3],       color);
-		emitLine(packetPtr, mvpMatrix, points[4 + i], points[4 + ((i + 1) & 3)], color);
-		emitLine(packetPtr, mvpMatrix, points[i],     points[4 + i],             color);
+		emitLine(packetPtr, points[i],     points[(i + 1) & 3],       gsColor);
+		emitLine(packetPtr, points[4 + i], points[4 + ((i + 1) & 3)], gsColor);
+		emitLine(packetPtr, points[i],     points[4 + i],             gsColor);
 	}
 
 	currentFrameQwPtr = draw_prim_end(packetPtr, 2, DRAW_RGBAQ_REGLIST);
@@ -1167,12 +1581,17 @@ void Renderer::begin2d(const Texture * tex)
 	inMode2d = true;
 
 	// Bind the text atlas for further `drawText()` calls:
-	setTexture((tex == nullptr) ? texAtlas.getTexture() : (*tex));
+	if (tex == nullptr)
+	{
+		fntLoadSdfAtlas();
+		tex = &sdfFontTexture;
+	}
+	setTexture(*tex);
 
 	// Reference the external tag `dmaTagDraw2d`:
 	BEGIN_DMA_TAG_NAMED(dmaTagDraw2d, currentFrameQwPtr);
 	currentFrameQwPtr = draw_primitive_xyoffset(currentFrameQwPtr, 0, 2048, 2048);
-	setTextureBufferSampling(); // For `texAtlas` or the user supplied texture.
+	setTextureBufferSampling(); // For `sdfFontTexture` or the user supplied texture.
 }
 
 // ========================================================
@@ -1182,9 +1601,11 @@ void Renderer::begin2d(const Texture * tex)
 void Renderer::end2d()
 {
 	ps2assert(inMode2d && "Not in 2D drawing mode!");
+	flushTextList();
 
 	currentFrameQwPtr = draw_primitive_xyoffset(currentFrameQwPtr, 0,
 		2048 - (getScreenWidth() / 2), 2048 - (getScreenHeight() / 2));
+	qwordCount2d += currentFrameQwPtr - dmaTagDraw2d;
 
 	// Close `dmaTagDraw2d`.
 	END_DMA_TAG_NAMED(dmaTagDraw2d, currentFrameQwPtr);
@@ -1198,6 +1619,7 @@ void Renderer::end2d()
 void Renderer::drawRectFilled(const Rect4i & rect, const Color4b color)
 {
 	ps2assert(inMode2d && "2D mode required!");
+	flushTextList();
 
 	rect_t rc;
 	rc.v0.x = rect.x;
@@ -1223,6 +1645,7 @@ void Renderer::drawRectFilled(const Rect4i & rect, const Color4b color)
 void Renderer::drawRectOutline(const Rect4i & rect, const Color4b color)
 {
 	ps2assert(inMode2d && "2D mode required!");
+	flushTextList();
 
 	rect_t rc;
 	rc.v0.x = rect.x;
@@ -1247,6 +1670,8 @@ void Renderer::drawRectOutline(const Rect4i & rect, const Color4b color)
 
 void Renderer::drawRectTextured(const Rect4i & rect, const Color4b color)
 {
+	flushTextList();
+
 	uint w, h;
 	if (currentTex != nullptr)
 	{
@@ -1333,13 +1758,18 @@ void Renderer::drawFrameStats()
 
 	Vec2f pos;
 	pos.x = 5.0f;
-	pos.y = getScreenHeight() - 88.0f;
+	pos.y = getScreenHeight() - 155.0f;
 
 	drawText(pos, white, FONT_CONSOLAS_24, format("Texture switches  : %u\n", texSwitches));
 	drawText(pos, white, FONT_CONSOLAS_24, format("Pipeline flushes  : %u\n", pipeFlushes));
 	drawText(pos, white, FONT_CONSOLAS_24, format("3D draw calls     : %u\n", drawCount3d));
 	drawText(pos, white, FONT_CONSOLAS_24, format("2D draw calls     : %u\n", drawCount2d));
 	drawText(pos, white, FONT_CONSOLAS_24, format("Tris sent to GS   : %u\n", trisCount3d));
+	drawText(pos, white, FONT_CONSOLAS_24, format("Sprites sent to GS: %u\n", spriteCount3d));
+	drawText(pos, white, FONT_CONSOLAS_24, format("Glyphs sent to GS : %u\n", glyphCount2d));
+	drawText(pos, white, FONT_CONSOLAS_24, format("2D packet qwords  : %u\n", prevQwordCount2d));
+	drawText(pos, white, FONT_CONSOLAS_24, format("Text cache hits   : %u/%u (%u bytes reused)\n",
+		textCacheHits, textCacheHits + textCacheMisses, textCacheBytes));
 }
 
 // ================================================================================================
@@ -1350,290 +1780,156 @@ namespace
 {
 
 // ========================================================
-// struct BuiltInFontGlyph:
+// Local text rendering data & SDF font data:
 // ========================================================
 
-struct ATTRIBUTE_ALIGNED(16) BuiltInFontGlyph
-{
-	// Texture coordinates to use when rendering.
-	// Stored *in pixels*, as required by the PS2 renderer.
-	int32 u0, v0;
-	int32 u1, v1;
-
-	// Dimensions of the glyph's bitmap (in pixels):
-	int32 w, h;
+// "Consolas" signed distance field atlas (see `builtin_fonts/` dir).
+// Generated by `tools/sdf_font_gen` from the Consolas bitmap fonts.
+#include "builtin_fonts/consolas_sdf.h"
 
-	// Pointer to start of glyph bitmap data:
-	//  `builtInFontBitmap->bitmap[]`
-	uint32 * pixels;
-};
+// Every font size samples the same distance field, only the
+// sprite size changes. The CLUT ramps the distance into alpha,
+// so the bilinear filter reconstructs a smooth glyph edge at any scale.
+// Pixels with alpha below this are discarded by the GS alpha test.
+static const int SDF_ALPHA_REF = 0x08;
 
-// ========================================================
-// struct BuiltInFontBitmap:
-// ========================================================
-
-struct ATTRIBUTE_ALIGNED(16) BuiltInFontBitmap
+// Load flags and metrics of each BuiltInFontId, in pixels:
+struct BuiltInFontSize
 {
-	// Glyphs in use / first char:
-	int32 numGlyphs;
-	int32 charStart;
-
-	// Dimensions of the bitmap, in pixels:
-	int32 bmpWidth;
-	int32 bmpHeight;
-
-	// Bitmap allocated to store decompressed glyphs.
-	// Bitmap glyphs are stored as a string of glyphs,
-	// forming a very wide image, but with height equal
-	// to the glyph's height. E.g.:
-	// +--------------------
-	// |1|2|3|...|A|B|C|...
-	// +--------------------
-	uint32 * bitmap;
-
-	// Glyphs for this font:
-	static const int MAX_GLYPHS = 96;
-	BuiltInFontGlyph glyphs[MAX_GLYPHS];
+	int32 advance; // Width of every glyph (monospaced).
+	int32 height;  // Line height.
+	bool  loaded;
 };
 
-// ========================================================
-// Local text rendering data & compressed font data:
-// ========================================================
-
-// "Consolas" fonts (see `builtin_fonts/` dir):
-#include "builtin_fonts/consolas10.h"
-#include "builtin_fonts/consolas12.h"
-#include "builtin_fonts/consolas16.h"
-#include "builtin_fonts/consolas20.h"
-#include "builtin_fonts/consolas24.h"
-#include "builtin_fonts/consolas30.h"
-#include "builtin_fonts/consolas36.h"
-#include "builtin_fonts/consolas40.h"
-#include "builtin_fonts/consolas48.h"
-
-// All built-in fonts must be registered here,
-// in the same order they appear in the BuiltInFontId enum!
-static const uint32 * const compressedFontData[] ATTRIBUTE_ALIGNED(16) =
-{
-	font_10Con,
-	font_12Con,
-	font_16Con,
-	font_20Con,
-	font_24Con,
-	font_30Con,
-	font_36Con,
-	font_40Con,
-	font_48Con
-};
-
-// Expanded built-in fonts, loaded on demand:
-static BuiltInFontBitmap builtInFonts[FONT_COUNT];
-
-} // namespace {}
+static BuiltInFontSize builtInFonts[FONT_COUNT];
 
 // ========================================================
-// Renderer::fntDecompressGlyphs():
+// struct TextRun:
 // ========================================================
 
-void Renderer::fntDecompressGlyphs(const BuiltInFontId fontId)
+// A string laid out by `drawCachedText()`. The glyph sprites
+// (UV/XYZ pairs) and a copy of the string live in the cache arenas.
+// The position is not part of the key: a hit somewhere else moves
+// the cached sprites by the difference to `startX/startY`.
+struct TextRun
 {
-	// Based on code found at: http://silverspaceship.com/inner/imgui/grlib/gr_extra.c
-	// Originally written by Sean Barrett.
-
-// --------------------------------------
-
-#define SKIPBIT() \
-	if ((buffer >>= 1), (--bitsLeft == 0)) { buffer = *source++; bitsLeft = 32; }
-
-#define PACKRGBA(r, g, b, a) \
-	(uint32)((((a) & 0xFF) << 24) | (((b) & 0xFF) << 16) | (((g) & 0xFF) << 8) | ((r) & 0xFF))
-
-// --------------------------------------
-
-	BuiltInFontBitmap * font = &builtInFonts[fontId];
-	font->numGlyphs = BuiltInFontBitmap::MAX_GLYPHS;
-
-	const uint32 * source = compressedFontData[fontId];
-
-	int32 i, j;
-	int32 effectiveCount;
-	int32 bitsLeft;
-	int32 buffer;
-
-	const int32 start = (source[0] >>  0) & 0xFF;
-	const int32 count = (source[0] >>  8) & 0xFF;
-	const int32 h     = (source[0] >> 16) & 0xFF;
-
-	BuiltInFontGlyph * glyphs = &font->glyphs[0];
-	int32 numGlyphs = font->numGlyphs;
-
-	if (count > numGlyphs)
-	{
-		effectiveCount = numGlyphs;
-	}
-	else
-	{
-		effectiveCount = count;
-	}
-
-	font->charStart = start;
-	font->bmpHeight = h; // Height is the same for every glyph
-	font->bmpWidth  = 0;
-	++source;
-
-	// Count bitmap size:
-	for (i = 0; i < effectiveCount; ++i)
-	{
-		const int32 w = (source[i >> 2] >> ((i & 3) << 3)) & 0xFF;
-		font->bmpWidth += w;
-	}
-
-	// Allocate memory:
-	font->bitmap = memAlloc<uint32>(MEM_TAG_RENDERER, (font->bmpWidth * font->bmpHeight), 128);
-
-	// Set glyphs:
-	uint32 * pBitmap = font->bitmap;
-	for (i = 0; i < effectiveCount; ++i)
-	{
-		const int32 w = (source[i >> 2] >> ((i & 3) << 3)) & 0xFF;
-		glyphs[i].w = w;
-		glyphs[i].h = h;
-		glyphs[i].pixels = pBitmap;
-		pBitmap += w * h;
-	}
-
-	source  += (count + 3) >> 2;
-	buffer   = *source++;
-	bitsLeft = 32;
+	uint32 hash;       // Hash of the string and all the other keys. Zero if slot is free.
+	uint32 color;      // Color4b packed as RGBA.
+	float  textScale;
+	float  startX, startY;     // Where the cached sprites were laid out.
+	float  advanceX, advanceY; // How much `pos` moves after drawing the text.
+	uint16 fontId;
+	uint16 strLength;
+	uint16 strOffset;  // Offset in `textRunChars`.
+	uint16 dataOffset; // Offset in `textRunData`.
+	uint16 dataCount;  // Dwords of glyph data.
+	uint16 pad;
+};
 
-	while (--numGlyphs >= 0)
+// Max runs and arena sizes. When any is full the whole
+// cache is dropped and repopulated by the following draws.
+static const uint TEXT_RUN_CACHE_SIZE  = 128; // Power of 2
+static const uint TEXT_RUN_CACHE_MAX   = TEXT_RUN_CACHE_SIZE * 3 / 4;
+static const uint TEXT_RUN_CHARS_SIZE  = 8192;
+static const uint TEXT_RUN_DATA_DWORDS = 8192; // 64KB
+
+static TextRun textRuns[TEXT_RUN_CACHE_SIZE];
+static uint    textRunCount;
+static char    textRunChars[TEXT_RUN_CHARS_SIZE];
+static uint    textRunCharsUsed;
+static uint64  textRunData[TEXT_RUN_DATA_DWORDS] ATTRIBUTE_ALIGNED(16);
+static uint    textRunDataUsed;
+
+// FNV-1a, also returns the string length.
+static inline uint32 hashTextRunString(const char * str, uint & length)
+{
+	uint32 h = 2166136261u;
+	uint i = 0;
+	for (; str[i] != '\0'; ++i)
 	{
-		uint32 * c = glyphs->pixels;
-		for (j = 0; j < glyphs->h; ++j)
-		{
-			int32 z = (buffer & 1);
-			SKIPBIT();
-			if (!z)
-			{
-				for (i = 0; i < glyphs->w; ++i)
-				{
-					*c++ = PACKRGBA(255, 255, 255, 0);
-				}
-			}
-			else
-			{
-				for (i = 0; i < glyphs->w; ++i)
-				{
-					z = (buffer & 1);
-					SKIPBIT();
-					if (!z)
-					{
-						*c++ = PACKRGBA(255, 255, 255, 0);
-					}
-					else
-					{
-						int32 n = 0;
-						n += n + (buffer & 1); SKIPBIT();
-						n += n + (buffer & 1); SKIPBIT();
-						n += n + (buffer & 1); SKIPBIT();
-						n += 1;
-						*c++ = PACKRGBA(255, 255, 255, ((255 * n) >> 3));
-					}
-				}
-			}
-		}
-		++glyphs;
+		h = (h ^ scast<ubyte>(str[i])) * 16777619u;
 	}
-
-	font->numGlyphs = count;
-
-// Cleanup the namespace:
-#undef PACKRGBA
-#undef SKIPBIT
+	length = i;
+	return h;
 }
 
-// ========================================================
-// Renderer::fntLoadGlyphs():
-// ========================================================
+static inline uint32 hashTextRunValue(const uint32 h, const uint32 value)
+{
+	return (h ^ value) * 16777619u;
+}
 
-void Renderer::fntLoadGlyphs(const BuiltInFontId fontId)
+// Moves the X/Y of a GS XYZ register by 12:4 fixed-point offsets.
+static inline uint64 offsetTextXyz(const uint64 xyz, const int dx, const int dy)
 {
-	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
-	ps2assert(builtInFonts[fontId].bitmap == nullptr && "Font already loaded!");
+	const uint32 x = scast<uint32>(scast<int>(xyz & 0xFFFF) + dx) & 0xFFFF;
+	const uint32 y = scast<uint32>(scast<int>((xyz >> 16) & 0xFFFF) + dy) & 0xFFFF;
+	return ((xyz >> 32) << 32) | (scast<uint64>(y) << 16) | x;
+}
 
-	// Expand data and allocate the bitmap:
-	fntDecompressGlyphs(fontId);
+static inline uint32 floatBits(const float f)
+{
+	union { float f; uint32 u; } bits;
+	bits.f = f;
+	return bits.u;
 }
 
+} // namespace {}
+
 // ========================================================
-// Renderer::fntUnloadGlyphs():
+// Renderer::fntLoadSdfAtlas():
 // ========================================================
 
-void Renderer::fntUnloadGlyphs(const BuiltInFontId fontId)
+void Renderer::fntLoadSdfAtlas()
 {
-	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
-	if (builtInFonts[fontId].bitmap == nullptr)
+	if (sdfFontPixels != nullptr)
 	{
-		return;
+		return; // Shared by all the font sizes, loaded once.
 	}
 
-	memFree(MEM_TAG_RENDERER, builtInFonts[fontId].bitmap); // Was allocated with `memAlloc()`
+	// Rows below the last glyph are not stored, so they stay zeroed (fully transparent).
+	sdfFontPixels = memClearedAlloc<ubyte>(MEM_TAG_RENDERER, SDF_ATLAS_WIDTH * SDF_ATLAS_HEIGHT, 128);
 
-	builtInFonts[fontId].numGlyphs = 0;
-	builtInFonts[fontId].charStart = 0;
-	builtInFonts[fontId].bmpWidth  = 0;
-	builtInFonts[fontId].bmpHeight = 0;
-	builtInFonts[fontId].bitmap    = nullptr;
-
-	memset(builtInFonts[fontId].glyphs, 0, BuiltInFontBitmap::MAX_GLYPHS * sizeof(BuiltInFontGlyph));
-}
-
-// ========================================================
-// Renderer::fntAllocateAtlasSpace():
-// ========================================================
+	// Expand the runs of zero indexes. Anything else is a literal texel.
+	const ubyte * source    = rcast<const ubyte *>(consolasSdfAtlasRle);
+	const ubyte * sourceEnd = source + SDF_ATLAS_RLE_SIZE;
+	ubyte * dest = sdfFontPixels;
 
-bool Renderer::fntAllocateAtlasSpace(const BuiltInFontId fontId)
-{
-	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
-	ps2assert(texAtlas.isInitialized());
-
-	// Reserve some memory for every glyph, since we know the amount beforehand:
-	texAtlas.reserveMemForRegions(builtInFonts[fontId].numGlyphs + 1);
-
-	for (int i = 0; i < builtInFonts[fontId].numGlyphs; ++i)
+	while (source != sourceEnd)
 	{
-		BuiltInFontGlyph & glyph = builtInFonts[fontId].glyphs[i];
-		if (glyph.pixels == nullptr)
+		if (*source != 0)
 		{
-			continue;
+			*dest++ = *source++;
 		}
-
-		// Alloc atlas space (+1 pixel each side for a safety border when sampling):
-		const int BorderSize = 1;
-		Rect4i region = texAtlas.allocRegion(glyph.w + (BorderSize * 2), glyph.h + (BorderSize * 2));
-		if (region.x < 0)
+		else
 		{
-			logError("The default text atlas seems to be full! Discarding further text glyphs...");
-			return false;
+			dest   += source[1];
+			source += 2;
 		}
+	}
+	ps2assert(dest <= sdfFontPixels + (SDF_ATLAS_WIDTH * SDF_ATLAS_HEIGHT));
 
-		// Fill the whole region with a default initial value:
-		texAtlas.setRegion(region.x, region.y, region.width, region.height, 0);
+	// Bilinear filtering is what makes the distance field work when scaled.
+	lod_t lod;
+	lod.calculation = LOD_USE_K;
+	lod.max_level   = 0;
+	lod.mag_filter  = LOD_MAG_LINEAR;
+	lod.min_filter  = LOD_MIN_LINEAR;
+	lod.l           = 0;
+	lod.k           = 0.0f;
 
-		// Copy the glyph pixels to its rectangle, preserving the border:
-		region.x += BorderSize;
-		region.y += BorderSize;
-		texAtlas.setRegion(region.x, region.y, glyph.w, glyph.h,
-			rcast<const ubyte *>(glyph.pixels), glyph.w * sizeof(uint32));
+	// The CLUT goes right after the 8-bit texture, still inside the user texture VRam.
+	clutbuffer_t clut;
+	clut.address      = vramUserTextureStart + ((SDF_ATLAS_WIDTH * SDF_ATLAS_HEIGHT) / 4);
+	clut.psm          = GS_PSM_32;
+	clut.storage_mode = CLUT_STORAGE_MODE1;
+	clut.start        = 0;
+	clut.load_method  = CLUT_LOAD;
 
-		// Store UVs for this glyph with pixels scale:
-		glyph.u0 = region.x;
-		glyph.v0 = region.y;
-		glyph.u1 = region.x + glyph.w;
-		glyph.v1 = region.y + glyph.h;
-	}
+	sdfFontTexture.initFromMemory(sdfFontPixels, TEXTURE_COMPONENTS_RGBA, SDF_ATLAS_WIDTH,
+			SDF_ATLAS_HEIGHT, GS_PSM_8, TEXTURE_FUNCTION_MODULATE, &lod, &clut);
+	sdfFontTexture.setClutColors(consolasSdfClut);
 
-	return true;
+	logComment("SDF font atlas loaded (%d bytes compressed)", SDF_ATLAS_RLE_SIZE);
 }
 
 // ========================================================
@@ -1644,8 +1940,8 @@ float Renderer::fntGetWhiteSpaceWidth(const BuiltInFontId fontId) const
 {
 	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
 	// Get with in pixels of a white space.
-	// Index zero should always be the white space glyph.
-	return scast<float>(builtInFonts[fontId].glyphs[0].w) * globalTextScale;
+	// Fonts are monospaced, so it is the same as any other glyph.
+	return scast<float>(builtInFonts[fontId].advance) * globalTextScale;
 }
 
 // ========================================================
@@ -1684,28 +1980,19 @@ bool Renderer::loadBuiltInFont(const BuiltInFontId fontId)
 	// Load a font only once.
 	if (isBuiltInFontLoaded(fontId))
 	{
-		logWarning("Built-in bitmap font #%d already loaded!", scast<int>(fontId));
+		logWarning("Built-in font #%d already loaded!", scast<int>(fontId));
 		return true;
 	}
 
-	// Initialize our texture atlas if this is the first font loaded:
-	if (!texAtlas.isInitialized())
-	{
-		texAtlas.init(
-			/* width   = */ Texture::MAX_SIZE,
-			/* height  = */ Texture::MAX_SIZE,
-			/* bpp     = */ 4,
-			/* fillVal = */ 0);
-	}
+	// All sizes share the one distance field texture:
+	fntLoadSdfAtlas();
 
-	// Load & decompress the glyphs:
-	fntLoadGlyphs(fontId);
+	builtInFonts[fontId].advance = consolasSdfMetrics[fontId][0];
+	builtInFonts[fontId].height  = consolasSdfMetrics[fontId][1];
+	builtInFonts[fontId].loaded  = true;
 
-	// Place them in the atlas texture:
-	if (!fntAllocateAtlasSpace(fontId))
-	{
-		return false;
-	}
+	// Glyph sizes might change.
+	clearTextRunCache();
 
 	logComment("Successfully loaded built-in font #%d", scast<int>(fontId));
 	return true;
@@ -1717,10 +2004,19 @@ bool Renderer::loadBuiltInFont(const BuiltInFontId fontId)
 
 void Renderer::unloadBuiltInFont(const BuiltInFontId fontId)
 {
-	// Note that unloading a font will not remove the glyphs from the texture atlas.
-	// The glyphs will remain allocated in the atlas space until the whole atlas
-	// texture is cleared.
-	fntUnloadGlyphs(fontId);
+	// Only the metrics are dropped. The SDF atlas is shared
+	// by all font sizes and stays loaded with the Renderer.
+	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
+	if (!builtInFonts[fontId].loaded)
+	{
+		return;
+	}
+
+	clearTextRunCache();
+
+	builtInFonts[fontId].advance = 0;
+	builtInFonts[fontId].height  = 0;
+	builtInFonts[fontId].loaded  = false;
 }
 
 // ========================================================
@@ -1730,7 +2026,7 @@ void Renderer::unloadBuiltInFont(const BuiltInFontId fontId)
 bool Renderer::isBuiltInFontLoaded(const BuiltInFontId fontId)
 {
 	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
-	return builtInFonts[fontId].bitmap != nullptr;
+	return builtInFonts[fontId].loaded;
 }
 
 // ========================================================
@@ -1743,6 +2039,7 @@ float Renderer::drawChar(Vec2f & pos, const Color4b color, const BuiltInFontId f
 
 	if (!isBuiltInFontLoaded(fontId)) // Load font if needed
 	{
+		flushTextList();
 		if (!loadBuiltInFont(fontId))
 		{
 			return 0;
@@ -1769,32 +2066,30 @@ float Renderer::drawChar(Vec2f & pos, const Color4b color, const BuiltInFontId f
 	default :
 		if (isgraph(c)) // Only add if char is printable
 		{
-			const int charIndex = c - builtInFonts[fontId].charStart;
-			if (charIndex >= 0 && charIndex < BuiltInFontBitmap::MAX_GLYPHS)
+			const int charIndex = c - SDF_CHAR_START;
+			if (charIndex >= 0 && charIndex < SDF_CHAR_COUNT)
 			{
-				const BuiltInFontGlyph & glyph = builtInFonts[fontId].glyphs[charIndex];
-
-				texrect_t rc;
-				rc.v0.x = pos.x;
-				rc.v0.y = pos.y;
-				rc.v0.z = 0xFFFFFFFF;
-				rc.t0.u = glyph.u0;
-				rc.t0.v = glyph.v0;
-				rc.v1.x = pos.x + (glyph.w * globalTextScale);
-				rc.v1.y = pos.y + (glyph.h * globalTextScale);
-				rc.v1.z = 0xFFFFFFFF;
-				rc.t1.u = glyph.u1;
-				rc.t1.v = glyph.v1;
-				rc.color.r = color.r;
-				rc.color.g = color.g;
-				rc.color.b = color.b;
-				rc.color.a = color.a;
-				rc.color.q = 1.0f;
-
-				currentFrameQwPtr = draw_rect_textured(currentFrameQwPtr, 0, &rc);
-				drawCount2d++;
-
-				charWidth = scast<float>(glyph.w);
+				const uint16 * glyphUVs = consolasSdfGlyphs[charIndex];
+				const int32 w = builtInFonts[fontId].advance;
+				const int32 h = builtInFonts[fontId].height;
+
+				// Top-left and bottom-right corners of the sprite, with the same
+				// pixel center offsets applied by the draw library's rectangles.
+				const int x0 = toFixed4(pos.x + TEXT_START_OFFSET);
+				const int y0 = toFixed4(pos.y + TEXT_START_OFFSET);
+				const int x1 = toFixed4(pos.x + (w * globalTextScale) + TEXT_END_OFFSET);
+				const int y1 = toFixed4(pos.y + (h * globalTextScale) + TEXT_END_OFFSET);
+
+				// Just UV/XYZ pairs. Prim and color are set once for the whole list.
+				// The atlas UVs are already in 12:4 fixed-point.
+				beginTextList(color);
+				*textListPtr++ = GS_SET_UV(glyphUVs[0], glyphUVs[1]);
+				*textListPtr++ = GS_SET_XYZ(x0, y0, 0xFFFFFFFF);
+				*textListPtr++ = GS_SET_UV(glyphUVs[2], glyphUVs[3]);
+				*textListPtr++ = GS_SET_XYZ(x1, y1, 0xFFFFFFFF);
+				glyphCount2d++;
+
+				charWidth = scast<float>(w);
 				pos.x += charWidth * globalTextScale;
 			}
 		}
@@ -1804,6 +2099,84 @@ float Renderer::drawChar(Vec2f & pos, const Color4b color, const BuiltInFontId f
 	return charWidth;
 }
 
+// ========================================================
+// Renderer::beginTextList():
+// ========================================================
+
+void Renderer::beginTextList(const Color4b color)
+{
+	ps2assert(inMode2d && "2D mode required!");
+
+	if (textListPtr != nullptr)
+	{
+		if (color.r == textListColor.r && color.g == textListColor.g &&
+		    color.b == textListColor.b && color.a == textListColor.a)
+		{
+			return; // Keep appending to the current list.
+		}
+
+		// REGLIST data has no room for a color change, so a new list is started.
+		flushTextList();
+	}
+
+	// Same state `draw_rect_textured()` sets, but once for the whole list:
+	prim_t textPrim;
+	textPrim.type         = PRIM_SPRITE;
+	textPrim.shading      = PRIM_SHADE_FLAT;
+	textPrim.mapping      = DRAW_ENABLE;
+	textPrim.fogging      = DRAW_DISABLE;
+	textPrim.blending     = DRAW_ENABLE;
+	textPrim.antialiasing = DRAW_DISABLE;
+	textPrim.mapping_type = PRIM_MAP_UV;
+	textPrim.colorfix     = PRIM_UNFIXED;
+
+	color_t gsColor;
+	gsColor.r = color.r;
+	gsColor.g = color.g;
+	gsColor.b = color.b;
+	gsColor.a = color.a;
+	gsColor.q = 1.0f;
+
+	// The SDF edge is soft, so the faint texels around it are dropped by the alpha test
+	// instead of being blended. The list is only committed if it gets any glyphs.
+	qword_t * q = currentFrameQwPtr;
+	PACK_GIFTAG(q, GIF_SET_TAG(1, 0, 0, 0, GIF_FLG_PACKED, 1), GIF_REG_AD);
+	q++;
+	PACK_GIFTAG(q, GS_SET_TEST(DRAW_ENABLE, ATEST_METHOD_GREATER_EQUAL, SDF_ALPHA_REF, ATEST_KEEP_ALL,
+			DRAW_DISABLE, DRAW_DISABLE, DRAW_ENABLE, zBuffer.method), GS_REG_TEST);
+	q++;
+
+	textListPtr   = rcast<uint64 *>(draw_prim_start(q, 0, &textPrim, &gsColor));
+	textListStart = textListPtr;
+	textListColor = color;
+}
+
+// ========================================================
+// Renderer::flushTextList():
+// ========================================================
+
+void Renderer::flushTextList()
+{
+	if (textListPtr == nullptr)
+	{
+		return;
+	}
+
+	// No glyphs added, e.g. only blanks drawn. The test state and list header
+	// were written past `currentFrameQwPtr`, so they are just discarded.
+	if (textListPtr == textListStart)
+	{
+		textListPtr = nullptr;
+		return;
+	}
+
+	// Each glyph is two UV/XYZ pairs, so the list is always a whole number of quadwords.
+	currentFrameQwPtr = draw_prim_end(rcast<qword_t *>(textListPtr), 2, TEXT_UV_XYZ_REGLIST);
+	currentFrameQwPtr = draw_enable_tests(currentFrameQwPtr, 0, &zBuffer); // Back to the default alpha test.
+	textListPtr = nullptr;
+	drawCount2d++;
+}
+
 // ========================================================
 // Renderer::drawText():
 // ========================================================
@@ -1824,7 +2197,7 @@ void Renderer::drawText(Vec2f & pos, const Color4b color, const BuiltInFontId fo
 		{
 		case '\n' :
 			pos.x  = initialX;
-			pos.y += builtInFonts[fontId].bmpHeight * globalTextScale; // Every glyph of a font-face has the same height
+			pos.y += builtInFonts[fontId].height * globalTextScale; // Every glyph of a font-face has the same height
 			break;
 
 		case '\r' :
@@ -1838,6 +2211,215 @@ void Renderer::drawText(Vec2f & pos, const Color4b color, const BuiltInFontId fo
 	}
 }
 
+// ========================================================
+// Renderer::drawCachedText():
+// ========================================================
+
+void Renderer::drawCachedText(Vec2f & pos, const Color4b color, const BuiltInFontId fontId, const char * str)
+{
+	ps2assert(fontId >= 0 && fontId < FONT_COUNT);
+	ps2assert(str != nullptr);
+
+	if (!isBuiltInFontLoaded(fontId)) // Load font if needed
+	{
+		flushTextList();
+		if (!loadBuiltInFont(fontId))
+		{
+			return;
+		}
+	}
+
+	const uint32 packedColor = scast<uint32>(color.r)         | (scast<uint32>(color.g) << 8) |
+	                           (scast<uint32>(color.b) << 16) | (scast<uint32>(color.a) << 24);
+
+	uint strLength;
+	uint32 hash = hashTextRunString(str, strLength);
+	hash = hashTextRunValue(hash, fontId);
+	hash = hashTextRunValue(hash, packedColor);
+	hash = hashTextRunValue(hash, floatBits(globalTextScale));
+	if (hash == 0)
+	{
+		hash = 1; // Zero marks the free slots.
+	}
+
+	// Linear probing. Also compare the keys and string, so a hash collision can't draw the wrong text.
+	uint slot = hash & (TEXT_RUN_CACHE_SIZE - 1);
+	for (; textRuns[slot].hash != 0; slot = (slot + 1) & (TEXT_RUN_CACHE_SIZE - 1))
+	{
+		const TextRun & run = textRuns[slot];
+		if (run.hash      != hash            ||
+		    run.fontId    != fontId          ||
+		    run.color     != packedColor     ||
+		    run.textScale != globalTextScale ||
+		    run.strLength != strLength       ||
+		    memcmp(&textRunChars[run.strOffset], str, strLength) != 0)
+		{
+			continue;
+		}
+
+		// Hit: copy the ready glyph sprites into the open list,
+		// moving them if the text was cached at another position.
+		if (run.dataCount != 0)
+		{
+			beginTextList(color);
+			const uint64 * data = &textRunData[run.dataOffset];
+			const int dx = toFixed4(pos.x) - toFixed4(run.startX);
+			const int dy = toFixed4(pos.y) - toFixed4(run.startY);
+			if (dx == 0 && dy == 0)
+			{
+				memcpy(textListPtr, data, run.dataCount * sizeof(uint64));
+			}
+			else
+			{
+				for (uint d = 0; d < run.dataCount; d += 2)
+				{
+					textListPtr[d]     = data[d];
+					textListPtr[d + 1] = offsetTextXyz(data[d + 1], dx, dy);
+				}
+			}
+			textListPtr  += run.dataCount;
+			glyphCount2d += run.dataCount / 4;
+		}
+
+		pos.x += run.advanceX;
+		pos.y += run.advanceY;
+
+		textCacheHits++;
+		textCacheBytes += run.dataCount * sizeof(uint64);
+		return;
+	}
+
+	// Miss: lay it out in the frame packet, then copy that to the cache.
+	textCacheMisses++;
+
+	const float startX = pos.x;
+	const float startY = pos.y;
+
+	beginTextList(color);
+	const uint64 * listBefore = textListStart;
+	const uint64 * dataStart  = textListPtr;
+
+	drawText(pos, color, fontId, str);
+
+	// The list only gets replaced if something inside `drawText()` closed it. Don't cache that.
+	if (textListStart != listBefore || textListPtr == nullptr)
+	{
+		return;
+	}
+
+	const uint dataCount = textListPtr - dataStart;
+	if (textRunCount     + 1         > TEXT_RUN_CACHE_MAX   ||
+	    textRunCharsUsed + strLength > TEXT_RUN_CHARS_SIZE  ||
+	    textRunDataUsed  + dataCount > TEXT_RUN_DATA_DWORDS)
+	{
+		clearTextRunCache();
+		if (strLength > TEXT_RUN_CHARS_SIZE || dataCount > TEXT_RUN_DATA_DWORDS)
+		{
+			return; // Would never fit.
+		}
+		slot = hash & (TEXT_RUN_CACHE_SIZE - 1);
+	}
+
+	TextRun & run  = textRuns[slot];
+	run.hash       = hash;
+	run.color      = packedColor;
+	run.textScale  = globalTextScale;
+	run.startX     = startX;
+	run.startY     = startY;
+	run.advanceX   = pos.x - startX;
+	run.advanceY   = pos.y - startY;
+	run.fontId     = scast<uint16>(fontId);
+	run.strLength  = scast<uint16>(strLength);
+	run.strOffset  = scast<uint16>(textRunCharsUsed);
+	run.dataOffset = scast<uint16>(textRunDataUsed);
+	run.dataCount  = scast<uint16>(dataCount);
+
+	memcpy(&textRunChars[textRunCharsUsed], str, strLength);
+	memcpy(&textRunData[textRunDataUsed], dataStart, dataCount * sizeof(uint64));
+	textRunCharsUsed += strLength;
+	textRunDataUsed  += dataCount;
+	textRunCount++;
+}
+
+// ========================================================
+// Renderer::clearTextRunCache():
+// ========================================================
+
+void Renderer::clearTextRunCache()
+{
+	memset(textRuns, 0, sizeof(textRuns));
+	textRunCount     = 0;
+	textRunCharsUsed = 0;
+	textRunDataUsed  = 0;
+}
+
+// ========================================================
+// Renderer::beginTextPacket():
+// ========================================================
+
+void Renderer::beginTextPacket()
+{
+	ps2assert(inMode2d && "2D mode required!");
+	ps2assert(textPacketStart == nullptr && "Already recording!");
+
+	flushTextList();
+	textPacketStart   = currentFrameQwPtr;
+	textPacketFlushes = pipeFlushes;
+}
+
+// ========================================================
+// Renderer::endTextPacket():
+// ========================================================
+
+uint Renderer::endTextPacket(qword_t * dest, const uint maxQwords)
+{
+	ps2assert(inMode2d && "2D mode required!");
+	ps2assert(textPacketStart != nullptr && "Not recording!");
+	ps2assert(dest != nullptr);
+
+	flushTextList();
+
+	const qword_t * start = textPacketStart;
+	textPacketStart = nullptr;
+
+	// A pipeline flush restarts the frame packet, so part of the data was already sent.
+	if (pipeFlushes != textPacketFlushes)
+	{
+		return 0;
+	}
+
+	const uint qwordCount = currentFrameQwPtr - start;
+	if (qwordCount > maxQwords)
+	{
+		return 0;
+	}
+
+	memcpy(dest, start, qwordCount * sizeof(qword_t));
+	return qwordCount;
+}
+
+// ========================================================
+// Renderer::drawTextPacket():
+// ========================================================
+
+void Renderer::drawTextPacket(const qword_t * packet, const uint qwordCount)
+{
+	ps2assert(inMode2d && "2D mode required!");
+	ps2assert(packet != nullptr);
+
+	if (qwordCount == 0)
+	{
+		return;
+	}
+
+	flushTextList();
+
+	// Recorded data is complete GIF packets, so it just goes into the 2D DMA tag as is.
+	memcpy(currentFrameQwPtr, packet, qwordCount * sizeof(qword_t));
+	currentFrameQwPtr += qwordCount;
+	drawCount2d++;
+}
+
 // ========================================================
 // Renderer::getTextLength():
 // ========================================================
@@ -1864,7 +2446,7 @@ void Renderer::getTextLength(const char * str, const BuiltInFontId fontId, Vec2f
 		{
 		case '\n' :
 			advance.x  = initialX;
-			advance.y += builtInFonts[fontId].bmpHeight * globalTextScale; // Every glyph of a font has the same height
+			advance.y += builtInFonts[fontId].height * globalTextScale; // Every glyph of a font has the same height
 			break;
 
 		case '\r' :
@@ -1882,11 +2464,10 @@ void Renderer::getTextLength(const char * str, const BuiltInFontId fontId, Vec2f
 		default :
 			if (isgraph(str[c])) // Only increment if char is printable
 			{
-				const int charIndex = str[c] - builtInFonts[fontId].charStart;
-				if (charIndex >= 0 && charIndex < BuiltInFontBitmap::MAX_GLYPHS)
+				const int charIndex = str[c] - SDF_CHAR_START;
+				if (charIndex >= 0 && charIndex < SDF_CHAR_COUNT)
 				{
-					const BuiltInFontGlyph & glyph = builtInFonts[fontId].glyphs[charIndex];
-					advance.x += glyph.w * globalTextScale;
+					advance.x += builtInFonts[fontId].advance * globalTextScale;
 				}
 			}
 			break;
@@ -1925,6 +2506,9 @@ const Matrix IDENTITY_MATRIX
 	0.0f, 0.0f, 0.0f, 1.0f
 );
 
+// Texture coordinates of a PackedDrawVertex are 4.12 fixed-point:
+const float PackedVertexFormat::TEXCOORD_SCALE = 4096.0f;
+
 // Renderer global instance:
 Renderer gRenderer;
 
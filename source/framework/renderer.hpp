@@ -36,6 +36,7 @@
 // Framework stuff:
 #include "common.hpp"
 #include "texture.hpp"
+#include "draw_vertex.hpp"
 
 // Maths helpers:
 #include "ps2_math/math_funcs.hpp"
@@ -73,32 +74,6 @@ enum BuiltInFontId
 // IDENTITY_MATRIX constant:
 extern const Matrix IDENTITY_MATRIX;
 
-// ========================================================
-// struct DrawVertex:
-// ========================================================
-
-struct ATTRIBUTE_ALIGNED(16) DrawVertex
-{
-	Vector position; // Only XYZ are used. W always = 1
-	Vector texCoord; // Only XY used. Z always = 0 and W always = 1
-	Vector color;    // XYZW are used to store the RGBA color
-};
-
-// ASM optimized packing of a DrawVertex:
-inline void packDrawVertex(DrawVertex & dv, const Vector & position, const Vector & texCoord, const Vector & color)
-{
-	asm volatile (
-		"lqc2    vf4, 0x0(%1)  \n\t" // vf4 = position
-		"lqc2    vf5, 0x0(%2)  \n\t" // vf5 = texCoord
-		"lqc2    vf6, 0x0(%3)  \n\t" // vf6 = color
-		"vmove.w vf4, vf0      \n\t" // vf4.w = 1.0 (set position.w to 1)
-		"sqc2    vf6, 0x20(%0) \n\t" // dv.color    = vf6
-		"sqc2    vf5, 0x10(%0) \n\t" // dv.texCoord = vf5
-		"sqc2    vf4, 0x00(%0) \n\t" // dv.position = vf4
-		: : "r" (&dv), "r" (&position), "r" (&texCoord), "r" (&color)
-	);
-}
-
 // ========================================================
 // class RenderPacket:
 // ========================================================
@@ -229,12 +204,13 @@ public:
 	void setClearScreenColor(ubyte r, ubyte g, ubyte b);
 
 	// Set rendering attributes for 3D primitives:
-	void setPrimShading(int shading);        // PRIM_SHADE_GOURAUD or PRIM_SHADE_FLAT. Default = PRIM_SHADE_GOURAUD
-	void setPrimTopology(int topology);      // PRIM_TRIANGLE, PRIM_LINE, PRIM_POINT, etc. Default = PRIM_TRIANGLE
-	void setPrimTextureMapping(bool enable); // Default = on
-	void setPrimFogging(bool enable);        // Default = off
-	void setPrimBlending(bool enable);       // Default = off
-	void setPrimAntialiasing(bool enable);   // Default = off
+	void setPrimShading(int shading);          // PRIM_SHADE_GOURAUD or PRIM_SHADE_FLAT. Default = PRIM_SHADE_GOURAUD
+	void setPrimTopology(int topology);        // PRIM_TRIANGLE, PRIM_LINE, PRIM_POINT, etc. Default = PRIM_TRIANGLE
+	void setPrimTextureMapping(bool enable);   // Default = on
+	void setPrimFogging(bool enable);          // Default = off
+	void setPrimBlending(bool enable);         // Default = off
+	void setPrimAdditiveBlending(bool enable); // Additive instead of alpha blending. Default = off
+	void setPrimAntialiasing(bool enable);     // Default = off
 	void setPrimBaseColor(ubyte r, ubyte g, ubyte b, ubyte a, float q); // Default = (255,255,255,255,1.0)
 
 	//
@@ -256,11 +232,29 @@ public:
 	                          const float (*texCoords)[2], uint texCoordCount,
 	                          const Color4f & baseColor);
 
+	// Same as the above, but for the compact vertex format. Positions are
+	// dequantized with `fmt` and transformed in a single VU0 pass.
+	void drawUnindexedTriangles(const PackedDrawVertex * verts, uint vertCount,
+	                            const PackedVertexFormat & fmt);
+	void drawIndexedTriangles(const uint16 * indexes, uint indexCount,
+	                          const PackedDrawVertex * verts, uint vertCount,
+	                          const PackedVertexFormat & fmt);
+
 	// Same as `drawIndexedTriangles` but without performing back-face culling.
 	// Off-screen triangle clipping is still done! This is used by the particle emitters.
 	void drawIndexedTrianglesUnculled(const uint16 * indexes, uint indexCount,
 	                                  const DrawVertex * verts, uint vertCount);
 
+	// Draws camera-facing sprites (particles) as one GS SPRITE primitive each.
+	// Only the centers are transformed, the size is projected with 1/w and clamped.
+	// Points are given as position/size streams (world units), drawn in the order of
+	// `drawOrder` (indexes into the streams) or in sequence if it is null. `colors` are
+	// optional per-sprite GS RGBA values (RGB 128 = 1.0), `color` is used if null.
+	// Sprites behind the eye or fully off-screen are rejected.
+	void drawSpritesFacingCamera(const float * posX, const float * posY, const float * posZ,
+	                             const float * sizes, const uint32 * colors, const uint16 * drawOrder,
+	                             uint count, const Color4f & color);
+
 	//
 	// Debug/line drawing:
 	//
@@ -314,6 +308,24 @@ public:
 	// Handles tabs and newlines ('\t' and '\n').
 	void drawText(Vec2f & pos, Color4b color, BuiltInFontId fontId, const char * str);
 
+	// Same as `drawText()`, but the laid out glyphs are cached, keyed by the string, font,
+	// text scale and color. Drawing the same text again, at any position, just copies the
+	// cached glyph sprites into the frame packet. Meant for literal UI strings. Text built at
+	// run time (`format()` and such) should go through `drawText()`: each new string takes
+	// a cache entry and evicts the static ones when the cache fills up.
+	void drawCachedText(Vec2f & pos, Color4b color, BuiltInFontId fontId, const char * str);
+
+	// Drop all cached text runs. Done automatically when fonts are loaded/unloaded.
+	void clearTextRunCache();
+
+	// Records the GS packet data of all the 2D drawing done between these two calls,
+	// so it can be replayed in a later frame with `drawTextPacket()`, without laying out
+	// the text again. `endTextPacket()` copies it to `dest` and returns the size in
+	// quadwords, or zero if it didn't fit or a texture switch split the recorded data.
+	void beginTextPacket();
+	uint endTextPacket(qword_t * dest, uint maxQwords);
+	void drawTextPacket(const qword_t * packet, uint qwordCount);
+
 	// Query the length in pixels a string would occupy if it were to be renderer with `drawText()`.
 	// On completion, `advance` is set to the amount `pos` would be advanced in the x and y for the
 	// given `drawText()` call with the same string. This method does not draw any text.
@@ -330,11 +342,8 @@ private:
 	Renderer & operator = (const Renderer &);
 
 	// Built-in font helpers:
-	void  fntLoadGlyphs(BuiltInFontId fontId);
-	void  fntUnloadGlyphs(BuiltInFontId fontId);
-	bool  fntAllocateAtlasSpace(BuiltInFontId fontId);
+	void  fntLoadSdfAtlas();
 	float fntGetWhiteSpaceWidth(BuiltInFontId fontId) const;
-	void  fntDecompressGlyphs(BuiltInFontId fontId);
 
 	// Misc internal helpers:
 	void initGsBuffers(int scrW, int scrH, int vidMode, int fbPsm, int zPsm, bool interlaced);
@@ -342,6 +351,11 @@ private:
 	void flipBuffers(framebuffer_t & fb);
 	void setTextureBufferSampling();
 
+	// Text glyphs are batched into a single list of GS sprites
+	// until the color changes or some other 2D primitive is drawn.
+	void beginTextList(Color4b color);
+	void flushTextList();
+
 private:
 
 	// The Renderer is an implicit singleton. Only one instance is allowed to exist.
@@ -361,6 +375,11 @@ private:
 	RenderPacket * currentFramePacket;
 	qword_t      * currentFrameQwPtr;
 	qword_t      * dmaTagDraw2d;
+	uint64       * textListStart; // First glyph of the open text sprite list.
+	uint64       * textListPtr;   // Open text sprite list, null if none.
+	Color4b        textListColor;
+	qword_t      * textPacketStart;   // Set between `beginTextPacket()` and `endTextPacket()`.
+	uint           textPacketFlushes; // `pipeFlushes` when the recording started.
 	Texture      * currentTex;
 	uint           frameIndex;
 
@@ -374,25 +393,35 @@ private:
 	color_t screenColor;
 
 	// Debug counters (per frame):
-	uint drawCount2d; // Number of 2D draw calls
-	uint drawCount3d; // Number of 3D draw calls
-	uint trisCount3d; // Number of 3D triangles sent to the GS
-	uint texSwitches; // Number of Texture switches
-	uint pipeFlushes; // Number of `flushPipeline()` calls
+	uint drawCount2d;   // Number of 2D draw calls
+	uint drawCount3d;   // Number of 3D draw calls
+	uint trisCount3d;   // Number of 3D triangles sent to the GS
+	uint spriteCount3d; // Number of 3D sprites sent to the GS
+	uint glyphCount2d;  // Number of text glyphs sent to the GS
+	uint qwordCount2d;  // Size of the 2D packets, in quadwords
+	uint prevQwordCount2d;
+	uint textCacheHits;    // `drawCachedText()` calls served from the cache
+	uint textCacheMisses;  // `drawCachedText()` calls that had to lay out the text
+	uint textCacheBytes;   // Packet bytes copied from the cache
+	uint texSwitches;   // Number of Texture switches
+	uint pipeFlushes;   // Number of `flushPipeline()` calls
 
 	// Current render matrices for 3D geometry transformation:
 	Matrix modelMatrix;
 	Matrix invModelMatrix;
 	Matrix vpMatrix;
 	Matrix mvpMatrix;
+	Matrix screenMvpMatrix; // mvpMatrix with the GS raster scale/offset folded in
 	Vector eyePosition;
 	Vector eyePosModelSpace;
 
 	// Optional default scale for text glyphs. Initially no scale (1.0):
 	float globalTextScale;
 
-	// Local atlas used by the built-in font glyphs:
-	TextureAtlas texAtlas;
+	// Signed distance field atlas shared by all the built-in font sizes.
+	// 8-bit indexes expanded from the compressed data + a CLUT ramping them to alpha.
+	Texture sdfFontTexture;
+	ubyte * sdfFontPixels;
 
 	// 2D rendering, including text, can only take place
 	// between `begin2d()` and `end2d()` calls.
@@ -0,0 +1,213 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: scratchpad.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Stack allocator and DMA helpers for the EE Scratch Pad memory (SPR).
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include "scratchpad.hpp"
+
+// ========================================================
+// Scratch Pad hardware constants:
+// ========================================================
+
+#if !defined(SCRATCH_PAD_HOST_EMULATION)
+
+// The Scratch Pad R/W memory is at a fixed address.
+static const uint32 SCRATCH_PAD_ADDRESS = 0x70000000;
+
+// fromSPR (channel 8) and toSPR (channel 9) DMA registers.
+static volatile uint32 * const D8_CHCR = rcast<volatile uint32 *>(0x1000D000);
+static volatile uint32 * const D8_MADR = rcast<volatile uint32 *>(0x1000D010);
+static volatile uint32 * const D8_QWC  = rcast<volatile uint32 *>(0x1000D020);
+static volatile uint32 * const D8_SADR = rcast<volatile uint32 *>(0x1000D080);
+static volatile uint32 * const D9_CHCR = rcast<volatile uint32 *>(0x1000D400);
+static volatile uint32 * const D9_MADR = rcast<volatile uint32 *>(0x1000D410);
+static volatile uint32 * const D9_QWC  = rcast<volatile uint32 *>(0x1000D420);
+static volatile uint32 * const D9_SADR = rcast<volatile uint32 *>(0x1000D480);
+
+// CHCR.STR: set to start a transfer, cleared by the DMAC when done.
+// Everything else zero selects a normal (non-chain) transfer.
+static const uint32 DMA_CHCR_STR = 0x100;
+
+// SPR addresses are 14 bits, quadword aligned.
+static const uint32 SPR_ADDR_MASK = 0x3FF0;
+
+// Physical address of a main RAM pointer, as the DMAC wants it.
+static const uint32 RAM_PHYS_MASK = 0x0FFFFFFF;
+
+#else // SCRATCH_PAD_HOST_EMULATION
+
+// The allocator aligns offsets from the base, so the base must be aligned
+// to at least any alignment requested, like the real SPR address is.
+static ubyte hostScratchPad[SCRATCH_PAD_SIZE_BYTES] ATTRIBUTE_ALIGNED(SCRATCH_PAD_SIZE_BYTES);
+
+#endif // SCRATCH_PAD_HOST_EMULATION
+
+// ================================================================================================
+// ScratchPadAllocator implementation:
+// ================================================================================================
+
+// ========================================================
+// ScratchPadAllocator::ScratchPadAllocator():
+// ========================================================
+
+ScratchPadAllocator::ScratchPadAllocator()
+	: base(nullptr)
+	, stackTop(0)
+	, peak(0)
+	, failedAllocs(0)
+{
+	#if !defined(SCRATCH_PAD_HOST_EMULATION)
+	base = rcast<ubyte *>(SCRATCH_PAD_ADDRESS);
+	#else // SCRATCH_PAD_HOST_EMULATION
+	base = hostScratchPad;
+	#endif // SCRATCH_PAD_HOST_EMULATION
+}
+
+// ========================================================
+// ScratchPadAllocator::allocBytes():
+// ========================================================
+
+void * ScratchPadAllocator::allocBytes(const uint sizeBytes, const uint alignment)
+{
+	ps2assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	const uint start = (stackTop + alignment - 1) & ~(alignment - 1);
+	if (start > SCRATCH_PAD_SIZE_BYTES || sizeBytes > SCRATCH_PAD_SIZE_BYTES - start)
+	{
+		// Not an error. Callers are expected to fall back to main RAM.
+		failedAllocs++;
+		return nullptr;
+	}
+
+	stackTop = start + sizeBytes;
+	if (stackTop > peak)
+	{
+		peak = stackTop;
+	}
+
+	return base + start;
+}
+
+// ========================================================
+// ScratchPadAllocator::rewind():
+// ========================================================
+
+void ScratchPadAllocator::rewind(const uint mark)
+{
+	ps2assert(mark <= stackTop && "Scratch Pad allocations released out of order!");
+	stackTop = mark;
+}
+
+// ========================================================
+// ScratchPadAllocator global instance:
+// ========================================================
+
+ScratchPadAllocator gScratchPad;
+
+// ================================================================================================
+// Scratch Pad DMA helpers:
+// ================================================================================================
+
+// ========================================================
+// sprDmaToSpr():
+// ========================================================
+
+void sprDmaToSpr(void * sprDest, const void * ramSrc, const uint qwords)
+{
+	ps2assert(gScratchPad.contains(sprDest));
+	ps2assert((rcast<size_t>(sprDest) & 15) == 0);
+	ps2assert((rcast<size_t>(ramSrc)  & 15) == 0);
+	ps2assert(qwords != 0 && qwords <= SCRATCH_PAD_SIZE_QWORDS);
+
+	#if !defined(SCRATCH_PAD_HOST_EMULATION)
+	sprDmaWaitToSpr();
+
+	// The DMAC reads RAM directly, so dirty cache lines must go out first.
+	ubyte * src = scast<ubyte *>(ccast<void *>(ramSrc));
+	SyncDCache(src, src + (qwords * 16));
+
+	*D9_MADR = rcast<uint32>(ramSrc) & RAM_PHYS_MASK;
+	*D9_SADR = rcast<uint32>(sprDest) & SPR_ADDR_MASK;
+	*D9_QWC  = qwords;
+	*D9_CHCR = DMA_CHCR_STR;
+	#else // SCRATCH_PAD_HOST_EMULATION
+	memcpy(sprDest, ramSrc, qwords * 16);
+	#endif // SCRATCH_PAD_HOST_EMULATION
+}
+
+// ========================================================
+// sprDmaFromSpr():
+// ========================================================
+
+void sprDmaFromSpr(void * ramDest, const void * sprSrc, const uint qwords)
+{
+	ps2assert(gScratchPad.contains(sprSrc));
+	ps2assert((rcast<size_t>(sprSrc)  & 15) == 0);
+	ps2assert((rcast<size_t>(ramDest) & 15) == 0);
+	ps2assert(qwords != 0 && qwords <= SCRATCH_PAD_SIZE_QWORDS);
+
+	#if !defined(SCRATCH_PAD_HOST_EMULATION)
+	sprDmaWaitFromSpr();
+
+	// Write back and drop the cached copy of the destination, so
+	// neither a later eviction nor a cache hit can see stale data.
+	ubyte * dest = scast<ubyte *>(ramDest);
+	SyncDCache(dest, dest + (qwords * 16));
+
+	*D8_MADR = rcast<uint32>(ramDest) & RAM_PHYS_MASK;
+	*D8_SADR = rcast<uint32>(sprSrc) & SPR_ADDR_MASK;
+	*D8_QWC  = qwords;
+	*D8_CHCR = DMA_CHCR_STR;
+	#else // SCRATCH_PAD_HOST_EMULATION
+	memcpy(ramDest, sprSrc, qwords * 16);
+	#endif // SCRATCH_PAD_HOST_EMULATION
+}
+
+// ========================================================
+// sprDmaWaitToSpr():
+// ========================================================
+
+void sprDmaWaitToSpr()
+{
+	#if !defined(SCRATCH_PAD_HOST_EMULATION)
+	while (*D9_CHCR & DMA_CHCR_STR) { }
+	#endif // SCRATCH_PAD_HOST_EMULATION
+}
+
+// ========================================================
+// sprDmaWaitFromSpr():
+// ========================================================
+
+void sprDmaWaitFromSpr()
+{
+	#if !defined(SCRATCH_PAD_HOST_EMULATION)
+	while (*D8_CHCR & DMA_CHCR_STR) { }
+	#endif // SCRATCH_PAD_HOST_EMULATION
+}
@@ -0,0 +1,185 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: scratchpad.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Stack allocator and DMA helpers for the EE Scratch Pad memory (SPR).
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef SCRATCHPAD_HPP
+#define SCRATCHPAD_HPP
+
+#include "common.hpp"
+
+//
+// The EE has 16KB of Scratch Pad RAM (SPR) mapped at a fixed address.
+// It is as fast as the data cache, never misses and can be filled/drained
+// by DMA while the CPU works on something else. Building without the PS2SDK
+// (no `_EE` define) replaces it with a plain 16KB buffer and the DMA helpers
+// with `memcpy`, so code using it can also run and be checked on a PC.
+//
+#if !defined(_EE)
+	#define SCRATCH_PAD_HOST_EMULATION 1
+#endif // _EE
+
+// 16 Kilobytes / 1024 quadwords.
+const uint SCRATCH_PAD_SIZE_BYTES  = 16 * 1024;
+const uint SCRATCH_PAD_SIZE_QWORDS = SCRATCH_PAD_SIZE_BYTES / 16;
+
+// ========================================================
+// class ScratchPadAllocator:
+// ========================================================
+
+//
+// Stack allocator over the Scratch Pad. Meant for short-lived
+// working sets of inner loops, so the memory is normally taken
+// with a `ScopedSprAlloc` and released when it goes out of scope.
+// Allocations return null when the SPR is full, so callers can
+// fall back to regular memory (usually the `gFrameAllocator`).
+// NOT thread-safe!
+//
+class ScratchPadAllocator
+{
+public:
+
+	ScratchPadAllocator();
+
+	// Returns null if there's not enough room left.
+	void * allocBytes(uint sizeBytes, uint alignment = DEFAULT_MEM_ALIGNMENT);
+
+	template<class T>
+	T * alloc(const uint elementCount, const uint alignment = DEFAULT_MEM_ALIGNMENT)
+	{
+		return rcast<T *>(allocBytes(elementCount * sizeof(T), alignment));
+	}
+
+	// Everything allocated after `getMark()` is released by `rewind()`.
+	uint getMark() const { return stackTop; }
+	void rewind(uint mark);
+
+	// Test if a pointer points inside the Scratch Pad.
+	bool contains(const void * ptr) const
+	{
+		const ubyte * p = scast<const ubyte *>(ptr);
+		return p >= base && p < base + SCRATCH_PAD_SIZE_BYTES;
+	}
+
+	// Usage stats. Peak is the high-water mark since startup.
+	uint getBytesUsed()     const { return stackTop; }
+	uint getBytesFree()     const { return SCRATCH_PAD_SIZE_BYTES - stackTop; }
+	uint getPeak()          const { return peak; }
+	uint getFailedAllocs()  const { return failedAllocs; }
+
+private:
+
+	// Copy/assign disallowed.
+	ScratchPadAllocator(const ScratchPadAllocator &);
+	ScratchPadAllocator & operator = (const ScratchPadAllocator &);
+
+	ubyte * base;
+	uint    stackTop;
+	uint    peak;
+	uint    failedAllocs;
+};
+
+extern ScratchPadAllocator gScratchPad;
+
+// ========================================================
+// class ScopedSprAlloc:
+// ========================================================
+
+//
+// Pushes a mark on construction and pops everything
+// allocated through it (or after it) on destruction.
+//
+class ScopedSprAlloc
+{
+public:
+
+	ScopedSprAlloc() : mark(gScratchPad.getMark()) { }
+	~ScopedSprAlloc() { gScratchPad.rewind(mark); }
+
+	template<class T>
+	T * alloc(const uint elementCount, const uint alignment = DEFAULT_MEM_ALIGNMENT)
+	{
+		return gScratchPad.alloc<T>(elementCount, alignment);
+	}
+
+private:
+
+	// Copy/assign disallowed.
+	ScopedSprAlloc(const ScopedSprAlloc &);
+	ScopedSprAlloc & operator = (const ScopedSprAlloc &);
+
+	const uint mark;
+};
+
+// ========================================================
+// sprOrFrameAlloc():
+// ========================================================
+
+// Scratch Pad if there's room, memory of the current frame otherwise.
+// Callers release it with a `ScopedSprAlloc` plus a frame allocator mark.
+template<class T>
+inline T * sprOrFrameAlloc(const uint elementCount, const uint alignment = DEFAULT_MEM_ALIGNMENT)
+{
+	T * ptr = gScratchPad.alloc<T>(elementCount, alignment);
+	if (ptr == nullptr)
+	{
+		ptr = gFrameAllocator.alloc<T>(elementCount, alignment);
+	}
+	return ptr;
+}
+
+// ========================================================
+// Scratch Pad DMA helpers:
+// ========================================================
+
+//
+// Transfers between main RAM and the Scratch Pad, using the toSPR
+// and fromSPR DMA channels. Sizes are in quadwords and both pointers
+// must be 16 bytes aligned. The main RAM range is written back from
+// the data cache and invalidated before the transfer, so it shouldn't
+// be touched by the CPU until the transfer completes.
+//
+// Starting a transfer waits for the previous one on the same channel.
+// The two channels are independent, so data can be staged in while
+// results of a previous block are still draining out.
+//
+void sprDmaToSpr(void * sprDest, const void * ramSrc, uint qwords);
+void sprDmaFromSpr(void * ramDest, const void * sprSrc, uint qwords);
+
+// Block until the transfers in flight are done.
+void sprDmaWaitToSpr();
+void sprDmaWaitFromSpr();
+
+// Round a size in bytes up to a whole number of quadwords.
+inline uint sprQwordsForBytes(const uint sizeBytes)
+{
+	return (sizeBytes + 15) >> 4;
+}
+
+#endif // SCRATCHPAD_HPP
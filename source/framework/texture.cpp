@@ -47,6 +47,7 @@
 
 Texture::Texture()
 	: texData(nullptr)
+	, clutData(nullptr)
 	, texHeight(0)
 	, texBuf()
 	, texLod()
@@ -71,6 +71,11 @@ public:
 	const ubyte * getPixels() const      { return texData;   }
 	void setPixels(const ubyte * pixels) { texData = pixels; }
 
+	// Optional CLUT colors of a palettized texture (also just a weak reference!).
+	// Uploaded by the Renderer with the pixels, at `getTexClut().address`.
+	const uint32 * getClutColors() const      { return clutData;   }
+	void setClutColors(const uint32 * colors) { clutData = colors; }
+
 	// Tables access:
 	texbuffer_t  & getTexBuffer() { return texBuf;  }
 	clutbuffer_t & getTexClut()   { return texClut; }
@@ -87,7 +92,8 @@ private:
 	Texture(const Texture &);
 	Texture & operator = (const Texture &);
 
-	const ubyte * texData; // Pointer to external data. Never freed.
+	const ubyte * texData;  // Pointer to external data. Never freed.
+	const uint32 * clutData; // Optional external CLUT. Never freed.
 	uint          texHeight;
 	texbuffer_t   texBuf;
 	lod_t         texLod;
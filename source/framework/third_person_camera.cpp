@@ -32,6 +32,7 @@
 
 #include "third_person_camera.hpp"
 #include "game_time.hpp"
+#include "ps2_math/fast_math.hpp"
 
 // ========================================================
 // ThirdPersonCamera::ThirdPersonCamera():
@@ -274,8 +275,8 @@ void ThirdPersonCamera::zoom(const float amount)
 
 void ThirdPersonCamera::rotateAroundCameraY(const float angle)
 {
-	const float sinAng = ps2math::sin(angle);
-	const float cosAng = ps2math::cos(angle);
+	float sinAng, cosAng;
+	ps2math::fast::sinCos(angle, &sinAng, &cosAng);
 
 	// Save off forward components for computation:
 	float xxx = forward.x;
@@ -0,0 +1,536 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: tlsf_allocator.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Two-Level Segregated Fit (TLSF) allocator over a fixed memory region.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+
+#include "tlsf_allocator.hpp"
+
+// ========================================================
+// Local helpers:
+// ========================================================
+
+// Blocks are split only if the remainder can hold a header plus a minimal payload.
+static const size_t TLSF_HEADER_SIZE = (sizeof(void *) * 4 + 15) & ~15;
+static const size_t TLSF_MIN_BLOCK   = TLSF_HEADER_SIZE + TlsfAllocator::ALIGN_SIZE;
+
+static inline size_t tlsfAlignUp(const size_t value, const size_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Index of the highest set bit. `x` must not be zero.
+// The EE has no count-leading-zeros for 32 bits, so a binary search it is.
+static inline uint tlsfFls(uint32 x)
+{
+	uint bit = 31;
+	if (!(x & 0xFFFF0000)) { x <<= 16; bit -= 16; }
+	if (!(x & 0xFF000000)) { x <<= 8;  bit -= 8;  }
+	if (!(x & 0xF0000000)) { x <<= 4;  bit -= 4;  }
+	if (!(x & 0xC0000000)) { x <<= 2;  bit -= 2;  }
+	if (!(x & 0x80000000)) {           bit -= 1;  }
+	return bit;
+}
+
+// Index of the lowest set bit. `x` must not be zero.
+static inline uint tlsfFfs(const uint32 x)
+{
+	return tlsfFls(x & (~x + 1));
+}
+
+// First and second level lists for a block of the given size.
+static inline void tlsfMappingInsert(const size_t size, uint * fl, uint * sl)
+{
+	if (size < TlsfAllocator::SMALL_BLOCK)
+	{
+		*fl = 0;
+		*sl = scast<uint>(size) / (TlsfAllocator::SMALL_BLOCK / TlsfAllocator::SL_COUNT);
+	}
+	else
+	{
+		const uint high = tlsfFls(scast<uint32>(size));
+		*sl = scast<uint>(size >> (high - TlsfAllocator::SL_LOG2)) ^ TlsfAllocator::SL_COUNT;
+		*fl = high - (TlsfAllocator::FL_SHIFT - 1);
+	}
+}
+
+// Same, but rounded up to the next list, so that
+// any block in the list found is big enough.
+static inline void tlsfMappingSearch(size_t size, uint * fl, uint * sl)
+{
+	if (size >= TlsfAllocator::SMALL_BLOCK)
+	{
+		size += (scast<size_t>(1) << (tlsfFls(scast<uint32>(size)) - TlsfAllocator::SL_LOG2)) - 1;
+	}
+	tlsfMappingInsert(size, fl, sl);
+}
+
+// ================================================================================================
+// TlsfAllocator implementation:
+// ================================================================================================
+
+// ========================================================
+// TlsfAllocator::nextPhys():
+// ========================================================
+
+TlsfAllocator::BlockHeader * TlsfAllocator::nextPhys(const BlockHeader * block)
+{
+	return rcast<BlockHeader *>(ccast<ubyte *>(rcast<const ubyte *>(block)) + TLSF_HEADER_SIZE + blockSize(block));
+}
+
+// ========================================================
+// TlsfAllocator::headerFromPtr():
+// ========================================================
+
+TlsfAllocator::BlockHeader * TlsfAllocator::headerFromPtr(const void * ptr)
+{
+	return rcast<BlockHeader *>(ccast<ubyte *>(scast<const ubyte *>(ptr)) - TLSF_HEADER_SIZE);
+}
+
+// ========================================================
+// TlsfAllocator::ptrFromHeader():
+// ========================================================
+
+void * TlsfAllocator::ptrFromHeader(BlockHeader * block)
+{
+	return rcast<ubyte *>(block) + TLSF_HEADER_SIZE;
+}
+
+// ========================================================
+// TlsfAllocator::init():
+// ========================================================
+
+void TlsfAllocator::init(void * memory, const size_t sizeBytes)
+{
+	ps2assert(memory != nullptr);
+
+	ubyte * start = rcast<ubyte *>(tlsfAlignUp(rcast<size_t>(memory), ALIGN_SIZE));
+	ubyte * end   = rcast<ubyte *>((rcast<size_t>(memory) + sizeBytes) & ~scast<size_t>(ALIGN_SIZE - 1));
+	ps2assert(end > start && scast<size_t>(end - start) >= TLSF_MIN_BLOCK + TLSF_HEADER_SIZE);
+
+	heapStart = start;
+	heapEnd   = end;
+	usedBytes = 0;
+	peakUsed  = 0;
+	flBitmap  = 0;
+
+	for (uint fl = 0; fl < FL_COUNT; ++fl)
+	{
+		slBitmap[fl] = 0;
+		for (uint sl = 0; sl < SL_COUNT; ++sl)
+		{
+			freeLists[fl][sl] = nullptr;
+		}
+	}
+
+	// One big free block, then a used sentinel of size zero,
+	// so the last real block always has a next physical block.
+	BlockHeader * block = rcast<BlockHeader *>(start);
+	block->prevPhys     = nullptr;
+	block->sizeAndFlags = (scast<size_t>(end - start) - (TLSF_HEADER_SIZE * 2)) | 1;
+
+	BlockHeader * sentinel  = nextPhys(block);
+	sentinel->prevPhys      = block;
+	sentinel->sizeAndFlags  = 0;
+
+	insertFree(block);
+}
+
+// ========================================================
+// TlsfAllocator::allocate():
+// ========================================================
+
+void * TlsfAllocator::allocate(const size_t sizeBytes, const size_t alignment)
+{
+	ps2assert(isInitialized());
+	ps2assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+	const size_t adjusted = tlsfAlignUp((sizeBytes != 0) ? sizeBytes : 1, ALIGN_SIZE);
+	const size_t needed   = (alignment <= ALIGN_SIZE) ? adjusted : (adjusted + alignment + TLSF_MIN_BLOCK);
+	if (needed >= (scast<size_t>(1) << 31))
+	{
+		return nullptr;
+	}
+
+	uint fl, sl;
+	tlsfMappingSearch(needed, &fl, &sl);
+	BlockHeader * block = findSuitable(&fl, &sl);
+	if (block == nullptr)
+	{
+		return nullptr;
+	}
+	removeFree(block, fl, sl);
+
+	// Split off a free block in front of the payload to align it:
+	if (alignment > ALIGN_SIZE)
+	{
+		const size_t payload = rcast<size_t>(ptrFromHeader(block));
+		size_t aligned = tlsfAlignUp(payload, alignment);
+		if (aligned != payload && (aligned - payload) < TLSF_MIN_BLOCK)
+		{
+			aligned = tlsfAlignUp(payload + TLSF_MIN_BLOCK, alignment);
+		}
+
+		const size_t gap = aligned - payload;
+		if (gap != 0)
+		{
+			BlockHeader * alignedBlock  = rcast<BlockHeader *>(rcast<ubyte *>(block) + gap);
+			alignedBlock->prevPhys      = block;
+			alignedBlock->sizeAndFlags  = blockSize(block) - gap;
+			nextPhys(alignedBlock)->prevPhys = alignedBlock;
+
+			// The block before is in use, so no merging needed.
+			block->sizeAndFlags = (gap - TLSF_HEADER_SIZE) | 1;
+			insertFree(block);
+			block = alignedBlock;
+		}
+	}
+
+	block = splitBlock(block, adjusted);
+	block->sizeAndFlags &= ~scast<size_t>(1);
+
+	usedBytes += TLSF_HEADER_SIZE + blockSize(block);
+	if (usedBytes > peakUsed)
+	{
+		peakUsed = usedBytes;
+	}
+
+	return ptrFromHeader(block);
+}
+
+// ========================================================
+// TlsfAllocator::reallocate():
+// ========================================================
+
+void * TlsfAllocator::reallocate(void * ptr, const size_t newSizeBytes, const size_t alignment)
+{
+	if (ptr == nullptr)
+	{
+		return allocate(newSizeBytes, alignment);
+	}
+
+	ps2assert(contains(ptr));
+	BlockHeader * block  = headerFromPtr(ptr);
+	const size_t oldSize = blockSize(block);
+	const size_t adjusted = tlsfAlignUp((newSizeBytes != 0) ? newSizeBytes : 1, ALIGN_SIZE);
+
+	// Try to resize in place, taking the next block if it is free:
+	BlockHeader * next = nextPhys(block);
+	if (adjusted <= oldSize || (isFree(next) && oldSize + TLSF_HEADER_SIZE + blockSize(next) >= adjusted))
+	{
+		usedBytes -= TLSF_HEADER_SIZE + oldSize;
+		if (adjusted > oldSize)
+		{
+			removeFree(next);
+			block->sizeAndFlags += TLSF_HEADER_SIZE + blockSize(next);
+			nextPhys(block)->prevPhys = block;
+		}
+
+		splitBlock(block, adjusted);
+		usedBytes += TLSF_HEADER_SIZE + blockSize(block);
+		if (usedBytes > peakUsed)
+		{
+			peakUsed = usedBytes;
+		}
+		return ptr;
+	}
+
+	void * newPtr = allocate(newSizeBytes, alignment);
+	if (newPtr == nullptr)
+	{
+		return nullptr;
+	}
+
+	memcpy(newPtr, ptr, oldSize);
+	release(ptr);
+	return newPtr;
+}
+
+// ========================================================
+// TlsfAllocator::release():
+// ========================================================
+
+void TlsfAllocator::release(void * ptr)
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+
+	ps2assert(contains(ptr));
+	BlockHeader * block = headerFromPtr(ptr);
+	ps2assert(!isFree(block) && "Double free or bad pointer!");
+
+	usedBytes -= TLSF_HEADER_SIZE + blockSize(block);
+	block->sizeAndFlags |= 1;
+
+	// Coalesce with the neighbors:
+	BlockHeader * prev = block->prevPhys;
+	if (prev != nullptr && isFree(prev))
+	{
+		removeFree(prev);
+		prev->sizeAndFlags += TLSF_HEADER_SIZE + blockSize(block);
+		nextPhys(prev)->prevPhys = prev;
+		block = prev;
+	}
+
+	block = mergeWithNext(block);
+	insertFree(block);
+}
+
+// ========================================================
+// TlsfAllocator::getBlockSize():
+// ========================================================
+
+size_t TlsfAllocator::getBlockSize(const void * ptr) const
+{
+	ps2assert(contains(ptr));
+	return blockSize(headerFromPtr(ptr));
+}
+
+// ========================================================
+// TlsfAllocator::getLargestFreeBlock():
+// ========================================================
+
+size_t TlsfAllocator::getLargestFreeBlock() const
+{
+	if (flBitmap == 0)
+	{
+		return 0;
+	}
+
+	// Only the last non-empty list has to be checked.
+	const uint fl = tlsfFls(flBitmap);
+	const uint sl = tlsfFls(slBitmap[fl]);
+
+	size_t largest = 0;
+	for (const BlockHeader * block = freeLists[fl][sl]; block != nullptr; block = block->nextFree)
+	{
+		if (blockSize(block) > largest)
+		{
+			largest = blockSize(block);
+		}
+	}
+	return largest;
+}
+
+// ========================================================
+// TlsfAllocator::checkIntegrity():
+// ========================================================
+
+bool TlsfAllocator::checkIntegrity() const
+{
+	size_t used = 0;
+	uint freeBlocks = 0;
+	const BlockHeader * prev = nullptr;
+	const BlockHeader * block = rcast<const BlockHeader *>(heapStart);
+
+	// Physical order: links are consistent and no two free blocks are adjacent.
+	while (blockSize(block) != 0 || isFree(block))
+	{
+		if (block->prevPhys != prev || rcast<const ubyte *>(block) >= heapEnd)
+		{
+			return false;
+		}
+		if (isFree(block))
+		{
+			if (prev != nullptr && isFree(prev))
+			{
+				return false;
+			}
+			++freeBlocks;
+		}
+		else
+		{
+			used += TLSF_HEADER_SIZE + blockSize(block);
+		}
+
+		prev  = block;
+		block = nextPhys(block);
+	}
+
+	if (block->prevPhys != prev || rcast<const ubyte *>(block) + TLSF_HEADER_SIZE != heapEnd || used != usedBytes)
+	{
+		return false;
+	}
+
+	// Free lists: every block is free, in the right list, and all free blocks are listed.
+	for (uint fl = 0; fl < FL_COUNT; ++fl)
+	{
+		for (uint sl = 0; sl < SL_COUNT; ++sl)
+		{
+			const bool listed = (freeLists[fl][sl] != nullptr);
+			if (listed != ((slBitmap[fl] & (1u << sl)) != 0))
+			{
+				return false;
+			}
+
+			for (const BlockHeader * f = freeLists[fl][sl]; f != nullptr; f = f->nextFree)
+			{
+				uint blockFl, blockSl;
+				tlsfMappingInsert(blockSize(f), &blockFl, &blockSl);
+				if (!isFree(f) || blockFl != fl || blockSl != sl || freeBlocks == 0)
+				{
+					return false;
+				}
+				--freeBlocks;
+			}
+		}
+
+		if ((slBitmap[fl] != 0) != ((flBitmap & (1u << fl)) != 0))
+		{
+			return false;
+		}
+	}
+
+	return freeBlocks == 0;
+}
+
+// ========================================================
+// TlsfAllocator::insertFree():
+// ========================================================
+
+void TlsfAllocator::insertFree(BlockHeader * block)
+{
+	uint fl, sl;
+	tlsfMappingInsert(blockSize(block), &fl, &sl);
+
+	BlockHeader * head = freeLists[fl][sl];
+	block->nextFree = head;
+	block->prevFree = nullptr;
+	if (head != nullptr)
+	{
+		head->prevFree = block;
+	}
+
+	freeLists[fl][sl] = block;
+	flBitmap     |= (1u << fl);
+	slBitmap[fl] |= (1u << sl);
+}
+
+// ========================================================
+// TlsfAllocator::removeFree():
+// ========================================================
+
+void TlsfAllocator::removeFree(BlockHeader * block)
+{
+	uint fl, sl;
+	tlsfMappingInsert(blockSize(block), &fl, &sl);
+	removeFree(block, fl, sl);
+}
+
+void TlsfAllocator::removeFree(BlockHeader * block, const uint fl, const uint sl)
+{
+	BlockHeader * next = block->nextFree;
+	BlockHeader * prev = block->prevFree;
+	if (next != nullptr)
+	{
+		next->prevFree = prev;
+	}
+	if (prev != nullptr)
+	{
+		prev->nextFree = next;
+		return;
+	}
+
+	freeLists[fl][sl] = next;
+	if (next == nullptr)
+	{
+		slBitmap[fl] &= ~(1u << sl);
+		if (slBitmap[fl] == 0)
+		{
+			flBitmap &= ~(1u << fl);
+		}
+	}
+}
+
+// ========================================================
+// TlsfAllocator::findSuitable():
+// ========================================================
+
+TlsfAllocator::BlockHeader * TlsfAllocator::findSuitable(uint * fl, uint * sl) const
+{
+	if (*fl >= FL_COUNT)
+	{
+		return nullptr;
+	}
+
+	// Search the current first level list, then any bigger one:
+	uint32 slMap = slBitmap[*fl] & (~0u << *sl);
+	if (slMap == 0)
+	{
+		const uint32 flMap = (*fl + 1 < 32) ? (flBitmap & (~0u << (*fl + 1))) : 0;
+		if (flMap == 0)
+		{
+			return nullptr;
+		}
+
+		*fl   = tlsfFfs(flMap);
+		slMap = slBitmap[*fl];
+	}
+
+	*sl = tlsfFfs(slMap);
+	return freeLists[*fl][*sl];
+}
+
+// ========================================================
+// TlsfAllocator::splitBlock():
+// ========================================================
+
+TlsfAllocator::BlockHeader * TlsfAllocator::splitBlock(BlockHeader * block, const size_t sizeBytes)
+{
+	// Give the tail back if it is worth a block of its own.
+	if (blockSize(block) >= sizeBytes + TLSF_MIN_BLOCK)
+	{
+		BlockHeader * rest  = rcast<BlockHeader *>(rcast<ubyte *>(ptrFromHeader(block)) + sizeBytes);
+		rest->prevPhys      = block;
+		rest->sizeAndFlags  = (blockSize(block) - sizeBytes - TLSF_HEADER_SIZE) | 1;
+		nextPhys(rest)->prevPhys = rest;
+
+		block->sizeAndFlags = sizeBytes | (block->sizeAndFlags & 1);
+		insertFree(mergeWithNext(rest));
+	}
+	return block;
+}
+
+// ========================================================
+// TlsfAllocator::mergeWithNext():
+// ========================================================
+
+TlsfAllocator::BlockHeader * TlsfAllocator::mergeWithNext(BlockHeader * block)
+{
+	BlockHeader * next = nextPhys(block);
+	if (isFree(next))
+	{
+		removeFree(next);
+		block->sizeAndFlags += TLSF_HEADER_SIZE + blockSize(next);
+		nextPhys(block)->prevPhys = block;
+	}
+	return block;
+}
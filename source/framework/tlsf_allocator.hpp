@@ -0,0 +1,138 @@
+
+// ================================================================================================
+// -*- C++ -*-
+// File: tlsf_allocator.hpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Two-Level Segregated Fit (TLSF) allocator over a fixed memory region.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+
+#ifndef TLSF_ALLOCATOR_HPP
+#define TLSF_ALLOCATOR_HPP
+
+#include "common.hpp"
+
+// ========================================================
+// class TlsfAllocator:
+// ========================================================
+
+//
+// General purpose allocator with O(1) allocate and free and immediate
+// coalescing of free blocks (see "TLSF: a New Dynamic Memory Allocator
+// for Real-Time Systems", M. Masmano et al.). Free blocks are kept in
+// lists segregated by size: the first level splits sizes in powers of
+// two, the second level splits each power of two in 32 linear ranges.
+// Two bitmaps tell which lists are non-empty, so finding a block that
+// fits is a couple of bit scans, never a walk.
+//
+// Blocks have a 16 bytes header and payloads are 16 bytes aligned.
+// Bigger alignments are handled by splitting off the front of the block.
+//
+// There's no constructor on purpose: instances with static storage are
+// zero-initialized and can be used before static constructors run, as
+// long as `init()` is called first. NOT thread-safe!
+//
+class TlsfAllocator
+{
+public:
+
+	// Take over `sizeBytes` of memory at `memory`. Not owned by the allocator.
+	void init(void * memory, size_t sizeBytes);
+	bool isInitialized() const { return heapStart != nullptr; }
+
+	// Returns null if there is no free block big enough.
+	void * allocate(size_t sizeBytes, size_t alignment);
+
+	// Grows or shrinks in place when possible, otherwise moves the block to a new
+	// one aligned to `alignment`, which should be the one `ptr` was allocated with.
+	// Returns null on failure, in which case the old block is left untouched.
+	void * reallocate(void * ptr, size_t newSizeBytes, size_t alignment = ALIGN_SIZE);
+
+	// `ptr` must have been returned by this allocator. Null is ignored.
+	void release(void * ptr);
+
+	// Test if a pointer lies within the memory managed by this allocator.
+	bool contains(const void * ptr) const
+	{
+		const ubyte * p = scast<const ubyte *>(ptr);
+		return p >= heapStart && p < heapEnd;
+	}
+
+	// Usable size of an allocated block. Can be larger than requested.
+	size_t getBlockSize(const void * ptr) const;
+
+	// Stats. Used bytes include the block headers.
+	size_t getHeapSize()  const { return scast<size_t>(heapEnd - heapStart); }
+	size_t getUsedBytes() const { return usedBytes; }
+	size_t getPeakUsed()  const { return peakUsed;  }
+	size_t getLargestFreeBlock() const;
+
+	// Walks all blocks checking the heap invariants. Slow, for debugging.
+	bool checkIntegrity() const;
+
+	enum
+	{
+		ALIGN_LOG2  = 4,
+		ALIGN_SIZE  = 1 << ALIGN_LOG2,
+		SL_LOG2     = 5,
+		SL_COUNT    = 1 << SL_LOG2,
+		FL_SHIFT    = SL_LOG2 + ALIGN_LOG2,
+		FL_COUNT    = 32 - FL_SHIFT + 1,
+		SMALL_BLOCK = 1 << FL_SHIFT
+	};
+
+private:
+
+	struct BlockHeader
+	{
+		BlockHeader * prevPhys;     // Block right before this one in memory. Null for the first.
+		size_t        sizeAndFlags; // Payload size; low bits are flags.
+		BlockHeader * nextFree;     // Free list links; only valid in free blocks.
+		BlockHeader * prevFree;
+	};
+
+	static size_t blockSize(const BlockHeader * block) { return block->sizeAndFlags & ~scast<size_t>(ALIGN_SIZE - 1); }
+	static bool   isFree(const BlockHeader * block)    { return (block->sizeAndFlags & 1) != 0; }
+	static BlockHeader * nextPhys(const BlockHeader * block);
+	static BlockHeader * headerFromPtr(const void * ptr);
+	static void * ptrFromHeader(BlockHeader * block);
+
+	void insertFree(BlockHeader * block);
+	void removeFree(BlockHeader * block);
+	void removeFree(BlockHeader * block, uint fl, uint sl);
+	BlockHeader * findSuitable(uint * fl, uint * sl) const;
+	BlockHeader * splitBlock(BlockHeader * block, size_t sizeBytes);
+	BlockHeader * mergeWithNext(BlockHeader * block);
+
+	ubyte * heapStart;
+	ubyte * heapEnd;
+	size_t  usedBytes;
+	size_t  peakUsed;
+	uint32  flBitmap;
+	uint32  slBitmap[FL_COUNT];
+	BlockHeader * freeLists[FL_COUNT][SL_COUNT];
+};
+
+#endif // TLSF_ALLOCATOR_HPP
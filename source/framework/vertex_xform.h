@@ -28,6 +28,10 @@
 // Vertex transformation routines. This is not meant to be
 // used as a header file but as a raw textual include.
 //
+// The VU0 asm has plain C++ versions for the other ps2_math
+// backends, so `tools/vertex_bench` can build the draw loops
+// on the development machine.
+//
 // ========================================================
 
 // Scale constants use to map a vertex to GS rasterizer space:
@@ -44,17 +48,74 @@ static const float V_GS_SCALE[4] ATTRIBUTE_ALIGNED(16) =
 	1.0f
 };
 
+// Vertexes per batch of the unindexed draws. Multiple of 3, so batches hold whole triangles.
+static const uint XFORM_BATCH_VERTS = 96;
+
+static inline uint xformBatchSize(const uint first, const uint count)
+{
+	return ((count - first) < XFORM_BATCH_VERTS) ? (count - first) : XFORM_BATCH_VERTS;
+}
+
+// ========================================================
+
+static inline void makeScreenMvpMatrix(Matrix & screenMvp, const Matrix & mvp)
+{
+	// The GS scale/offset of `scaleVert()` folded into the MVP.
+	// (x * q) * S + S == (x * S + w * S) * q, so the perspective
+	// divide of `transformProjectPoints()` lands in raster space.
+	const Matrix raster(
+		GS_RASTER_SCALE_X, 0.0f,              0.0f,              0.0f,
+		0.0f,              GS_RASTER_SCALE_Y, 0.0f,              0.0f,
+		0.0f,              0.0f,              GS_RASTER_SCALE_Z, 0.0f,
+		GS_RASTER_SCALE_X, GS_RASTER_SCALE_Y, GS_RASTER_SCALE_Z, 1.0f);
+
+	screenMvp = mvp * raster;
+}
+
+// ========================================================
+
+static inline void makePackedMvpMatrix(Matrix & packedMvp, const PackedVertexFormat & fmt, const Matrix & mvp)
+{
+	// Fold the dequantization into the transform, so the
+	// unpacked int16 positions go straight to raster space.
+	const Matrix dequant(
+		fmt.scale.x, 0.0f,        0.0f,        0.0f,
+		0.0f,        fmt.scale.y, 0.0f,        0.0f,
+		0.0f,        0.0f,        fmt.scale.z, 0.0f,
+		fmt.bias.x,  fmt.bias.y,  fmt.bias.z,  1.0f);
+
+	packedMvp = dequant * mvp;
+}
+
+// ========================================================
+
+static inline void makePackedEyePosition(Vector & eyePosPacked, const PackedVertexFormat & fmt, const Vector & eyeModelSpace)
+{
+	// Eye position moved into the quantized space of the vertexes.
+	eyePosPacked.x = (eyeModelSpace.x - fmt.bias.x) / fmt.scale.x;
+	eyePosPacked.y = (eyeModelSpace.y - fmt.bias.y) / fmt.scale.y;
+	eyePosPacked.z = (eyeModelSpace.z - fmt.bias.z) / fmt.scale.z;
+	eyePosPacked.w = 1.0f;
+}
+
 // ========================================================
 
 static inline void ftoi4XYZ(const Vector * vIn, int * vOut)
 {
 	// To integer fixed point. Format used for vertex positions.
+#if PS2MATH_USE_VU0
 	asm volatile (
 		"lqc2       vf4, 0x0(%1) \n\t"
 		"vftoi4.xyz vf5, vf4     \n\t"
 		"sqc2       vf5, 0x0(%0) \n\t"
 		: : "r" (vOut), "r" (vIn)
 	);
+#else // !PS2MATH_USE_VU0
+	vOut[0] = scast<int>(vIn->x * 16.0f);
+	vOut[1] = scast<int>(vIn->y * 16.0f);
+	vOut[2] = scast<int>(vIn->z * 16.0f);
+	vOut[3] = 0;
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -64,6 +125,7 @@ static inline void ftoi0XYZW(const Vector * vIn, int * vOut)
 	// Color val to integer fixed point. Used for colors only.
 	// Multiply XYZ by 128 and convert to integer FP.
 	const float q = 128.0f;
+#if PS2MATH_USE_VU0
 	asm volatile (
 		"lqc2        vf4, 0x0(%1)  \n\t"
 		"mfc1        $8,  %2       \n\t"
@@ -74,6 +136,12 @@ static inline void ftoi0XYZW(const Vector * vIn, int * vOut)
 		: : "r" (vOut), "r" (vIn), "f" (q)
 		: "$8"
 	);
+#else // !PS2MATH_USE_VU0
+	vOut[0] = scast<int>(vIn->x * q);
+	vOut[1] = scast<int>(vIn->y * q);
+	vOut[2] = scast<int>(vIn->z * q);
+	vOut[3] = scast<int>(vIn->w);
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -81,6 +149,7 @@ static inline void ftoi0XYZW(const Vector * vIn, int * vOut)
 static inline void setTexcColor(DrawVertex & dv, const Vector & texCoord, const Vector & color)
 {
 	// Sets the `texCoord` and `color` fields of a DrawVertex with 4 VU instructions.
+#if PS2MATH_USE_VU0
 	asm volatile (
 		"lqc2 vf5, 0x00(%1) \n\t" // vf5 = texCoord
 		"lqc2 vf6, 0x00(%2) \n\t" // vf6 = color
@@ -88,6 +157,10 @@ static inline void setTexcColor(DrawVertex & dv, const Vector & texCoord, const
 		"sqc2 vf5, 0x10(%0) \n\t" // dv.texCoord = vf5
 		: : "r" (&dv), "r" (&texCoord), "r" (&color)
 	);
+#else // !PS2MATH_USE_VU0
+	dv.texCoord = texCoord;
+	dv.color    = color;
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -95,6 +168,7 @@ static inline void setTexcColor(DrawVertex & dv, const Vector & texCoord, const
 static inline void scaleVert(Vector * v, float q)
 {
 	// Multiply `v` by `q` and scale XYZ using the GS scale factors.
+#if PS2MATH_USE_VU0
 	asm volatile (
 		"lqc2      vf4, 0x0(%0)  \n\t"
 		"lqc2      vf5, 0x0(%1)  \n\t"
@@ -107,6 +181,11 @@ static inline void scaleVert(Vector * v, float q)
 		: : "r" (v), "r" (V_GS_SCALE), "f" (q)
 		: "$8"
 	);
+#else // !PS2MATH_USE_VU0
+	v->x = (v->x * q) * V_GS_SCALE[0] + V_GS_SCALE[0];
+	v->y = (v->y * q) * V_GS_SCALE[1] + V_GS_SCALE[1];
+	v->z = (v->z * q) * V_GS_SCALE[2] + V_GS_SCALE[2];
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -115,6 +194,7 @@ static inline void applyXForm(Vector * vOut, const Matrix * m, const Vector * vI
 {
 	// Multiply Vector with Matrix (apply transform).
 	// This was salvaged from libVu0.c
+#if PS2MATH_USE_VU0
 	asm volatile (
 		"lqc2         vf4, 0x0(%1)  \n\t"
 		"lqc2         vf5, 0x10(%1) \n\t"
@@ -128,14 +208,19 @@ static inline void applyXForm(Vector * vOut, const Matrix * m, const Vector * vI
 		"sqc2         vf9, 0x0(%0)  \n\t"
 		: : "r" (vOut), "r" (m), "r" (vIn)
 	);
+#else // !PS2MATH_USE_VU0
+	*vOut = (*m) * (*vIn);
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
 static inline void inverseMatrix(Matrix * mOut, const Matrix * mIn)
 {
-	// Inverse of input matrix.
+	// Inverse of input matrix. Rotation and translation only,
+	// the 3x3 part is transposed rather than inverted.
 	// This was salvaged from libVu0.c
+#if PS2MATH_USE_VU0
 	asm volatile (
 		"lq          $8,  0x00(%1) \n\t"
 		"lq          $9,  0x10(%1) \n\t"
@@ -166,13 +251,30 @@ static inline void inverseMatrix(Matrix * mOut, const Matrix * mIn)
 		: : "r" (mOut), "r" (mIn)
 		: "$8", "$9", "$10", "$11", "$12", "$13", "$14", "$15"
 	);
+#else // !PS2MATH_USE_VU0
+	const Matrix & m = *mIn;
+	Matrix result;
+	for (int i = 0; i < 3; ++i)
+	{
+		for (int j = 0; j < 3; ++j)
+		{
+			result(i,j) = m(j,i);
+		}
+		result(i,3) = 0.0f;
+		result(3,i) = -(m(3,0) * m(i,0) + m(3,1) * m(i,1) + m(3,2) * m(i,2));
+	}
+	result(3,3) = m(3,3);
+	*mOut = result;
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
 static inline bool clipTriangle(const Vector * v0, const Vector * v1, const Vector * v2)
 {
+	// Any X, Y or W <= 0 or X, Y >= 4096 (the status flags below).
 	// This was salvaged from libVu0.c
+#if PS2MATH_USE_VU0
 	register int ret;
 	asm volatile (
 		"vsub.xyzw vf04, vf00, vf00 \n\t"
@@ -202,6 +304,18 @@ static inline bool clipTriangle(const Vector * v0, const Vector * v1, const Vect
 		: "r"  (v0), "r" (v1), "r" (v2)
 	);
 	return ret != 0;
+#else // !PS2MATH_USE_VU0
+	const Vector * v[3] = { v0, v1, v2 };
+	for (int i = 0; i < 3; ++i)
+	{
+		if (v[i]->x <= 0.0f || v[i]->y <= 0.0f || v[i]->w <= 0.0f ||
+		    v[i]->x >= 4096.0f || v[i]->y >= 4096.0f)
+		{
+			return true;
+		}
+	}
+	return false;
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
@@ -216,6 +330,7 @@ static inline bool cullBackFacingTriangle(const Vector * eye, const Vector * v0,
 	// const Vector c = *v0 - *eye;
 	// return dotProduct3(c, d) <= 0.0f;
 	//
+#if PS2MATH_USE_VU0
 	register float dot;
 	asm volatile (
 		"lqc2        vf4, 0x0(%1)  \n\t" // vf4 = eye
@@ -238,11 +353,16 @@ static inline bool cullBackFacingTriangle(const Vector * eye, const Vector * v0,
 		: "$2"
 	);
 	return dot <= 0.0f;
+#else // !PS2MATH_USE_VU0
+	const Vector d = crossProduct(*v2 - *v0, *v1 - *v0);
+	const Vector c = *v0 - *eye;
+	return dotProduct3(c, d) <= 0.0f;
+#endif // PS2MATH_USE_VU0
 }
 
 // ========================================================
 
-static inline void emitVert(uint64 * restrict & packetPtr, Vector & tPos, const float q, const DrawVertex & dv)
+static inline void emitVert(uint64 * restrict & packetPtr, const Vector & tPos, const float q, const DrawVertex & dv)
 {
 	// Convert vertex position to fixed-point:
 	int tPosFixed[4] ATTRIBUTE_ALIGNED(16);
@@ -279,29 +399,146 @@ static inline void emitVert(uint64 * restrict & packetPtr, Vector & tPos, const
 
 // ========================================================
 
-static inline void emitLine(qword_t * restrict & packetPtr, const Matrix & mvpMatrix,
-                            const Vector & from, const Vector & to, const Color4f & color)
+static inline void unpackVerts(Vector * restrict vOut, const PackedDrawVertex * restrict pv, const uint count)
 {
-	float   qFrom;
-	float   qTo;
-	Vector  tPosFrom;
-	Vector  tPosTo;
-	xyz_t   gsPosFrom;
-	xyz_t   gsPosTo;
-	Vector  tColor;
+	// Unpack the int16 positions of PackedDrawVertexes to float,
+	// with W=1. Still quantized; the scale/bias goes in the matrix.
+	//
+	// pextlh with $0 moves each int16 to the upper half of a word,
+	// then the arithmetic shift brings it back down sign-extended.
+	for (uint i = 0; i < count; ++i)
+	{
+#if PS2MATH_USE_VU0
+		asm volatile (
+			"lq         $8,  0x0(%1) \n\t" // $8  = whole vertex
+			"pextlh     $8,  $8,  $0 \n\t" // $8  = { x<<16, y<<16, z<<16, u<<16 }
+			"psraw      $8,  $8,  16 \n\t" // $8  = { x, y, z, u } sign-extended
+			"qmtc2      $8,  vf8     \n\t"
+			"vitof0.xyz vf8, vf8     \n\t" // vf8 = float(xyz)
+			"vmove.w    vf8, vf0     \n\t" // vf8.w = 1
+			"sqc2       vf8, 0x0(%0) \n\t"
+			: : "r" (&vOut[i]), "r" (&pv[i])
+			: "$8"
+		);
+#else // !PS2MATH_USE_VU0
+		vOut[i].x = pv[i].position[0];
+		vOut[i].y = pv[i].position[1];
+		vOut[i].z = pv[i].position[2];
+		vOut[i].w = 1.0f;
+#endif // PS2MATH_USE_VU0
+	}
+}
+
+// ========================================================
+
+static inline void emitPackedVert(uint64 * restrict & packetPtr, const Vector & tPos, const float q, const PackedDrawVertex & pv)
+{
+	// Convert vertex position to fixed-point:
+	int tPosFixed[4] ATTRIBUTE_ALIGNED(16);
+	ftoi4XYZ(&tPos, tPosFixed);
+
+	// Color is already in the GS format:
 	color_t gsColor;
-	int     tPosFixed[4]   ATTRIBUTE_ALIGNED(16);
-	int     tColorFixed[4] ATTRIBUTE_ALIGNED(16);
+	gsColor.r = pv.color[0];
+	gsColor.g = pv.color[1];
+	gsColor.b = pv.color[2];
+	gsColor.a = pv.color[3];
+	gsColor.q = q;
+
+	// Texture coords from fixed-point, with perspective scale:
+	const float uvScale = q * (1.0f / PackedVertexFormat::TEXCOORD_SCALE);
+	texel_t gsTexel;
+	gsTexel.u = scast<float>(pv.texCoord[0]) * uvScale;
+	gsTexel.v = scast<float>(pv.texCoord[1]) * uvScale;
+
+	// Store fixed-point position:
+	xyz_t gsPos;
+	gsPos.x = scast<u16>(tPosFixed[0]);
+	gsPos.y = scast<u16>(tPosFixed[1]);
+	gsPos.z = scast<u32>(tPosFixed[2]);
+
+	// Add to packet:
+	*(packetPtr)++ = gsColor.rgbaq;
+	*(packetPtr)++ = gsTexel.uv;
+	*(packetPtr)++ = gsPos.xyz;
+}
+
+// ========================================================
+
+// Sprite size limits, in pixels (half the width/height):
+static const float SPRITE_MIN_HALF_SIZE = 0.5f;
+static const float SPRITE_MAX_HALF_SIZE = 128.0f;
+
+// Sprites with a W smaller than this are behind or too close to the eye.
+static const float SPRITE_MIN_W = 0.01f;
+
+static inline void emitSprite(uint64 * restrict & packetPtr, const Vector & tPos, const float halfW,
+                              const float halfH, const float q, color_t gsColor)
+{
+	// A GS sprite is defined by its top-left and bottom-right corners.
+	// Both use the Q of the center, so the texture is mapped linearly.
+	const Vector corner0(tPos.x - halfW, tPos.y - halfH, tPos.z, 1.0f);
+	const Vector corner1(tPos.x + halfW, tPos.y + halfH, tPos.z, 1.0f);
+
+	int tPosFixed0[4] ATTRIBUTE_ALIGNED(16);
+	int tPosFixed1[4] ATTRIBUTE_ALIGNED(16);
+	ftoi4XYZ(&corner0, tPosFixed0);
+	ftoi4XYZ(&corner1, tPosFixed1);
+
+	gsColor.q = q;
+
+	texel_t gsTexel0;
+	gsTexel0.u = 0.0f;
+	gsTexel0.v = 0.0f;
 
-	// Transform the two vertexes:
-	applyXForm(&tPosFrom, &mvpMatrix, &from);
-	applyXForm(&tPosTo,   &mvpMatrix, &to);
+	texel_t gsTexel1;
+	gsTexel1.u = q;
+	gsTexel1.v = q;
 
-	// Perspective divide and scale:
-	qFrom = 1.0f / tPosFrom.w;
-	qTo   = 1.0f / tPosTo.w;
-	scaleVert(&tPosFrom, qFrom);
-	scaleVert(&tPosTo,   qTo);
+	xyz_t gsPos0;
+	gsPos0.x = scast<u16>(tPosFixed0[0]);
+	gsPos0.y = scast<u16>(tPosFixed0[1]);
+	gsPos0.z = scast<u32>(tPosFixed0[2]);
+
+	xyz_t gsPos1;
+	gsPos1.x = scast<u16>(tPosFixed1[0]);
+	gsPos1.y = scast<u16>(tPosFixed1[1]);
+	gsPos1.z = scast<u32>(tPosFixed1[2]);
+
+	// Add to packet:
+	*(packetPtr)++ = gsColor.rgbaq;
+	*(packetPtr)++ = gsTexel0.uv;
+	*(packetPtr)++ = gsPos0.xyz;
+	*(packetPtr)++ = gsColor.rgbaq;
+	*(packetPtr)++ = gsTexel1.uv;
+	*(packetPtr)++ = gsPos1.xyz;
+}
+
+// ========================================================
+
+static inline color_t makeGsLineColor(const Color4f & color)
+{
+	// Transform color to GS format and convert to fixed-point:
+	Vector tColor(color.r, color.g, color.b, color.a);
+	int tColorFixed[4] ATTRIBUTE_ALIGNED(16);
+	ftoi0XYZW(&tColor, tColorFixed);
+
+	color_t gsColor;
+	gsColor.r = scast<ubyte>(tColorFixed[0]);
+	gsColor.g = scast<ubyte>(tColorFixed[1]);
+	gsColor.b = scast<ubyte>(tColorFixed[2]);
+	gsColor.a = scast<ubyte>(tColorFixed[3]);
+	gsColor.q = 1.0f; // Unimportant in this case. Set to 1.
+	return gsColor;
+}
+
+static inline void emitLine(qword_t * restrict & packetPtr, const Vector & tPosFrom,
+                            const Vector & tPosTo, const color_t gsColor)
+{
+	// Endpoints already went through `transformProjectPoints()`.
+	xyz_t gsPosFrom;
+	xyz_t gsPosTo;
+	int   tPosFixed[4] ATTRIBUTE_ALIGNED(16);
 
 	// HACK: I'm getting lazy here and reusing the triangle clipping function.
 	// Works well enough for our purposes. We don't need efficiency for debug line rendering.
@@ -322,20 +559,6 @@ static inline void emitLine(qword_t * restrict & packetPtr, const Matrix & mvpMa
 	gsPosTo.y = scast<u16>(tPosFixed[1]);
 	gsPosTo.z = scast<u32>(tPosFixed[2]);
 
-	// Transform color to GS format and convert to fixed-point:
-	tColor.x = color.r;
-	tColor.y = color.g;
-	tColor.z = color.b;
-	tColor.w = color.a;
-	ftoi0XYZW(&tColor, tColorFixed);
-
-	// Store fixed-point color:
-	gsColor.r = scast<ubyte>(tColorFixed[0]);
-	gsColor.g = scast<ubyte>(tColorFixed[1]);
-	gsColor.b = scast<ubyte>(tColorFixed[2]);
-	gsColor.a = scast<ubyte>(tColorFixed[3]);
-	gsColor.q = 1.0f; // Unimportant in this case. Set to 1.
-
 	// "Draw" the line (add it to a render packet):
 	packetPtr->dw[0] = gsColor.rgbaq;
 	packetPtr->dw[1] = gsPosFrom.xyz;
@@ -387,54 +610,100 @@ static inline void emitLine(qword_t * restrict & packetPtr, const Matrix & mvpMa
 
 #ifndef NO_TRIANGLE_CLIPPING
 
-#define TRIANGLE_XFORM_SCR_CLIP(v0, v1, v2)  \
-	applyXForm(&tPos0, &mvpMatrix, &(v0)); \
-	applyXForm(&tPos1, &mvpMatrix, &(v1)); \
-	applyXForm(&tPos2, &mvpMatrix, &(v2)); \
-	const float q0 = 1.0f / tPos0.w; \
-	scaleVert(&tPos0, q0); \
-	const float q1 = 1.0f / tPos1.w; \
-	scaleVert(&tPos1, q1); \
-	const float q2 = 1.0f / tPos2.w; \
-	scaleVert(&tPos2, q2); \
-	if (clipTriangle(&tPos0, &tPos1, &tPos2)) \
+#define PROJECTED_TRIANGLE_SCR_CLIP(t0, t1, t2) \
+	if (clipTriangle(&(t0), &(t1), &(t2))) \
 	{ \
 		continue; \
 	}
 
 #else // NO_TRIANGLE_CLIPPING defined
 
-#define TRIANGLE_XFORM_SCR_CLIP(v0, v1, v2)  \
-	applyXForm(&tPos0, &mvpMatrix, &(v0)); \
-	applyXForm(&tPos1, &mvpMatrix, &(v1)); \
-	applyXForm(&tPos2, &mvpMatrix, &(v2)); \
-	const float q0 = 1.0f / tPos0.w; \
-	scaleVert(&tPos0, q0); \
-	const float q1 = 1.0f / tPos1.w; \
-	scaleVert(&tPos1, q1); \
-	const float q2 = 1.0f / tPos2.w; \
-	scaleVert(&tPos2, q2); \
-	/* No clipping after the transform when disabled! */
+#define PROJECTED_TRIANGLE_SCR_CLIP(t0, t1, t2) /* No clipping after the transform when disabled! */
 
 #endif // NO_TRIANGLE_CLIPPING
 
 // ========================================================
 
-#define XFORM_TRIANGLE(v0, v1, v2) \
-	Vector tPos0, tPos1, tPos2; \
-	TRIANGLE_BACK_FACE_CULL((v0).position, (v1).position, (v2).position); \
-	TRIANGLE_XFORM_SCR_CLIP((v0).position, (v1).position, (v2).position); \
-	emitVert(packetPtr, tPos0, q0, (v0)); \
-	emitVert(packetPtr, tPos1, q1, (v1)); \
-	emitVert(packetPtr, tPos2, q2, (v2));
+// `t0-t2` are the positions output by `transformProjectPoints()`, with Q in W.
+#define EMIT_PROJECTED_TRIANGLE(v0, v1, v2, t0, t1, t2) \
+	PROJECTED_TRIANGLE_SCR_CLIP((t0), (t1), (t2)); \
+	emitVert(packetPtr, (t0), (t0).w, (v0)); \
+	emitVert(packetPtr, (t1), (t1).w, (v1)); \
+	emitVert(packetPtr, (t2), (t2).w, (v2));
+
+// ========================================================
+
+#ifndef NO_BACK_FACE_CULLING
+
+// Culling happens in the quantized space of the packed vertexes, against
+// `eyePosPacked`. Scaling all axes by positive factors preserves the sign
+// of the test, so the result is the same as in model space.
+#define PACKED_TRIANGLE_BACK_FACE_CULL(v0, v1, v2) \
+	if (cullBackFacingTriangle(&eyePosPacked, &(v0), &(v1), &(v2))) \
+	{ \
+		continue; \
+	}
+
+#else // NO_BACK_FACE_CULLING defined
+
+#define PACKED_TRIANGLE_BACK_FACE_CULL(v0, v1, v2) /* No-op */
+
+#endif // NO_BACK_FACE_CULLING
+
+// Expects `eyePosPacked` to be declared by the caller. `q0-q2` are the
+// unpacked positions and `t0-t2` the projected ones, with Q in W.
+#define EMIT_PACKED_TRIANGLE(v0, v1, v2, q0, q1, q2, t0, t1, t2) \
+	PACKED_TRIANGLE_BACK_FACE_CULL((q0), (q1), (q2)); \
+	PROJECTED_TRIANGLE_SCR_CLIP((t0), (t1), (t2)); \
+	emitPackedVert(packetPtr, (t0), (t0).w, (v0)); \
+	emitPackedVert(packetPtr, (t1), (t1).w, (v1)); \
+	emitPackedVert(packetPtr, (t2), (t2).w, (v2));
+
+// ========================================================
+
+// Transforms, culls, clips and emits one batch of an unindexed DrawVertex draw.
+// `batchVerts` is at most XFORM_BATCH_VERTS, as is `tPositions[]`, which receives
+// the projected positions. Returns the number of triangles added to the packet.
+static inline uint drawTriangleBatch(uint64 * restrict & packetPtr, const DrawVertex * restrict batch,
+                                     const uint batchVerts, const Matrix & screenMvp,
+                                     const Vector & eyePosModelSpace, Vector * restrict tPositions)
+{
+	transformProjectPoints(tPositions, screenMvp, &batch->position, sizeof(DrawVertex), batchVerts);
+
+	uint trisEmitted = 0;
+	for (uint v = 0; v < batchVerts; v += 3)
+	{
+		const DrawVertex & v0 = batch[v + 0];
+		const DrawVertex & v1 = batch[v + 1];
+		const DrawVertex & v2 = batch[v + 2];
+		TRIANGLE_BACK_FACE_CULL(v0.position, v1.position, v2.position);
+		EMIT_PROJECTED_TRIANGLE(v0, v1, v2, tPositions[v + 0], tPositions[v + 1], tPositions[v + 2]);
+		++trisEmitted;
+	}
+	return trisEmitted;
+}
 
 // ========================================================
 
-#define XFORM_TRIANGLE_NO_BF_CULL(v0, v1, v2) \
-	Vector tPos0, tPos1, tPos2; \
-	TRIANGLE_XFORM_SCR_CLIP((v0).position, (v1).position, (v2).position); \
-	emitVert(packetPtr, tPos0, q0, (v0)); \
-	emitVert(packetPtr, tPos1, q1, (v1)); \
-	emitVert(packetPtr, tPos2, q2, (v2));
+// Same as the above for PackedDrawVertexes. `packedMvp` and `eyePosPacked` come from
+// `makePackedMvpMatrix()` and `makePackedEyePosition()`; `qPositions[]` receives the
+// unpacked positions.
+static inline uint drawPackedTriangleBatch(uint64 * restrict & packetPtr, const PackedDrawVertex * restrict batch,
+                                           const uint batchVerts, const Matrix & packedMvp, const Vector & eyePosPacked,
+                                           Vector * restrict qPositions, Vector * restrict tPositions)
+{
+	unpackVerts(qPositions, batch, batchVerts);
+	transformProjectPoints(tPositions, packedMvp, qPositions, batchVerts);
+
+	uint trisEmitted = 0;
+	for (uint v = 0; v < batchVerts; v += 3)
+	{
+		EMIT_PACKED_TRIANGLE(batch[v + 0], batch[v + 1], batch[v + 2],
+			qPositions[v + 0], qPositions[v + 1], qPositions[v + 2],
+			tPositions[v + 0], tPositions[v + 1], tPositions[v + 2]);
+		++trisEmitted;
+	}
+	return trisEmitted;
+}
 
 // ========================================================
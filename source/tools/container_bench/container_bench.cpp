@@ -0,0 +1,599 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: container_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host test and benchmark of Array, SmallArray and HashMap against the old Array.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds `framework/array.hpp` and `framework/hash_map.hpp` for the host,
+// over the TLSF heap of `framework/tlsf_allocator.cpp` like `memTagMalloc()`
+// on the PS2, and:
+//
+//  - checks the non-POD support (every constructed element destroyed exactly
+//    once through growth, insert, erase and clear), SmallArray spilling and
+//    going back inline, and HashMap against a reference over random inserts,
+//    erases and lookups.
+//  - times them against the old Array<T>, which grew by a fixed few elements
+//    at a time: appends of ints and 16 byte structs (like the `md2Anims` and
+//    `TextureAtlas::nodes` loads), front inserts, many tiny arrays, and anim
+//    name lookups by `strcmp()` scan against the HashMap.
+//
+// The old Array is the one from before the geometric growth, cut down to
+// what the benchmark calls. Runs on the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework container_bench.cpp -o container_bench
+//   ./container_bench
+//
+// Exits with a non-zero status if any check fails.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <time.h>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` needs the PS2SDK headers, so define the few
+// things the containers use and skip the real header.
+#define COMMON_HPP
+
+#define nullptr NULL
+#define ccast const_cast
+#define rcast reinterpret_cast
+#define scast static_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+#define NOINLINE __attribute__((noinline))
+
+typedef unsigned char ubyte;
+typedef unsigned int  uint;
+typedef unsigned int  uint32;
+typedef int           int32;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+#define fatalError(...) do { std::printf(__VA_ARGS__); std::exit(EXIT_FAILURE); } while (0)
+
+#include "tlsf_allocator.cpp"
+
+// Same interface as `framework/memory.hpp`, over a TLSF heap.
+enum MemAllocTag { MEM_TAG_GENERIC, MEM_TAG_CPP_NEW };
+const size_t DEFAULT_MEM_ALIGNMENT = 16;
+static TlsfAllocator gTlsfHeap;
+
+inline MemAllocTag memGetNewTag() { return MEM_TAG_CPP_NEW; }
+
+template<class T>
+inline T * memAlloc(MemAllocTag, const size_t elementCount, const size_t alignment = DEFAULT_MEM_ALIGNMENT)
+{
+	return scast<T *>(gTlsfHeap.allocate(elementCount * sizeof(T), alignment));
+}
+
+template<class T>
+inline T * memClearedAlloc(MemAllocTag tag, const size_t elementCount, const size_t alignment = DEFAULT_MEM_ALIGNMENT)
+{
+	T * ptr = memAlloc<T>(tag, elementCount, alignment);
+	if (ptr != nullptr)
+	{
+		std::memset(ptr, 0, elementCount * sizeof(T));
+	}
+	return ptr;
+}
+
+inline void memFree(MemAllocTag, void * ptr)
+{
+	gTlsfHeap.release(ptr);
+}
+
+struct MemPlacement { };
+
+inline void * operator new (size_t, void * where, MemPlacement)
+{
+	return where;
+}
+
+inline void operator delete (void *, void *, MemPlacement)
+{
+}
+
+template<class T>
+inline void memConstruct(T * where)
+{
+	new (where, MemPlacement()) T();
+}
+
+template<class T>
+inline void memConstruct(T * where, const T & value)
+{
+	new (where, MemPlacement()) T(value);
+}
+
+template<class T>
+inline void memDestroy(T * obj)
+{
+	obj->~T();
+}
+
+#include "array.hpp"
+#include "hash_map.hpp"
+
+// ========================================================
+// The old Array<T>:
+// ========================================================
+
+// Before the geometric growth: POD only, and every reallocation
+// adds just ALLOCEXTRA elements on top of what was asked for.
+template<class T>
+class OldArray
+{
+public:
+
+	typedef unsigned int size_type;
+
+	OldArray() : ptr(nullptr), total(0), used(0) { }
+	~OldArray() { if (ptr != nullptr) { memFree(MEM_TAG_GENERIC, ptr); } }
+
+	void reserve(const size_type newCapacity)
+	{
+		if (newCapacity <= total)
+		{
+			return;
+		}
+
+		T * oldPtr = ptr;
+		total = newCapacity + ALLOCEXTRA;
+		ptr   = memAlloc<T>(MEM_TAG_GENERIC, total);
+		if (ptr == nullptr)
+		{
+			fatalError("Out-of-memory on Array<T> reallocation!");
+		}
+		if (oldPtr != nullptr)
+		{
+			std::memcpy(ptr, oldPtr, used * sizeof(T));
+			memFree(MEM_TAG_GENERIC, oldPtr);
+		}
+	}
+
+	void pushBack(const T & val)
+	{
+		if (used == total)
+		{
+			reserve(total + 1);
+		}
+		ptr[used++] = val;
+	}
+
+	void insert(const size_type index, const T & val)
+	{
+		if (total <= used)
+		{
+			reserve(total + 1);
+		}
+		if (index < used)
+		{
+			std::memmove(ptr + index + 1, ptr + index, (used - index) * sizeof(T));
+		}
+		++used;
+		ptr[index] = val;
+	}
+
+	size_type size() const { return used; }
+	const T & operator [] (const size_type index) const { return ptr[index]; }
+
+private:
+
+	OldArray(const OldArray &);
+	OldArray & operator = (const OldArray &);
+
+	T *       ptr;
+	size_type total;
+	size_type used;
+
+	enum { ALLOCEXTRA = ( (sizeof(T) <= 1) ? 64
+	                    : (sizeof(T) <= 2) ? 32
+	                    : (sizeof(T) <= 4) ? 16
+	                    : (sizeof(T) <= 8) ? 8 : 4 ) };
+};
+
+// ========================================================
+// Test helpers:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static uint32 randUint()
+{
+	randState = randState * 1664525 + 1013904223;
+	return randState >> 8;
+}
+
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Keeps the optimizer from dropping the work.
+static volatile uint32 sink;
+
+// Counts its live instances and checks it's never copied from a dead one.
+struct Tracked
+{
+	static int live;
+	int  value;
+	bool alive;
+
+	explicit Tracked(const int v = 0) : value(v), alive(true) { ++live; }
+	Tracked(const Tracked & other) : value(other.value), alive(true) { CHECK(other.alive); ++live; }
+	~Tracked() { CHECK(alive); *ccast<volatile bool *>(&alive) = false; --live; } // Volatile, or GCC drops the dead store.
+	Tracked & operator = (const Tracked & other) { CHECK(alive && other.alive); value = other.value; return *this; }
+	bool operator == (const Tracked & other) const { return value == other.value; }
+};
+int Tracked::live = 0;
+
+// 16 bytes, like an MD2 anim entry.
+struct Node
+{
+	uint x, y, w, h;
+};
+
+// 12 bytes, like a `TextureAtlas` skyline node (Vec3i).
+struct SkylineNode
+{
+	int x, y, z;
+};
+
+// ========================================================
+// Tests:
+// ========================================================
+
+static void testNonPod()
+{
+	std::printf("Non-POD element lifetimes...\n");
+	{
+		Array<Tracked> array;
+		for (int i = 0; i < 1000; ++i)
+		{
+			array.pushBack(Tracked(i));
+		}
+		array.insert(0, array[500]); // Element of the same array.
+		array.insert(array.size(), array[0]);
+		array.erase(10);
+		array.popBack();
+		CHECK(Tracked::live == scast<int>(array.size()));
+		CHECK(array[0].value == 500 && array[1].value == 0 && array[10].value == 10);
+		array.resize(50, Tracked(7));
+		CHECK(Tracked::live == 50 && array[49].value == 7);
+		array.clear();
+		CHECK(Tracked::live == 0);
+	}
+	{
+		SmallArray<Tracked, 8> small;
+		for (int i = 0; i < 8; ++i)
+		{
+			small.pushBack(Tracked(i));
+		}
+		CHECK(small.isInline());
+		small.pushBack(Tracked(8));
+		CHECK(!small.isInline() && small[8].value == 8 && small[0].value == 0);
+		small.clear();
+		CHECK(small.isInline() && Tracked::live == 0);
+		small.pushBack(Tracked(1));
+	}
+	CHECK(Tracked::live == 0);
+}
+
+static void testHashMap()
+{
+	std::printf("HashMap against std::map, 200k random operations...\n");
+	{
+		HashMap<uint32, Tracked> map;
+		std::map<uint32, int> reference;
+		bool same = true;
+
+		for (int op = 0; op < 200000; ++op)
+		{
+			const uint32 key = randUint() % 5000;
+			const uint r = randUint() % 10;
+			if (r < 5)
+			{
+				const bool wasNew = map.insert(key, Tracked(op));
+				same = same && (wasNew == (reference.find(key) == reference.end()));
+				reference[key] = op;
+			}
+			else if (r < 8)
+			{
+				same = same && (map.erase(key) == (reference.erase(key) != 0));
+			}
+			else
+			{
+				const Tracked * found = map.find(key);
+				std::map<uint32, int>::const_iterator it = reference.find(key);
+				same = same && ((found == nullptr) == (it == reference.end()));
+				same = same && (found == nullptr || found->value == it->second);
+			}
+		}
+
+		CHECK(same);
+		CHECK(map.size() == reference.size());
+		CHECK(Tracked::live == scast<int>(map.size()));
+
+		uint visited = 0;
+		for (uint b = 0; b < map.getBucketCount(); ++b)
+		{
+			if (map.isBucketUsed(b))
+			{
+				CHECK(reference[map.getKeyAt(b)] == map.getValueAt(b).value);
+				++visited;
+			}
+		}
+		CHECK(visited == map.size());
+	}
+	{
+		// Values copied from another entry, through the growth points.
+		HashMap<uint32, Tracked> map;
+		map.insert(0, Tracked(100));
+		for (uint32 k = 1; k < 1000; ++k)
+		{
+			map.insert(k, map[k - 1]);
+		}
+		CHECK(map.size() == 1000 && map[999].value == 100);
+	}
+	CHECK(Tracked::live == 0);
+}
+
+// ========================================================
+// Benchmarks:
+// ========================================================
+
+static const int TRIALS = 3;
+
+// Milliseconds of the body, best of TRIALS.
+#define TIME_MS(result, ...) \
+	do { \
+		(result) = 1e30; \
+		for (int trial = 0; trial < TRIALS; ++trial) \
+		{ \
+			const double start = nowSeconds(); \
+			__VA_ARGS__; \
+			const double ms = (nowSeconds() - start) * 1e3; \
+			if (ms < (result)) { (result) = ms; } \
+		} \
+	} while (0)
+
+// The kernels are kept out of line, so that the code generated
+// for each array is not affected by what got inlined around it.
+template<class ARRAY, class T>
+static NOINLINE void appendAll(const uint count, const T & value)
+{
+	ARRAY array;
+	for (uint i = 0; i < count; ++i)
+	{
+		array.pushBack(value);
+	}
+	sink = array.size();
+}
+
+template<class ARRAY, class T>
+static NOINLINE void insertAllAtFront(const uint count, const T & value)
+{
+	ARRAY array;
+	for (uint i = 0; i < count; ++i)
+	{
+		array.insert(0, value);
+	}
+	sink = array.size();
+}
+
+// Fills many short arrays with inserts at random positions,
+// about what `TextureAtlas::allocRegion()` does with its nodes.
+template<class ARRAY, class T>
+static NOINLINE void insertAllAtRandom(const uint arrays, const uint count, const T & value)
+{
+	for (uint a = 0; a < arrays; ++a)
+	{
+		ARRAY array;
+		for (uint i = 0; i < count; ++i)
+		{
+			array.insert(randUint() % (array.size() + 1), value);
+		}
+		sink = array.size();
+	}
+}
+
+// Many short-lived arrays of a few elements, like per-entity lists.
+template<class ARRAY>
+static NOINLINE void manySmallArrays(const uint arrays, const uint elements)
+{
+	for (uint a = 0; a < arrays; ++a)
+	{
+		ARRAY array;
+		for (uint i = 0; i < elements; ++i)
+		{
+			array.pushBack(scast<int>(a + i));
+		}
+		sink = array[elements - 1];
+	}
+}
+
+static void benchArrays()
+{
+	std::printf("\nArrays, milliseconds, best of %d:\n\n", TRIALS);
+	std::printf("%-32s | %9s | %9s | %8s\n", "", "old Array", "Array", "speedup");
+
+	const Node node = { 1, 2, 3, 4 };
+	static const uint intCounts[]  = { 1000, 10000, 100000 };
+	static const uint nodeCounts[] = { 1000, 10000, 30000 };
+
+	for (uint c = 0; c < 3; ++c)
+	{
+		double oldMs, newMs;
+		TIME_MS(oldMs, appendAll<OldArray<int> >(intCounts[c], 1));
+		TIME_MS(newMs, appendAll<Array<int> >(intCounts[c], 1));
+		char label[64];
+		std::snprintf(label, sizeof(label), "pushBack %u ints", intCounts[c]);
+		std::printf("%-32s | %9.3f | %9.3f | %7.0fx\n", label, oldMs, newMs, oldMs / newMs);
+	}
+
+	for (uint c = 0; c < 3; ++c)
+	{
+		double oldMs, newMs;
+		TIME_MS(oldMs, appendAll<OldArray<Node> >(nodeCounts[c], node));
+		TIME_MS(newMs, appendAll<Array<Node> >(nodeCounts[c], node));
+		char label[64];
+		std::snprintf(label, sizeof(label), "pushBack %u 16 byte structs", nodeCounts[c]);
+		std::printf("%-32s | %9.3f | %9.3f | %7.0fx\n", label, oldMs, newMs, oldMs / newMs);
+	}
+
+	const SkylineNode skylineNode = { 1, 2, 3 };
+	{
+		double oldMs, newMs;
+		TIME_MS(oldMs, insertAllAtFront<OldArray<SkylineNode> >(10000, skylineNode));
+		TIME_MS(newMs, insertAllAtFront<Array<SkylineNode> >(10000, skylineNode));
+		std::printf("%-32s | %9.3f | %9.3f | %7.1fx\n", "insert(0) 10000 12 byte structs", oldMs, newMs, oldMs / newMs);
+	}
+	{
+		double oldMs, newMs;
+		TIME_MS(oldMs, insertAllAtRandom<OldArray<SkylineNode> >(10000, 64, skylineNode));
+		TIME_MS(newMs, insertAllAtRandom<Array<SkylineNode> >(10000, 64, skylineNode));
+		std::printf("%-32s | %9.3f | %9.3f | %7.1fx\n", "10000x 64 random inserts", oldMs, newMs, oldMs / newMs);
+	}
+
+	std::printf("\n%-32s | %9s | %9s | %9s | %8s\n", "", "old Array", "Array", "SmallArray", "speedup");
+	static const uint smallCounts[] = { 2, 6, 12 };
+	for (uint c = 0; c < 3; ++c)
+	{
+		double oldMs, newMs, smallMs;
+		TIME_MS(oldMs,   manySmallArrays<OldArray<int> >(200000, smallCounts[c]));
+		TIME_MS(newMs,   manySmallArrays<Array<int> >(200000, smallCounts[c]));
+		TIME_MS(smallMs, manySmallArrays<SmallArray<int, 8> >(200000, smallCounts[c]));
+		char label[64];
+		std::snprintf(label, sizeof(label), "200000 arrays of %u ints", smallCounts[c]);
+		std::printf("%-32s | %9.3f | %9.3f | %10.3f | %7.1fx\n", label, oldMs, newMs, smallMs, oldMs / smallMs);
+	}
+}
+
+static void benchLookups()
+{
+	std::printf("\nName lookups, 1M lookups, milliseconds, best of %d:\n\n", TRIALS);
+	std::printf("%-32s | %11s | %9s | %8s\n", "", "strcmp scan", "HashMap", "speedup");
+
+	// MD2 anim names are at most 15 chars, with common prefixes.
+	static const uint nameCounts[] = { 8, 20, 200 };
+	static char names[200][16];
+	for (uint n = 0; n < 200; ++n)
+	{
+		std::snprintf(names[n], sizeof(names[n]), "anim_%s%03u", (n & 1) ? "run" : "attack", n);
+	}
+
+	for (uint c = 0; c < 3; ++c)
+	{
+		const uint count = nameCounts[c];
+		HashMap<const char *, uint> byName;
+		for (uint n = 0; n < count; ++n)
+		{
+			byName.insert(names[n], n);
+		}
+
+		// Lookups use copies of the names, as the game passes its own strings.
+		static char queries[1024][16];
+		for (uint q = 0; q < 1024; ++q)
+		{
+			std::strcpy(queries[q], names[randUint() % count]);
+		}
+
+		double scanMs, hashMs;
+		TIME_MS(scanMs,
+		{
+			uint found = 0;
+			for (uint l = 0; l < 1000000; ++l)
+			{
+				const char * query = queries[l & 1023];
+				for (uint n = 0; n < count; ++n)
+				{
+					if (std::strcmp(names[n], query) == 0) { found += n; break; }
+				}
+			}
+			sink = found;
+		});
+		TIME_MS(hashMs,
+		{
+			uint found = 0;
+			for (uint l = 0; l < 1000000; ++l)
+			{
+				const uint * index = byName.find(queries[l & 1023]);
+				found += (index != nullptr) ? *index : 0;
+			}
+			sink = found;
+		});
+
+		char label[64];
+		std::snprintf(label, sizeof(label), "%u names", count);
+		std::printf("%-32s | %11.3f | %9.3f | %7.1fx\n", label, scanMs, hashMs, scanMs / hashMs);
+	}
+}
+
+// ========================================================
+
+int main()
+{
+	static const size_t HEAP_SIZE = 64 * 1024 * 1024;
+	void * heapMemory = std::malloc(HEAP_SIZE);
+	std::memset(heapMemory, 0, HEAP_SIZE); // Fault the pages in before any timing.
+	gTlsfHeap.init(heapMemory, HEAP_SIZE);
+
+	testNonPod();
+	testHashMap();
+	benchArrays();
+	benchLookups();
+
+	CHECK(gTlsfHeap.getUsedBytes() == 0);
+	CHECK(gTlsfHeap.checkIntegrity());
+	CHECK(assertsFailed == 0);
+	std::free(heapMemory);
+
+	if (checksFailed != 0)
+	{
+		std::printf("\n%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll checks passed.\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,450 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: cull_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host test and benchmark of the batch AABB culling against Frustum::testAabb().
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds `ps2_math/frustum_cull.cpp` for the host and compares `cullAabbs()`
+// with one `Frustum::testAabb()` call per box, the way the game culls its objects:
+//
+//  - checks that both give the same visibility for random boxes (every
+//    count from 1 to 37 to cover the partial last group of four, and 4096
+//    boxes), and that culling children with the plane mask of their parent
+//    gives the same result as testing them against all planes.
+//  - times three cases, in nanoseconds per box: boxes scattered around the
+//    camera (mostly culled), the 11x11 tiles of the dungeon active area
+//    (mostly visible, culled through the area bounds like `drawMap()`),
+//    and clusters of 16 boxes culled through their parent box.
+//    The batch times are given with and without filling the AabbSoA,
+//    since `drawMap()` fills it every frame.
+//
+// Runs on the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework cull_bench.cpp -o cull_bench
+//   ./cull_bench
+//
+// Builds with the SSE2 backend on x86-64. Add -DPS2MATH_BACKEND=0 for the
+// plain C++ backend. Exits with a non-zero status if any check fails.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` needs the PS2SDK headers, so define the few
+// things `frustum_cull.cpp` and `aabb.hpp` use and skip the real header.
+#define COMMON_HPP
+
+#define nullptr NULL
+#define restrict __restrict
+#define rcast reinterpret_cast
+#define scast static_cast
+
+typedef unsigned char uint8;
+typedef unsigned int  uint;
+typedef unsigned int  uint32;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+
+#include "ps2_math/frustum_cull.cpp"
+
+// ========================================================
+// Test helpers:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static float randFloat(const float lo, const float hi)
+{
+	randState = randState * 1664525 + 1013904223;
+	return lo + (hi - lo) * ((randState >> 8) * (1.0f / 16777216.0f));
+}
+
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Keeps the optimizer from dropping the work.
+static volatile uint sink;
+
+static const uint MAX_BOXES = 4096;
+
+// Boxes as the game keeps them, and the same boxes in the batch layout.
+static Aabb gBoxes[MAX_BOXES];
+static PS2MATH_ALIGNED(16) float gSoAMemory[MAX_BOXES * 6];
+static AabbSoA gSoA;
+static uint gVisibleBits[MAX_BOXES / 32];
+static unsigned char gChildMasks[MAX_BOXES];
+
+static Aabb randBox(const float centerRange, const float minHalfSize, const float maxHalfSize)
+{
+	const Vector center(randFloat(-centerRange, centerRange), randFloat(-centerRange, centerRange),
+	                    randFloat(-centerRange, centerRange), 1.0f);
+	const Vector half(randFloat(minHalfSize, maxHalfSize), randFloat(minHalfSize, maxHalfSize),
+	                  randFloat(minHalfSize, maxHalfSize), 0.0f);
+	return Aabb(center - half, center + half);
+}
+
+static void fillSoA(const Aabb * boxes, const uint count)
+{
+	for (uint i = 0; i < count; ++i)
+	{
+		gSoA.setBox(i, boxes[i]);
+	}
+}
+
+// The third person camera of the dungeon game: above and behind the player.
+static void setupFrustum(Frustum & frustum, const Vector & eye, const Vector & target)
+{
+	Matrix view;
+	view.makeLookAt(eye, target, Vector(0.0f, 1.0f, 0.0f, 0.0f));
+	frustum.setProjection(60.0f * 3.14159265f / 180.0f, 640, 448, 2.0f, 2000.0f);
+	frustum.update(view);
+}
+
+// ========================================================
+// Tests:
+// ========================================================
+
+static void testSameAsTestAabb(const Frustum & frustum, const FrustumCullPlanes & planes)
+{
+	std::printf("cullAabbs() against Frustum::testAabb()...\n");
+
+	uint mismatches = 0;
+	uint totalVisible = 0;
+	uint totalTested = 0;
+
+	for (uint count = 1; count <= 37; ++count)
+	{
+		for (uint i = 0; i < count; ++i)
+		{
+			gBoxes[i] = randBox(60.0f, 0.1f, 8.0f);
+		}
+		fillSoA(gBoxes, count);
+
+		const uint visible = cullAabbs(planes, gSoA, count, FRUSTUM_ALL_PLANES, gVisibleBits);
+		uint expected = 0;
+		for (uint i = 0; i < count; ++i)
+		{
+			const bool visibleOld = frustum.testAabb(gBoxes[i]);
+			mismatches += (visibleOld != isAabbVisible(gVisibleBits, i)) ? 1 : 0;
+			expected   += visibleOld ? 1 : 0;
+		}
+		mismatches += (visible != expected) ? 1 : 0;
+	}
+
+	for (uint i = 0; i < MAX_BOXES; ++i)
+	{
+		gBoxes[i] = randBox(60.0f, 0.1f, 8.0f);
+	}
+	fillSoA(gBoxes, MAX_BOXES);
+	cullAabbs(planes, gSoA, MAX_BOXES, FRUSTUM_ALL_PLANES, gVisibleBits, gChildMasks);
+
+	for (uint i = 0; i < MAX_BOXES; ++i)
+	{
+		const bool visibleOld = frustum.testAabb(gBoxes[i]);
+		mismatches   += (visibleOld != isAabbVisible(gVisibleBits, i)) ? 1 : 0;
+		totalVisible += visibleOld ? 1 : 0;
+		++totalTested;
+
+		// A visible box only crosses planes it was tested against.
+		CHECK((gChildMasks[i] & ~FRUSTUM_ALL_PLANES) == 0);
+		CHECK(visibleOld || gChildMasks[i] == 0);
+	}
+
+	std::printf("  %u of %u random boxes visible, %u mismatches\n", totalVisible, totalTested, mismatches);
+	CHECK(mismatches == 0);
+}
+
+static void testParentMask(const Frustum & frustum, const FrustumCullPlanes & planes)
+{
+	std::printf("Children culled with the plane mask of their parent...\n");
+
+	uint mismatches = 0;
+	uint parentsInside = 0;
+
+	for (uint cluster = 0; cluster < 256; ++cluster)
+	{
+		const Aabb parentRegion = randBox(60.0f, 2.0f, 10.0f);
+		const Vector size = parentRegion.maxs - parentRegion.mins;
+
+		Aabb parent;
+		parent.clear();
+		for (uint i = 0; i < 16; ++i)
+		{
+			const Vector a(parentRegion.mins.x + randFloat(0.0f, size.x), parentRegion.mins.y + randFloat(0.0f, size.y),
+			               parentRegion.mins.z + randFloat(0.0f, size.z), 1.0f);
+			const Vector b(parentRegion.mins.x + randFloat(0.0f, size.x), parentRegion.mins.y + randFloat(0.0f, size.y),
+			               parentRegion.mins.z + randFloat(0.0f, size.z), 1.0f);
+			gBoxes[i] = Aabb(min3PerElement(a, b), max3PerElement(a, b));
+			parent.merge(gBoxes[i]);
+		}
+
+		uint planeMask;
+		const bool parentVisible = cullAabb(planes, parent, FRUSTUM_ALL_PLANES, &planeMask);
+		CHECK(parentVisible == frustum.testAabb(parent));
+		parentsInside += (parentVisible && planeMask == FRUSTUM_NO_PLANES) ? 1 : 0;
+
+		fillSoA(gBoxes, 16);
+		if (parentVisible)
+		{
+			cullAabbs(planes, gSoA, 16, planeMask, gVisibleBits);
+		}
+		else
+		{
+			gVisibleBits[0] = 0;
+		}
+
+		for (uint i = 0; i < 16; ++i)
+		{
+			mismatches += (frustum.testAabb(gBoxes[i]) != isAabbVisible(gVisibleBits, i)) ? 1 : 0;
+		}
+	}
+
+	std::printf("  256 clusters of 16, %u parents fully inside, %u mismatches\n", parentsInside, mismatches);
+	CHECK(mismatches == 0);
+}
+
+// ========================================================
+// Benchmarks:
+// ========================================================
+
+static const int TRIALS = 5;
+
+// Nanoseconds per box of the body run `reps` times over `boxes` boxes, best of TRIALS.
+#define TIME_NS_PER_BOX(result, reps, boxes, ...) \
+	do { \
+		(result) = 1e30; \
+		for (int trial = 0; trial < TRIALS; ++trial) \
+		{ \
+			const double start = nowSeconds(); \
+			for (uint rep = 0; rep < (reps); ++rep) { __VA_ARGS__; } \
+			const double ns = (nowSeconds() - start) * 1e9 / (double(reps) * (boxes)); \
+			if (ns < (result)) { (result) = ns; } \
+		} \
+	} while (0)
+
+static void printRow(const char * label, const uint visible, const uint count,
+                     const double oldNs, const double batchNs, const double batchFillNs)
+{
+	std::printf("%-28s | %4u/%-4u | %8.2f | %8.2f | %9.2f | %5.1fx\n", label, visible, count,
+	            oldNs, batchNs, batchFillNs, oldNs / batchFillNs);
+}
+
+static uint cullOneByOne(const Frustum & frustum, const Aabb * boxes, const uint count)
+{
+	uint visible = 0;
+	for (uint i = 0; i < count; ++i)
+	{
+		visible += frustum.testAabb(boxes[i]) ? 1 : 0;
+	}
+	return visible;
+}
+
+// Boxes scattered all around the camera, most of them off screen.
+static void benchScattered(const Frustum & frustum, const FrustumCullPlanes & planes)
+{
+	static const uint counts[] = { 16, 128, 1024 };
+	for (uint c = 0; c < 3; ++c)
+	{
+		const uint count = counts[c];
+		const uint reps  = 1000000 / count;
+		for (uint i = 0; i < count; ++i)
+		{
+			gBoxes[i] = randBox(100.0f, 0.5f, 4.0f);
+		}
+		fillSoA(gBoxes, count);
+
+		double oldNs, batchNs, batchFillNs;
+		TIME_NS_PER_BOX(oldNs, reps, count, sink = cullOneByOne(frustum, gBoxes, count));
+		TIME_NS_PER_BOX(batchNs, reps, count, sink = cullAabbs(planes, gSoA, count, FRUSTUM_ALL_PLANES, gVisibleBits));
+		TIME_NS_PER_BOX(batchFillNs, reps, count,
+		{
+			fillSoA(gBoxes, count);
+			sink = cullAabbs(planes, gSoA, count, FRUSTUM_ALL_PLANES, gVisibleBits);
+		});
+
+		char label[64];
+		std::snprintf(label, sizeof(label), "scattered, %u boxes", count);
+		printRow(label, cullOneByOne(frustum, gBoxes, count), count, oldNs, batchNs, batchFillNs);
+	}
+}
+
+// The 11x11 active area of `TileMap::drawMap()`: cull the area bounds,
+// then the tiles against the planes the area crosses.
+static uint cullTileArea(const FrustumCullPlanes & planes, const Aabb & area, const uint count)
+{
+	uint planeMask;
+	if (!cullAabb(planes, area, FRUSTUM_ALL_PLANES, &planeMask))
+	{
+		return 0;
+	}
+	return cullAabbs(planes, gSoA, count, planeMask, gVisibleBits);
+}
+
+static void benchTiles(const Frustum & frustum, const FrustumCullPlanes & planes, const char * label,
+                       const float cameraX, const float cameraZ)
+{
+	const float TILE_SIZE = 2.5f;
+	const uint count = 11 * 11;
+
+	Aabb area;
+	area.clear();
+	for (uint z = 0; z < 11; ++z)
+	{
+		for (uint x = 0; x < 11; ++x)
+		{
+			const float tx = cameraX + (scast<float>(x) - 5.0f) * TILE_SIZE;
+			const float tz = cameraZ + (scast<float>(z) - 5.0f) * TILE_SIZE;
+			Aabb & tile = gBoxes[x + z * 11];
+			tile = Aabb(Vector(tx, 0.0f, tz, 1.0f), Vector(tx + TILE_SIZE, randFloat(0.1f, 3.0f), tz + TILE_SIZE, 1.0f));
+			area.merge(tile);
+		}
+	}
+	fillSoA(gBoxes, count);
+
+	const uint reps = 8000;
+	double oldNs, batchNs, batchFillNs;
+	TIME_NS_PER_BOX(oldNs, reps, count, sink = cullOneByOne(frustum, gBoxes, count));
+	TIME_NS_PER_BOX(batchNs, reps, count, sink = cullTileArea(planes, area, count));
+	TIME_NS_PER_BOX(batchFillNs, reps, count,
+	{
+		fillSoA(gBoxes, count);
+		sink = cullTileArea(planes, area, count);
+	});
+
+	CHECK(cullTileArea(planes, area, count) == cullOneByOne(frustum, gBoxes, count));
+	printRow(label, cullOneByOne(frustum, gBoxes, count), count, oldNs, batchNs, batchFillNs);
+}
+
+// Clusters of 16 boxes, culled through their parent box first.
+static uint cullClusters(const FrustumCullPlanes & planes, const Aabb * parents, const uint clusters)
+{
+	uint visible = 0;
+	for (uint c = 0; c < clusters; ++c)
+	{
+		uint planeMask;
+		if (cullAabb(planes, parents[c], FRUSTUM_ALL_PLANES, &planeMask))
+		{
+			AabbSoA children = gSoA;
+			children.centerX += c * 16;
+			children.centerY += c * 16;
+			children.centerZ += c * 16;
+			children.extentX += c * 16;
+			children.extentY += c * 16;
+			children.extentZ += c * 16;
+			visible += cullAabbs(planes, children, 16, planeMask, gVisibleBits);
+		}
+	}
+	return visible;
+}
+
+static void benchClusters(const Frustum & frustum, const FrustumCullPlanes & planes)
+{
+	static const uint clusters = 64;
+	static Aabb parents[clusters];
+	const uint count = clusters * 16;
+
+	for (uint c = 0; c < clusters; ++c)
+	{
+		const Vector center(randFloat(-100.0f, 100.0f), randFloat(-10.0f, 10.0f), randFloat(-100.0f, 100.0f), 1.0f);
+		parents[c].clear();
+		for (uint i = 0; i < 16; ++i)
+		{
+			const Vector offset(randFloat(-8.0f, 8.0f), randFloat(-2.0f, 2.0f), randFloat(-8.0f, 8.0f), 0.0f);
+			const Vector half(randFloat(0.5f, 1.5f), randFloat(0.5f, 1.5f), randFloat(0.5f, 1.5f), 0.0f);
+			gBoxes[c * 16 + i] = Aabb(center + offset - half, center + offset + half);
+			parents[c].merge(gBoxes[c * 16 + i]);
+		}
+	}
+	fillSoA(gBoxes, count);
+
+	const uint reps = 1000;
+	double oldNs, batchNs, batchFillNs;
+	TIME_NS_PER_BOX(oldNs, reps, count, sink = cullOneByOne(frustum, gBoxes, count));
+	TIME_NS_PER_BOX(batchNs, reps, count, sink = cullClusters(planes, parents, clusters));
+	TIME_NS_PER_BOX(batchFillNs, reps, count,
+	{
+		fillSoA(gBoxes, count);
+		sink = cullClusters(planes, parents, clusters);
+	});
+
+	CHECK(cullClusters(planes, parents, clusters) == cullOneByOne(frustum, gBoxes, count));
+	printRow("64 clusters of 16 boxes", cullOneByOne(frustum, gBoxes, count), count, oldNs, batchNs, batchFillNs);
+}
+
+// ========================================================
+
+int main()
+{
+	gSoA.setMemory(gSoAMemory, MAX_BOXES);
+
+	// Camera in the middle of the random boxes.
+	Frustum frustum;
+	setupFrustum(frustum, Vector(0.0f, 12.0f, 10.0f, 1.0f), Vector(0.0f, 0.0f, 0.0f, 1.0f));
+	const FrustumCullPlanes planes(frustum);
+
+	testSameAsTestAabb(frustum, planes);
+	testParentMask(frustum, planes);
+
+	std::printf("\nNanoseconds per box, best of %d (%s backend):\n\n", TRIALS,
+	            PS2MATH_USE_VU0 ? "VU0" : (PS2MATH_USE_SSE2 ? "SSE2" : "scalar"));
+	std::printf("%-28s | %9s | %8s | %8s | %9s | %6s\n", "", "visible", "testAabb", "batch", "fill+batch", "speedup");
+
+	benchScattered(frustum, planes);
+	benchTiles(frustum, planes, "11x11 tiles, area inside", 0.0f, -2.0f);
+	benchTiles(frustum, planes, "11x11 tiles, area crossing", 12.0f, 0.0f);
+	benchClusters(frustum, planes);
+
+	CHECK(assertsFailed == 0);
+	if (checksFailed != 0)
+	{
+		std::printf("\n%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll checks passed.\n");
+	return EXIT_SUCCESS;
+}
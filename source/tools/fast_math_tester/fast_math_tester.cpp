@@ -0,0 +1,370 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: fast_math_tester.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host tool that measures the accuracy and throughput of the ps2math::fast functions.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+
+//
+// Checks the error bounds documented in `framework/ps2_math/fast_math.hpp`
+// against the double precision C library, by walking every float in the
+// documented ranges, then times the functions against the single precision
+// C library ones. Runs on the development machine, not the PS2:
+//
+//   g++ -O2 -I../../framework fast_math_tester.cpp ../../framework/ps2_math/fast_math.cpp -o fast_math_tester
+//   ./fast_math_tester [stride, default 1 = every float]
+//
+// Builds with the SSE2 backend on x86-64. Add -DPS2MATH_BACKEND=0 to test the
+// plain C++ backend, which has the same math as the VU0 batch code.
+//
+// It also builds with ee-g++ and the ps2sdk, to run on the console like the
+// demos. That is the only way to measure the EE `rsqrt()`, which is the FPU
+// `rsqrt.s` and has no host equivalent, and to check the VU0 batch code.
+// Pass a stride of a few hundred there, the double precision reference
+// functions are slow on the EE.
+//
+
+#include "ps2_math/fast_math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+typedef unsigned int uint32;
+
+// ========================================================
+
+static float floatFromBits(const uint32 bits)
+{
+	float f;
+	std::memcpy(&f, &bits, sizeof(f));
+	return f;
+}
+
+static uint32 bitsFromFloat(const float f)
+{
+	uint32 bits;
+	std::memcpy(&bits, &f, sizeof(bits));
+	return bits;
+}
+
+static double absError(const double approx, const double exact)
+{
+	return std::fabs(approx - exact);
+}
+
+static double relError(const double approx, const double exact)
+{
+	return std::fabs((approx - exact) / exact);
+}
+
+// Error in units of the spacing between floats at the exact result.
+static double ulpError(const float approx, const double exact)
+{
+	const float f = static_cast<float>(exact);
+	const double ulp = static_cast<double>(floatFromBits(bitsFromFloat(f) + 1)) - f;
+	return std::fabs(approx - exact) / ulp;
+}
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static float randFloat(const float lo, const float hi)
+{
+	randState = randState * 1664525 + 1013904223;
+	return lo + (hi - lo) * ((randState >> 8) * (1.0f / 16777216.0f));
+}
+
+// ========================================================
+// Accuracy:
+// ========================================================
+
+static void testSinCos(const uint32 stride)
+{
+	// Worst error per range of |x|.
+	static const float bands[] = { PS2MATH_TWOPI, 100.0f, 1e4f };
+	static const int BAND_COUNT = sizeof(bands) / sizeof(bands[0]);
+	double sinError[BAND_COUNT] = { 0.0, 0.0, 0.0 };
+	double cosError[BAND_COUNT] = { 0.0, 0.0, 0.0 };
+	float  sinWorst[BAND_COUNT] = { 0.0f, 0.0f, 0.0f };
+	float  cosWorst[BAND_COUNT] = { 0.0f, 0.0f, 0.0f };
+
+	const uint32 last = bitsFromFloat(bands[BAND_COUNT - 1]);
+	for (uint32 bits = 0; bits <= last; bits += stride)
+	{
+		for (int sign = 0; sign < 2; ++sign)
+		{
+			const float x = sign ? -floatFromBits(bits) : floatFromBits(bits);
+			float s, c;
+			ps2math::fast::sinCos(x, &s, &c);
+
+			const double es = absError(s, std::sin(static_cast<double>(x)));
+			const double ec = absError(c, std::cos(static_cast<double>(x)));
+
+			int band = 0;
+			while (std::fabs(x) > bands[band]) { ++band; }
+			for (int b = band; b < BAND_COUNT; ++b)
+			{
+				if (es > sinError[b]) { sinError[b] = es; sinWorst[b] = x; }
+				if (ec > cosError[b]) { cosError[b] = ec; cosWorst[b] = x; }
+			}
+		}
+	}
+
+	for (int b = 0; b < BAND_COUNT; ++b)
+	{
+		std::printf("sin  |x| <= %-8g max abs error %.3g (at x = %.9g)\n", bands[b], sinError[b], sinWorst[b]);
+		std::printf("cos  |x| <= %-8g max abs error %.3g (at x = %.9g)\n", bands[b], cosError[b], cosWorst[b]);
+	}
+}
+
+static void testAtan2(const uint32 stride)
+{
+	// Every ratio in [0, 1], both below and above the diagonal.
+	double maxError = 0.0;
+	float worstY = 0.0f, worstX = 0.0f;
+	const uint32 last = bitsFromFloat(1.0f);
+	for (uint32 bits = 0; bits <= last; bits += stride)
+	{
+		const float a = floatFromBits(bits);
+		const double e0 = absError(ps2math::fast::atan2(a, 1.0f), std::atan2(static_cast<double>(a), 1.0));
+		const double e1 = absError(ps2math::fast::atan2(1.0f, a), std::atan2(1.0, static_cast<double>(a)));
+		if (e0 > maxError) { maxError = e0; worstY = a; worstX = 1.0f; }
+		if (e1 > maxError) { maxError = e1; worstY = 1.0f; worstX = a; }
+	}
+	std::printf("atan2 ratios in [0, 1]   max abs error %.3g (at y = %.9g, x = %.9g)\n", maxError, worstY, worstX);
+
+	// Random points in all quadrants, including the axes.
+	maxError = 0.0;
+	for (int i = 0; i < 10000000; ++i)
+	{
+		float y = randFloat(-1e4f, 1e4f);
+		float x = randFloat(-1e4f, 1e4f);
+		if ((i & 15) == 0) { y = 0.0f; }
+		if ((i & 15) == 1) { x = 0.0f; }
+		if ((i & 15) == 2) { y *= 1e-6f; }
+
+		const double exact = std::atan2(static_cast<double>(y), static_cast<double>(x));
+		const double e = absError(ps2math::fast::atan2(y, x), exact);
+		if (e > maxError) { maxError = e; worstY = y; worstX = x; }
+	}
+	std::printf("atan2 random quadrants   max abs error %.3g (at y = %.9g, x = %.9g)\n", maxError, worstY, worstX);
+}
+
+static void testRsqrt(const uint32 stride)
+{
+	// The relative error repeats for every even power of two,
+	// so [1, 4) covers all mantissas for both exponent parities.
+	double maxError = 0.0, maxUlps = 0.0;
+	float worst = 0.0f;
+	const uint32 first = bitsFromFloat(1.0f);
+	const uint32 last  = bitsFromFloat(4.0f);
+	for (uint32 bits = first; bits < last; bits += stride)
+	{
+		const float x = floatFromBits(bits);
+		const float r = ps2math::fast::rsqrt(x);
+		const double exact = 1.0 / std::sqrt(static_cast<double>(x));
+		const double e = relError(r, exact);
+		if (e > maxError) { maxError = e; worst = x; }
+		maxUlps = std::max(maxUlps, ulpError(r, exact));
+	}
+	std::printf("rsqrt [1, 4)             max rel error %.3g (at x = %.9g), %.1f ulps\n", maxError, worst, maxUlps);
+
+	// Spot check the whole range of normal floats.
+	maxError = 0.0;
+	for (uint32 bits = bitsFromFloat(1e-30f); bits < bitsFromFloat(1e30f); bits += 4093 * stride)
+	{
+		const float x = floatFromBits(bits);
+		const double e = relError(ps2math::fast::rsqrt(x), 1.0 / std::sqrt(static_cast<double>(x)));
+		if (e > maxError) { maxError = e; worst = x; }
+	}
+	std::printf("rsqrt [1e-30, 1e30]      max rel error %.3g (at x = %.9g)\n", maxError, worst);
+}
+
+// ========================================================
+// Batch versions:
+// ========================================================
+
+static const int BATCH_SIZE = 4099; // Not a multiple of 4, to go through the leftovers.
+
+struct PS2MATH_ALIGNED(16) BatchData
+{
+	float x[BATCH_SIZE + 1];
+	float y[BATCH_SIZE + 1];
+	float r0[BATCH_SIZE + 1];
+	float r1[BATCH_SIZE + 1];
+};
+
+static BatchData batch;
+
+static void testBatch()
+{
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		batch.x[i] = randFloat(-100.0f, 100.0f);
+		batch.y[i] = randFloat(-100.0f, 100.0f);
+	}
+
+	// Signed zeros, where a sign bit test differs from the float
+	// compare of the scalar atan2(): atan2(-0, -1) is PI, not -PI.
+	static const float zeros[][2] =
+	{
+		{  0.0f,  1.0f }, { -0.0f,  1.0f }, {  0.0f, -1.0f }, { -0.0f, -1.0f },
+		{  1.0f,  0.0f }, {  1.0f, -0.0f }, { -1.0f,  0.0f }, { -1.0f, -0.0f },
+		{  0.0f,  0.0f }, { -0.0f,  0.0f }, {  0.0f, -0.0f }, { -0.0f, -0.0f }
+	};
+	for (unsigned int i = 0; i < sizeof(zeros) / sizeof(zeros[0]); ++i)
+	{
+		batch.y[i] = zeros[i][0];
+		batch.x[i] = zeros[i][1];
+	}
+
+	// Largest difference to the scalar version.
+	double sinDiff = 0.0, cosDiff = 0.0, atanDiff = 0.0, rsqrtDiff = 0.0;
+
+	ps2math::fast::sinCos(batch.r0, batch.r1, batch.x, BATCH_SIZE);
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		float s, c;
+		ps2math::fast::sinCos(batch.x[i], &s, &c);
+		sinDiff = std::max(sinDiff, absError(batch.r0[i], s));
+		cosDiff = std::max(cosDiff, absError(batch.r1[i], c));
+	}
+
+	ps2math::fast::atan2(batch.r0, batch.y, batch.x, BATCH_SIZE);
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		atanDiff = std::max(atanDiff, absError(batch.r0[i], ps2math::fast::atan2(batch.y[i], batch.x[i])));
+	}
+
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		batch.x[i] = std::fabs(batch.x[i]) + 1e-3f;
+	}
+	ps2math::fast::rsqrt(batch.r0, batch.x, BATCH_SIZE);
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		rsqrtDiff = std::max(rsqrtDiff, relError(batch.r0[i], ps2math::fast::rsqrt(batch.x[i])));
+	}
+
+	std::printf("batch vs scalar: sin %.3g, cos %.3g, atan2 %.3g, rsqrt %.3g (relative)\n",
+	            sinDiff, cosDiff, atanDiff, rsqrtDiff);
+}
+
+// ========================================================
+// Throughput:
+// ========================================================
+
+static volatile float benchSink;
+static const int BENCH_REPEATS = 2000;
+
+static double nsPerValue(const std::clock_t start, const std::clock_t end)
+{
+	return (static_cast<double>(end - start) / CLOCKS_PER_SEC) * 1e9 / (static_cast<double>(BENCH_REPEATS) * BATCH_SIZE);
+}
+
+#define BENCH_LOOP(expr)                                  \
+	do {                                                  \
+		const std::clock_t start = std::clock();          \
+		for (int rep = 0; rep < BENCH_REPEATS; ++rep)     \
+		{                                                 \
+			float acc = 0.0f;                             \
+			for (int i = 0; i < BATCH_SIZE; ++i)          \
+			{                                             \
+				acc += (expr);                            \
+			}                                             \
+			benchSink = acc;                              \
+		}                                                 \
+		elapsed = nsPerValue(start, std::clock());        \
+	} while (0)
+
+#define BENCH_BATCH(call)                                 \
+	do {                                                  \
+		const std::clock_t start = std::clock();          \
+		for (int rep = 0; rep < BENCH_REPEATS; ++rep)     \
+		{                                                 \
+			call;                                         \
+			benchSink = batch.r0[rep % BATCH_SIZE];       \
+		}                                                 \
+		elapsed = nsPerValue(start, std::clock());        \
+	} while (0)
+
+static void benchmark()
+{
+	for (int i = 0; i < BATCH_SIZE; ++i)
+	{
+		batch.x[i] = randFloat(0.01f, 100.0f);
+		batch.y[i] = randFloat(-100.0f, 100.0f);
+	}
+
+	double elapsed;
+	std::printf("\n%-8s | %12s | %12s | %12s\n", "ns/value", "C library", "fast", "fast batch");
+
+	double libm, fast;
+	BENCH_LOOP(std::sin(batch.x[i]) + std::cos(batch.x[i])); libm = elapsed;
+	BENCH_LOOP(ps2math::fast::sin(batch.x[i]) + ps2math::fast::cos(batch.x[i])); fast = elapsed;
+	BENCH_BATCH(ps2math::fast::sinCos(batch.r0, batch.r1, batch.x, BATCH_SIZE));
+	std::printf("%-8s | %12.2f | %12.2f | %12.2f\n", "sin+cos", libm, fast, elapsed);
+
+	BENCH_LOOP(std::atan2(batch.y[i], batch.x[i])); libm = elapsed;
+	BENCH_LOOP(ps2math::fast::atan2(batch.y[i], batch.x[i])); fast = elapsed;
+	BENCH_BATCH(ps2math::fast::atan2(batch.r0, batch.y, batch.x, BATCH_SIZE));
+	std::printf("%-8s | %12.2f | %12.2f | %12.2f\n", "atan2", libm, fast, elapsed);
+
+	BENCH_LOOP(1.0f / std::sqrt(batch.x[i])); libm = elapsed;
+	BENCH_LOOP(ps2math::fast::rsqrt(batch.x[i])); fast = elapsed;
+	BENCH_BATCH(ps2math::fast::rsqrt(batch.r0, batch.x, BATCH_SIZE));
+	std::printf("%-8s | %12.2f | %12.2f | %12.2f\n", "rsqrt", libm, fast, elapsed);
+}
+
+#undef BENCH_LOOP
+#undef BENCH_BATCH
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	const uint32 stride = (argc > 1) ? static_cast<uint32>(std::atoi(argv[1])) : 1;
+	if (stride == 0)
+	{
+		std::fprintf(stderr, "Usage: %s [stride, default 1 = every float]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("Backend: %s, testing every %u float(s)\n\n",
+	            PS2MATH_USE_VU0 ? "VU0" : (PS2MATH_USE_SSE2 ? "SSE2" : "scalar"), stride);
+
+	testSinCos(stride);
+	testAtan2(stride);
+	testRsqrt(stride);
+	testBatch();
+	benchmark();
+	return EXIT_SUCCESS;
+}
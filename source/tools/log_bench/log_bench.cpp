@@ -0,0 +1,698 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: log_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host benchmark of the deferred log against the immediate logPrintf() path.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Times a few typical log messages, in nanoseconds per message:
+//
+//  - logPrintf:   the immediate path, `vformat()` then the console print.
+//  - logDeferred: what the logging thread pays with the deferred log, the
+//                 argument encoding plus the copy into the ring.
+//  - flush, text: `logFlush()` formatting the records and printing them,
+//                 done later, at the end of the frame.
+//  - flush, dump: `logFlush()` writing the raw records to a dump file
+//                 instead, for `tools/log_decoder` to format on the host.
+//
+// The console print is replaced by a copy of the text into a memory buffer,
+// so the numbers leave out the cost of the actual output device, which is
+// the same for both paths. Each message formatted from the ring is also
+// compared with `snprintf()`.
+//
+// The ring code is copied from `framework/common.cpp`, since the framework
+// needs the PS2SDK; keep it in sync. The only change is that the string
+// addresses in the record header are pointer sized here, because the EE
+// layout stores them in 32 bits. Runs on the development machine:
+//
+//   g++ -std=gnu++98 -O2 log_bench.cpp -o log_bench
+//   ./log_bench
+//
+// Exits with a non-zero status if a deferred message doesn't match.
+//
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <time.h>
+
+typedef unsigned char  ubyte;
+typedef unsigned char  uint8;
+typedef unsigned short uint16;
+typedef unsigned int   uint;
+typedef unsigned int   uint32;
+typedef int            int32;
+
+#define scast static_cast
+#define rcast reinterpret_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+
+// ========================================================
+// Stand-in for the console:
+// ========================================================
+
+// `gConsole.print()` keeps a scroll-back buffer of lines; this keeps just
+// the copy of the text, wrapping around when the buffer is full.
+static char   consoleBuffer[64 * 1024];
+static size_t consoleUsed;
+
+// Copy of the last message, kept only while checking the results.
+static bool keepLastMessage;
+static char lastMessage[2048];
+
+static void consolePrint(const char * str)
+{
+	const size_t length = std::strlen(str);
+	if (consoleUsed + length >= sizeof(consoleBuffer))
+	{
+		consoleUsed = 0;
+	}
+	std::memcpy(consoleBuffer + consoleUsed, str, length + 1);
+	consoleUsed += length;
+}
+
+// Same as `logOutput()`, less the text colors.
+static void logOutput(const char messageTag, const char * filename, const int lineNum, const char * message)
+{
+	char prefix[64];
+	const char * trimmedFilename = std::strrchr(filename, '/');
+	std::snprintf(prefix, sizeof(prefix), "<%c> %-15.14s%-4d: ", messageTag,
+	              (trimmedFilename != NULL) ? trimmedFilename + 1 : filename, lineNum);
+	consolePrint(prefix);
+	consolePrint(message);
+	consolePrint("\n");
+
+	if (keepLastMessage)
+	{
+		std::strcpy(lastMessage, message);
+	}
+}
+
+// ========================================================
+// Immediate path, from `framework/common.cpp`:
+// ========================================================
+
+static char * vformat(const char * fmt, va_list vaList)
+{
+	enum { MAX_BUF_CHARS = 2048 };
+	static int index = 0;
+	static char strings[4][MAX_BUF_CHARS] ATTRIBUTE_ALIGNED(16);
+
+	char * buf = strings[index];
+	index = (index + 1) & 3;
+
+	uint charsWritten = scast<uint>(vsnprintf(buf, MAX_BUF_CHARS, fmt, vaList));
+	if (charsWritten >= MAX_BUF_CHARS)
+	{
+		charsWritten = MAX_BUF_CHARS - 1;
+	}
+
+	buf[charsWritten] = '\0';
+	return buf;
+}
+
+static void logPrintf(const char * messageTag, const char * filename, const int lineNum, const char * fmt, ...)
+{
+	va_list vaList;
+	va_start(vaList, fmt);
+	logOutput(*messageTag, filename, lineNum, vformat(fmt, vaList));
+	va_end(vaList);
+}
+
+// ========================================================
+// Deferred path, from `framework/common.cpp`:
+// ========================================================
+
+static void logFlush();
+
+static const uint LOG_RING_SIZE       = 16384;
+static const uint LOG_MAX_RECORD_SIZE = 1024;
+static const uint LOG_MAX_STRING_ARG  = 255;
+
+struct LogRecordHeader
+{
+	uint16    size;
+	uint8     tag;
+	uint8     unused;
+	int32     lineNum;
+	uintptr_t fmt;      // 32 bits on the EE.
+	uintptr_t filename; // 32 bits on the EE.
+};
+
+static ubyte logRing[LOG_RING_SIZE] ATTRIBUTE_ALIGNED(16);
+static volatile uint32 logRingWritePos;
+static volatile uint32 logRingReadPos;
+static volatile uint   logDroppedCount;
+static FILE * logDumpFile;
+
+enum LogArgType
+{
+	LOG_ARG_NONE,
+	LOG_ARG_INT,
+	LOG_ARG_DOUBLE,
+	LOG_ARG_STRING,
+	LOG_ARG_POINTER
+};
+
+struct LogFormatSpec
+{
+	const char * start;
+	const char * end;
+	LogArgType   type;
+	uint         size;
+	uint         stars;
+};
+
+static void parseLogFormatSpec(const char * fmt, LogFormatSpec & spec)
+{
+	spec.start = fmt++;
+	spec.type  = LOG_ARG_NONE;
+	spec.size  = sizeof(int);
+	spec.stars = 0;
+
+	while (*fmt != '\0' && std::strchr("-+ #0123456789.*", *fmt) != NULL)
+	{
+		if (*fmt++ == '*')
+		{
+			spec.stars++;
+		}
+	}
+
+	for (uint longs = 0;; ++fmt)
+	{
+		if      (*fmt == 'l') { spec.size = (++longs == 1) ? sizeof(long) : sizeof(long long); }
+		else if (*fmt == 'q' || *fmt == 'j' || *fmt == 'L') { spec.size = sizeof(long long); }
+		else if (*fmt == 'z' || *fmt == 't') { spec.size = sizeof(size_t); }
+		else if (*fmt != 'h') { break; }
+	}
+
+	switch (*fmt)
+	{
+	case 'd' : case 'i' : case 'u' : case 'o' :
+	case 'x' : case 'X' : case 'c' :
+		spec.type = LOG_ARG_INT;
+		break;
+	case 'e' : case 'E' : case 'f' : case 'F' :
+	case 'g' : case 'G' : case 'a' : case 'A' :
+		spec.type = LOG_ARG_DOUBLE;
+		break;
+	case 's' :
+		spec.type = LOG_ARG_STRING;
+		break;
+	case 'p' :
+		spec.type = LOG_ARG_POINTER;
+		break;
+	default :
+		break;
+	}
+
+	spec.end = (*fmt != '\0') ? fmt + 1 : fmt;
+}
+
+static inline bool logRecordAppend(ubyte * record, uint & used, const void * data, const uint size)
+{
+	if (used + size > LOG_MAX_RECORD_SIZE)
+	{
+		return false;
+	}
+	std::memcpy(record + used, data, size);
+	used += size;
+	return true;
+}
+
+template<class T>
+static inline int logFormatArg(char * out, const uint outSize, const char * spec,
+                               const uint stars, const int * starArgs, const T value)
+{
+	switch (stars)
+	{
+	case 0  : return std::snprintf(out, outSize, spec, value);
+	case 1  : return std::snprintf(out, outSize, spec, starArgs[0], value);
+	default : return std::snprintf(out, outSize, spec, starArgs[0], starArgs[1], value);
+	}
+}
+
+static inline const ubyte * logRecordRead(const ubyte * ptr, void * data, const uint size)
+{
+	std::memcpy(data, ptr, size);
+	return ptr + size;
+}
+
+static bool logRingPush(const ubyte * record, const uint size)
+{
+	uint32 writePos = logRingWritePos;
+	const uint32 readPos = logRingReadPos;
+
+	const uint offset  = writePos & (LOG_RING_SIZE - 1);
+	const uint padding = (offset + size > LOG_RING_SIZE) ? (LOG_RING_SIZE - offset) : 0;
+
+	if ((writePos - readPos) + padding + size > LOG_RING_SIZE)
+	{
+		logFlush();
+		writePos = logRingWritePos;
+	}
+
+	if (padding != 0)
+	{
+		LogRecordHeader * skip = rcast<LogRecordHeader *>(&logRing[offset]);
+		skip->size = scast<uint16>(padding);
+		skip->tag  = 0;
+		writePos  += padding;
+	}
+
+	std::memcpy(&logRing[writePos & (LOG_RING_SIZE - 1)], record, size);
+
+	__asm__ __volatile__ ("" ::: "memory");
+	logRingWritePos = writePos + size;
+	return true;
+}
+
+static void logFormatRecord(const LogRecordHeader & header, char * buffer, const uint bufferSize)
+{
+	const ubyte * args = rcast<const ubyte *>(&header + 1);
+	const char  * fmt  = rcast<const char *>(header.fmt);
+	uint used = 0;
+
+	while (*fmt != '\0' && used < bufferSize - 1)
+	{
+		if (*fmt != '%')
+		{
+			buffer[used++] = *fmt++;
+			continue;
+		}
+
+		LogFormatSpec spec;
+		parseLogFormatSpec(fmt, spec);
+		fmt = spec.end;
+
+		int starArgs[2] = { 0, 0 };
+		for (uint s = 0; s < spec.stars && s < 2; ++s)
+		{
+			args = logRecordRead(args, &starArgs[s], sizeof(int));
+		}
+
+		char specStr[32];
+		uint specLen = 0;
+		for (const char * c = spec.start; c < spec.end - 1 && specLen < sizeof(specStr) - 4; ++c)
+		{
+			if (std::strchr("hlqjztL", *c) == NULL)
+			{
+				specStr[specLen++] = *c;
+			}
+		}
+
+		const char conv = *(spec.end - 1);
+		if (spec.type == LOG_ARG_INT && spec.size == sizeof(long long))
+		{
+			specStr[specLen++] = 'l';
+			specStr[specLen++] = 'l';
+		}
+		specStr[specLen++] = conv;
+		specStr[specLen]   = '\0';
+
+		char * out = buffer + used;
+		const uint outSize = bufferSize - used;
+		int written = 0;
+
+		switch (spec.type)
+		{
+		case LOG_ARG_INT :
+			if (spec.size == sizeof(long long))
+			{
+				long long value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			else
+			{
+				int value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			break;
+
+		case LOG_ARG_DOUBLE :
+			{
+				double value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			break;
+
+		case LOG_ARG_STRING :
+			{
+				uint16 length;
+				args = logRecordRead(args, &length, sizeof(length));
+				char str[LOG_MAX_STRING_ARG + 1];
+				args = logRecordRead(args, str, length);
+				str[length] = '\0';
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, scast<const char *>(str));
+			}
+			break;
+
+		case LOG_ARG_POINTER :
+			{
+				void * value;
+				args = logRecordRead(args, &value, sizeof(value));
+				written = logFormatArg(out, outSize, specStr, spec.stars, starArgs, value);
+			}
+			break;
+
+		default :
+			if (conv == '%')
+			{
+				buffer[used++] = '%';
+			}
+			break;
+		}
+
+		if (spec.type == LOG_ARG_STRING)
+		{
+			args = rcast<const ubyte *>((rcast<uintptr_t>(args) + 3) & ~3);
+		}
+
+		if (written > 0)
+		{
+			used += (scast<uint>(written) < outSize) ? scast<uint>(written) : outSize - 1;
+		}
+	}
+
+	buffer[used] = '\0';
+}
+
+static void logDeferred(const char * messageTag, const char * filename, const int lineNum, const char * fmt, ...)
+{
+	ubyte record[LOG_MAX_RECORD_SIZE] ATTRIBUTE_ALIGNED(16);
+
+	LogRecordHeader header;
+	header.size     = 0;
+	header.tag      = scast<uint8>(*messageTag);
+	header.unused   = 0;
+	header.fmt      = rcast<uintptr_t>(fmt);
+	header.filename = rcast<uintptr_t>(filename);
+	header.lineNum  = lineNum;
+
+	uint used = sizeof(header);
+	bool fits = true;
+
+	va_list vaList;
+	va_start(vaList, fmt);
+
+	for (const char * f = fmt; *f != '\0' && fits;)
+	{
+		if (*f != '%')
+		{
+			++f;
+			continue;
+		}
+
+		LogFormatSpec spec;
+		parseLogFormatSpec(f, spec);
+		f = spec.end;
+
+		for (uint s = 0; s < spec.stars; ++s)
+		{
+			const int value = va_arg(vaList, int);
+			fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+		}
+
+		switch (spec.type)
+		{
+		case LOG_ARG_INT :
+			if (spec.size == sizeof(long long))
+			{
+				const long long value = va_arg(vaList, long long);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			else
+			{
+				const int value = va_arg(vaList, int);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			break;
+
+		case LOG_ARG_DOUBLE :
+			{
+				const double value = va_arg(vaList, double);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			break;
+
+		case LOG_ARG_STRING :
+			{
+				const char * str = va_arg(vaList, const char *);
+				if (str == NULL)
+				{
+					str = "(null)";
+				}
+
+				size_t length = std::strlen(str);
+				if (length > LOG_MAX_STRING_ARG)
+				{
+					length = LOG_MAX_STRING_ARG;
+				}
+
+				const uint16 length16 = scast<uint16>(length);
+				const uint32 zeros    = 0;
+				fits = fits && logRecordAppend(record, used, &length16, sizeof(length16));
+				fits = fits && logRecordAppend(record, used, str, length);
+				fits = fits && logRecordAppend(record, used, &zeros, ((used + 3) & ~3) - used);
+			}
+			break;
+
+		case LOG_ARG_POINTER :
+			{
+				const void * value = va_arg(vaList, const void *);
+				fits = fits && logRecordAppend(record, used, &value, sizeof(value));
+			}
+			break;
+
+		default :
+			break;
+		}
+	}
+
+	va_end(vaList);
+
+	if (!fits)
+	{
+		logDroppedCount++;
+		return;
+	}
+
+	used = (used + 3) & ~3;
+	header.size = scast<uint16>(used);
+	std::memcpy(record, &header, sizeof(header));
+
+	logRingPush(record, used);
+}
+
+static void logFlush()
+{
+	uint32 readPos = logRingReadPos;
+	const uint32 writePos = logRingWritePos;
+
+	while (readPos != writePos)
+	{
+		const LogRecordHeader * header =
+			rcast<const LogRecordHeader *>(&logRing[readPos & (LOG_RING_SIZE - 1)]);
+
+		if (header->tag != 0)
+		{
+			if (logDumpFile != NULL)
+			{
+				std::fwrite(header, 1, header->size, logDumpFile);
+			}
+			else
+			{
+				char message[2048];
+				logFormatRecord(*header, message, sizeof(message));
+				logOutput(scast<char>(header->tag), rcast<const char *>(header->filename),
+				          header->lineNum, message);
+			}
+		}
+
+		readPos += header->size;
+
+		__asm__ __volatile__ ("" ::: "memory");
+		logRingReadPos = readPos;
+	}
+}
+
+// ========================================================
+// Test messages:
+// ========================================================
+
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static const char * const FILENAME = "framework/texture_atlas.cpp";
+
+enum MessageKind
+{
+	MSG_PLAIN,  // No arguments.
+	MSG_INTS,   // A few integers.
+	MSG_FLOATS, // Floats, which go through the double formatting.
+	MSG_STRING, // A file name, copied into the record.
+	MSG_MIXED,  // All of the above.
+	MSG_COUNT
+};
+
+static const char * const kindNames[MSG_COUNT] = { "no args", "3 ints", "2 floats", "1 string", "mixed" };
+
+// Logs message `kind` through `LOG`, with arguments that change
+// with `i` so the formatting can't be cached.
+#define LOG_MESSAGE(LOG, kind, i) \
+	do { \
+		switch (kind) \
+		{ \
+		case MSG_PLAIN  : LOG("C", FILENAME, 120, "Tile map textures loaded successfully!"); break; \
+		case MSG_INTS   : LOG("C", FILENAME, 121, "Atlas page %u: %u nodes, %d bytes free", (i) & 7, (i) * 3, 65536 - (i)); break; \
+		case MSG_FLOATS : LOG("W", FILENAME, 122, "Frame took %.2f ms, budget %.1f ms", 16.0 + (i) * 0.01, 16.6); break; \
+		case MSG_STRING : LOG("E", FILENAME, 123, "Texture \"%s\" not found, using the default", textureNames[(i) & 3]); break; \
+		case MSG_MIXED  : LOG("C", FILENAME, 124, "%s: %u tris, %u verts, %5.1f%% of the pool", textureNames[(i) & 3], (i), (i) * 2, (i) * 0.001); break; \
+		default : break; \
+		} \
+	} while (0)
+
+static const char * const textureNames[4] =
+{
+	"textures/walls/stone_brick_01.tga",
+	"textures/floor/dirt.tga",
+	"textures/props/barrel_top.tga",
+	"textures/fx/torch_flame.tga"
+};
+
+// ========================================================
+
+int main()
+{
+	// Messages per timed batch: few enough that the ring never fills
+	// up and flushes by itself during the timing of logDeferred().
+	static const uint BATCH = 128;
+	static const uint BATCHES = 2000;
+	static const int TRIALS = 3;
+
+	int mismatches = 0;
+	static char dumpBuffer[LOG_RING_SIZE * 2];
+
+	std::printf("Nanoseconds per message, best of %d:\n\n", TRIALS);
+	std::printf("message  | logPrintf | logDeferred | flush, text | flush, dump | deferred + text flush\n");
+
+	for (int kind = 0; kind < MSG_COUNT; ++kind)
+	{
+		double immediateNs = 1e30, deferredNs = 1e30, flushTextNs = 1e30, flushDumpNs = 1e30;
+
+		for (int trial = 0; trial < TRIALS; ++trial)
+		{
+			double t0 = nowSeconds();
+			for (uint b = 0; b < BATCHES; ++b)
+			{
+				for (uint i = 0; i < BATCH; ++i)
+				{
+					LOG_MESSAGE(logPrintf, kind, i);
+				}
+			}
+			double ns = (nowSeconds() - t0) * 1e9 / (double(BATCHES) * BATCH);
+			immediateNs = (ns < immediateNs) ? ns : immediateNs;
+
+			// Formatting the ring into text:
+			double deferredTotal = 0.0, flushTotal = 0.0;
+			for (uint b = 0; b < BATCHES; ++b)
+			{
+				t0 = nowSeconds();
+				for (uint i = 0; i < BATCH; ++i)
+				{
+					LOG_MESSAGE(logDeferred, kind, i);
+				}
+				const double t1 = nowSeconds();
+				logFlush();
+				const double t2 = nowSeconds();
+				deferredTotal += t1 - t0;
+				flushTotal    += t2 - t1;
+			}
+			ns = deferredTotal * 1e9 / (double(BATCHES) * BATCH);
+			deferredNs = (ns < deferredNs) ? ns : deferredNs;
+			ns = flushTotal * 1e9 / (double(BATCHES) * BATCH);
+			flushTextNs = (ns < flushTextNs) ? ns : flushTextNs;
+
+			// Dumping the raw records instead:
+			flushTotal = 0.0;
+			for (uint b = 0; b < BATCHES; ++b)
+			{
+				logDumpFile = fmemopen(dumpBuffer, sizeof(dumpBuffer), "wb");
+				for (uint i = 0; i < BATCH; ++i)
+				{
+					LOG_MESSAGE(logDeferred, kind, i);
+				}
+				t0 = nowSeconds();
+				logFlush();
+				flushTotal += nowSeconds() - t0;
+				std::fclose(logDumpFile);
+				logDumpFile = NULL;
+			}
+			ns = flushTotal * 1e9 / (double(BATCHES) * BATCH);
+			flushDumpNs = (ns < flushDumpNs) ? ns : flushDumpNs;
+		}
+
+		// The text out of the ring must be what snprintf() gives.
+		keepLastMessage = true;
+		for (uint i = 0; i < BATCH; ++i)
+		{
+			char expected[2048];
+			LOG_MESSAGE(logPrintf, kind, i);
+			std::strcpy(expected, lastMessage);
+			LOG_MESSAGE(logDeferred, kind, i);
+			logFlush();
+			if (std::strcmp(expected, lastMessage) != 0)
+			{
+				std::printf("  mismatch: \"%s\" vs \"%s\"\n", expected, lastMessage);
+				++mismatches;
+			}
+		}
+		keepLastMessage = false;
+
+		std::printf("%-8s | %9.1f | %11.1f | %11.1f | %11.1f | %21.1f\n", kindNames[kind],
+		            immediateNs, deferredNs, flushTextNs, flushDumpNs, deferredNs + flushTextNs);
+	}
+
+	if (mismatches != 0 || logDroppedCount != 0)
+	{
+		std::printf("\n%d mismatched message(s), %u dropped.\n", mismatches, logDroppedCount);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll deferred messages match snprintf().\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,400 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: log_decoder.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host tool that turns a binary dump of the deferred log back into text.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Decodes the files written by the deferred log after a `logSetDumpFile()` call.
+// The records only store the addresses of the format strings and filenames, so
+// the ELF of the same build is needed to read the strings back. This runs on the
+// development machine, not the PS2:
+//
+//   g++ -O2 log_decoder.cpp -o log_decoder
+//   ./log_decoder game.elf log.plog > log.txt
+//
+// The record layout is described in `framework/common.cpp`, keep the two in sync.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+typedef unsigned char  ubyte;
+typedef unsigned short uint16;
+typedef unsigned int   uint32;
+
+// Same as `LogRecordHeader` in `framework/common.cpp`.
+struct LogRecordHeader
+{
+	uint16 size;
+	ubyte  tag;
+	ubyte  unused;
+	uint32 fmt;
+	uint32 filename;
+	int    lineNum;
+};
+
+// Same as `LogDumpHeader` in `framework/common.cpp`.
+struct LogDumpHeader
+{
+	char  magic[4];
+	ubyte version;
+	ubyte sizeOfLong;
+	ubyte sizeOfSizeT;
+	ubyte sizeOfPointer;
+};
+
+// ========================================================
+
+static std::vector<ubyte> readFile(const char * filename)
+{
+	std::vector<ubyte> data;
+	FILE * file = std::fopen(filename, "rb");
+	if (file == NULL)
+	{
+		std::fprintf(stderr, "Can't open \"%s\"!\n", filename);
+		std::exit(EXIT_FAILURE);
+	}
+
+	ubyte chunk[4096];
+	size_t count;
+	while ((count = std::fread(chunk, 1, sizeof(chunk), file)) != 0)
+	{
+		data.insert(data.end(), chunk, chunk + count);
+	}
+
+	std::fclose(file);
+	return data;
+}
+
+// ========================================================
+
+// Loaded sections of the ELF, to look up strings by address.
+// Only the little-endian ELFs of the EE (or the host, for testing) are handled.
+struct ElfImage
+{
+	struct Section
+	{
+		unsigned long long address;
+		unsigned long long size;
+		unsigned long long offset;
+	};
+
+	std::vector<ubyte>   data;
+	std::vector<Section> sections;
+
+	template<class T>
+	T read(const unsigned long long offset) const
+	{
+		T value = T();
+		if (offset + sizeof(T) <= data.size())
+		{
+			std::memcpy(&value, &data[offset], sizeof(T));
+		}
+		return value;
+	}
+
+	void load(const char * filename)
+	{
+		data = readFile(filename);
+		if (data.size() < 64 || std::memcmp(&data[0], "\x7F" "ELF", 4) != 0 || data[5] != 1)
+		{
+			std::fprintf(stderr, "\"%s\" is not a little-endian ELF!\n", filename);
+			std::exit(EXIT_FAILURE);
+		}
+
+		const bool is64 = (data[4] == 2);
+		const unsigned long long shoff = is64 ? read<unsigned long long>(0x28) : read<uint32>(0x20);
+		const uint16 shentsize = read<uint16>(is64 ? 0x3A : 0x2E);
+		const uint16 shnum     = read<uint16>(is64 ? 0x3C : 0x30);
+
+		for (uint16 i = 0; i < shnum; ++i)
+		{
+			const unsigned long long sh = shoff + (i * shentsize);
+			const uint32 type = read<uint32>(sh + 0x04);
+			const unsigned long long flags = is64 ? read<unsigned long long>(sh + 0x08) : read<uint32>(sh + 0x08);
+
+			const unsigned SHT_NOBITS = 8;
+			const unsigned SHF_ALLOC  = 2;
+			if (type == SHT_NOBITS || !(flags & SHF_ALLOC))
+			{
+				continue;
+			}
+
+			Section section;
+			section.address = is64 ? read<unsigned long long>(sh + 0x10) : read<uint32>(sh + 0x0C);
+			section.offset  = is64 ? read<unsigned long long>(sh + 0x18) : read<uint32>(sh + 0x10);
+			section.size    = is64 ? read<unsigned long long>(sh + 0x20) : read<uint32>(sh + 0x14);
+			sections.push_back(section);
+		}
+	}
+
+	std::string stringAt(const uint32 address) const
+	{
+		for (size_t i = 0; i < sections.size(); ++i)
+		{
+			const Section & s = sections[i];
+			if (address < s.address || address >= s.address + s.size)
+			{
+				continue;
+			}
+
+			std::string str;
+			for (unsigned long long o = s.offset + (address - s.address); o < data.size() && data[o] != 0; ++o)
+			{
+				str += static_cast<char>(data[o]);
+			}
+			return str;
+		}
+
+		char unknown[32];
+		std::sprintf(unknown, "<0x%08X?>", address);
+		return unknown;
+	}
+};
+
+// ========================================================
+
+// Reads the little-endian argument bytes of a record.
+struct ArgReader
+{
+	const ubyte * ptr;
+	const ubyte * end;
+	size_t        offset; // From the start of the record, for the string padding.
+
+	unsigned long long readUnsigned(const unsigned size)
+	{
+		unsigned long long value = 0;
+		for (unsigned b = 0; b < size && ptr < end; ++b, ++ptr, ++offset)
+		{
+			value |= static_cast<unsigned long long>(*ptr) << (b * 8);
+		}
+		return value;
+	}
+
+	long long readSigned(const unsigned size)
+	{
+		const unsigned long long value = readUnsigned(size);
+		if (size < 8 && (value & (1ULL << ((size * 8) - 1))))
+		{
+			return static_cast<long long>(value | (~0ULL << (size * 8)));
+		}
+		return static_cast<long long>(value);
+	}
+
+	double readDouble()
+	{
+		const unsigned long long bits = readUnsigned(8);
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	std::string readString()
+	{
+		const unsigned length = static_cast<unsigned>(readUnsigned(2));
+		std::string str;
+		for (unsigned c = 0; c < length && ptr < end; ++c, ++ptr, ++offset)
+		{
+			str += static_cast<char>(*ptr);
+		}
+		while ((offset & 3) != 0 && ptr < end)
+		{
+			++ptr;
+			++offset;
+		}
+		return str;
+	}
+};
+
+// ========================================================
+
+static std::string formatRecord(const std::string & fmt, ArgReader & args, const LogDumpHeader & target)
+{
+	// Same parsing as `parseLogFormatSpec()` on the EE, but with the sizes of the target.
+	std::string out;
+	for (size_t i = 0; i < fmt.size();)
+	{
+		if (fmt[i] != '%')
+		{
+			out += fmt[i++];
+			continue;
+		}
+
+		std::string spec = "%";
+		unsigned stars = 0;
+		++i;
+
+		while (i < fmt.size() && std::strchr("-+ #0123456789.*", fmt[i]) != NULL)
+		{
+			stars += (fmt[i] == '*');
+			spec  += fmt[i++];
+		}
+
+		unsigned intSize = 4;
+		for (unsigned longs = 0; i < fmt.size(); ++i)
+		{
+			const char m = fmt[i];
+			if      (m == 'l') { intSize = (++longs == 1) ? target.sizeOfLong : 8; }
+			else if (m == 'q' || m == 'j' || m == 'L') { intSize = 8; }
+			else if (m == 'z' || m == 't') { intSize = target.sizeOfSizeT; }
+			else if (m != 'h') { break; }
+		}
+
+		if (i >= fmt.size())
+		{
+			break;
+		}
+
+		const char conv = fmt[i++];
+		int starArgs[2] = { 0, 0 };
+		for (unsigned s = 0; s < stars; ++s)
+		{
+			const int value = static_cast<int>(args.readSigned(4));
+			if (s < 2)
+			{
+				starArgs[s] = value;
+			}
+		}
+
+		// Values are always passed as the widest type, so the
+		// host's own sizes don't matter.
+		char buffer[1024];
+		buffer[0] = '\0';
+		#define FORMAT_ARG(fmtStr, value)                                                                   \
+			do {                                                                                            \
+				if      (stars == 0) std::snprintf(buffer, sizeof(buffer), fmtStr, value);                  \
+				else if (stars == 1) std::snprintf(buffer, sizeof(buffer), fmtStr, starArgs[0], value);     \
+				else std::snprintf(buffer, sizeof(buffer), fmtStr, starArgs[0], starArgs[1], value);        \
+			} while (0)
+
+		switch (conv)
+		{
+		case 'd' : case 'i' :
+			FORMAT_ARG((spec + "ll" + conv).c_str(), args.readSigned(intSize));
+			break;
+		case 'u' : case 'o' : case 'x' : case 'X' :
+			{
+				unsigned long long value = args.readUnsigned(intSize);
+				FORMAT_ARG((spec + "ll" + conv).c_str(), value);
+			}
+			break;
+		case 'c' :
+			FORMAT_ARG((spec + conv).c_str(), static_cast<int>(args.readSigned(4)));
+			break;
+		case 'e' : case 'E' : case 'f' : case 'F' :
+		case 'g' : case 'G' : case 'a' : case 'A' :
+			FORMAT_ARG((spec + conv).c_str(), args.readDouble());
+			break;
+		case 's' :
+			FORMAT_ARG((spec + conv).c_str(), args.readString().c_str());
+			break;
+		case 'p' :
+			FORMAT_ARG((spec + "llX").c_str(), args.readUnsigned(target.sizeOfPointer));
+			out += "0x";
+			break;
+		case '%' :
+			out += '%';
+			break;
+		default :
+			break;
+		} // switch (conv)
+
+		#undef FORMAT_ARG
+		out += buffer;
+	}
+	return out;
+}
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	if (argc != 3)
+	{
+		std::fprintf(stderr, "Usage: %s <program.elf> <log.plog>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	ElfImage elf;
+	elf.load(argv[1]);
+
+	const std::vector<ubyte> dump = readFile(argv[2]);
+	LogDumpHeader target;
+	if (dump.size() < sizeof(target))
+	{
+		std::fprintf(stderr, "\"%s\" is too short!\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	std::memcpy(&target, &dump[0], sizeof(target));
+	if (std::memcmp(target.magic, "PLOG", 4) != 0 || target.version != 1)
+	{
+		std::fprintf(stderr, "\"%s\" is not a version 1 log dump!\n", argv[2]);
+		return EXIT_FAILURE;
+	}
+
+	size_t pos = sizeof(target);
+	unsigned count = 0;
+
+	while (pos + sizeof(LogRecordHeader) <= dump.size())
+	{
+		LogRecordHeader header;
+		std::memcpy(&header, &dump[pos], sizeof(header));
+		if (header.size < sizeof(header) || pos + header.size > dump.size())
+		{
+			std::fprintf(stderr, "Truncated or corrupted record at offset %u!\n", static_cast<unsigned>(pos));
+			return EXIT_FAILURE;
+		}
+
+		ArgReader args;
+		args.ptr    = &dump[pos] + sizeof(header);
+		args.end    = &dump[pos] + header.size;
+		args.offset = sizeof(header);
+
+		// Same prefix as `LOG_PRINTF_ADD_MESSAGE_PREFIX`.
+		std::string filename = elf.stringAt(header.filename);
+		const size_t slash = filename.rfind('/');
+		if (slash != std::string::npos)
+		{
+			filename = filename.substr(slash + 1);
+		}
+
+		const std::string message = formatRecord(elf.stringAt(header.fmt), args, target);
+		std::printf("<%c> %-15.14s%-4d: %s\n", header.tag, filename.c_str(), header.lineNum, message.c_str());
+
+		pos += header.size;
+		++count;
+	}
+
+	std::fprintf(stderr, "%u messages decoded.\n", count);
+	return EXIT_SUCCESS;
+}
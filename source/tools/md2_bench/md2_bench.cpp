@@ -0,0 +1,594 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: md2_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host benchmark of the MD2 model lighting.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds `framework/md2_model.cpp` for the host, with the ps2_math backend of
+// the machine, loads a synthesized MD2 model and times the per-entity lighting
+// (`Md2LightTable`, filled by `GameWorld::computeEntityLighting()` every frame
+// for each visible entity in range of a light) with 1 to 3 lights:
+//
+//  - table build: `setAmbient()`, then an `addLight()` pass over the
+//    162 normals per light.
+//  - assembly:    `Md2Model::assembleFrame()` to DrawVertex without and
+//    with the light table, so the difference is the cost of the fetches.
+//  - per vertex:  lighting each vertex of the model directly, which is
+//    what the table replaces. Cut down to the light loop; not in the tree.
+//
+// Also checks the frame assembly against the file data: positions, that the
+// table colors match the direct lighting, and the packed vertexes. Runs on
+// the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework md2_bench.cpp -o md2_bench
+//   ./md2_bench [model triangles, default 500]
+//
+// Builds with the SSE2 backend on x86-64. Add -DPS2MATH_BACKEND=0 to
+// time the plain C++ math instead. Exits with a non-zero status if any
+// check fails.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` and `ingame_console.hpp` need the PS2SDK headers,
+// so define the few things the MD2 code uses and skip them.
+#define COMMON_HPP
+#define INGAME_CONSOLE_HPP
+
+#define nullptr NULL
+#define restrict __restrict
+#define ccast const_cast
+#define rcast reinterpret_cast
+#define scast static_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+#define ATTRIBUTE_PACKED __attribute__((packed))
+#define CT_ASSERT_SIZE(type, size) typedef int ct_assert_ ## type ## _size[(sizeof(type) == (size)) ? 1 : -1]
+
+typedef unsigned char  ubyte;
+typedef unsigned char  uint8;
+typedef short          int16;
+typedef unsigned short uint16;
+typedef unsigned int   uint;
+typedef unsigned int   uint32;
+typedef int            int32;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+#define fatalError(...) do { std::printf(__VA_ARGS__); std::exit(EXIT_FAILURE); } while (0)
+
+#define logComment(...) /* nothing */
+#define logWarning(...) do { std::printf("  warning: "); std::printf(__VA_ARGS__); std::printf("\n"); } while (0)
+#define logError(...)   do { std::printf("  error: ");   std::printf(__VA_ARGS__); std::printf("\n"); } while (0)
+
+struct Color4f
+{
+	float r, g, b, a;
+};
+
+inline Color4f makeColor4f(const float r, const float g, const float b, const float a = 1.0f)
+{
+	const Color4f c = { r, g, b, a };
+	return c;
+}
+
+// A macro here: C++98 doesn't take the unnamed struct of `stdMd2Anims` as a template argument.
+#define arrayLength(arr) scast<uint>(sizeof(arr) / sizeof((arr)[0]))
+
+template<class T>
+inline T clamp(const T x, const T minimum, const T maximum)
+{
+	return (x < minimum) ? minimum : (x > maximum) ? maximum : x;
+}
+
+inline uint32 make4CC(const ubyte c0, const ubyte c1, const ubyte c2, const ubyte c3)
+{
+	return scast<uint32>(c0) | (scast<uint32>(c1) << 8) | (scast<uint32>(c2) << 16) | (scast<uint32>(c3) << 24);
+}
+
+// `printAnimList()` prints to the in-game console.
+inline const char * format(const char *, ...)
+{
+	return "";
+}
+
+struct ConsoleStandIn
+{
+	void print(const char *) { }
+};
+
+static ConsoleStandIn gConsole;
+
+// Same interface as `framework/memory.hpp`, over the C heap.
+enum MemAllocTag { MEM_TAG_GENERIC, MEM_TAG_CPP_NEW };
+const size_t DEFAULT_MEM_ALIGNMENT = 16;
+
+inline MemAllocTag memGetNewTag() { return MEM_TAG_CPP_NEW; }
+
+template<class T>
+inline T * memAlloc(MemAllocTag, const size_t elementCount, const size_t alignment = DEFAULT_MEM_ALIGNMENT)
+{
+	void * ptr = nullptr;
+	return (posix_memalign(&ptr, alignment, elementCount * sizeof(T)) == 0) ? scast<T *>(ptr) : nullptr;
+}
+
+template<class T>
+inline T * memClearedAlloc(MemAllocTag tag, const size_t elementCount, const size_t alignment = DEFAULT_MEM_ALIGNMENT)
+{
+	T * ptr = memAlloc<T>(tag, elementCount, alignment);
+	if (ptr != nullptr)
+	{
+		std::memset(ptr, 0, elementCount * sizeof(T));
+	}
+	return ptr;
+}
+
+inline void memFree(MemAllocTag, void * ptr)
+{
+	std::free(ptr);
+}
+
+struct MemPlacement { };
+
+inline void * operator new (size_t, void * where, MemPlacement)
+{
+	return where;
+}
+
+inline void operator delete (void *, void *, MemPlacement)
+{
+}
+
+template<class T>
+inline void memConstruct(T * where, const T & value)
+{
+	new (where, MemPlacement()) T(value);
+}
+
+template<class T>
+inline void memDestroy(T * obj)
+{
+	obj->~T();
+}
+
+// `PackedVertexFormat::TEXCOORD_SCALE` lives in `renderer.cpp`.
+#include "draw_vertex.hpp"
+const float PackedVertexFormat::TEXCOORD_SCALE = 4096.0f;
+
+#include "ps2_math/math_funcs.cpp"
+#include "md2_model.cpp"
+
+// ========================================================
+// Test helpers:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static float randFloat(const float lo, const float hi)
+{
+	randState = randState * 1664525 + 1013904223;
+	return lo + (hi - lo) * ((randState >> 8) * (1.0f / 16777216.0f));
+}
+
+static uint randUint(const uint upperBound)
+{
+	randState = randState * 1664525 + 1013904223;
+	return (randState >> 8) % upperBound;
+}
+
+static Vector randUnitVector()
+{
+	for (;;)
+	{
+		const float x = randFloat(-1.0f, 1.0f);
+		const float y = randFloat(-1.0f, 1.0f);
+		const float z = randFloat(-1.0f, 1.0f);
+		const float lenSqr = (x * x) + (y * y) + (z * z);
+		if (lenSqr > 0.01f && lenSqr <= 1.0f)
+		{
+			const float invLen = 1.0f / std::sqrt(lenSqr);
+			return Vector(x * invLen, y * invLen, z * invLen, 0.0f);
+		}
+	}
+}
+
+// clock() is too coarse to time a single table build.
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Keeps the optimizer from dropping the work.
+static volatile float sink;
+
+// ========================================================
+// Synthesized MD2 file:
+// ========================================================
+
+// The on-disk layout read by `Md2Model::initFromMemory()`.
+// No GL commands, one skin and two 4-frame animations.
+struct ATTRIBUTE_PACKED Md2FileHeader
+{
+	uint32 magic, version, skinWidth, skinHeight, frameSize, skinCount;
+	uint32 vertsPerFrame, texCoordCount, triangleCount, glCmdCount, frameCount;
+	uint32 offsetSkins, offsetTexCoords, offsetTris, offsetFrames, offsetGLCmds, offsetEnd;
+};
+
+struct ATTRIBUTE_PACKED Md2FileTriangle { uint16 vertex[3]; uint16 uv[3]; };
+struct ATTRIBUTE_PACKED Md2FileVertex   { uint8 v[3]; uint8 normalIndex; };
+struct ATTRIBUTE_PACKED Md2FileKeyframe { float scale[3]; float translate[3]; char name[16]; };
+
+static const uint SKIN_SIZE   = 256;
+static const uint FRAME_COUNT = 8;
+static const char * const frameNames[FRAME_COUNT] =
+{
+	"stand01", "stand02", "stand03", "stand04", "run1", "run2", "run3", "run4"
+};
+
+static ubyte * buildMd2File(const uint triangleCount, uint & sizeBytes)
+{
+	// About as many vertexes as triangles on a closed model; texture seams add a few.
+	const uint vertCount     = triangleCount / 2 + 2;
+	const uint texCoordCount = vertCount + vertCount / 4;
+	const uint frameSize     = sizeof(Md2FileKeyframe) + vertCount * sizeof(Md2FileVertex);
+
+	Md2FileHeader header;
+	std::memset(&header, 0, sizeof(header));
+	header.magic           = make4CC('I', 'D', 'P', '2');
+	header.version         = 8;
+	header.skinWidth       = SKIN_SIZE;
+	header.skinHeight      = SKIN_SIZE;
+	header.frameSize       = frameSize;
+	header.skinCount       = 1;
+	header.vertsPerFrame   = vertCount;
+	header.texCoordCount   = texCoordCount;
+	header.triangleCount   = triangleCount;
+	header.frameCount      = FRAME_COUNT;
+	header.offsetSkins     = sizeof(header);
+	header.offsetTexCoords = header.offsetSkins + 64;
+	header.offsetTris      = header.offsetTexCoords + texCoordCount * 2 * sizeof(uint16);
+	header.offsetFrames    = header.offsetTris + triangleCount * sizeof(Md2FileTriangle);
+	header.offsetGLCmds    = header.offsetFrames + FRAME_COUNT * frameSize;
+	header.offsetEnd       = header.offsetGLCmds;
+
+	sizeBytes = header.offsetEnd;
+	ubyte * data = scast<ubyte *>(std::calloc(sizeBytes, 1));
+	std::memcpy(data, &header, sizeof(header));
+	std::strcpy(rcast<char *>(data + header.offsetSkins), "models/test/skin.pcx");
+
+	uint16 * texCoords = rcast<uint16 *>(data + header.offsetTexCoords);
+	for (uint i = 0; i < texCoordCount * 2; ++i)
+	{
+		texCoords[i] = scast<uint16>(randUint(SKIN_SIZE));
+	}
+
+	Md2FileTriangle * tris = rcast<Md2FileTriangle *>(data + header.offsetTris);
+	for (uint t = 0; t < triangleCount; ++t)
+	{
+		for (uint v = 0; v < 3; ++v)
+		{
+			tris[t].vertex[v] = scast<uint16>(randUint(vertCount));
+			tris[t].uv[v]     = scast<uint16>(randUint(texCoordCount));
+		}
+	}
+
+	for (uint f = 0; f < FRAME_COUNT; ++f)
+	{
+		ubyte * framePtr = data + header.offsetFrames + f * frameSize;
+		Md2FileKeyframe keyframe;
+		std::memset(&keyframe, 0, sizeof(keyframe));
+		for (uint i = 0; i < 3; ++i)
+		{
+			keyframe.scale[i]     = randFloat(0.1f, 0.25f);
+			keyframe.translate[i] = randFloat(-24.0f, -8.0f);
+		}
+		std::strcpy(keyframe.name, frameNames[f]);
+		std::memcpy(framePtr, &keyframe, sizeof(keyframe));
+
+		Md2FileVertex * verts = rcast<Md2FileVertex *>(framePtr + sizeof(keyframe));
+		for (uint v = 0; v < vertCount; ++v)
+		{
+			verts[v].v[0] = scast<uint8>(randUint(256));
+			verts[v].v[1] = scast<uint8>(randUint(256));
+			verts[v].v[2] = scast<uint8>(randUint(256));
+			verts[v].normalIndex = scast<uint8>(randUint(Md2LightTable::NUM_NORMALS));
+		}
+	}
+	return data;
+}
+
+// Normal index of each assembled vertex of `frame`, in assembly order.
+static void getVertexNormalIndexes(const ubyte * data, const uint frame, ubyte * normalIndexes)
+{
+	const Md2FileHeader * header = rcast<const Md2FileHeader *>(data);
+	const Md2FileTriangle * tris = rcast<const Md2FileTriangle *>(data + header->offsetTris);
+	const Md2FileVertex * verts  = rcast<const Md2FileVertex *>(data + header->offsetFrames +
+	                               frame * header->frameSize + sizeof(Md2FileKeyframe));
+
+	for (uint t = 0; t < header->triangleCount; ++t)
+	{
+		for (uint v = 0; v < 3; ++v)
+		{
+			normalIndexes[t * 3 + v] = verts[tris[t].vertex[v]].normalIndex;
+		}
+	}
+}
+
+// ========================================================
+// Lighting without the table:
+// ========================================================
+
+static const uint MAX_LIGHTS = 3;
+
+// Lights each vertex of the assembled frame directly, instead of
+// fetching from a `Md2LightTable`. Same clamp as `addLight()`.
+static void lightVertsDirect(const ubyte * normalIndexes, DrawVertex * verts, const uint vertCount,
+                             const Color4f & vertColor, const Color4f & ambient, const Vector * dirs,
+                             const Color4f * colors, const uint lightCount)
+{
+	const float maxIntensity = 1.99f;
+	for (uint v = 0; v < vertCount; ++v)
+	{
+		const Vector & normal = Md2LightTable::getNormal(normalIndexes[v]);
+		float r = ambient.r;
+		float g = ambient.g;
+		float b = ambient.b;
+		for (uint l = 0; l < lightCount; ++l)
+		{
+			const float nDotL = dotProduct3(normal, dirs[l]);
+			if (nDotL <= 0.0f)
+			{
+				continue;
+			}
+			r = ps2math::min(r + colors[l].r * nDotL, maxIntensity);
+			g = ps2math::min(g + colors[l].g * nDotL, maxIntensity);
+			b = ps2math::min(b + colors[l].b * nDotL, maxIntensity);
+		}
+		verts[v].color = Vector(vertColor.r * r, vertColor.g * g, vertColor.b * b, vertColor.a);
+	}
+}
+
+// ========================================================
+// Tests:
+// ========================================================
+
+static void testLoad(const Md2Model & model, const uint triangleCount)
+{
+	std::printf("Loading the synthesized MD2...\n");
+
+	CHECK(model.getTriangleCount() == triangleCount);
+	CHECK(model.getKeyframeCount() == FRAME_COUNT);
+	CHECK(model.getAnimCount() == 2);
+
+	uint start, end, fps;
+	CHECK(model.findAnimByName("stand", start, end, fps) && start == 0 && end == 3);
+	CHECK(model.findAnimByName("run", start, end, fps) && start == 4 && end == 7);
+	CHECK(!model.findAnimByName("walk", start, end, fps));
+	CHECK(model.findAnimByPartialName("ru", start, end, fps) && start == 4);
+}
+
+static void testAssembly(const Md2Model & model, const ubyte * data, DrawVertex * verts, DrawVertex * litVerts,
+                         PackedDrawVertex * packedVerts, ubyte * normalIndexes, const Color4f & ambient,
+                         const Vector * dirs, const Color4f * colors)
+{
+	std::printf("Frame assembly against the file data...\n");
+
+	const uint vertCount = model.getTriangleCount() * 3;
+	const Color4f vertColor = makeColor4f(0.9f, 0.8f, 0.7f, 128.0f);
+
+	for (uint frame = 0; frame < FRAME_COUNT; frame += 3)
+	{
+		model.assembleFrame(frame, SKIN_SIZE, SKIN_SIZE, vertColor, verts);
+		model.assembleFrame(frame, SKIN_SIZE, SKIN_SIZE, vertColor, packedVerts);
+
+		// Inside the frame bounds, unlit color, packed within a quantization step.
+		const Aabb & bounds = model.getBoundsForFrame(frame);
+		const PackedVertexFormat & fmt = model.getPackedVertexFormat();
+		uint outOfBounds = 0, badColors = 0, badPacked = 0;
+		for (uint v = 0; v < vertCount; ++v)
+		{
+			const Vector & p = verts[v].position;
+			outOfBounds += (p.w != 1.0f || p.x < bounds.mins.x || p.y < bounds.mins.y || p.z < bounds.mins.z ||
+			                p.x > bounds.maxs.x || p.y > bounds.maxs.y || p.z > bounds.maxs.z) ? 1 : 0;
+			badColors += (verts[v].color.x != vertColor.r || verts[v].color.w != vertColor.a) ? 1 : 0;
+
+			for (uint i = 0; i < 3; ++i)
+			{
+				const float * scale = &fmt.scale.x;
+				const float * bias  = &fmt.bias.x;
+				const float unpacked = packedVerts[v].position[i] * scale[i] + bias[i];
+				badPacked += (std::fabs(unpacked - (&p.x)[i]) > scale[i]) ? 1 : 0;
+			}
+			badPacked += (packedVerts[v].color[0] != scast<ubyte>(vertColor.r * 128.0f)) ? 1 : 0;
+		}
+		CHECK(outOfBounds == 0);
+		CHECK(badColors == 0);
+		CHECK(badPacked == 0);
+	}
+
+	// The table and lighting every vertex must agree.
+	for (uint lights = 0; lights <= MAX_LIGHTS; ++lights)
+	{
+		Md2LightTable table;
+		table.setAmbient(ambient);
+		for (uint l = 0; l < lights; ++l)
+		{
+			table.addLight(dirs[l], colors[l]);
+		}
+
+		model.assembleFrame(1, SKIN_SIZE, SKIN_SIZE, vertColor, litVerts, &table);
+		model.assembleFrame(1, SKIN_SIZE, SKIN_SIZE, vertColor, verts);
+		getVertexNormalIndexes(data, 1, normalIndexes);
+		lightVertsDirect(normalIndexes, verts, vertCount, vertColor, ambient, dirs, colors, lights);
+
+		float maxError = 0.0f;
+		for (uint v = 0; v < vertCount; ++v)
+		{
+			maxError = ps2math::max(maxError, std::fabs(litVerts[v].color.x - verts[v].color.x));
+			maxError = ps2math::max(maxError, std::fabs(litVerts[v].color.y - verts[v].color.y));
+			maxError = ps2math::max(maxError, std::fabs(litVerts[v].color.z - verts[v].color.z));
+		}
+		std::printf("  %u light(s): max color difference %g\n", lights, maxError);
+		CHECK(maxError < 1e-5f);
+	}
+}
+
+// ========================================================
+// Benchmark:
+// ========================================================
+
+static void bench(const Md2Model & model, DrawVertex * verts, const ubyte * normalIndexes,
+                  const Color4f & ambient, const Vector * dirs, const Color4f * colors)
+{
+	const uint vertCount = model.getTriangleCount() * 3;
+	const Color4f vertColor = makeColor4f(1.0f, 1.0f, 1.0f, 128.0f);
+	const int reps = 200000;
+	const int vertReps = reps / 10;
+	Md2LightTable table;
+
+	std::printf("\nBackend: %s, %u triangle model, microseconds per entity:\n\n",
+	            PS2MATH_USE_SSE2 ? "SSE2" : "scalar", model.getTriangleCount());
+	std::printf("lights | table build | assembly, unlit | assembly, table | per vertex, no table\n");
+
+	for (uint lights = 1; lights <= MAX_LIGHTS; ++lights)
+	{
+		double t0 = nowSeconds();
+		for (int r = 0; r < reps; ++r)
+		{
+			table.setAmbient(ambient);
+			for (uint l = 0; l < lights; ++l)
+			{
+				table.addLight(dirs[l], colors[l]);
+			}
+			sink = table.getColor(r % Md2LightTable::NUM_NORMALS).x;
+		}
+		const double buildUs = (nowSeconds() - t0) * 1e6 / reps;
+
+		t0 = nowSeconds();
+		for (int r = 0; r < vertReps; ++r)
+		{
+			model.assembleFrame(1, SKIN_SIZE, SKIN_SIZE, vertColor, verts);
+			sink = verts[r % vertCount].color.x;
+		}
+		const double unlitUs = (nowSeconds() - t0) * 1e6 / vertReps;
+
+		t0 = nowSeconds();
+		for (int r = 0; r < vertReps; ++r)
+		{
+			model.assembleFrame(1, SKIN_SIZE, SKIN_SIZE, vertColor, verts, &table);
+			sink = verts[r % vertCount].color.x;
+		}
+		const double tableUs = (nowSeconds() - t0) * 1e6 / vertReps;
+
+		t0 = nowSeconds();
+		for (int r = 0; r < vertReps; ++r)
+		{
+			lightVertsDirect(normalIndexes, verts, vertCount, vertColor, ambient, dirs, colors, lights);
+			sink = verts[r % vertCount].color.x;
+		}
+		const double directUs = (nowSeconds() - t0) * 1e6 / vertReps;
+
+		std::printf("%6u | %11.3f | %15.3f | %15.3f | %20.3f\n", lights, buildUs, unlitUs, tableUs, directUs);
+	}
+}
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	const int triangles = (argc > 1) ? std::atoi(argv[1]) : 500;
+	if (triangles <= 0 || triangles > 4096)
+	{
+		std::fprintf(stderr, "Usage: %s [model triangles, 1 to 4096, default 500]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	uint sizeBytes = 0;
+	ubyte * data = buildMd2File(triangles, sizeBytes);
+
+	Md2Model model;
+	if (!model.initFromMemory(data, sizeBytes))
+	{
+		std::printf("Failed to load the synthesized MD2!\n");
+		return EXIT_FAILURE;
+	}
+
+	const uint vertCount = triangles * 3;
+	DrawVertex * verts    = memAlloc<DrawVertex>(MEM_TAG_GENERIC, vertCount);
+	DrawVertex * litVerts = memAlloc<DrawVertex>(MEM_TAG_GENERIC, vertCount);
+	PackedDrawVertex * packedVerts = memAlloc<PackedDrawVertex>(MEM_TAG_GENERIC, vertCount);
+	ubyte * normalIndexes = memAlloc<ubyte>(MEM_TAG_GENERIC, vertCount);
+
+	const Color4f ambient = makeColor4f(0.6f, 0.6f, 0.6f);
+	Vector  dirs[MAX_LIGHTS];
+	Color4f colors[MAX_LIGHTS];
+	for (uint l = 0; l < MAX_LIGHTS; ++l)
+	{
+		dirs[l]   = randUnitVector();
+		colors[l] = makeColor4f(randFloat(0.3f, 0.8f), randFloat(0.2f, 0.6f), randFloat(0.1f, 0.3f));
+	}
+
+	testLoad(model, triangles);
+	testAssembly(model, data, verts, litVerts, packedVerts, normalIndexes, ambient, dirs, colors);
+
+	getVertexNormalIndexes(data, 1, normalIndexes);
+	bench(model, verts, normalIndexes, ambient, dirs, colors);
+
+	memFree(MEM_TAG_GENERIC, normalIndexes);
+	memFree(MEM_TAG_GENERIC, packedVerts);
+	memFree(MEM_TAG_GENERIC, litVerts);
+	memFree(MEM_TAG_GENERIC, verts);
+	std::free(data);
+
+	CHECK(assertsFailed == 0);
+	if (checksFailed != 0)
+	{
+		std::printf("\n%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll checks passed.\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,808 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: mem_trace_analyzer.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host tool that replays EE heap traces to measure fragmentation and compare allocators.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+
+//
+// Replays the allocation traces written by a MEM_TRACE=1 build after a
+// `memTraceStart()` call. Prints a summary of the churn per tag and per call
+// site, then replays the same sequence of allocations against a TLSF and a
+// size-class pool allocator to compare their footprint and speed with the
+// C heap. Runs on the development machine, not the PS2:
+//
+//   g++ -O2 mem_trace_analyzer.cpp -o mem_trace_analyzer
+//   ./mem_trace_analyzer trace.pmem [heap.csv] [heap size in MB, default 32]
+//
+// The optional CSV gets the occupancy of the recorded heap over time
+// (seconds, live, extent, free, largest free block, fragmentation), e.g.:
+//
+//   gnuplot -p -e "set datafile separator ','; plot 'heap.csv' using 1:2 with lines title 'live',
+//                  '' using 1:5 with lines title 'largest free'"  (on a single line)
+//
+// Call site PCs can be resolved with `addr2line -f -C -e game.elf <pc>`.
+// The record layout is described in `framework/memory.cpp`, keep the two in sync.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <vector>
+
+typedef unsigned char  ubyte;
+typedef unsigned short uint16;
+typedef unsigned int   uint32;
+
+// ========================================================
+
+// Same as `MemTraceRecord` in `framework/memory.cpp`.
+struct MemTraceRecord
+{
+	uint32 timestamp;
+	uint32 address;
+	uint32 oldAddress;
+	uint32 sizeBytes;
+	uint32 callerPc;
+	uint16 alignment;
+	ubyte  tag;
+	ubyte  op;
+};
+
+// Same as `MemTraceHeader` in `framework/memory.cpp`.
+struct MemTraceHeader
+{
+	char   magic[4];
+	uint16 version;
+	uint16 recordSize;
+	uint32 cpuClockHz;
+};
+
+enum
+{
+	MEM_OP_MALLOC  = 1,
+	MEM_OP_FREE    = 2,
+	MEM_OP_REALLOC = 3
+};
+
+// Same order as `MemAllocTag` in `framework/memory.hpp`.
+static const char * const tagNames[] =
+{
+	"GENERIC", "CPP_NEW", "GEOMETRY", "TEXTURE", "PARTICLE", "RENDERER", "FRAME"
+};
+static const uint32 TAG_COUNT = sizeof(tagNames) / sizeof(tagNames[0]);
+
+static const uint32 NIL = 0xFFFFFFFF;
+
+// ========================================================
+
+static std::vector<ubyte> readFile(const char * filename)
+{
+	std::vector<ubyte> data;
+	FILE * file = std::fopen(filename, "rb");
+	if (file == NULL)
+	{
+		std::fprintf(stderr, "Can't open \"%s\"!\n", filename);
+		std::exit(EXIT_FAILURE);
+	}
+
+	ubyte chunk[4096];
+	size_t count;
+	while ((count = std::fread(chunk, 1, sizeof(chunk), file)) != 0)
+	{
+		data.insert(data.end(), chunk, chunk + count);
+	}
+
+	std::fclose(file);
+	return data;
+}
+
+static uint32 alignUp(const uint32 value, const uint32 alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Index of the highest set bit. `x` must not be zero.
+static uint32 highestBit(const uint32 x)
+{
+	return 31 - __builtin_clz(x);
+}
+
+// Index of the lowest set bit. `x` must not be zero.
+static uint32 lowestBit(const uint32 x)
+{
+	return __builtin_ctz(x);
+}
+
+// ========================================================
+// Heap operations to replay:
+// ========================================================
+
+//
+// The trace is turned into a list of operations on numbered
+// slots up front, so the allocators are timed without the
+// address lookups of the trace itself.
+//
+struct HeapOp
+{
+	uint32 slot;
+	uint32 sizeBytes; // Zero for frees.
+	uint32 alignment;
+};
+
+class Allocator
+{
+public:
+	virtual ~Allocator() { }
+	virtual const char * name() const = 0;
+	virtual bool   allocate(uint32 sizeBytes, uint32 alignment, uint32 * offset) = 0;
+	virtual void   release(uint32 offset) = 0;
+	virtual uint32 highWaterMark() const = 0; // Bytes from the start of the arena.
+};
+
+// ========================================================
+// class TlsfAllocator:
+// ========================================================
+
+//
+// Two-Level Segregated Fit over a simulated arena: O(1) allocate and
+// release, immediate coalescing. Block headers live in the arena, like
+// they would on the console, so the footprint includes its overhead.
+//
+class TlsfAllocator : public Allocator
+{
+public:
+
+	explicit TlsfAllocator(const uint32 arenaBytes)
+		: arena(arenaBytes / 4, 0)
+		, flBitmap(0)
+		, highWater(0)
+	{
+		std::fill(&slBitmap[0], &slBitmap[FL_COUNT], 0u);
+		std::fill(&heads[0][0], &heads[FL_COUNT - 1][SL_COUNT - 1] + 1, NIL);
+
+		// One big free block followed by a used sentinel of size zero.
+		const uint32 sentinel = (arenaBytes & ~7u) - HEADER_SIZE;
+		prevOf(0) = NIL;
+		sizeOf(0) = (sentinel - HEADER_SIZE) | FREE_BIT;
+		prevOf(sentinel) = 0;
+		sizeOf(sentinel) = 0;
+		insertFree(0);
+	}
+
+	const char * name() const { return "TLSF"; }
+	uint32 highWaterMark() const { return highWater; }
+
+	bool allocate(const uint32 sizeBytes, const uint32 alignment, uint32 * offset)
+	{
+		const uint32 adjusted = std::max<uint32>(alignUp(sizeBytes, ALIGN_SIZE), MIN_PAYLOAD);
+		const uint32 needed   = (alignment <= ALIGN_SIZE) ? adjusted : adjusted + alignment + MIN_BLOCK;
+
+		uint32 fl, sl;
+		mappingSearch(needed, &fl, &sl);
+		uint32 block = findSuitable(&fl, &sl);
+		if (block == NIL)
+		{
+			return false;
+		}
+		removeFree(block, fl, sl);
+
+		// Split off a free block in front to align the payload:
+		if (alignment > ALIGN_SIZE)
+		{
+			const uint32 payload = block + HEADER_SIZE;
+			uint32 aligned = alignUp(payload, alignment);
+			if (aligned != payload && aligned - payload < MIN_BLOCK)
+			{
+				aligned = alignUp(payload + MIN_BLOCK, alignment);
+			}
+
+			const uint32 gap = aligned - payload;
+			if (gap != 0)
+			{
+				const uint32 next = block + gap;
+				sizeOf(next) = blockSize(block) - gap;
+				prevOf(next) = block;
+				prevOf(nextPhys(next)) = next;
+				sizeOf(block) = (gap - HEADER_SIZE) | FREE_BIT;
+				insertFree(block);
+				block = next;
+			}
+		}
+
+		// Give back what is left at the end:
+		if (blockSize(block) >= adjusted + MIN_BLOCK)
+		{
+			const uint32 rest = block + HEADER_SIZE + adjusted;
+			sizeOf(rest) = (blockSize(block) - adjusted - HEADER_SIZE) | FREE_BIT;
+			prevOf(rest) = block;
+			prevOf(nextPhys(rest)) = rest;
+			sizeOf(block) = adjusted;
+			insertFree(rest);
+		}
+
+		sizeOf(block) &= ~FREE_BIT;
+		highWater = std::max(highWater, nextPhys(block));
+		*offset = block + HEADER_SIZE;
+		return true;
+	}
+
+	void release(const uint32 offset)
+	{
+		uint32 block = offset - HEADER_SIZE;
+		sizeOf(block) |= FREE_BIT;
+
+		// Merge with the neighbors:
+		const uint32 prev = prevOf(block);
+		if (prev != NIL && isFree(prev))
+		{
+			removeFree(prev);
+			sizeOf(prev) += HEADER_SIZE + blockSize(block);
+			block = prev;
+		}
+
+		const uint32 next = nextPhys(block);
+		if (isFree(next))
+		{
+			removeFree(next);
+			sizeOf(block) += HEADER_SIZE + blockSize(next);
+		}
+
+		prevOf(nextPhys(block)) = block;
+		insertFree(block);
+	}
+
+	// Raw arena access for allocators built on top of this one.
+	uint32 & word(const uint32 offset) { return arena[offset / 4]; }
+
+private:
+
+	enum
+	{
+		ALIGN_SIZE   = 8,
+		SL_LOG2      = 5,
+		SL_COUNT     = 1 << SL_LOG2,
+		FL_SHIFT     = SL_LOG2 + 3,
+		FL_COUNT     = 32 - FL_SHIFT + 1,
+		SMALL_BLOCK  = 1 << FL_SHIFT,
+		HEADER_SIZE  = 8, // Previous physical block + size/flags.
+		MIN_PAYLOAD  = 8, // Room for the free list links.
+		MIN_BLOCK    = HEADER_SIZE + MIN_PAYLOAD,
+		FREE_BIT     = 1
+	};
+
+	uint32 & prevOf(const uint32 block)     { return arena[block / 4];     }
+	uint32 & sizeOf(const uint32 block)     { return arena[block / 4 + 1]; }
+	uint32 & nextFreeOf(const uint32 block) { return arena[block / 4 + 2]; }
+	uint32 & prevFreeOf(const uint32 block) { return arena[block / 4 + 3]; }
+
+	uint32 blockSize(const uint32 block) { return sizeOf(block) & ~7u; }
+	bool   isFree(const uint32 block)    { return (sizeOf(block) & FREE_BIT) != 0; }
+	uint32 nextPhys(const uint32 block)  { return block + HEADER_SIZE + blockSize(block); }
+
+	static void mappingInsert(const uint32 size, uint32 * fl, uint32 * sl)
+	{
+		if (size < SMALL_BLOCK)
+		{
+			*fl = 0;
+			*sl = size / (SMALL_BLOCK / SL_COUNT);
+		}
+		else
+		{
+			const uint32 high = highestBit(size);
+			*sl = (size >> (high - SL_LOG2)) ^ SL_COUNT;
+			*fl = high - (FL_SHIFT - 1);
+		}
+	}
+
+	// Rounds up to the next list, so any block found there is big enough.
+	static void mappingSearch(uint32 size, uint32 * fl, uint32 * sl)
+	{
+		if (size >= SMALL_BLOCK)
+		{
+			size += (1u << (highestBit(size) - SL_LOG2)) - 1;
+		}
+		mappingInsert(size, fl, sl);
+	}
+
+	uint32 findSuitable(uint32 * fl, uint32 * sl)
+	{
+		if (*fl >= FL_COUNT)
+		{
+			return NIL;
+		}
+
+		uint32 slMap = slBitmap[*fl] & (~0u << *sl);
+		if (slMap == 0)
+		{
+			const uint32 flMap = (*fl + 1 < 32) ? (flBitmap & (~0u << (*fl + 1))) : 0;
+			if (flMap == 0)
+			{
+				return NIL;
+			}
+			*fl   = lowestBit(flMap);
+			slMap = slBitmap[*fl];
+		}
+
+		*sl = lowestBit(slMap);
+		return heads[*fl][*sl];
+	}
+
+	void insertFree(const uint32 block)
+	{
+		uint32 fl, sl;
+		mappingInsert(blockSize(block), &fl, &sl);
+
+		const uint32 head = heads[fl][sl];
+		nextFreeOf(block) = head;
+		prevFreeOf(block) = NIL;
+		if (head != NIL)
+		{
+			prevFreeOf(head) = block;
+		}
+
+		heads[fl][sl] = block;
+		flBitmap     |= 1u << fl;
+		slBitmap[fl] |= 1u << sl;
+	}
+
+	void removeFree(const uint32 block)
+	{
+		uint32 fl, sl;
+		mappingInsert(blockSize(block), &fl, &sl);
+		removeFree(block, fl, sl);
+	}
+
+	void removeFree(const uint32 block, const uint32 fl, const uint32 sl)
+	{
+		const uint32 next = nextFreeOf(block);
+		const uint32 prev = prevFreeOf(block);
+		if (next != NIL)
+		{
+			prevFreeOf(next) = prev;
+		}
+		if (prev != NIL)
+		{
+			nextFreeOf(prev) = next;
+		}
+		else
+		{
+			heads[fl][sl] = next;
+			if (next == NIL)
+			{
+				slBitmap[fl] &= ~(1u << sl);
+				if (slBitmap[fl] == 0)
+				{
+					flBitmap &= ~(1u << fl);
+				}
+			}
+		}
+	}
+
+	std::vector<uint32> arena;
+	uint32 flBitmap;
+	uint32 slBitmap[FL_COUNT];
+	uint32 heads[FL_COUNT][SL_COUNT];
+	uint32 highWater;
+};
+
+// ========================================================
+// class PoolAllocator:
+// ========================================================
+
+//
+// Size-class pools for small blocks, carved from 16KB slabs that are
+// never returned. Bigger or over-aligned blocks go to a TLSF allocator,
+// which also provides the slabs. The class of a block is found from
+// the slab it is in, so blocks don't need a header.
+//
+class PoolAllocator : public Allocator
+{
+public:
+
+	explicit PoolAllocator(const uint32 arenaBytes)
+		: backing(arenaBytes)
+		, slabClass((arenaBytes / SLAB_SIZE) + 1, NO_CLASS)
+	{
+		std::fill(&freeLists[0], &freeLists[CLASS_COUNT], NIL);
+	}
+
+	const char * name() const { return "Size-class pools + TLSF"; }
+	uint32 highWaterMark() const { return backing.highWaterMark(); }
+
+	bool allocate(const uint32 sizeBytes, const uint32 alignment, uint32 * offset)
+	{
+		const uint32 sizeClass = classFor(sizeBytes, alignment);
+		if (sizeClass == NO_CLASS)
+		{
+			return backing.allocate(sizeBytes, alignment, offset);
+		}
+
+		if (freeLists[sizeClass] == NIL && !addSlab(sizeClass))
+		{
+			return false;
+		}
+
+		*offset = freeLists[sizeClass];
+		freeLists[sizeClass] = backing.word(*offset);
+		return true;
+	}
+
+	void release(const uint32 offset)
+	{
+		const uint32 sizeClass = slabClass[offset / SLAB_SIZE];
+		if (sizeClass == NO_CLASS)
+		{
+			backing.release(offset);
+			return;
+		}
+
+		backing.word(offset) = freeLists[sizeClass];
+		freeLists[sizeClass] = offset;
+	}
+
+private:
+
+	enum
+	{
+		SLAB_SIZE   = 16 * 1024,
+		CLASS_COUNT = 14,
+		NO_CLASS    = 0xFF
+	};
+
+	static uint32 classFor(const uint32 sizeBytes, const uint32 alignment)
+	{
+		if (alignment > 16)
+		{
+			return NO_CLASS;
+		}
+		for (uint32 c = 0; c < CLASS_COUNT; ++c)
+		{
+			if (sizeBytes <= classSizes[c])
+			{
+				return c;
+			}
+		}
+		return NO_CLASS;
+	}
+
+	bool addSlab(const uint32 sizeClass)
+	{
+		uint32 slab;
+		if (!backing.allocate(SLAB_SIZE, SLAB_SIZE, &slab))
+		{
+			return false;
+		}
+
+		slabClass[slab / SLAB_SIZE] = static_cast<ubyte>(sizeClass);
+
+		const uint32 blockSize = classSizes[sizeClass];
+		const uint32 count = SLAB_SIZE / blockSize;
+		for (uint32 i = count; i-- > 0;)
+		{
+			const uint32 block = slab + (i * blockSize);
+			backing.word(block) = freeLists[sizeClass];
+			freeLists[sizeClass] = block;
+		}
+		return true;
+	}
+
+	static const uint32 classSizes[CLASS_COUNT];
+
+	TlsfAllocator      backing;
+	std::vector<ubyte> slabClass;
+	uint32             freeLists[CLASS_COUNT];
+};
+
+const uint32 PoolAllocator::classSizes[CLASS_COUNT] =
+{
+	16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048
+};
+
+// ========================================================
+// replay():
+// ========================================================
+
+static void replay(Allocator & allocator, const std::vector<HeapOp> & ops,
+                   const uint32 slotCount, const uint32 peakLiveBytes)
+{
+	std::vector<uint32> slots(slotCount, NIL);
+	uint32 failed = 0;
+
+	const std::clock_t start = std::clock();
+	for (size_t i = 0; i < ops.size(); ++i)
+	{
+		const HeapOp & op = ops[i];
+		if (op.sizeBytes != 0)
+		{
+			if (!allocator.allocate(op.sizeBytes, op.alignment, &slots[op.slot]))
+			{
+				slots[op.slot] = NIL;
+				++failed;
+			}
+		}
+		else if (slots[op.slot] != NIL)
+		{
+			allocator.release(slots[op.slot]);
+		}
+	}
+	const std::clock_t end = std::clock();
+
+	const double nsPerOp = ops.empty() ? 0.0 :
+		(static_cast<double>(end - start) * 1e9 / CLOCKS_PER_SEC) / ops.size();
+
+	std::printf("%-24s | %10.2f KB | %7.2fx | %6u | %8.1f\n", allocator.name(),
+	            allocator.highWaterMark() / 1024.0,
+	            (peakLiveBytes != 0) ? static_cast<double>(allocator.highWaterMark()) / peakLiveBytes : 0.0,
+	            failed, nsPerOp);
+}
+
+// ========================================================
+// class HeapOccupancy:
+// ========================================================
+
+// Live blocks of the recorded heap, by address.
+class HeapOccupancy
+{
+public:
+
+	HeapOccupancy() : liveBytes(0), peakLiveBytes(0), lowAddr(NIL), highAddr(0) { }
+
+	void add(const uint32 address, const uint32 sizeBytes)
+	{
+		blocks[address] = sizeBytes;
+		liveBytes += sizeBytes;
+		peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+		lowAddr  = std::min(lowAddr, address);
+		highAddr = std::max(highAddr, address + sizeBytes);
+	}
+
+	// Returns the size of the block, zero if unknown.
+	uint32 remove(const uint32 address)
+	{
+		std::map<uint32, uint32>::iterator it = blocks.find(address);
+		if (it == blocks.end())
+		{
+			return 0;
+		}
+		const uint32 sizeBytes = it->second;
+		liveBytes -= sizeBytes;
+		blocks.erase(it);
+		return sizeBytes;
+	}
+
+	// Largest gap between live blocks inside the extent seen so far.
+	uint32 largestFreeBlock() const
+	{
+		uint32 largest = 0;
+		uint32 cursor  = lowAddr;
+		for (std::map<uint32, uint32>::const_iterator it = blocks.begin(); it != blocks.end(); ++it)
+		{
+			if (it->first > cursor)
+			{
+				largest = std::max(largest, it->first - cursor);
+			}
+			cursor = std::max(cursor, it->first + it->second);
+		}
+		if (highAddr > cursor)
+		{
+			largest = std::max(largest, highAddr - cursor);
+		}
+		return largest;
+	}
+
+	uint32 extent() const { return (highAddr > lowAddr) ? highAddr - lowAddr : 0; }
+
+	std::map<uint32, uint32> blocks;
+	uint32 liveBytes;
+	uint32 peakLiveBytes;
+	uint32 lowAddr;
+	uint32 highAddr;
+};
+
+// ========================================================
+// main():
+// ========================================================
+
+struct CallSiteStats
+{
+	uint32 allocs;
+	uint32 bytes;
+};
+
+static bool sortCallSites(const std::pair<uint32, CallSiteStats> & a, const std::pair<uint32, CallSiteStats> & b)
+{
+	return a.second.allocs > b.second.allocs;
+}
+
+int main(int argc, const char * argv[])
+{
+	if (argc < 2 || argc > 4)
+	{
+		std::fprintf(stderr, "Usage: %s <trace.pmem> [heap.csv] [heap size in MB]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	const std::vector<ubyte> trace = readFile(argv[1]);
+	MemTraceHeader header;
+	if (trace.size() < sizeof(header))
+	{
+		std::fprintf(stderr, "\"%s\" is too short!\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	std::memcpy(&header, &trace[0], sizeof(header));
+	if (std::memcmp(header.magic, "PMEM", 4) != 0 || header.version != 1 ||
+	    header.recordSize != sizeof(MemTraceRecord))
+	{
+		std::fprintf(stderr, "\"%s\" is not a version 1 memory trace!\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	FILE * csv = NULL;
+	if (argc >= 3)
+	{
+		csv = std::fopen(argv[2], "wt");
+		if (csv == NULL)
+		{
+			std::fprintf(stderr, "Can't open \"%s\" for writing!\n", argv[2]);
+			return EXIT_FAILURE;
+		}
+		std::fprintf(csv, "seconds,live,extent,free,largest_free,fragmentation\n");
+	}
+
+	const uint32 heapMB = (argc >= 4) ? static_cast<uint32>(std::atoi(argv[3])) : 32;
+	const size_t recordCount = (trace.size() - sizeof(header)) / sizeof(MemTraceRecord);
+	const uint32 sampleEvery = std::max<uint32>(1, static_cast<uint32>(recordCount / 2000));
+
+	HeapOccupancy heap;
+	std::vector<HeapOp> ops;
+	std::map<uint32, uint32> addrToSlot;
+	std::map<uint32, CallSiteStats> callSites;
+	uint32 slotCount = 0;
+
+	uint32 tagAllocs[TAG_COUNT]    = { 0 };
+	uint32 tagLive[TAG_COUNT]      = { 0 };
+	uint32 tagPeak[TAG_COUNT]      = { 0 };
+	std::map<uint32, ubyte> addrToTag;
+
+	uint32 mallocs = 0, frees = 0, reallocs = 0, unknownFrees = 0;
+	double seconds = 0.0;
+	uint32 prevTimestamp = 0;
+
+	for (size_t r = 0; r < recordCount; ++r)
+	{
+		MemTraceRecord rec;
+		std::memcpy(&rec, &trace[sizeof(header) + r * sizeof(rec)], sizeof(rec));
+
+		// The cycle counter wraps around, but consecutive records are close.
+		if (r != 0)
+		{
+			seconds += static_cast<double>(rec.timestamp - prevTimestamp) / header.cpuClockHz;
+		}
+		prevTimestamp = rec.timestamp;
+
+		const uint32 tag = (rec.tag < TAG_COUNT) ? rec.tag : 0;
+		const bool freesOld = (rec.op == MEM_OP_FREE) || (rec.op == MEM_OP_REALLOC && rec.oldAddress != 0);
+		const bool allocs   = (rec.op == MEM_OP_MALLOC) || (rec.op == MEM_OP_REALLOC);
+
+		if (freesOld)
+		{
+			const uint32 address = (rec.op == MEM_OP_FREE) ? rec.address : rec.oldAddress;
+			const uint32 sizeBytes = heap.remove(address);
+
+			std::map<uint32, uint32>::iterator slot = addrToSlot.find(address);
+			if (slot != addrToSlot.end())
+			{
+				HeapOp op = { slot->second, 0, 0 };
+				ops.push_back(op);
+				addrToSlot.erase(slot);
+
+				const ubyte oldTag = addrToTag[address];
+				tagLive[oldTag] -= sizeBytes;
+			}
+			else
+			{
+				++unknownFrees; // Allocated before the trace started.
+			}
+			if (rec.op == MEM_OP_FREE)
+			{
+				++frees;
+			}
+		}
+
+		if (allocs)
+		{
+			HeapOp op = { slotCount, rec.sizeBytes, std::max<uint32>(rec.alignment, 8) };
+			ops.push_back(op);
+			addrToSlot[rec.address] = slotCount++;
+			addrToTag[rec.address]  = static_cast<ubyte>(tag);
+			heap.add(rec.address, rec.sizeBytes);
+
+			tagAllocs[tag]++;
+			tagLive[tag] += rec.sizeBytes;
+			tagPeak[tag] = std::max(tagPeak[tag], tagLive[tag]);
+
+			CallSiteStats & site = callSites[rec.callerPc];
+			site.allocs++;
+			site.bytes += rec.sizeBytes;
+
+			if (rec.op == MEM_OP_MALLOC) { ++mallocs; } else { ++reallocs; }
+		}
+
+		if (csv != NULL && (r % sampleEvery) == 0)
+		{
+			const uint32 freeBytes = heap.extent() - std::min(heap.extent(), heap.liveBytes);
+			const uint32 largest   = heap.largestFreeBlock();
+			std::fprintf(csv, "%f,%u,%u,%u,%u,%f\n", seconds, heap.liveBytes, heap.extent(), freeBytes, largest,
+			             (freeBytes != 0) ? 1.0 - static_cast<double>(largest) / freeBytes : 0.0);
+		}
+	}
+
+	if (csv != NULL)
+	{
+		std::fclose(csv);
+	}
+
+	// Summary of the recorded heap:
+	std::printf("%u records over %.2f seconds: %u mallocs, %u reallocs, %u frees (%u of blocks allocated before the trace)\n",
+	            static_cast<uint32>(recordCount), seconds, mallocs, reallocs, frees, unknownFrees);
+	std::printf("Peak live %.2f KB, heap extent %.2f KB, largest free block at the end %.2f KB\n\n",
+	            heap.peakLiveBytes / 1024.0, heap.extent() / 1024.0, heap.largestFreeBlock() / 1024.0);
+
+	std::printf("| tag name | allocs  | peak live\n");
+	for (uint32 t = 0; t < TAG_COUNT; ++t)
+	{
+		std::printf("| %-8s | %-7u | %.2f KB\n", tagNames[t], tagAllocs[t], tagPeak[t] / 1024.0);
+	}
+
+	std::vector<std::pair<uint32, CallSiteStats> > sites(callSites.begin(), callSites.end());
+	std::sort(sites.begin(), sites.end(), sortCallSites);
+	std::printf("\nBusiest call sites:\n");
+	for (size_t i = 0; i < sites.size() && i < 10; ++i)
+	{
+		std::printf("  0x%08X: %u allocs, %.2f KB total\n", sites[i].first,
+		            sites[i].second.allocs, sites[i].second.bytes / 1024.0);
+	}
+
+	// The same allocations replayed against other allocators:
+	std::printf("\n%-24s | %13s | %8s | %6s | %8s\n", "allocator", "footprint", "vs live", "failed", "ns/op");
+	std::printf("%-24s | %10.2f KB | %7.2fx | %6s | %8s\n", "Recorded C heap", heap.extent() / 1024.0,
+	            (heap.peakLiveBytes != 0) ? static_cast<double>(heap.extent()) / heap.peakLiveBytes : 0.0, "-", "-");
+
+	TlsfAllocator tlsf(heapMB * 1024 * 1024);
+	replay(tlsf, ops, slotCount, heap.peakLiveBytes);
+
+	PoolAllocator pools(heapMB * 1024 * 1024);
+	replay(pools, ops, slotCount, heap.peakLiveBytes);
+
+	return EXIT_SUCCESS;
+}
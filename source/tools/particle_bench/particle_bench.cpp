@@ -0,0 +1,558 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: particle_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host benchmark of the particle update and sort, the real emitters versus the old AoS particles.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+
+//
+// Builds `framework/particle_emitter.cpp` for the host, with the ps2_math
+// backend of the machine and the Scratch Pad emulation of `scratchpad.cpp`,
+// and times a frame of the particle system over 1k, 8k and 64k particles,
+// in emitters of 256 particles:
+//
+//  - update: `ParticleManager::updateEmitters()`; LOD, budget split, then
+//    kill, integrate, spawn and submit of every emitter (SoA streams).
+//  - sort:   `ParticleManager::drawAllParticles()`; sort keys and radix sort
+//    of the frame. The renderer is a stand-in that only checks the sprites.
+//  - AoS:    the same emitters with the `Particle` struct array and `Vector`
+//    math from before the SoA streams, with the order preserving compaction.
+//
+// The old emitter is cut down to its `updateParticles()`. Also checks that
+// every particle submitted is drawn, back-to-front, and inside the bounds of
+// its emitter. Runs on the development machine, not the PS2:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework particle_bench.cpp -o particle_bench
+//   ./particle_bench [frames per size, default 200]
+//
+// Builds with the SSE2 backend on x86-64. Add -DPS2MATH_BACKEND=0 to
+// time the plain C++ loops instead. Exits with a non-zero status if any
+// check fails.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp`, `renderer.hpp` and `game_time.hpp` need the PS2SDK
+// headers, so define the few things the particle code uses and skip them.
+#define COMMON_HPP
+#define RENDERER_HPP
+#define GAME_TIME_HPP
+
+#define nullptr NULL
+#define restrict __restrict
+#define rcast reinterpret_cast
+#define scast static_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+
+typedef unsigned char  ubyte;
+typedef unsigned char  uint8;
+typedef unsigned short uint16;
+typedef unsigned int   uint;
+typedef unsigned int   uint32;
+typedef int            int32;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+
+#define logComment(...) /* nothing */
+#define logWarning(...) do { std::printf("  warning: "); std::printf(__VA_ARGS__); std::printf("\n"); } while (0)
+#define logError(...)   do { std::printf("  error: ");   std::printf(__VA_ARGS__); std::printf("\n"); } while (0)
+
+struct Color4f
+{
+	float r, g, b, a;
+};
+
+inline Color4f makeColor4f(const float r, const float g, const float b, const float a = 1.0f)
+{
+	const Color4f c = { r, g, b, a };
+	return c;
+}
+
+template<class T>
+inline void swap(T & a, T & b)
+{
+	const T tmp = a;
+	a = b;
+	b = tmp;
+}
+
+template<class T>
+inline T clamp(const T x, const T minimum, const T maximum)
+{
+	return (x < minimum) ? minimum : (x > maximum) ? maximum : x;
+}
+
+template<class T>
+inline T lerp(const T a, const T b, const T t)
+{
+	return a + t * (b - a);
+}
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+inline uint randomInt()
+{
+	randState = randState * 1664525 + 1013904223;
+	return randState;
+}
+
+inline int randomInt(const int lowerBound, const int upperBound)
+{
+	if (lowerBound == upperBound)
+	{
+		return lowerBound;
+	}
+	return (randomInt() % (upperBound - lowerBound)) + lowerBound;
+}
+
+inline float randomFloat(const float lowerBound, const float upperBound)
+{
+	return ((randomInt() >> 8) * (1.0f / 16777216.0f)) * (upperBound - lowerBound) + lowerBound;
+}
+
+// Same interface as `framework/memory.hpp`, over the C heap.
+enum MemAllocTag { MEM_TAG_GENERIC, MEM_TAG_PARTICLES };
+const size_t DEFAULT_MEM_ALIGNMENT = 16;
+
+template<class T>
+inline T * memClearedAlloc(MemAllocTag, const size_t elementCount, const size_t alignment = DEFAULT_MEM_ALIGNMENT)
+{
+	void * ptr = nullptr;
+	if (posix_memalign(&ptr, alignment, elementCount * sizeof(T)) != 0)
+	{
+		std::fprintf(stderr, "Out of memory!\n");
+		std::exit(EXIT_FAILURE);
+	}
+	std::memset(ptr, 0, elementCount * sizeof(T));
+	return scast<T *>(ptr);
+}
+
+template<class T>
+inline T * memRealloc(MemAllocTag, T * oldPtr, const size_t newElementCount)
+{
+	return scast<T *>(std::realloc(oldPtr, newElementCount * sizeof(T)));
+}
+
+inline void memFree(MemAllocTag, void * ptr)
+{
+	std::free(ptr);
+}
+
+// Only what `sprOrFrameAlloc()` and the particle sort call. Holds the
+// sort keys and draw order of 64k particles, which don't fit in the SPR.
+class FrameAllocator
+{
+public:
+
+	FrameAllocator() : used(0) { }
+
+	void * allocBytes(const size_t sizeBytes, const size_t alignment)
+	{
+		const size_t start = (used + alignment - 1) & ~(alignment - 1);
+		if (start + sizeBytes > sizeof(buffer))
+		{
+			return nullptr;
+		}
+		used = start + sizeBytes;
+		return buffer + start;
+	}
+
+	template<class T>
+	T * alloc(const size_t elementCount, const size_t alignment)
+	{
+		return reinterpret_cast<T *>(allocBytes(elementCount * sizeof(T), alignment));
+	}
+
+	size_t getMark() const { return used; }
+	void rewind(const size_t mark) { if (mark < used) { used = mark; } }
+
+	size_t used;
+	ubyte  buffer[1024 * 1024] ATTRIBUTE_ALIGNED(16);
+};
+
+static FrameAllocator gFrameAllocator;
+
+// ========================================================
+// Stand-ins for `framework/renderer.hpp` and `game_time.hpp`:
+// ========================================================
+
+#include "ps2_math/vector.hpp"
+#include "ps2_math/aabb.hpp"
+
+class Texture { };
+
+// Instead of drawing, counts the sprites and, when `checkSprites` is
+// set, checks that each draw call goes back-to-front from `eyePos`.
+class Renderer
+{
+public:
+
+	Renderer() : spritesDrawn(0), spritesOutOfOrder(0), checkSprites(false) { }
+
+	void setPrimAdditiveBlending(bool) { }
+	void setTexture(const Texture &) { }
+
+	void drawSpritesFacingCamera(const float * posX, const float * posY, const float * posZ,
+	                             const float *, const uint32 *, const uint16 * drawOrder,
+	                             const uint count, const Color4f &)
+	{
+		spritesDrawn += count;
+		if (!checkSprites)
+		{
+			return;
+		}
+
+		float prevDistSqr = HUGE_VALF;
+		for (uint i = 0; i < count; ++i)
+		{
+			const uint  p  = drawOrder[i];
+			const float dx = posX[p] - eyePos.x;
+			const float dy = posY[p] - eyePos.y;
+			const float dz = posZ[p] - eyePos.z;
+			const float distSqr = (dx * dx) + (dy * dy) + (dz * dz);
+
+			// The sort keys drop the low bits of the distance.
+			if (distSqr > prevDistSqr * 1.001f)
+			{
+				++spritesOutOfOrder;
+			}
+			prevDistSqr = distSqr;
+		}
+	}
+
+	uint   spritesDrawn;
+	uint   spritesOutOfOrder;
+	bool   checkSprites;
+	Vector eyePos;
+};
+
+static Renderer gRenderer;
+
+struct GameTime
+{
+	uint currentTimeMillis;
+};
+
+static GameTime gTime;
+
+#include "scratchpad.cpp"
+#include "radix_sort.cpp"
+#include "ps2_math/math_funcs.cpp"
+#include "particle_emitter.cpp"
+
+// ========================================================
+// The old AoS emitter:
+// ========================================================
+
+// Before the SoA streams: one struct per particle, dead ones removed
+// by shifting the live ones down. Only the update is kept, with the
+// parameters the benchmark sets on the real emitters.
+class OldEmitter
+{
+public:
+
+	struct Particle
+	{
+		Vector position;
+		Vector velocity;
+		float  size;
+		uint   durationMs;
+	};
+
+	OldEmitter() : particles(nullptr), activeParticleCount(0), maxParticles(0), lastUpdateMs(0) { }
+	~OldEmitter() { memFree(MEM_TAG_PARTICLES, particles); }
+
+	void init(const uint max, const Vector & origin, const Vector & velocity,
+	          const Vector & gravity, const Vector & wind, const uint lifeCycleMs)
+	{
+		particles           = memClearedAlloc<Particle>(MEM_TAG_PARTICLES, max);
+		maxParticles        = max;
+		emitterOrigin       = origin;
+		particleVelocityVec = velocity;
+		gravityVec          = gravity;
+		windVelocityVec     = wind;
+		particleLifeCycleMs = lifeCycleMs;
+	}
+
+	void updateParticles(const uint currentTimeMs, const float deltaTimeSec)
+	{
+		uint num = 0;
+		for (uint i = 0; i < activeParticleCount; ++i)
+		{
+			if (particles[i].durationMs > currentTimeMs)
+			{
+				if (num != i)
+				{
+					particles[num] = particles[i];
+				}
+				++num;
+			}
+		}
+		activeParticleCount = num;
+
+		for (uint i = 0; i < activeParticleCount; ++i)
+		{
+			Particle & particle = particles[i];
+			particle.velocity += gravityVec * deltaTimeSec;
+			particle.velocity += (windVelocityVec - particle.velocity) * deltaTimeSec;
+			particle.position += particle.velocity * deltaTimeSec;
+		}
+
+		// Min and max particles are the same, so it refills every frame.
+		lastUpdateMs = currentTimeMs;
+		while (activeParticleCount < maxParticles)
+		{
+			Particle & particle  = particles[activeParticleCount++];
+			particle.position    = emitterOrigin;
+			particle.velocity    = particleVelocityVec;
+			particle.size        = randomFloat(0.5f, 1.0f);
+			particle.durationMs  = currentTimeMs + particleLifeCycleMs + randomInt(0, 500);
+			particle.velocity   += getRandVector();
+		}
+	}
+
+	uint getActiveCount() const { return activeParticleCount; }
+
+private:
+
+	static Vector getRandVector()
+	{
+		const float z = randomFloat(-1.0f, 1.0f);
+		const float r = ps2math::sqrt(1.0f - (z * z));
+		const float t = randomFloat(-PS2MATH_PI, PS2MATH_PI);
+		return Vector(ps2math::cos(t) * r, ps2math::sin(t) * r, z, 1.0f);
+	}
+
+	Particle * particles;
+	uint   activeParticleCount;
+	uint   maxParticles;
+	uint   lastUpdateMs;
+	uint   particleLifeCycleMs;
+	Vector emitterOrigin;
+	Vector particleVelocityVec;
+	Vector gravityVec;
+	Vector windVelocityVec;
+};
+
+// ========================================================
+// Benchmark:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+static const uint PARTICLES_PER_EMITTER = 256;
+static const uint FRAME_TIME_MS         = 33;
+static const uint WARM_UP_FRAMES        = 60;
+static const uint SPRITE_TEXTURES       = 4;
+
+// clock() is too coarse to time a single frame of the small sizes.
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Emitters on a grid around the eye, all inside the near LOD
+// distance, so every emitter runs at full rate like the old ones.
+static Vector emitterOrigin(const uint index)
+{
+	return Vector((index % 16) * 0.5f - 4.0f, 0.0f, (index / 16) * 0.5f - 4.0f, 1.0f);
+}
+
+static bool insideBounds(const Aabb & bounds, const float x, const float y, const float z)
+{
+	return x >= bounds.mins.x && x <= bounds.maxs.x &&
+	       y >= bounds.mins.y && y <= bounds.maxs.y &&
+	       z >= bounds.mins.z && z <= bounds.maxs.z;
+}
+
+static void benchmark(const uint emitterCount, const uint frames)
+{
+	const Vector velocity(0.0f,  2.0f, 0.0f, 0.0f);
+	const Vector gravity (0.0f, -9.8f, 0.0f, 0.0f);
+	const Vector wind    (0.0f,  2.0f, 0.0f, 0.0f);
+	const Vector eyePos  (0.0f,  1.0f, 0.0f, 1.0f);
+	const uint   lifeCycleMs    = 1000;
+	const uint   totalParticles = emitterCount * PARTICLES_PER_EMITTER;
+
+	static Texture textures[SPRITE_TEXTURES];
+
+	gParticleManager.reservePool(totalParticles);
+	gParticleManager.setParticleBudget(totalParticles);
+
+	ParticleEmitter * emitters = new ParticleEmitter[emitterCount];
+	OldEmitter * oldEmitters   = new OldEmitter[emitterCount];
+	for (uint e = 0; e < emitterCount; ++e)
+	{
+		ParticleEmitter & emitter = emitters[e];
+		emitter.setMinMaxParticles(PARTICLES_PER_EMITTER, PARTICLES_PER_EMITTER);
+		emitter.setParticleReleaseAmount(PARTICLES_PER_EMITTER);
+		emitter.setParticleLifeCycle(lifeCycleMs);
+		emitter.setParticleVelocity(velocity);
+		emitter.setEmitterGravity(gravity);
+		emitter.setWindVelocity(wind);
+		emitter.setAirResistance(true);
+		emitter.setEmitterOrigin(emitterOrigin(e));
+		emitter.setParticleSpriteTexture(&textures[e % SPRITE_TEXTURES]);
+
+		oldEmitters[e].init(PARTICLES_PER_EMITTER, emitterOrigin(e), velocity, gravity, wind, lifeCycleMs);
+	}
+
+	// Same random sequence for both, time only after the warm up.
+	const uint32 seed = randState;
+	double updateSeconds = 0.0, sortSeconds = 0.0, oldSeconds = 0.0;
+	gTime.currentTimeMillis = 0;
+
+	for (uint frame = 0; frame < WARM_UP_FRAMES + frames; ++frame)
+	{
+		gTime.currentTimeMillis += FRAME_TIME_MS;
+		for (uint e = 0; e < emitterCount; ++e)
+		{
+			gParticleManager.queueEmitter(&emitters[e]);
+		}
+
+		const bool lastFrame = (frame == WARM_UP_FRAMES + frames - 1);
+		gRenderer.spritesDrawn = 0;
+		gRenderer.checkSprites = lastFrame;
+		gRenderer.eyePos       = eyePos;
+
+		const double start = nowSeconds();
+		gParticleManager.updateEmitters(eyePos);
+		const double updated = nowSeconds();
+
+		if (lastFrame)
+		{
+			// Check before the draw, while the bounds are those of the particles
+			// drawn. Ranges are allocated in update order, not in emitter order,
+			// so each particle only has to be inside the bounds of some emitter.
+			ParticleArrays pool;
+			gParticleManager.getRangeArrays(0, pool);
+			uint outside = 0;
+			for (uint p = 0; p < totalParticles; ++p)
+			{
+				uint e = 0;
+				while (e < emitterCount && !insideBounds(emitters[e].getBounds(), pool.posX[p], pool.posY[p], pool.posZ[p]))
+				{
+					++e;
+				}
+				outside += (e == emitterCount);
+			}
+			CHECK(outside == 0);
+		}
+
+		const double sortStart = nowSeconds();
+		gParticleManager.drawAllParticles(eyePos);
+		const double sorted = nowSeconds();
+
+		if (frame >= WARM_UP_FRAMES)
+		{
+			updateSeconds += updated - start;
+			sortSeconds   += sorted - sortStart;
+		}
+		CHECK(gRenderer.spritesDrawn == totalParticles);
+	}
+
+	CHECK(gParticleManager.getParticlesGranted() == totalParticles);
+	CHECK(gRenderer.spritesOutOfOrder == 0);
+
+	randState = seed;
+	uint oldAlive = 0;
+	for (uint frame = 0; frame < WARM_UP_FRAMES + frames; ++frame)
+	{
+		const uint timeMs = (frame + 1) * FRAME_TIME_MS;
+		const double start = nowSeconds();
+		for (uint e = 0; e < emitterCount; ++e)
+		{
+			oldEmitters[e].updateParticles(timeMs, FRAME_TIME_MS * 0.001f);
+		}
+		if (frame >= WARM_UP_FRAMES)
+		{
+			oldSeconds += nowSeconds() - start;
+		}
+	}
+	for (uint e = 0; e < emitterCount; ++e)
+	{
+		oldAlive += oldEmitters[e].getActiveCount();
+	}
+	CHECK(oldAlive == totalParticles);
+
+	const double updateNs = updateSeconds * 1e9 / (scast<double>(frames) * totalParticles);
+	const double oldNs    = oldSeconds    * 1e9 / (scast<double>(frames) * totalParticles);
+	std::printf("%9u | %8u | %10.3f | %10.3f | %10.3f | %7.2fx | %10.3f\n", totalParticles, emitterCount,
+	            oldSeconds * 1e3 / frames, updateSeconds * 1e3 / frames, updateNs, oldNs / updateNs,
+	            sortSeconds * 1e3 / frames);
+
+	delete[] oldEmitters;
+	delete[] emitters;
+}
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	const int frames = (argc > 1) ? std::atoi(argv[1]) : 200;
+	if (frames <= 0)
+	{
+		std::fprintf(stderr, "Usage: %s [frames per size, default 200]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("Backend: %s, %d frames, %u particles per emitter, refilled every frame\n\n",
+	            PS2MATH_USE_SSE2 ? "SSE2" : "scalar", frames, PARTICLES_PER_EMITTER);
+	std::printf("%9s | %8s | %10s | %10s | %10s | %8s | %10s\n",
+	            "particles", "emitters", "AoS ms", "update ms", "ns/prt", "speedup", "sort ms");
+
+	static const uint emitterCounts[] = { 4, 32, 256 };
+	for (int i = 0; i < 3; ++i)
+	{
+		benchmark(emitterCounts[i], scast<uint>(frames));
+	}
+
+	if (assertsFailed != 0 || checksFailed != 0)
+	{
+		std::printf("\n%d checks and %d asserts FAILED!\n", checksFailed, assertsFailed);
+		return EXIT_FAILURE;
+	}
+	std::printf("\nAll checks passed.\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,334 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: ps2math_tester.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Accuracy test and micro-benchmark of the ps2_math Vector/Matrix backends.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Runs the same checks on whichever backend `ps2_math/math_funcs.hpp` selects:
+// Matrix * Matrix, Matrix * Vector (the transform of `applyXForm()` in
+// `vertex_xform.h`), crossProduct, normalize and lerpScale are compared with
+// a double precision reference over random inputs, then timed. Errors are
+// in units of FLT_EPSILON, relative to the magnitude of the terms summed,
+// so cancellation doesn't inflate them. Exits with a non-zero status if any
+// error is above the tolerance.
+//
+// On the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework ps2math_tester.cpp -o ps2math_tester
+//   ./ps2math_tester [input count, default 4096]
+//
+// Builds with the SSE2 backend on x86-64. Add -DPS2MATH_BACKEND=0 for
+// the plain C++ backend. Only needs the C library and the ps2_math headers,
+// so it can also be built with `ee-g++ -D_EE` and run on the PS2 to check
+// the VU0 backend, printing to the ps2link console.
+//
+
+#include "ps2_math/vector.hpp"
+#include "ps2_math/matrix.hpp"
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef unsigned int uint32;
+
+// Worst acceptable error, in FLT_EPSILONs. The EE FPU and VU0 truncate
+// instead of rounding to nearest, which doubles the error of each op,
+// and a 4 term dot product takes 7 of them.
+static const double TOLERANCE_EPS = 16.0;
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static float randFloat(const float lo, const float hi)
+{
+	randState = randState * 1664525 + 1013904223;
+	return lo + (hi - lo) * ((randState >> 8) * (1.0f / 16777216.0f));
+}
+
+static Vector randVector(const float lo, const float hi)
+{
+	Vector v;
+	v.x = randFloat(lo, hi);
+	v.y = randFloat(lo, hi);
+	v.z = randFloat(lo, hi);
+	v.w = randFloat(lo, hi);
+	return v;
+}
+
+static double secondsSince(const clock_t start)
+{
+	return static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+}
+
+// `new` doesn't guarantee the 16 bytes alignment of the Vector/Matrix types
+// with every C library, and lqc2/movaps fault on misaligned addresses.
+template<class T>
+static T * alignedArray(const uint32 count, void ** rawPtr)
+{
+	*rawPtr = malloc((count * sizeof(T)) + 15);
+	if (*rawPtr == NULL)
+	{
+		fprintf(stderr, "Out of memory!\n");
+		exit(EXIT_FAILURE);
+	}
+	return reinterpret_cast<T *>((reinterpret_cast<size_t>(*rawPtr) + 15) & ~static_cast<size_t>(15));
+}
+
+static double absd(const double x)
+{
+	return (x < 0.0) ? -x : x;
+}
+
+// ========================================================
+// Error tracking:
+// ========================================================
+
+struct ErrorStats
+{
+	const char * name;
+	double maxErrorEps;
+	uint32 worstIndex;
+	uint32 failures;
+
+	explicit ErrorStats(const char * n)
+		: name(n), maxErrorEps(0.0), worstIndex(0), failures(0)
+	{ }
+
+	// `scale` is the magnitude the error is relative to.
+	void add(const uint32 index, const float approx, const double exact, const double scale)
+	{
+		const double errEps = absd(approx - exact) / ((scale > DBL_MIN) ? scale : 1.0) / FLT_EPSILON;
+		if (errEps > maxErrorEps)
+		{
+			maxErrorEps = errEps;
+			worstIndex  = index;
+		}
+		if (!(errEps <= TOLERANCE_EPS)) // Also catches NaNs.
+		{
+			++failures;
+		}
+	}
+
+	bool report() const
+	{
+		printf("%-16s max error %7.3f eps (input %u)%s\n", name, maxErrorEps, worstIndex,
+		       (failures != 0) ? "  ** FAILED" : "");
+		return failures == 0;
+	}
+};
+
+// ========================================================
+// Accuracy:
+// ========================================================
+
+static bool testMatrixMultiply(const Matrix * a, const Matrix * b, const uint32 count)
+{
+	ErrorStats stats("Matrix * Matrix");
+	for (uint32 n = 0; n < count; ++n)
+	{
+		const Matrix r = a[n] * b[n];
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				double exact = 0.0, scale = 0.0;
+				for (int k = 0; k < 4; ++k)
+				{
+					exact += static_cast<double>(a[n](i,k)) * b[n](k,j);
+					scale += absd(static_cast<double>(a[n](i,k)) * b[n](k,j));
+				}
+				stats.add(n, r(i,j), exact, scale);
+			}
+		}
+	}
+	return stats.report();
+}
+
+static bool testTransform(const Matrix * m, const Vector * v, const uint32 count)
+{
+	ErrorStats stats("Matrix * Vector");
+	for (uint32 n = 0; n < count; ++n)
+	{
+		const Vector r = m[n] * v[n];
+		const float * rp = &r.x;
+		const float * vp = &v[n].x;
+		for (int j = 0; j < 4; ++j)
+		{
+			double exact = 0.0, scale = 0.0;
+			for (int k = 0; k < 4; ++k)
+			{
+				exact += static_cast<double>(m[n](k,j)) * vp[k];
+				scale += absd(static_cast<double>(m[n](k,j)) * vp[k]);
+			}
+			stats.add(n, rp[j], exact, scale);
+		}
+	}
+	return stats.report();
+}
+
+static bool testCrossProduct(const Vector * a, const Vector * b, const uint32 count)
+{
+	ErrorStats stats("crossProduct");
+	for (uint32 n = 0; n < count; ++n)
+	{
+		const Vector r = crossProduct(a[n], b[n]);
+		const double ax = a[n].x, ay = a[n].y, az = a[n].z;
+		const double bx = b[n].x, by = b[n].y, bz = b[n].z;
+		stats.add(n, r.x, ay * bz - az * by, absd(ay * bz) + absd(az * by));
+		stats.add(n, r.y, az * bx - ax * bz, absd(az * bx) + absd(ax * bz));
+		stats.add(n, r.z, ax * by - ay * bx, absd(ax * by) + absd(ay * bx));
+		stats.add(n, r.w, 1.0, 1.0);
+	}
+	return stats.report();
+}
+
+static bool testNormalize(const Vector * v, const uint32 count)
+{
+	ErrorStats stats("normalize");
+	for (uint32 n = 0; n < count; ++n)
+	{
+		const Vector r = normalize(v[n]);
+		const double x = v[n].x, y = v[n].y, z = v[n].z;
+		const double len = sqrt(x * x + y * y + z * z);
+		stats.add(n, r.x, x / len, 1.0);
+		stats.add(n, r.y, y / len, 1.0);
+		stats.add(n, r.z, z / len, 1.0);
+		stats.add(n, r.w, 1.0, 1.0);
+	}
+	return stats.report();
+}
+
+static bool testLerpScale(const Vector * a, const Vector * b, const float * t, const uint32 count)
+{
+	ErrorStats stats("lerpScale");
+	const float s = 0.75f;
+	for (uint32 n = 0; n < count; ++n)
+	{
+		Vector r;
+		lerpScale(r, a[n], b[n], t[n], s); // r.w is undefined.
+		const float * rp = &r.x;
+		const float * ap = &a[n].x;
+		const float * bp = &b[n].x;
+		for (int j = 0; j < 3; ++j)
+		{
+			const double exact = (ap[j] + static_cast<double>(t[n]) * (static_cast<double>(bp[j]) - ap[j])) * s;
+			const double scale = (absd(ap[j]) + absd(t[n]) * (absd(ap[j]) + absd(bp[j]))) * s;
+			stats.add(n, rp[j], exact, scale);
+		}
+	}
+	return stats.report();
+}
+
+// ========================================================
+// Speed:
+// ========================================================
+
+// Keeps the optimizer from dropping the work.
+static volatile float sink;
+
+// Runs `body` over all the inputs enough times for about `totalOps` calls.
+#define TIME_OP(label, totalOps, count, body) \
+	do { \
+		const uint32 passes = ((totalOps) + (count) - 1) / (count); \
+		const clock_t start = clock(); \
+		for (uint32 p = 0; p < passes; ++p) \
+		{ \
+			for (uint32 n = 0; n < (count); ++n) \
+			{ \
+				body; \
+			} \
+		} \
+		const double ns = secondsSince(start) * 1e9 / (static_cast<double>(passes) * (count)); \
+		printf("%-16s %8.2f ns/op\n", (label), ns); \
+	} while (0)
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	const int countArg = (argc > 1) ? atoi(argv[1]) : 4096;
+	if (countArg <= 0)
+	{
+		fprintf(stderr, "Usage: %s [input count, default 4096]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	const uint32 count = static_cast<uint32>(countArg);
+	void * rawPtrs[6];
+	Matrix * ma = alignedArray<Matrix>(count, &rawPtrs[0]);
+	Matrix * mb = alignedArray<Matrix>(count, &rawPtrs[1]);
+	Vector * va = alignedArray<Vector>(count, &rawPtrs[2]);
+	Vector * vb = alignedArray<Vector>(count, &rawPtrs[3]);
+	Vector * vr = alignedArray<Vector>(count, &rawPtrs[4]);
+	float  * tv = alignedArray<float>(count,  &rawPtrs[5]);
+
+	for (uint32 n = 0; n < count; ++n)
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				ma[n](i,j) = randFloat(-2.0f, 2.0f);
+				mb[n](i,j) = randFloat(-2.0f, 2.0f);
+			}
+		}
+		va[n] = randVector(-100.0f, 100.0f);
+		vb[n] = randVector(-100.0f, 100.0f);
+		tv[n] = randFloat(0.0f, 1.0f);
+	}
+
+	static const char * backendNames[] = { "scalar", "SSE2", "VU0" };
+	printf("Backend: %s, %u inputs, tolerance %.0f eps\n\n", backendNames[PS2MATH_BACKEND], count, TOLERANCE_EPS);
+
+	bool passed = true;
+	passed &= testMatrixMultiply(ma, mb, count);
+	passed &= testTransform(ma, va, count);
+	passed &= testCrossProduct(va, vb, count);
+	passed &= testNormalize(va, count);
+	passed &= testLerpScale(va, vb, tv, count);
+	printf("\n");
+
+	const uint32 totalOps = 4000000;
+	TIME_OP("Matrix * Matrix", totalOps, count, { const Matrix r = ma[n] * mb[n]; sink = r(3,3); });
+	TIME_OP("Matrix * Vector", totalOps, count, { vr[n] = ma[n] * va[n]; });
+	TIME_OP("crossProduct",    totalOps, count, { vr[n] = crossProduct(va[n], vb[n]); });
+	TIME_OP("normalize",       totalOps, count, { vr[n] = normalize(va[n]); });
+	TIME_OP("lerpScale",       totalOps, count, { lerpScale(vr[n], va[n], vb[n], tv[n], 0.75f); });
+	sink = vr[count / 2].x;
+
+	for (int i = 0; i < 6; ++i)
+	{
+		free(rawPtrs[i]);
+	}
+
+	printf("\n%s\n", passed ? "All results within tolerance." : "Some results are out of tolerance!");
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,500 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: radix_sort_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host benchmark and test of the radix sort against quickSort and qsort.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds `framework/radix_sort.cpp` and `framework/quick_sort.hpp` for the
+// host and times the two sorts of the engine, old path against new:
+//
+//  - particles: `radixSort32()` of the back-to-front keys of
+//    `ParticleEmitter` (key build included) against `quickSort()` and
+//    `qsort()` of `Particle` structs with the old comparator, which
+//    computes both distances on every compare. "quickSort keys" sorts
+//    precomputed key/index pairs, to tell the comparator cost apart
+//    from the algorithm.
+//  - tiles: `quickSort()` of `TileDrawCmd`s, which `TileMap::drawMap()`
+//    uses, against `radixSort16()` of a floors-first key. Batches are at
+//    most 121 tiles, where the radix sort doesn't pay off yet.
+//
+// Over several sizes and input distributions, in nanoseconds per element.
+// The radix output is also checked to be a stable sort of the input. The key
+// makers and the predicates are copied here; keep them in sync with
+// `particle_emitter.cpp` and `tile_map.cpp`. Runs on the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework radix_sort_bench.cpp -o radix_sort_bench
+//   ./radix_sort_bench
+//
+// Exits with a non-zero status if a radix sort result is wrong.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` needs the PS2SDK headers, so define the few
+// things the sorts use and skip the real header.
+#define COMMON_HPP
+
+#define nullptr NULL
+#define scast static_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+#define ps2assert(cond) /* nothing */
+
+typedef unsigned short uint16;
+typedef unsigned int   uint;
+typedef unsigned int   uint32;
+typedef int            int32;
+
+template<class T>
+inline void swap(T & a, T & b)
+{
+	const T tmp = a;
+	a = b;
+	b = tmp;
+}
+
+#include "ps2_math/vector.hpp"
+#include "quick_sort.hpp"
+#include "radix_sort.cpp"
+
+// ========================================================
+// Copies of the engine keys and the old predicates:
+// ========================================================
+
+struct Particle
+{
+	Vector position;
+	Vector velocity;
+	float  size;
+	uint   durationMs;
+};
+
+static const uint PRT_KEY_GROUP_SHIFT = 26;
+
+static inline uint32 makeParticleSortKey(const uint group, const float distSqr)
+{
+	return (group << PRT_KEY_GROUP_SHIFT) | (radixKeyFromFloatDescending(distSqr) >> (32 - PRT_KEY_GROUP_SHIFT));
+}
+
+struct PrtQSortPredicate
+{
+	Vector cameraPosition;
+	int operator() (const Particle & prtA, const Particle & prtB) const
+	{
+		const float aDistSqr = distanceSqr(prtA.position, cameraPosition);
+		const float bDistSqr = distanceSqr(prtB.position, cameraPosition);
+		if (aDistSqr < bDistSqr) { return  1; }
+		if (aDistSqr > bDistSqr) { return -1; }
+		return 0;
+	}
+};
+
+// `qsort()` has no user pointer, hence the global.
+static Vector qsortCameraPosition;
+static int prtQSortCompare(const void * a, const void * b)
+{
+	const float aDistSqr = distanceSqr(static_cast<const Particle *>(a)->position, qsortCameraPosition);
+	const float bDistSqr = distanceSqr(static_cast<const Particle *>(b)->position, qsortCameraPosition);
+	if (aDistSqr < bDistSqr) { return  1; }
+	if (aDistSqr > bDistSqr) { return -1; }
+	return 0;
+}
+
+struct KeyIndex
+{
+	uint32 key;
+	uint16 index;
+};
+
+struct KeyIndexPredicate
+{
+	int operator() (const KeyIndex & a, const KeyIndex & b) const
+	{
+		return (a.key < b.key) ? -1 : ((a.key > b.key) ? 1 : 0);
+	}
+};
+
+// From `tile_map.hpp`.
+enum TileId { FLR = 11, TILE_COUNT = 14 };
+
+struct TileDrawCmd
+{
+	float x, z;
+	TileId id;
+	bool fade;
+};
+
+// Floors first, then the other tiles by id, all in the low byte.
+inline uint16 makeTileSortKey(const TileId id)
+{
+	return scast<uint16>((id == FLR) ? 0 : (scast<uint>(id) + 1));
+}
+
+struct TileDrawQSortPredicate
+{
+	int operator() (const TileDrawCmd & tileA, const TileDrawCmd & tileB) const
+	{
+		if (tileA.id != FLR && tileB.id == FLR) { return  1; }
+		if (tileA.id == FLR && tileB.id != FLR) { return -1; }
+		return scast<int>(tileA.id) - scast<int>(tileB.id);
+	}
+};
+
+// ========================================================
+// Helpers:
+// ========================================================
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static uint32 randUint()
+{
+	randState = randState * 1664525 + 1013904223;
+	return randState >> 8;
+}
+static float randFloat(const float lo, const float hi)
+{
+	return lo + (hi - lo) * (randUint() * (1.0f / 16777216.0f));
+}
+
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// The 16-bit values can't index past that.
+static const uint MAX_COUNT = 65536;
+
+// Keeps the optimizer from dropping the work.
+static volatile uint32 sink;
+
+static int checksFailed = 0;
+
+enum Distribution
+{
+	DIST_RANDOM,   // Uniform distances.
+	DIST_SORTED,   // Already back-to-front, the last frame's order.
+	DIST_REVERSED, // Front-to-back.
+	DIST_NEARLY,   // Sorted, then 1% of the elements swapped around.
+	DIST_FEW,      // Only 16 distinct distances, lots of ties.
+	DIST_COUNT
+};
+
+static const char * const distNames[DIST_COUNT] = { "random", "sorted", "reversed", "nearly sorted", "16 distinct" };
+
+// Particles around the origin (the camera) with the distances
+// laid out as the distribution asks.
+static void makeParticles(Particle * particles, const uint count, const Distribution dist)
+{
+	float * dists = new float[count];
+	for (uint i = 0; i < count; ++i)
+	{
+		dists[i] = (dist == DIST_FEW) ? scast<float>(1 + randUint() % 16) : randFloat(1.0f, 100.0f);
+	}
+	if (dist == DIST_SORTED || dist == DIST_NEARLY)
+	{
+		std::sort(dists, dists + count);
+		std::reverse(dists, dists + count);
+	}
+	else if (dist == DIST_REVERSED)
+	{
+		std::sort(dists, dists + count);
+	}
+	if (dist == DIST_NEARLY)
+	{
+		for (uint s = 0; s < count / 100; ++s)
+		{
+			swap(dists[randUint() % count], dists[randUint() % count]);
+		}
+	}
+
+	for (uint i = 0; i < count; ++i)
+	{
+		// Random direction on the XZ plane plus a bit of height.
+		const float x = randFloat(-1.0f, 1.0f);
+		const float y = randFloat(0.0f, 0.5f);
+		const float z = randFloat(-1.0f, 1.0f);
+		const float scale = dists[i] / std::sqrt(x * x + y * y + z * z + 1e-6f);
+		particles[i].position   = Vector(x * scale, y * scale, z * scale, 1.0f);
+		particles[i].velocity   = Vector(0.0f, 0.0f, 0.0f, 0.0f);
+		particles[i].size       = 1.0f;
+		particles[i].durationMs = i;
+	}
+	delete[] dists;
+}
+
+// The radix result must be what a stable sort of the same key/index
+// pairs gives: every index once, each key matching its element, keys
+// in order and ties left in input order.
+template<class KEY>
+static bool isStableSortOf(const KEY * inKeys, const KEY * keys, const uint16 * values, const uint count)
+{
+	static bool seen[MAX_COUNT];
+	std::memset(seen, 0, sizeof(seen));
+
+	for (uint i = 0; i < count; ++i)
+	{
+		if (values[i] >= count || seen[values[i]] || keys[i] != inKeys[values[i]])
+		{
+			return false;
+		}
+		seen[values[i]] = true;
+
+		if (i > 0 && (keys[i - 1] > keys[i] || (keys[i - 1] == keys[i] && values[i - 1] > values[i])))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Repetitions so that each timing covers about 1M elements.
+static uint repsFor(const uint count)
+{
+	const uint reps = (1u << 20) / count;
+	return (reps < 4) ? 4 : reps;
+}
+
+// Nanoseconds per element of `body`, run `reps` times. Best of a
+// few trials, since a single one is easily off by 2x on a busy machine.
+static const int TRIALS = 3;
+#define TIME_NS_PER_ELEMENT(result, body) \
+	do { \
+		(result) = 1e30; \
+		for (int trial = 0; trial < TRIALS; ++trial) \
+		{ \
+			const double start = nowSeconds(); \
+			for (uint r = 0; r < reps; ++r) \
+			{ \
+				body; \
+			} \
+			const double ns = (nowSeconds() - start) * 1e9 / (double(reps) * count); \
+			if (ns < (result)) { (result) = ns; } \
+		} \
+	} while (0)
+
+// ========================================================
+// Particle sorts:
+// ========================================================
+
+static void benchParticles(const uint count, const Distribution dist)
+{
+	static Particle source[MAX_COUNT];
+	static Particle work[MAX_COUNT];
+	static uint32 keys[MAX_COUNT];
+	static uint32 inKeys[MAX_COUNT];
+	static uint32 scratchKeys[MAX_COUNT];
+	static uint16 values[MAX_COUNT];
+	static uint16 scratchValues[MAX_COUNT];
+	static KeyIndex pairs[MAX_COUNT];
+
+	makeParticles(source, count, dist);
+	const Vector eyePos(0.0f, 0.0f, 0.0f, 1.0f);
+	const uint reps = repsFor(count);
+
+	// Radix: key build plus sort, as `ParticleManager` does it.
+	double radixNs;
+	TIME_NS_PER_ELEMENT(radixNs,
+	{
+		for (uint i = 0; i < count; ++i)
+		{
+			keys[i]   = makeParticleSortKey(0, distanceSqr(source[i].position, eyePos));
+			values[i] = scast<uint16>(i);
+		}
+		radixSort32(keys, values, scratchKeys, scratchValues, count);
+		sink = values[r % count];
+	});
+
+	for (uint i = 0; i < count; ++i)
+	{
+		inKeys[i] = makeParticleSortKey(0, distanceSqr(source[i].position, eyePos));
+	}
+	if (!isStableSortOf(inKeys, keys, values, count))
+	{
+		std::printf("  radixSort32 result is wrong: %u elements, %s\n", count, distNames[dist]);
+		++checksFailed;
+	}
+
+	// The struct copies below are not part of the sorts; time them alone.
+	double copyNs;
+	TIME_NS_PER_ELEMENT(copyNs,
+	{
+		std::memcpy(work, source, count * sizeof(Particle));
+		sink = work[r % count].durationMs;
+	});
+
+	PrtQSortPredicate pred;
+	pred.cameraPosition = eyePos;
+	double quickNs;
+	TIME_NS_PER_ELEMENT(quickNs,
+	{
+		std::memcpy(work, source, count * sizeof(Particle));
+		quickSort(work, count, pred);
+		sink = work[r % count].durationMs;
+	});
+	quickNs -= copyNs;
+
+	qsortCameraPosition = eyePos;
+	double qsortNs;
+	TIME_NS_PER_ELEMENT(qsortNs,
+	{
+		std::memcpy(work, source, count * sizeof(Particle));
+		std::qsort(work, count, sizeof(Particle), prtQSortCompare);
+		sink = work[r % count].durationMs;
+	});
+	qsortNs -= copyNs;
+
+	KeyIndexPredicate keyPred;
+	double keysNs;
+	TIME_NS_PER_ELEMENT(keysNs,
+	{
+		for (uint i = 0; i < count; ++i)
+		{
+			pairs[i].key   = makeParticleSortKey(0, distanceSqr(source[i].position, eyePos));
+			pairs[i].index = scast<uint16>(i);
+		}
+		quickSort(pairs, count, keyPred);
+		sink = pairs[r % count].index;
+	});
+
+	std::printf("%6u | %-13s | %9.1f | %9.1f | %9.1f | %14.1f | %17.1fx\n", count, distNames[dist],
+	            radixNs, quickNs, qsortNs, keysNs, quickNs / radixNs);
+}
+
+// ========================================================
+// Tile sorts:
+// ========================================================
+
+static void benchTiles(const uint count)
+{
+	static const uint MAX_TILES = 1024;
+	static TileDrawCmd source[MAX_TILES];
+	static TileDrawCmd work[MAX_TILES];
+	static uint16 keys[MAX_TILES];
+	static uint16 inKeys[MAX_TILES];
+	static uint16 scratchKeys[MAX_TILES];
+	static uint16 values[MAX_TILES];
+	static uint16 scratchValues[MAX_TILES];
+
+	// Mostly floors, walls and corners for the rest, like a dungeon room.
+	for (uint i = 0; i < count; ++i)
+	{
+		const uint r = randUint() % 100;
+		source[i].id   = (r < 60) ? FLR : scast<TileId>(randUint() % TILE_COUNT);
+		source[i].x    = scast<float>(i % 32);
+		source[i].z    = scast<float>(i / 32);
+		source[i].fade = false;
+	}
+	const uint reps = repsFor(count);
+
+	double radixNs;
+	TIME_NS_PER_ELEMENT(radixNs,
+	{
+		for (uint i = 0; i < count; ++i)
+		{
+			keys[i]   = makeTileSortKey(source[i].id);
+			values[i] = scast<uint16>(i);
+		}
+		radixSort16(keys, values, scratchKeys, scratchValues, count);
+		sink = values[r % count];
+	});
+
+	for (uint i = 0; i < count; ++i)
+	{
+		inKeys[i] = makeTileSortKey(source[i].id);
+	}
+	if (!isStableSortOf(inKeys, keys, values, count))
+	{
+		std::printf("  radixSort16 result is wrong: %u tiles\n", count);
+		++checksFailed;
+	}
+
+	double copyNs;
+	TIME_NS_PER_ELEMENT(copyNs,
+	{
+		std::memcpy(work, source, count * sizeof(TileDrawCmd));
+		sink = work[r % count].id;
+	});
+
+	TileDrawQSortPredicate pred;
+	double quickNs;
+	TIME_NS_PER_ELEMENT(quickNs,
+	{
+		std::memcpy(work, source, count * sizeof(TileDrawCmd));
+		quickSort(work, count, pred);
+		sink = work[r % count].id;
+	});
+	quickNs -= copyNs;
+
+	std::printf("%6u | %9.1f | %9.1f | %17.1fx\n", count, radixNs, quickNs, quickNs / radixNs);
+}
+
+// ========================================================
+
+int main()
+{
+	static const uint sizes[] = { 16, 64, 256, 1024, 4096, 16384, 65536 };
+	static const uint numSizes = sizeof(sizes) / sizeof(sizes[0]);
+
+	std::printf("Particles, nanoseconds per element:\n\n");
+	std::printf(" count | distribution  | radixSort | quickSort |     qsort | quickSort keys | radix vs quickSort\n");
+	for (uint s = 0; s < numSizes; ++s)
+	{
+		for (int d = 0; d < DIST_COUNT; ++d)
+		{
+			benchParticles(sizes[s], scast<Distribution>(d));
+		}
+	}
+
+	std::printf("\nTiles, nanoseconds per element:\n\n");
+	std::printf(" count | radixSort | quickSort | radix vs quickSort\n");
+	static const uint tileSizes[] = { 32, 64, 121, 256, 512, 1024 }; // 121 = `ActiveTiles::PATTERN_SIZE`
+	static const uint numTileSizes = sizeof(tileSizes) / sizeof(tileSizes[0]);
+	for (uint s = 0; s < numTileSizes; ++s)
+	{
+		benchTiles(tileSizes[s]);
+	}
+
+	if (checksFailed != 0)
+	{
+		std::printf("\n%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll radix sort results are stable and in order.\n");
+	return EXIT_SUCCESS;
+}
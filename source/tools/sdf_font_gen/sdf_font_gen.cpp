@@ -0,0 +1,375 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: sdf_font_gen.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host tool that generates the signed distance field atlas used by the built-in fonts.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds the single 8-bit SDF atlas that replaced the nine Consolas bitmap fonts
+// compiled into the framework. This runs on the development machine, not the PS2:
+//
+//   g++ -O2 sdf_font_gen.cpp -o sdf_font_gen
+//   ./sdf_font_gen ../../framework/builtin_fonts/consolas_sdf.h
+//
+// The distance field is computed from the largest bitmap font (Consolas 48),
+// then downsampled 2x. The metrics of every size (advance and line height)
+// are taken from the original bitmap fonts, so the text layout is unchanged.
+//
+// Output is a `.h` with the RLE compressed atlas, the CLUT mapping distance
+// to alpha and the glyph texture coordinates. See `Renderer::fntLoadSdfAtlas()`.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+typedef unsigned char  ubyte;
+typedef unsigned short uint16;
+typedef unsigned int   uint32;
+
+// The original fonts, in the compressed format used by `stb_font`.
+#include "../../framework/builtin_fonts/consolas10.h"
+#include "../../framework/builtin_fonts/consolas12.h"
+#include "../../framework/builtin_fonts/consolas16.h"
+#include "../../framework/builtin_fonts/consolas20.h"
+#include "../../framework/builtin_fonts/consolas24.h"
+#include "../../framework/builtin_fonts/consolas30.h"
+#include "../../framework/builtin_fonts/consolas36.h"
+#include "../../framework/builtin_fonts/consolas40.h"
+#include "../../framework/builtin_fonts/consolas48.h"
+
+// Same order of the `BuiltInFontId` enum.
+static const uint32 * const fontData[] =
+{
+	font_10Con, font_12Con, font_16Con, font_20Con, font_24Con,
+	font_30Con, font_36Con, font_40Con, font_48Con
+};
+static const int FONT_COUNT  = sizeof(fontData) / sizeof(fontData[0]);
+static const int SOURCE_FONT = FONT_COUNT - 1;
+
+// Atlas layout, in atlas texels:
+static const int ATLAS_WIDTH  = 256;
+static const int ATLAS_HEIGHT = 256;
+static const int DOWNSAMPLE   = 2; // Source pixels per atlas texel
+static const int CELL_PAD     = 3; // Distance field border around each glyph
+static const float SPREAD     = 4.0f; // Max distance encoded, in atlas texels
+
+// CLUT alpha ramp width around the edge (index 128), in distance units.
+// 32 is one atlas texel, so edges stay ~1 pixel soft at every size.
+static const float ALPHA_RAMP = 32.0f;
+
+// ========================================================
+
+struct Font
+{
+	int charStart;
+	int count;
+	int width;  // Monospaced, all glyphs have the same width.
+	int height;
+	std::vector<float> coverage; // One `width * height` image per glyph.
+};
+
+// ========================================================
+
+static Font decodeFont(const uint32 * source)
+{
+	// Same decoder as the old `Renderer::fntDecompressGlyphs()`.
+	Font font;
+	font.charStart = (source[0] >>  0) & 0xFF;
+	font.count     = (source[0] >>  8) & 0xFF;
+	font.height    = (source[0] >> 16) & 0xFF;
+	++source;
+
+	std::vector<int> widths(font.count);
+	for (int i = 0; i < font.count; ++i)
+	{
+		widths[i] = (source[i >> 2] >> ((i & 3) << 3)) & 0xFF;
+		if (widths[i] != widths[0])
+		{
+			std::fprintf(stderr, "Font is not monospaced!\n");
+			std::exit(EXIT_FAILURE);
+		}
+	}
+	font.width = widths[0];
+	font.coverage.resize(font.count * font.width * font.height);
+
+	source += (font.count + 3) >> 2;
+	uint32 buffer   = *source++;
+	int    bitsLeft = 32;
+
+	#define READBIT(out) \
+		out = (buffer & 1); \
+		if ((buffer >>= 1), (--bitsLeft == 0)) { buffer = *source++; bitsLeft = 32; }
+
+	float * c = &font.coverage[0];
+	for (int g = 0; g < font.count; ++g)
+	{
+		for (int y = 0; y < font.height; ++y)
+		{
+			int z;
+			READBIT(z);
+			for (int x = 0; x < font.width; ++x)
+			{
+				if (!z)
+				{
+					*c++ = 0.0f;
+					continue;
+				}
+
+				int bit;
+				READBIT(bit);
+				if (!bit)
+				{
+					*c++ = 0.0f;
+					continue;
+				}
+
+				int n = 0;
+				READBIT(bit); n += n + bit;
+				READBIT(bit); n += n + bit;
+				READBIT(bit); n += n + bit;
+				*c++ = (n + 1) / 8.0f;
+			}
+		}
+	}
+
+	#undef READBIT
+	return font;
+}
+
+// ========================================================
+
+static bool isInside(const Font & font, const int glyph, const int x, const int y)
+{
+	if (x < 0 || y < 0 || x >= font.width || y >= font.height)
+	{
+		return false;
+	}
+	return font.coverage[(glyph * font.width * font.height) + (y * font.width) + x] >= 0.5f;
+}
+
+// Signed distance in source pixels from the center of pixel (px, py) to the
+// glyph edge. Positive inside. Brute force search, the glyphs are tiny.
+static float sourceDistance(const Font & font, const int glyph, const int px, const int py)
+{
+	const bool inside = isInside(font, glyph, px, py);
+	const int radius  = static_cast<int>(SPREAD * DOWNSAMPLE) + 1;
+	float best = static_cast<float>(radius);
+
+	for (int dy = -radius; dy <= radius; ++dy)
+	{
+		for (int dx = -radius; dx <= radius; ++dx)
+		{
+			if (isInside(font, glyph, px + dx, py + dy) != inside)
+			{
+				// Edge is halfway between the two pixel centers.
+				const float d = std::sqrt(static_cast<float>((dx * dx) + (dy * dy))) - 0.5f;
+				if (d < best)
+				{
+					best = d;
+				}
+			}
+		}
+	}
+
+	return inside ? best : -best;
+}
+
+// ========================================================
+
+static void writeWords(FILE * out, const char * comment, const char * name, const std::vector<ubyte> & bytes)
+{
+	std::vector<ubyte> padded(bytes);
+	while (padded.size() % 4)
+	{
+		padded.push_back(0);
+	}
+
+	std::fprintf(out, "// %s\n", comment);
+	std::fprintf(out, "static const uint32 %s[] __attribute__((aligned(16))) = {", name);
+	for (size_t i = 0; i < padded.size(); i += 4)
+	{
+		const uint32 w = padded[i] | (padded[i + 1] << 8) | (padded[i + 2] << 16) | (padded[i + 3] << 24);
+		std::fprintf(out, "%s0x%08x%s", ((i / 4) % 6 == 0) ? "\n\t" : " ", w, (i + 4 < padded.size()) ? "," : "");
+	}
+	std::fprintf(out, "\n};\n\n");
+}
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	if (argc != 2)
+	{
+		std::fprintf(stderr, "Usage: %s <output.h>\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	Font fonts[FONT_COUNT];
+	for (int f = 0; f < FONT_COUNT; ++f)
+	{
+		fonts[f] = decodeFont(fontData[f]);
+	}
+
+	const Font & src  = fonts[SOURCE_FONT];
+	const int coreW   = (src.width  + DOWNSAMPLE - 1) / DOWNSAMPLE;
+	const int coreH   = (src.height + DOWNSAMPLE - 1) / DOWNSAMPLE;
+	const int cellW   = coreW + (CELL_PAD * 2);
+	const int cellH   = coreH + (CELL_PAD * 2);
+	const int columns = ATLAS_WIDTH / cellW;
+	const int rows    = (src.count + columns - 1) / columns;
+
+	if (rows * cellH > ATLAS_HEIGHT)
+	{
+		std::fprintf(stderr, "Glyphs don't fit in the atlas!\n");
+		return EXIT_FAILURE;
+	}
+
+	// Distance field of each glyph cell:
+	std::vector<ubyte> atlas(ATLAS_WIDTH * ATLAS_HEIGHT, 0);
+	std::vector<uint16> glyphUVs;
+
+	for (int g = 0; g < src.count; ++g)
+	{
+		const int cellX = (g % columns) * cellW;
+		const int cellY = (g / columns) * cellH;
+
+		for (int ty = 0; ty < cellH; ++ty)
+		{
+			for (int tx = 0; tx < cellW; ++tx)
+			{
+				// Average of the source pixels under this texel, in texel units:
+				const int sx = (tx - CELL_PAD) * DOWNSAMPLE;
+				const int sy = (ty - CELL_PAD) * DOWNSAMPLE;
+				float d = 0.0f;
+				for (int y = 0; y < DOWNSAMPLE; ++y)
+				{
+					for (int x = 0; x < DOWNSAMPLE; ++x)
+					{
+						d += sourceDistance(src, g, sx + x, sy + y);
+					}
+				}
+				d /= (DOWNSAMPLE * DOWNSAMPLE * DOWNSAMPLE);
+
+				float v = 128.0f + (d * (128.0f / SPREAD));
+				v = (v < 0.0f) ? 0.0f : ((v > 255.0f) ? 255.0f : v);
+				atlas[((cellY + ty) * ATLAS_WIDTH) + cellX + tx] = static_cast<ubyte>(v + 0.5f);
+			}
+		}
+
+		// GS UVs are 12:4 fixed-point texels. The glyph spans
+		// `src.width / DOWNSAMPLE` texels, not a whole number.
+		glyphUVs.push_back(static_cast<uint16>((cellX + CELL_PAD) * 16));
+		glyphUVs.push_back(static_cast<uint16>((cellY + CELL_PAD) * 16));
+		glyphUVs.push_back(static_cast<uint16>(((cellX + CELL_PAD) * 16) + (src.width  * 16 / DOWNSAMPLE)));
+		glyphUVs.push_back(static_cast<uint16>(((cellY + CELL_PAD) * 16) + (src.height * 16 / DOWNSAMPLE)));
+	}
+
+	// Only the rows in use are stored, the rest of the texture stays zeroed.
+	// Zero runs (far outside the glyphs) are RLE compressed as {0, count}.
+	const int usedRows = rows * cellH;
+	std::vector<ubyte> rle;
+	for (int i = 0; i < usedRows * ATLAS_WIDTH;)
+	{
+		if (atlas[i] != 0)
+		{
+			rle.push_back(atlas[i++]);
+			continue;
+		}
+
+		int run = 0;
+		while (i < usedRows * ATLAS_WIDTH && atlas[i] == 0 && run < 255)
+		{
+			++run;
+			++i;
+		}
+		rle.push_back(0);
+		rle.push_back(static_cast<ubyte>(run));
+	}
+
+	// CLUT maps distance to alpha. RGB is 1.0 in the GS
+	// modulate function (0x80), the vertex color tints it.
+	// Stored already swizzled for the CSM1 storage mode.
+	std::vector<ubyte> clut(256 * 4);
+	for (int i = 0; i < 256; ++i)
+	{
+		float a = ((i - 128) / ALPHA_RAMP) + 0.5f;
+		a = (a < 0.0f) ? 0.0f : ((a > 1.0f) ? 1.0f : a);
+
+		const int pos = (i & 0xE7) | ((i & 0x08) << 1) | ((i & 0x10) >> 1);
+		clut[(pos * 4) + 0] = 0x80;
+		clut[(pos * 4) + 1] = 0x80;
+		clut[(pos * 4) + 2] = 0x80;
+		clut[(pos * 4) + 3] = static_cast<ubyte>((a * 0x80) + 0.5f);
+	}
+
+	FILE * out = std::fopen(argv[1], "wt");
+	if (out == NULL)
+	{
+		std::fprintf(stderr, "Can't open \"%s\" for writing!\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	std::fprintf(out, "// Consolas SDF atlas, generated by tools/sdf_font_gen. Do not edit.\n");
+	std::fprintf(out, "// Atlas is %dx%d PSMT8, %d rows in use, glyph cells of %dx%d texels.\n\n",
+	             ATLAS_WIDTH, ATLAS_HEIGHT, usedRows, cellW, cellH);
+
+	std::fprintf(out, "static const int SDF_ATLAS_WIDTH   = %d;\n", ATLAS_WIDTH);
+	std::fprintf(out, "static const int SDF_ATLAS_HEIGHT  = %d;\n", ATLAS_HEIGHT);
+	std::fprintf(out, "static const int SDF_ATLAS_RLE_SIZE = %d; // Bytes\n", static_cast<int>(rle.size()));
+	std::fprintf(out, "static const int SDF_CHAR_START    = %d;\n", src.charStart);
+	std::fprintf(out, "static const int SDF_CHAR_COUNT    = %d;\n\n", src.count);
+
+	writeWords(out, "RLE compressed atlas indexes:", "consolasSdfAtlasRle", rle);
+	writeWords(out, "CLUT, RGBA32:", "consolasSdfClut", clut);
+
+	std::fprintf(out, "// Glyph UVs {u0, v0, u1, v1}, 12:4 fixed-point:\n");
+	std::fprintf(out, "static const uint16 consolasSdfGlyphs[][4] __attribute__((aligned(16))) = {");
+	for (int g = 0; g < src.count; ++g)
+	{
+		std::fprintf(out, "%s{ %u, %u, %u, %u }%s", (g % 4 == 0) ? "\n\t" : " ",
+		             glyphUVs[(g * 4) + 0], glyphUVs[(g * 4) + 1], glyphUVs[(g * 4) + 2], glyphUVs[(g * 4) + 3],
+		             (g + 1 < src.count) ? "," : "");
+	}
+	std::fprintf(out, "\n};\n\n");
+
+	std::fprintf(out, "// Metrics of each BuiltInFontId {advance, line height}, in pixels:\n");
+	std::fprintf(out, "static const ubyte consolasSdfMetrics[][2] __attribute__((aligned(16))) = {");
+	for (int f = 0; f < FONT_COUNT; ++f)
+	{
+		std::fprintf(out, "\n\t{ %d, %d }%s", fonts[f].width, fonts[f].height, (f + 1 < FONT_COUNT) ? "," : "");
+	}
+	std::fprintf(out, "\n};\n");
+	std::fclose(out);
+
+	std::printf("Atlas RLE: %d bytes (%d texels in use), CLUT: %d bytes.\n",
+	            static_cast<int>(rle.size()), usedRows * ATLAS_WIDTH, static_cast<int>(clut.size()));
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,308 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: spr_alloc_test.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host test of the Scratch Pad stack allocator and its overflow handling.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds `framework/scratchpad.cpp` in its host emulation mode (no `_EE`)
+// and checks the allocator at and past the 16KB limit: failed allocations
+// return null and leave the stack untouched, alignment padding can't push
+// the top past the end, scopes rewind nested allocations, `sprOrFrameAlloc()`
+// falls back to the frame allocator once the SPR is full, and data staged
+// through the DMA helpers round-trips. Runs on the development machine:
+//
+//   g++ -O2 -I../../framework spr_alloc_test.cpp -o spr_alloc_test
+//   ./spr_alloc_test
+//
+// Exits with a non-zero status if any check fails.
+//
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` needs the PS2SDK headers, so define the few
+// things `scratchpad.cpp` uses and skip the real header.
+#define COMMON_HPP
+
+#define nullptr NULL
+#define rcast reinterpret_cast
+#define scast static_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+
+typedef unsigned char ubyte;
+typedef unsigned int  uint;
+typedef unsigned int  uint32;
+
+const size_t DEFAULT_MEM_ALIGNMENT = 16;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+
+// Only what `sprOrFrameAlloc()` calls. A fixed buffer, so the
+// tests can also run it out of memory.
+class FrameAllocator
+{
+public:
+
+	FrameAllocator() : used(0) { }
+
+	void * allocBytes(const size_t sizeBytes, const size_t alignment)
+	{
+		const size_t start = (used + alignment - 1) & ~(alignment - 1);
+		if (start + sizeBytes > sizeof(buffer))
+		{
+			return nullptr;
+		}
+		used = start + sizeBytes;
+		return buffer + start;
+	}
+
+	template<class T>
+	T * alloc(const size_t elementCount, const size_t alignment)
+	{
+		return reinterpret_cast<T *>(allocBytes(elementCount * sizeof(T), alignment));
+	}
+
+	bool contains(const void * ptr) const
+	{
+		const ubyte * p = static_cast<const ubyte *>(ptr);
+		return p >= buffer && p < buffer + sizeof(buffer);
+	}
+
+	size_t used;
+	ubyte  buffer[32 * 1024] ATTRIBUTE_ALIGNED(16);
+};
+
+static FrameAllocator gFrameAllocator;
+
+#include "scratchpad.cpp"
+
+// ========================================================
+// Test helpers:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+static bool isAligned(const void * ptr, const size_t alignment)
+{
+	return (reinterpret_cast<size_t>(ptr) & (alignment - 1)) == 0;
+}
+
+// ========================================================
+// Tests:
+// ========================================================
+
+static void testFillToTheLimit()
+{
+	std::printf("Fill to the limit...\n");
+	ScopedSprAlloc scope;
+	const uint failedBefore = gScratchPad.getFailedAllocs();
+
+	// 16 blocks of 1KB take the whole SPR.
+	ubyte * blocks[16];
+	for (int i = 0; i < 16; ++i)
+	{
+		blocks[i] = scope.alloc<ubyte>(1024);
+		CHECK(blocks[i] != nullptr);
+		CHECK(gScratchPad.contains(blocks[i]));
+	}
+	CHECK(gScratchPad.getBytesFree() == 0);
+	CHECK(gScratchPad.getPeak() == SCRATCH_PAD_SIZE_BYTES);
+
+	// Every further request fails and the stack top must not move.
+	CHECK(scope.alloc<ubyte>(1) == nullptr);
+	CHECK(scope.alloc<ubyte>(16) == nullptr);
+	CHECK(gScratchPad.getBytesUsed() == SCRATCH_PAD_SIZE_BYTES);
+	CHECK(gScratchPad.getFailedAllocs() == failedBefore + 2);
+
+	// The blocks don't overlap and all of them are writable.
+	for (int i = 0; i < 16; ++i)
+	{
+		std::memset(blocks[i], i, 1024);
+	}
+	for (int i = 0; i < 16; ++i)
+	{
+		CHECK(blocks[i][0] == i && blocks[i][1023] == i);
+	}
+}
+
+static void testOversizedRequests()
+{
+	std::printf("Oversized requests...\n");
+	ScopedSprAlloc scope;
+	const uint used = gScratchPad.getBytesUsed();
+
+	// Bigger than the whole SPR, and big enough to wrap
+	// `start + sizeBytes` around if the check were naive.
+	CHECK(scope.alloc<ubyte>(SCRATCH_PAD_SIZE_BYTES + 1) == nullptr);
+	CHECK(scope.alloc<ubyte>(~0u - 8) == nullptr);
+	CHECK(gScratchPad.getBytesUsed() == used);
+
+	// Exactly the whole SPR fits when it's empty.
+	CHECK(scope.alloc<ubyte>(SCRATCH_PAD_SIZE_BYTES) != nullptr);
+}
+
+static void testAlignmentPadding()
+{
+	std::printf("Alignment padding...\n");
+	ScopedSprAlloc scope;
+
+	ubyte * a = scope.alloc<ubyte>(4, 4);
+	CHECK(a != nullptr && isAligned(a, 4));
+
+	// Padding up to 128 bytes.
+	ubyte * b = scope.alloc<ubyte>(16, 128);
+	CHECK(b != nullptr && isAligned(b, 128));
+	CHECK(b >= a + 4);
+
+	// Leave 8 bytes free: a request that fits in size but
+	// whose aligned start is past the end must fail.
+	const uint fill = gScratchPad.getBytesFree() - 8;
+	CHECK(scope.alloc<ubyte>(fill, 1) != nullptr);
+	CHECK(gScratchPad.getBytesFree() == 8);
+	CHECK(scope.alloc<ubyte>(4, 16) == nullptr);
+	CHECK(gScratchPad.getBytesUsed() <= SCRATCH_PAD_SIZE_BYTES);
+	CHECK(scope.alloc<ubyte>(8, 1) != nullptr);
+	CHECK(gScratchPad.getBytesFree() == 0);
+}
+
+static void testNestedScopes()
+{
+	std::printf("Nested scopes...\n");
+	const uint outerMark = gScratchPad.getMark();
+	{
+		ScopedSprAlloc outer;
+		CHECK(outer.alloc<float>(256) != nullptr);
+		const uint innerMark = gScratchPad.getMark();
+		{
+			ScopedSprAlloc inner;
+			CHECK(inner.alloc<float>(2048) != nullptr);
+			CHECK(inner.alloc<float>(2048) == nullptr); // Full.
+		}
+		CHECK(gScratchPad.getMark() == innerMark);
+		CHECK(outer.alloc<float>(2048) != nullptr);     // Room again.
+	}
+	CHECK(gScratchPad.getMark() == outerMark);
+}
+
+static void testFrameFallback()
+{
+	std::printf("Frame allocator fallback...\n");
+	ScopedSprAlloc scope;
+	gFrameAllocator.used = 0;
+
+	float * inSpr = sprOrFrameAlloc<float>(3000);
+	CHECK(inSpr != nullptr && gScratchPad.contains(inSpr));
+
+	// 3000 + 3000 floats don't fit in 16KB, so the second goes to the frame.
+	float * inFrame = sprOrFrameAlloc<float>(3000);
+	CHECK(inFrame != nullptr && gFrameAllocator.contains(inFrame));
+	CHECK(isAligned(inFrame, DEFAULT_MEM_ALIGNMENT));
+
+	// Both out of memory: callers get null.
+	CHECK(sprOrFrameAlloc<float>(8192) == nullptr);
+
+	gFrameAllocator.used = 0;
+}
+
+static void testDmaRoundTrip()
+{
+	std::printf("DMA staging round-trip...\n");
+	ScopedSprAlloc scope;
+
+	static float ram[4096] ATTRIBUTE_ALIGNED(16);
+	for (int i = 0; i < 4096; ++i)
+	{
+		ram[i] = static_cast<float>(i);
+	}
+
+	// Stage through two SPR buffers of 256 floats, doubling each value.
+	float * buffers[2] = { scope.alloc<float>(256, 64), scope.alloc<float>(256, 64) };
+	CHECK(buffers[0] != nullptr && buffers[1] != nullptr);
+	if (buffers[0] == nullptr || buffers[1] == nullptr)
+	{
+		return;
+	}
+
+	for (int block = 0, buf = 0; block < 16; ++block, buf ^= 1)
+	{
+		float * ramBlock = ram + (block * 256);
+		sprDmaToSpr(buffers[buf], ramBlock, 256 / 4);
+		sprDmaWaitToSpr();
+		for (int i = 0; i < 256; ++i)
+		{
+			buffers[buf][i] *= 2.0f;
+		}
+		sprDmaFromSpr(ramBlock, buffers[buf], 256 / 4);
+	}
+	sprDmaWaitFromSpr();
+
+	int mismatches = 0;
+	for (int i = 0; i < 4096; ++i)
+	{
+		mismatches += (ram[i] != static_cast<float>(i) * 2.0f);
+	}
+	CHECK(mismatches == 0);
+	CHECK(sprQwordsForBytes(1) == 1 && sprQwordsForBytes(16) == 1 && sprQwordsForBytes(17) == 2);
+}
+
+// ========================================================
+
+int main()
+{
+	testFillToTheLimit();
+	testOversizedRequests();
+	testAlignmentPadding();
+	testNestedScopes();
+	testFrameFallback();
+	testDmaRoundTrip();
+
+	CHECK(gScratchPad.getBytesUsed() == 0);
+	CHECK(assertsFailed == 0);
+
+	if (checksFailed != 0)
+	{
+		std::printf("%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("All checks passed. SPR peak: %u bytes, failed allocations: %u.\n",
+	            gScratchPad.getPeak(), gScratchPad.getFailedAllocs());
+	return EXIT_SUCCESS;
+}
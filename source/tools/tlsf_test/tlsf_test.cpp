@@ -0,0 +1,496 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: tlsf_test.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host stress test and latency benchmark of the TLSF allocator.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds `framework/tlsf_allocator.cpp` for the host, then:
+//
+//  - stress: random allocate/reallocate/release with the 16, 64 and 128 byte
+//    alignments the renderer uses (plus 256), checking the block contents,
+//    alignment and `checkIntegrity()` as it goes, and that the heap coalesces
+//    back into a single free block at the end.
+//  - exhaustion: allocates until the heap is full, checks failures return null
+//    and leave the heap intact, then frees in a scattered order.
+//  - latency: the same steady state workload through the TLSF heap and through
+//    the system allocator (`malloc()`, or `memalign()` for the bigger alignments,
+//    which is what `memTagMalloc()` used before), timing every call. Reports the
+//    mean, percentiles and the worst case, each the best of a few runs.
+//
+// Runs on the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework tlsf_test.cpp -o tlsf_test
+//   ./tlsf_test [stress ops, default 1000000]
+//
+// Exits with a non-zero status if any check fails.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+#include <time.h>
+#include <vector>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` needs the PS2SDK headers, so define the few
+// things `tlsf_allocator.cpp` uses and skip the real header.
+#define COMMON_HPP
+
+#define nullptr NULL
+#define ccast const_cast
+#define rcast reinterpret_cast
+#define scast static_cast
+
+typedef unsigned char ubyte;
+typedef unsigned int  uint;
+typedef unsigned int  uint32;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+
+#include "tlsf_allocator.cpp"
+
+// ========================================================
+// Test helpers:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static uint32 randUint()
+{
+	randState = randState * 1664525 + 1013904223;
+	return randState >> 8;
+}
+
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static bool isAligned(const void * ptr, const size_t alignment)
+{
+	return (reinterpret_cast<size_t>(ptr) & (alignment - 1)) == 0;
+}
+
+// Mostly small blocks, some up to a few KB and the odd big one, like
+// the model, texture and container allocations of a level load.
+static size_t randAllocSize()
+{
+	const uint r = randUint() % 100;
+	if (r < 60) { return 16 + randUint() % 240;     }
+	if (r < 90) { return 256 + randUint() % 3840;   }
+	if (r < 99) { return 4096 + randUint() % 61440; }
+	return 65536 + randUint() % 196608;
+}
+
+static size_t randAlignment()
+{
+	const uint r = randUint() % 100;
+	if (r < 70) { return 16;  }
+	if (r < 85) { return 64;  }
+	if (r < 97) { return 128; }
+	return 256;
+}
+
+struct LiveBlock
+{
+	ubyte * ptr;
+	size_t  size;
+	size_t  alignment;
+	ubyte   fill;
+};
+
+static bool blockIntact(const LiveBlock & block)
+{
+	for (size_t i = 0; i < block.size; ++i)
+	{
+		if (block.ptr[i] != block.fill)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static const size_t HEAP_SIZE = 16 * 1024 * 1024;
+
+// ========================================================
+// Tests:
+// ========================================================
+
+static void testStress(void * heapMemory, const uint ops)
+{
+	std::printf("Stress, %u random operations...\n", ops);
+
+	TlsfAllocator tlsf;
+	tlsf.init(heapMemory, HEAP_SIZE);
+	const size_t initialFree = tlsf.getLargestFreeBlock();
+
+	std::vector<LiveBlock> live;
+	uint failedAllocs = 0, reallocs = 0;
+	bool contentsOk = true, alignmentOk = true, integrityOk = true;
+
+	for (uint op = 0; op < ops; ++op)
+	{
+		const uint r = randUint() % 100;
+		if (live.empty() || r < 45)
+		{
+			LiveBlock block;
+			block.size      = randAllocSize();
+			block.alignment = randAlignment();
+			block.fill      = static_cast<ubyte>(op);
+			block.ptr       = static_cast<ubyte *>(tlsf.allocate(block.size, block.alignment));
+			if (block.ptr == NULL)
+			{
+				++failedAllocs;
+				continue;
+			}
+			alignmentOk = alignmentOk && isAligned(block.ptr, block.alignment) && tlsf.getBlockSize(block.ptr) >= block.size;
+			std::memset(block.ptr, block.fill, block.size);
+			live.push_back(block);
+		}
+		else if (r < 60)
+		{
+			// Grow or shrink; the common prefix must survive.
+			LiveBlock & block = live[randUint() % live.size()];
+			const size_t newSize = randAllocSize();
+			ubyte * newPtr = static_cast<ubyte *>(tlsf.reallocate(block.ptr, newSize, block.alignment));
+			if (newPtr == NULL)
+			{
+				++failedAllocs;
+				continue;
+			}
+			block.ptr  = newPtr;
+			block.size = std::min(block.size, newSize);
+			contentsOk = contentsOk && blockIntact(block);
+			alignmentOk = alignmentOk && isAligned(block.ptr, block.alignment);
+			block.size = newSize;
+			std::memset(block.ptr, block.fill, block.size);
+			++reallocs;
+		}
+		else
+		{
+			const size_t index = randUint() % live.size();
+			contentsOk = contentsOk && blockIntact(live[index]);
+			tlsf.release(live[index].ptr);
+			live[index] = live.back();
+			live.pop_back();
+		}
+
+		if ((op % 10000) == 0)
+		{
+			integrityOk = integrityOk && tlsf.checkIntegrity();
+		}
+	}
+
+	std::printf("  %u reallocations, %u failed (heap full), %u blocks live, peak %u KB of %u KB.\n",
+	            reallocs, failedAllocs, static_cast<uint>(live.size()),
+	            static_cast<uint>(tlsf.getPeakUsed() / 1024), static_cast<uint>(HEAP_SIZE / 1024));
+
+	for (size_t i = 0; i < live.size(); ++i)
+	{
+		contentsOk = contentsOk && blockIntact(live[i]);
+		tlsf.release(live[i].ptr);
+	}
+
+	CHECK(contentsOk);
+	CHECK(alignmentOk);
+	CHECK(integrityOk);
+	CHECK(tlsf.checkIntegrity());
+	CHECK(tlsf.getUsedBytes() == 0);
+	CHECK(tlsf.getLargestFreeBlock() == initialFree); // Back to a single block.
+}
+
+static void testExhaustion(void * heapMemory)
+{
+	std::printf("Exhaustion...\n");
+
+	TlsfAllocator tlsf;
+	tlsf.init(heapMemory, HEAP_SIZE);
+	const size_t initialFree = tlsf.getLargestFreeBlock();
+
+	// Fill it up with mixed alignments, then mop up the alignment gaps and
+	// the tail with smaller and smaller blocks, since a good fit search
+	// refuses a block that is only a bit bigger than the request.
+	std::vector<void *> blocks;
+	for (;;)
+	{
+		void * ptr = tlsf.allocate(2048 + randUint() % 2048, (randUint() & 1) ? 128 : 16);
+		if (ptr == NULL)
+		{
+			break;
+		}
+		blocks.push_back(ptr);
+	}
+	for (size_t size = 2048; size >= 16;)
+	{
+		void * ptr = tlsf.allocate(size, 16);
+		if (ptr == NULL)
+		{
+			size /= 2;
+			continue;
+		}
+		blocks.push_back(ptr);
+	}
+
+	// All of it used but a few headers, then every further request fails.
+	std::printf("  %u blocks, %u bytes left over.\n", static_cast<uint>(blocks.size()),
+	            static_cast<uint>(tlsf.getHeapSize() - tlsf.getUsedBytes()));
+	CHECK(tlsf.getUsedBytes() > tlsf.getHeapSize() - 256);
+	CHECK(tlsf.allocate(HEAP_SIZE, 16) == NULL);
+	CHECK(tlsf.allocate(~static_cast<size_t>(0) - 64, 16) == NULL);
+	CHECK(tlsf.allocate(8192, 256) == NULL);
+	CHECK(tlsf.reallocate(blocks[0], HEAP_SIZE / 2) == NULL);
+	CHECK(tlsf.checkIntegrity());
+
+	// Free every other block first: nothing can coalesce yet.
+	for (size_t i = 0; i < blocks.size(); i += 2)
+	{
+		tlsf.release(blocks[i]);
+	}
+	CHECK(tlsf.checkIntegrity());
+	CHECK(tlsf.getLargestFreeBlock() < 16384);
+
+	for (size_t i = 1; i < blocks.size(); i += 2)
+	{
+		tlsf.release(blocks[i]);
+	}
+	CHECK(tlsf.checkIntegrity());
+	CHECK(tlsf.getUsedBytes() == 0);
+	CHECK(tlsf.getLargestFreeBlock() == initialFree);
+}
+
+// ========================================================
+// Latency benchmark:
+// ========================================================
+
+struct Latencies
+{
+	std::vector<double> allocNs;
+	std::vector<double> freeNs;
+};
+
+struct LatencyStats
+{
+	double mean, p50, p99, p999, p9999, worst;
+};
+
+static LatencyStats computeStats(std::vector<double> & ns, const double timerNs)
+{
+	std::sort(ns.begin(), ns.end());
+	double sum = 0.0;
+	for (size_t i = 0; i < ns.size(); ++i)
+	{
+		sum += ns[i];
+	}
+	const size_t n = ns.size();
+	LatencyStats stats;
+	stats.mean  = sum / n - timerNs;
+	stats.p50   = ns[n / 2] - timerNs;
+	stats.p99   = ns[n * 99 / 100] - timerNs;
+	stats.p999  = ns[n * 999 / 1000] - timerNs;
+	stats.p9999 = ns[n * 9999 / 10000] - timerNs;
+	stats.worst = ns[n - 1] - timerNs;
+	return stats;
+}
+
+// Best of the runs for each statistic. A single host run easily has an
+// operation preempted by the OS, which is no fault of the allocator.
+static void keepBest(LatencyStats & best, const LatencyStats & stats)
+{
+	best.mean  = std::min(best.mean,  stats.mean);
+	best.p50   = std::min(best.p50,   stats.p50);
+	best.p99   = std::min(best.p99,   stats.p99);
+	best.p999  = std::min(best.p999,  stats.p999);
+	best.p9999 = std::min(best.p9999, stats.p9999);
+	best.worst = std::min(best.worst, stats.worst);
+}
+
+static void printStats(const char * name, const LatencyStats & stats)
+{
+	std::printf("%-16s | %6.0f | %6.0f | %6.0f | %6.0f | %7.0f | %8.0f\n", name,
+	            stats.mean, stats.p50, stats.p99, stats.p999, stats.p9999, stats.worst);
+}
+
+// Runs the same sequence of requests through `ALLOC`. Live
+// blocks are kept around 4000, for a fragmented steady state.
+template<class ALLOC>
+static void runLatency(ALLOC & allocator, const uint ops, Latencies & out)
+{
+	randState = 777;
+	std::vector<void *> live;
+	live.reserve(8192);
+	out.allocNs.clear();
+	out.freeNs.clear();
+	out.allocNs.reserve(ops);
+	out.freeNs.reserve(ops);
+
+	for (uint op = 0; op < ops; ++op)
+	{
+		const bool doAlloc = live.size() < 2000 || (live.size() < 6000 && (randUint() & 1));
+		if (doAlloc)
+		{
+			const size_t size = randAllocSize();
+			const size_t alignment = randAlignment();
+			const double t0 = nowSeconds();
+			void * ptr = allocator.allocate(size, alignment);
+			const double t1 = nowSeconds();
+			if (ptr != NULL)
+			{
+				static_cast<ubyte *>(ptr)[0] = 1; // Touch it, as a caller would.
+				live.push_back(ptr);
+				out.allocNs.push_back((t1 - t0) * 1e9);
+			}
+		}
+		else
+		{
+			const size_t index = randUint() % live.size();
+			void * ptr = live[index];
+			live[index] = live.back();
+			live.pop_back();
+			const double t0 = nowSeconds();
+			allocator.release(ptr);
+			const double t1 = nowSeconds();
+			out.freeNs.push_back((t1 - t0) * 1e9);
+		}
+	}
+
+	for (size_t i = 0; i < live.size(); ++i)
+	{
+		allocator.release(live[i]);
+	}
+}
+
+struct TlsfHeap
+{
+	TlsfAllocator tlsf;
+	void * allocate(const size_t size, const size_t alignment) { return tlsf.allocate(size, alignment); }
+	void release(void * ptr) { tlsf.release(ptr); }
+};
+
+struct SystemHeap
+{
+	void * allocate(const size_t size, const size_t alignment)
+	{
+		return (alignment <= 16) ? std::malloc(size) : memalign(alignment, size);
+	}
+	void release(void * ptr) { std::free(ptr); }
+};
+
+static void benchLatency(void * heapMemory, const uint ops)
+{
+	// Cost of the timer calls themselves, taken off every sample.
+	double timerNs = 1e30;
+	for (int i = 0; i < 100000; ++i)
+	{
+		const double t0 = nowSeconds();
+		const double t1 = nowSeconds();
+		timerNs = std::min(timerNs, (t1 - t0) * 1e9);
+	}
+
+	TlsfHeap tlsfHeap;
+	tlsfHeap.tlsf.init(heapMemory, HEAP_SIZE);
+	SystemHeap systemHeap;
+
+	// A first run of each to warm up, then the measured ones.
+	static const int RUNS = 3;
+	const LatencyStats none = { 1e30, 1e30, 1e30, 1e30, 1e30, 1e30 };
+	LatencyStats tlsfAlloc = none, tlsfFree = none, systemAlloc = none, systemFree = none;
+	Latencies latencies;
+
+	runLatency(tlsfHeap, ops, latencies);
+	for (int run = 0; run < RUNS; ++run)
+	{
+		runLatency(tlsfHeap, ops, latencies);
+		keepBest(tlsfAlloc, computeStats(latencies.allocNs, timerNs));
+		keepBest(tlsfFree,  computeStats(latencies.freeNs,  timerNs));
+	}
+	CHECK(tlsfHeap.tlsf.checkIntegrity() && tlsfHeap.tlsf.getUsedBytes() == 0);
+
+	runLatency(systemHeap, ops, latencies);
+	for (int run = 0; run < RUNS; ++run)
+	{
+		runLatency(systemHeap, ops, latencies);
+		keepBest(systemAlloc, computeStats(latencies.allocNs, timerNs));
+		keepBest(systemFree,  computeStats(latencies.freeNs,  timerNs));
+	}
+
+	std::printf("\nLatency, %u operations, ~4000 live blocks, nanoseconds, best of %d runs"
+	            " (timer cost of %.0f ns removed):\n\n", ops, RUNS, timerNs);
+	std::printf("                 |   mean |    p50 |    p99 |  p99.9 |  p99.99 |    worst\n");
+	printStats("TLSF allocate",   tlsfAlloc);
+	printStats("malloc/memalign", systemAlloc);
+	printStats("TLSF release",    tlsfFree);
+	printStats("free",            systemFree);
+}
+
+// ========================================================
+
+int main(int argc, const char * argv[])
+{
+	const int ops = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+	if (ops <= 0)
+	{
+		std::fprintf(stderr, "Usage: %s [stress ops, default 1000000]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	void * heapMemory = std::malloc(HEAP_SIZE);
+	std::memset(heapMemory, 0, HEAP_SIZE); // Fault the pages in before any timing.
+
+	testStress(heapMemory, static_cast<uint>(ops));
+	testExhaustion(heapMemory);
+	benchLatency(heapMemory, static_cast<uint>(ops));
+
+	std::free(heapMemory);
+	CHECK(assertsFailed == 0);
+
+	if (checksFailed != 0)
+	{
+		std::printf("\n%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll checks passed.\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,401 @@
+// ================================================================================================
+// -*- C++ -*-
+// File: vertex_bench.cpp
+// Author: Guilherme R. Lampert
+// Created on: 19/10/26
+// Brief: Host benchmark of the draw-time cost of DrawVertex against PackedDrawVertex.
+//
+// License:
+//  This source code is released under the MIT License.
+//  Copyright (c) 2015 Guilherme R. Lampert.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy
+//  of this software and associated documentation files (the "Software"), to deal
+//  in the Software without restriction, including without limitation the rights
+//  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//  copies of the Software, and to permit persons to whom the Software is
+//  furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included in
+//  all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+//  THE SOFTWARE.
+//
+// ================================================================================================
+
+//
+// Builds the draw loops of `framework/vertex_xform.h` for the host, with the
+// ps2_math backend of the machine, and times the per-frame vertex work of an
+// animated model in both vertex formats of `framework/draw_vertex.hpp`,
+// in nanoseconds per vertex:
+//
+//  - assembly: `packDrawVertex()` of the frame vertexes into the temp buffer,
+//    as `Md2Model::assembleFrame*()` does for each visible entity.
+//  - draw:     the loop of `Renderer::drawUnindexedTriangles()` up to the GIF
+//    packet; `drawTriangleBatch()`/`drawPackedTriangleBatch()`, which unpack
+//    (packed only), `transformProjectPoints()`, cull, clip and emit a batch.
+//
+// The model is a closed sphere mesh seen by the game camera, so about half of
+// the triangles are back-facing, like a real model. It is timed alone (all in
+// cache) and as 64 copies (a few MB of DrawVertexes, more than the host caches
+// keep close). Also checks that both formats emit the same triangles, with
+// positions within a fraction of a pixel.
+//
+// The DMA tags and GIF packet setup around the loop are left out. Runs on
+// the development machine:
+//
+//   g++ -std=gnu++98 -O2 -I../../framework vertex_bench.cpp -o vertex_bench
+//   ./vertex_bench
+//
+// Builds with the SSE2 backend on x86-64. Add -DPS2MATH_BACKEND=0 for the
+// plain C++ backend. Exits with a non-zero status if any check fails.
+//
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+
+// ========================================================
+// Minimal stand-ins for `framework/common.hpp`:
+// ========================================================
+
+// `common.hpp` needs the PS2SDK headers, so define the few things
+// `xform_batch.cpp`, `draw_vertex.hpp` and `vertex_xform.h` use and
+// skip the real header.
+#define COMMON_HPP
+
+#define nullptr NULL
+#define restrict __restrict
+#define rcast reinterpret_cast
+#define scast static_cast
+#define ATTRIBUTE_ALIGNED(alignment) __attribute__((aligned(alignment)))
+#define CT_ASSERT_SIZE(type, size) typedef int ct_assert_ ## type ## _size[(sizeof(type) == (size)) ? 1 : -1]
+
+typedef unsigned char  ubyte;
+typedef unsigned char  uint8;
+typedef short          int16;
+typedef unsigned short uint16;
+typedef unsigned int   uint;
+typedef unsigned int   uint32;
+typedef unsigned long long uint64;
+
+static int assertsFailed = 0;
+#define ps2assert(cond) if (!(cond)) { std::printf("  assert failed: %s\n", #cond); ++assertsFailed; }
+
+template<class T>
+inline T clamp(const T x, const T minimum, const T maximum)
+{
+	return (x < minimum) ? minimum : (x > maximum) ? maximum : x;
+}
+
+struct Color4f
+{
+	float r, g, b, a;
+};
+
+// The GS register layouts of the PS2SDK `draw_types.h`.
+typedef unsigned short u16;
+typedef unsigned int   u32;
+typedef unsigned long long u64;
+
+typedef union { u64 rgbaq; struct { ubyte r, g, b, a; float q; }; } __attribute__((packed, aligned(8))) color_t;
+typedef union { u64 uv;    struct { float u, v; }; } __attribute__((packed, aligned(8))) texel_t;
+typedef union { u64 xyz;   struct { u16 x, y; u32 z; }; } __attribute__((packed, aligned(8))) xyz_t;
+typedef union { u64 dw[2]; u32 sw[4]; } __attribute__((aligned(16))) qword_t;
+
+#include "ps2_math/math_funcs.cpp"
+#include "ps2_math/xform_batch.cpp"
+
+// `PackedVertexFormat::TEXCOORD_SCALE` lives in `renderer.cpp`.
+#include "draw_vertex.hpp"
+const float PackedVertexFormat::TEXCOORD_SCALE = 4096.0f;
+
+#include "vertex_xform.h"
+
+// ========================================================
+// The two draw loops of `Renderer::drawUnindexedTriangles()`:
+// ========================================================
+
+// Positions of one batch; the renderer takes them from the Scratch Pad.
+static PS2MATH_ALIGNED(16) Vector qPositions[XFORM_BATCH_VERTS];
+static PS2MATH_ALIGNED(16) Vector tPositions[XFORM_BATCH_VERTS];
+
+// Returns the triangles emitted.
+static uint drawUnindexed(uint64 * restrict packetPtr, const DrawVertex * restrict verts, const uint vertCount,
+                          const Matrix & screenMvp, const Vector & eyePosModelSpace)
+{
+	uint trisSentToGs = 0;
+	for (uint first = 0; first < vertCount; first += XFORM_BATCH_VERTS)
+	{
+		trisSentToGs += drawTriangleBatch(packetPtr, verts + first, xformBatchSize(first, vertCount),
+		                                  screenMvp, eyePosModelSpace, tPositions);
+	}
+	return trisSentToGs;
+}
+
+static uint drawUnindexedPacked(uint64 * restrict packetPtr, const PackedDrawVertex * restrict verts, const uint vertCount,
+                                const PackedVertexFormat & fmt, const Matrix & screenMvp, const Vector & eyePosModelSpace)
+{
+	Matrix packedMvp;
+	Vector eyePosPacked;
+	makePackedMvpMatrix(packedMvp, fmt, screenMvp);
+	makePackedEyePosition(eyePosPacked, fmt, eyePosModelSpace);
+
+	uint trisSentToGs = 0;
+	for (uint first = 0; first < vertCount; first += XFORM_BATCH_VERTS)
+	{
+		trisSentToGs += drawPackedTriangleBatch(packetPtr, verts + first, xformBatchSize(first, vertCount),
+		                                        packedMvp, eyePosPacked, qPositions, tPositions);
+	}
+	return trisSentToGs;
+}
+
+// ========================================================
+// Test helpers:
+// ========================================================
+
+static int checksFailed = 0;
+
+#define CHECK(cond) \
+	do { \
+		if (!(cond)) { std::printf("  %s(%d): check failed: %s\n", __FILE__, __LINE__, #cond); ++checksFailed; } \
+	} while (0)
+
+// Small deterministic generator, so that runs are comparable.
+static uint32 randState = 12345;
+static float randFloat(const float lo, const float hi)
+{
+	randState = randState * 1664525 + 1013904223;
+	return lo + (hi - lo) * ((randState >> 8) * (1.0f / 16777216.0f));
+}
+
+static double nowSeconds()
+{
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Keeps the optimizer from dropping the work.
+static volatile uint sink;
+
+// ========================================================
+// Test model:
+// ========================================================
+
+// 16x16 sphere, about the 500 triangles of the game's MD2 models.
+static const uint STACKS = 16;
+static const uint SLICES = 16;
+static const uint MAX_VERTS = (STACKS - 1) * SLICES * 6;
+static const uint MAX_COPIES = 64;
+
+// Source vertexes of one frame, as the assembly loop computes them.
+static PS2MATH_ALIGNED(16) Vector srcPositions[MAX_VERTS];
+static PS2MATH_ALIGNED(16) Vector srcTexCoords[MAX_VERTS];
+static PS2MATH_ALIGNED(16) Vector srcColors[MAX_VERTS];
+static uint modelVertCount = 0;
+
+// Assembled vertexes of every copy, and a GIF packet big enough for all.
+static DrawVertex       drawVerts[MAX_COPIES][MAX_VERTS];
+static PackedDrawVertex packedVerts[MAX_COPIES][MAX_VERTS];
+static uint64           packet[MAX_VERTS * 3];
+static uint64           packetPacked[MAX_VERTS * 3];
+
+static Vector spherePoint(const uint stack, const uint slice, const float radius)
+{
+	const float theta = 3.14159265f * stack / STACKS;
+	const float phi   = 2.0f * 3.14159265f * slice / SLICES;
+	return Vector(radius * std::sin(theta) * std::cos(phi), radius * std::cos(theta),
+	              radius * std::sin(theta) * std::sin(phi), 1.0f);
+}
+
+static void addVertex(const Vector & pos, const uint stack, const uint slice)
+{
+	srcPositions[modelVertCount] = pos;
+	srcTexCoords[modelVertCount] = Vector(scast<float>(slice) / SLICES, scast<float>(stack) / STACKS, 0.0f, 1.0f);
+	srcColors[modelVertCount]    = Vector(randFloat(0.2f, 1.5f), randFloat(0.2f, 1.5f), randFloat(0.2f, 1.5f), 255.0f);
+	++modelVertCount;
+}
+
+static void buildModel(Aabb & bounds)
+{
+	// Two triangles per quad, minus the degenerate ones at the poles.
+	const float radius = 24.0f;
+	for (uint st = 0; st < STACKS; ++st)
+	{
+		for (uint sl = 0; sl < SLICES; ++sl)
+		{
+			const Vector p00 = spherePoint(st,     sl,     radius);
+			const Vector p01 = spherePoint(st,     sl + 1, radius);
+			const Vector p10 = spherePoint(st + 1, sl,     radius);
+			const Vector p11 = spherePoint(st + 1, sl + 1, radius);
+			if (st != 0)
+			{
+				addVertex(p00, st, sl); addVertex(p01, st, sl + 1); addVertex(p11, st + 1, sl + 1);
+			}
+			if (st != STACKS - 1)
+			{
+				addVertex(p00, st, sl); addVertex(p11, st + 1, sl + 1); addVertex(p10, st + 1, sl);
+			}
+		}
+	}
+
+	bounds.clear();
+	for (uint v = 0; v < modelVertCount; ++v)
+	{
+		bounds.mins = min3PerElement(srcPositions[v], bounds.mins);
+		bounds.maxs = max3PerElement(srcPositions[v], bounds.maxs);
+	}
+}
+
+static void assembleUnpacked(DrawVertex * restrict out)
+{
+	for (uint v = 0; v < modelVertCount; ++v)
+	{
+		packDrawVertex(out[v], srcPositions[v], srcTexCoords[v], srcColors[v]);
+	}
+}
+
+static void assemblePacked(PackedDrawVertex * restrict out, const PackedVertexFormat & fmt)
+{
+	for (uint v = 0; v < modelVertCount; ++v)
+	{
+		packDrawVertex(out[v], srcPositions[v], srcTexCoords[v], srcColors[v], fmt);
+	}
+}
+
+// ========================================================
+// Tests:
+// ========================================================
+
+static void testSameOutput(const PackedVertexFormat & fmt, const Matrix & screenMvp, const Vector & eye)
+{
+	std::printf("Packed vertexes against DrawVertex...\n");
+
+	assembleUnpacked(drawVerts[0]);
+	assemblePacked(packedVerts[0], fmt);
+	const uint tris       = drawUnindexed(packet, drawVerts[0], modelVertCount, screenMvp, eye);
+	const uint trisPacked = drawUnindexedPacked(packetPacked, packedVerts[0], modelVertCount, fmt, screenMvp, eye);
+	std::printf("  %u of %u triangles emitted, %u packed\n", tris, modelVertCount / 3, trisPacked);
+	CHECK(tris == trisPacked);
+	CHECK(tris > modelVertCount / 12 && tris < modelVertCount / 6); // A bit less than half the sphere is visible.
+
+	// Positions are 12.4 fixed-point; RGBA must be exact (Q comes from the
+	// slightly different positions), UVs within the 4.12 quantization.
+	int maxPosError = 0;
+	uint colorMismatches = 0;
+	double maxUvError = 0.0;
+	const uint words = ((tris < trisPacked) ? tris : trisPacked) * 9;
+	for (uint w = 0; w < words; w += 3)
+	{
+		colorMismatches += ((packet[w] & 0xFFFFFFFF) != (packetPacked[w] & 0xFFFFFFFF)) ? 1 : 0;
+
+		float uv[2], uvPacked[2];
+		std::memcpy(uv, &packet[w + 1], sizeof(uv));
+		std::memcpy(uvPacked, &packetPacked[w + 1], sizeof(uvPacked));
+		float q;
+		std::memcpy(&q, rcast<const char *>(&packet[w]) + 4, sizeof(q));
+		for (int i = 0; i < 2; ++i)
+		{
+			const double err = std::fabs(uv[i] - uvPacked[i]) / q;
+			maxUvError = (err > maxUvError) ? err : maxUvError;
+		}
+
+		for (int shift = 0; shift < 32; shift += 16)
+		{
+			const int a = scast<int>((packet[w + 2] >> shift) & 0xFFFF);
+			const int b = scast<int>((packetPacked[w + 2] >> shift) & 0xFFFF);
+			maxPosError = (std::abs(a - b) > maxPosError) ? std::abs(a - b) : maxPosError;
+		}
+	}
+
+	std::printf("  max XY error %d/16 pixel, %u color mismatches, max UV error %.6f\n", maxPosError, colorMismatches, maxUvError);
+	CHECK(maxPosError <= 4);
+	CHECK(colorMismatches == 0);
+	CHECK(maxUvError <= 1.0 / PackedVertexFormat::TEXCOORD_SCALE);
+}
+
+// ========================================================
+// Benchmarks:
+// ========================================================
+
+static const int TRIALS = 5;
+
+// Nanoseconds per vertex of the body run `reps` times, best of TRIALS.
+#define TIME_NS_PER_VERT(result, reps, verts, ...) \
+	do { \
+		(result) = 1e30; \
+		for (int trial = 0; trial < TRIALS; ++trial) \
+		{ \
+			const double start = nowSeconds(); \
+			for (uint rep = 0; rep < (reps); ++rep) { __VA_ARGS__; } \
+			const double ns = (nowSeconds() - start) * 1e9 / (double(reps) * (verts)); \
+			if (ns < (result)) { (result) = ns; } \
+		} \
+	} while (0)
+
+static void bench(const uint copies, const PackedVertexFormat & fmt, const Matrix & screenMvp, const Vector & eye)
+{
+	const uint verts = copies * modelVertCount;
+	const uint reps  = 2000000 / verts + 1;
+	double assembleNs, assemblePackedNs, drawNs, drawPackedNs;
+
+	TIME_NS_PER_VERT(assembleNs, reps, verts,
+		for (uint c = 0; c < copies; ++c) { assembleUnpacked(drawVerts[c]); });
+	TIME_NS_PER_VERT(assemblePackedNs, reps, verts,
+		for (uint c = 0; c < copies; ++c) { assemblePacked(packedVerts[c], fmt); });
+	TIME_NS_PER_VERT(drawNs, reps, verts,
+		for (uint c = 0; c < copies; ++c) { sink = drawUnindexed(packet, drawVerts[c], modelVertCount, screenMvp, eye); });
+	TIME_NS_PER_VERT(drawPackedNs, reps, verts,
+		for (uint c = 0; c < copies; ++c) { sink = drawUnindexedPacked(packetPacked, packedVerts[c], modelVertCount, fmt, screenMvp, eye); });
+
+	std::printf("%2u model(s), %4u KB / %4u KB | %8.2f %8.2f | %8.2f %8.2f | %8.2f %8.2f | %5.2fx\n",
+	            copies, scast<uint>(verts * sizeof(DrawVertex) / 1024), scast<uint>(verts * sizeof(PackedDrawVertex) / 1024),
+	            assembleNs, assemblePackedNs, drawNs, drawPackedNs, assembleNs + drawNs, assemblePackedNs + drawPackedNs,
+	            (assembleNs + drawNs) / (assemblePackedNs + drawPackedNs));
+}
+
+// ========================================================
+
+int main()
+{
+	Aabb bounds;
+	buildModel(bounds);
+
+	PackedVertexFormat fmt;
+	fmt.fromBounds(bounds);
+
+	// The game camera and projection (`GameWorld`), model at the origin.
+	const Vector eye(0.0f, 40.0f, 70.0f, 1.0f);
+	Matrix view, projection, screenMvp;
+	view.makeLookAt(eye, Vector(0.0f, 0.0f, 0.0f, 1.0f), Vector(0.0f, 1.0f, 0.0f, 0.0f));
+	projection.makePerspectiveProjection(60.0f * 3.14159265f / 180.0f, 640.0f / 448.0f, 640.0f, 448.0f, 2.0f, 2000.0f);
+	makeScreenMvpMatrix(screenMvp, view * projection);
+
+	testSameOutput(fmt, screenMvp, eye);
+
+	std::printf("\nNanoseconds per vertex, best of %d (%s backend), DrawVertex / packed:\n\n", TRIALS,
+	            PS2MATH_USE_VU0 ? "VU0" : (PS2MATH_USE_SSE2 ? "SSE2" : "scalar"));
+	std::printf("%-30s | %17s | %17s | %17s | %6s\n", "", "assembly", "draw", "total", "speedup");
+
+	bench(1, fmt, screenMvp, eye);
+	bench(MAX_COPIES, fmt, screenMvp, eye);
+
+	CHECK(assertsFailed == 0);
+	if (checksFailed != 0)
+	{
+		std::printf("\n%d check(s) FAILED.\n", checksFailed);
+		return EXIT_FAILURE;
+	}
+
+	std::printf("\nAll checks passed.\n");
+	return EXIT_SUCCESS;
+}